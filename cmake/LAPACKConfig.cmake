@@ -70,6 +70,59 @@ else()
     message( "${red}   XBLAS not found.${plain}" )
 endif()
 
+#-------------------------------------------------------------------------------
+# Check for MKL or OpenBLAS, for setting the number of threads (ThreadScope).
+message( STATUS "Checking for MKL" )
+
+try_run(
+    run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+    SOURCES
+        "${CMAKE_CURRENT_SOURCE_DIR}/config/mkl_version.cc"
+    LINK_LIBRARIES
+        ${LAPACK_LIBRARIES} ${blaspp_libraries}
+    COMPILE_DEFINITIONS
+        ${blaspp_defines}
+    COMPILE_OUTPUT_VARIABLE
+        compile_output
+    RUN_OUTPUT_VARIABLE
+        run_output
+)
+debug_try_run( "mkl_version.cc" "${compile_result}" "${compile_output}"
+                                "${run_result}" "${run_output}" )
+
+if (compile_result AND "${run_output}" MATCHES "MKL_VERSION=([0-9.]+)")
+    message( "${blue}   Found MKL ${CMAKE_MATCH_1}${plain}" )
+    list( APPEND lapackpp_defs_ "-DLAPACK_HAVE_MKL" )
+else()
+    message( "${red}   MKL not found.${plain}" )
+
+    message( STATUS "Checking for OpenBLAS" )
+
+    try_run(
+        run_result compile_result ${CMAKE_CURRENT_BINARY_DIR}
+        SOURCES
+            "${CMAKE_CURRENT_SOURCE_DIR}/config/openblas_version.cc"
+        LINK_LIBRARIES
+            ${LAPACK_LIBRARIES} ${blaspp_libraries}
+        COMPILE_DEFINITIONS
+            ${blaspp_defines}
+        COMPILE_OUTPUT_VARIABLE
+            compile_output
+        RUN_OUTPUT_VARIABLE
+            run_output
+    )
+    debug_try_run( "openblas_version.cc" "${compile_result}" "${compile_output}"
+                                         "${run_result}" "${run_output}" )
+
+    if (compile_result
+        AND "${run_output}" MATCHES "OPENBLAS_VERSION=[^0-9]*([0-9.]+)")
+        message( "${blue}   Found OpenBLAS ${CMAKE_MATCH_1}${plain}" )
+        list( APPEND lapackpp_defs_ "-DLAPACK_HAVE_OPENBLAS" )
+    else()
+        message( "${red}   OpenBLAS not found.${plain}" )
+    endif()
+endif()
+
 #-------------------------------------------------------------------------------
 # Find LAPACKE, either in the BLAS/LAPACK library or in -llapacke.
 # Check for pstrf (Cholesky with pivoting).
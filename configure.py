@@ -92,6 +92,10 @@ def main():
 
     config.gpu_blas()
 
+    # Optional override of ILAENV block sizes; see include/lapack/ilaenv.hh.
+    if (config.environ['ilaenv_override'] in ('1', 'yes', 'true')):
+        config.environ.append( 'CXXFLAGS', config.define('ILAENV_OVERRIDE') )
+
     blaspp = config.get_package(
         'BLAS++',
         ['../blaspp', './blaspp'],
@@ -20,5 +20,13 @@ const char* lapackpp_id();
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#include "lapack/batch.hh"
+#include "lapack/fixed.hh"
+#include "lapack/thread_scope.hh"
+#include "lapack/backend.hh"
+#include "lapack/ilaenv.hh"
+#include "lapack/factor.hh"
+#include "lapack/layout.hh"
+#include "lapack/simd.hh"
 
 #endif // LAPACK_HH
@@ -0,0 +1,78 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BACKEND_HH
+#define LAPACK_BACKEND_HH
+
+#include "lapack/util.hh"
+
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// @defgroup backend Runtime LAPACK backends
+///
+/// By default, LAPACK++ calls the LAPACK library it was linked with,
+/// named "linked". Additional LAPACK libraries (backends) can be loaded at
+/// runtime with dlopen, and routines bound to them individually, e.g.,
+/// to use MKL for gesdd but OpenBLAS for small getrf.
+///
+/// A routine is bound by its name with precision (e.g., "dgesdd"), or else
+/// its name without precision (e.g., "gesdd"), or else "default".
+/// Backends must use the same integer size (LP64 or ILP64) and Fortran
+/// name mangling as the linked library.
+///
+/// Currently the drivers and computational routines for LU (gesv, getrf,
+/// getrs), Cholesky (posv, potrf, potrs), QR and least squares (geqrf,
+/// gels), SVD (gesvd, gesdd), and symmetric/Hermitian eigenvalues
+/// (syevd, heevd) are dispatched; other routines always use the linked
+/// library.
+///
+/// Backends can also be set up from the environment, read at the first call
+/// of a dispatched routine or backend function:
+///
+/// - LAPACKPP_BACKEND_CONFIG: file with lines
+///   `library <name> <path>` and `routine <routine> <name>`;
+///   `#` starts a comment.
+/// - LAPACKPP_BACKEND_LIBRARIES: `name=path;...`,
+///   e.g., `mkl=libmkl_rt.so;openblas=libopenblas.so.0`.
+/// - LAPACKPP_BACKEND_ROUTINES: `routine=name;...`,
+///   e.g., `default=openblas;gesdd=mkl`.
+///
+/// Settings are applied in that order, so the variables override the file.
+
+//------------------------------------------------------------------------------
+/// Loads LAPACK library path under the given name, replacing any library
+/// already loaded under that name.
+/// Throws Error if the library cannot be loaded.
+/// @ingroup backend
+void backend_load( std::string const& name, std::string const& path );
+
+/// Binds routine (e.g., "dgesdd", "gesdd", or "default") to the backend
+/// with the given name, which must be loaded or "linked". An empty name
+/// removes the binding.
+/// Throws Error if the backend is unknown.
+/// @ingroup backend
+void backend_set( std::string const& routine, std::string const& name );
+
+/// @return name of the backend that routine (e.g., "dgesdd") is bound to.
+/// @ingroup backend
+std::string backend_get( std::string const& routine );
+
+/// @return names of available backends, starting with "linked".
+/// @ingroup backend
+std::vector< std::string > backend_names();
+
+/// Reads backend libraries and routine bindings from the file filename,
+/// in the format of LAPACKPP_BACKEND_CONFIG.
+/// Throws Error if the file cannot be read or has a syntax error.
+/// @ingroup backend
+void backend_config( std::string const& filename );
+
+}  // namespace lapack
+
+#endif // LAPACK_BACKEND_HH
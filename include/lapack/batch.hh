@@ -0,0 +1,549 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_HH
+#define LAPACK_BATCH_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+namespace lapack {
+
+// Host batch routines. Problems in a batch are solved in parallel using
+// OpenMP, with the vendor BLAS set to one thread.
+//
+// In pointer-array versions, each argument vector has either
+// 1 entry, shared by all problems (fixed size), or
+// batch_size entries, one per problem (variable size).
+// In strided versions, problem i starts at A + i*strideA, etc.
+// In interleaved versions, the batch index is innermost: element (r, c)
+// of problem k is at A[ k + (r + c*lda)*batch_size ], which lets kernels
+// vectorize across the batch for tiny matrices.
+// info has batch_size entries, set to each problem's return value.
+
+// -----------------------------------------------------------------------------
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info );
+
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info );
+
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info );
+
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void getrs_batch_strided(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    size_t batch_size, int64_t* info );
+
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void potrs_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info );
+
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info );
+
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info );
+
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info );
+
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info );
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_HH
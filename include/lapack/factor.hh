@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FACTOR_HH
+#define LAPACK_FACTOR_HH
+
+#include "lapack/util.hh"
+#include "lapack/workspace.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+/// @defgroup factor Factorization objects
+///
+/// Factorization objects own a copy of the factors in aligned storage,
+/// factor once, then solve as often as needed, reusing the factors and
+/// workspace. solve takes any number of right-hand sides, and can be called
+/// again for each new batch of them as they arrive. Pivots are kept as
+/// `lapack_int`, so they are passed to LAPACK without conversion, and
+/// repeated solves do no memory allocation once sizes are seen. rcond
+/// calls the LAPACK condition estimators (gecon, pocon, hecon, trcon),
+/// which allocate their O(n) workspace on each call.
+///
+/// The input matrix is copied, not modified. If factoring fails (info > 0),
+/// info() reports it, and solve and inverse throw Error. For LU and LDLT,
+/// info > 0 means A is exactly singular, so rcond and det return 0;
+/// for Cholesky, A is not positive definite, so they throw Error.
+///
+/// Objects are not thread safe; use one per thread, or lock.
+///
+/// Example:
+///
+///     lapack::LU< double > lu( n, A, lda );
+///     if (lu.info() == 0) {
+///         double rcond = lu.rcond();
+///         lu.solve( nrhs, B, ldb );   // B = A^{-1} B
+///         lu.solve( nrhs, B2, ldb );  // no re-factoring
+///     }
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting, $PA = LU$, of an n-by-n matrix,
+/// using getrf.
+/// @ingroup factor
+template <typename scalar_t>
+class LU
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LU();
+    LU( int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Factors a new n-by-n matrix A, reusing storage.
+    /// @return info from getrf.
+    int64_t factor( int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Solves $op(A) X = B$; overwrites n-by-nrhs B with X.
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb,
+                lapack::Op trans = lapack::Op::NoTrans );
+
+    /// @return reciprocal condition number estimate, in the 1 or inf norm.
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    /// @return determinant. May overflow or underflow for large n.
+    scalar_t det() const;
+
+    /// Computes the n-by-n inverse in Ainv, using getri on a copy.
+    void inverse( scalar_t* Ainv, int64_t ldainv );
+
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factors L and U, as from getrf, with leading dimension ld().
+    scalar_t const* data() const { return (scalar_t const*) storage_.data(); }
+    int64_t ld() const { return blas::max( 1, n_ ); }
+
+    /// @return 1-based pivots, as from getrf.
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_one_;
+    real_t anorm_inf_;
+    std::vector< lapack_int > ipiv_;
+    Workspace ipiv64_;  // for routines without lapack_int pivot versions
+    Workspace storage_;
+    Workspace ws_;
+};
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization, $A = LL^H$ or $A = U^H U$, of an n-by-n
+/// Hermitian positive definite matrix, using potrf.
+/// Only the uplo triangle of A is read.
+/// @ingroup factor
+template <typename scalar_t>
+class Cholesky
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    Cholesky();
+    Cholesky( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Factors a new n-by-n matrix A, reusing storage.
+    /// @return info from potrf.
+    int64_t factor( lapack::Uplo uplo, int64_t n,
+                    scalar_t const* A, int64_t lda );
+
+    /// Solves $A X = B$; overwrites n-by-nrhs B with X.
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return reciprocal condition number estimate, in the 1 norm.
+    real_t rcond();
+
+    /// @return determinant, which is real and positive.
+    /// May overflow or underflow for large n.
+    real_t det() const;
+
+    /// Computes the full n-by-n inverse in Ainv, using potri on a copy.
+    void inverse( scalar_t* Ainv, int64_t ldainv );
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factor in the uplo triangle, with leading dimension ld().
+    scalar_t const* data() const { return (scalar_t const*) storage_.data(); }
+    int64_t ld() const { return blas::max( 1, n_ ); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    Workspace storage_;
+};
+
+//------------------------------------------------------------------------------
+/// Symmetric indefinite factorization with Bunch-Kaufman pivoting,
+/// $A = LDL^H$ or $A = UDU^H$, of an n-by-n Hermitian matrix
+/// ($LDL^T$ for real), using hetrf (sytrf for real).
+/// Only the uplo triangle of A is read.
+/// @ingroup factor
+template <typename scalar_t>
+class LDLT
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LDLT();
+    LDLT( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Factors a new n-by-n matrix A, reusing storage.
+    /// @return info from hetrf.
+    int64_t factor( lapack::Uplo uplo, int64_t n,
+                    scalar_t const* A, int64_t lda );
+
+    /// Solves $A X = B$; overwrites n-by-nrhs B with X.
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return reciprocal condition number estimate, in the 1 norm.
+    real_t rcond();
+
+    /// @return determinant, which is real. From the 1-by-1 and 2-by-2
+    /// blocks of D, since det( L ) = 1. May overflow or underflow.
+    real_t det() const;
+
+    /// Computes the full n-by-n inverse in Ainv, using hetri2 on a copy.
+    void inverse( scalar_t* Ainv, int64_t ldainv );
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factors as from hetrf, with leading dimension ld().
+    scalar_t const* data() const { return (scalar_t const*) storage_.data(); }
+    int64_t ld() const { return blas::max( 1, n_ ); }
+
+    /// @return pivots, as from hetrf.
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    std::vector< lapack_int > ipiv_;
+    Workspace ipiv64_;  // for routines without lapack_int pivot versions
+    Workspace storage_;
+    Workspace ws_;
+};
+
+//------------------------------------------------------------------------------
+/// QR factorization, $A = QR$, of an m-by-n matrix with m >= n,
+/// using geqrf. Solves full-rank least squares problems.
+/// @ingroup factor
+template <typename scalar_t>
+class QR
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    QR();
+    QR( int64_t m, int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Factors a new m-by-n matrix A, m >= n, reusing storage.
+    /// @return info from geqrf (always 0).
+    int64_t factor( int64_t m, int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Solves the least squares problem $\min_X || A X - B ||_F$.
+    /// On entry, B is m-by-nrhs; on exit, its first n rows are X.
+    /// Right-hand sides are applied in blocks of columns, so the
+    /// workspace is bounded regardless of nrhs.
+    /// Throws Error if R is exactly singular.
+    void solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return reciprocal condition number estimate of R, in the 1 or
+    /// inf norm.
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    /// @return determinant, $\det( Q ) \prod R_{ii}$; requires m == n.
+    /// May overflow or underflow for large n.
+    scalar_t det() const;
+
+    /// Computes the n-by-m pseudo-inverse $A^+ = R^{-1} Q^H$ in Ainv,
+    /// which is the inverse if m == n.
+    void inverse( scalar_t* Ainv, int64_t ldainv );
+
+    int64_t m()    const { return m_; }
+    int64_t n()    const { return n_; }
+    int64_t info() const { return info_; }
+
+    /// @return factors as from geqrf, with leading dimension ld().
+    scalar_t const* data() const { return (scalar_t const*) storage_.data(); }
+    int64_t ld() const { return blas::max( 1, m_ ); }
+
+    /// @return Householder scalars tau, as from geqrf.
+    scalar_t const* tau() const { return tau_.data(); }
+
+private:
+    int64_t m_;
+    int64_t n_;
+    int64_t info_;
+    std::vector< scalar_t > tau_;
+    Workspace storage_;
+    Workspace ws_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_FACTOR_HH
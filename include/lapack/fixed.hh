@@ -0,0 +1,627 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FIXED_HH
+#define LAPACK_FIXED_HH
+
+#include "lapack/util.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+//==============================================================================
+/// Header-only routines for tiny matrices whose size N is known at compile
+/// time, 1 <= N <= 8, such as 2x2 to 8x8 systems in geometry codes.
+///
+/// The matrix is copied into a local N-by-N array, factored, and copied
+/// back. All loop bounds are compile-time constants, so the compiler fully
+/// unrolls the loops and keeps the local arrays in registers. Row swaps
+/// use compile-time indices with a runtime test, rather than indexing
+/// by the runtime pivot, for the same reason. There is no call into
+/// LAPACK, no workspace, and no argument checking; lda and ldb must be
+/// valid, as in the corresponding LAPACK routines.
+///
+/// Results are interchangeable with `lapack::getrf`, etc.: the same
+/// pivot rule (first entry of largest $|re| + |im|$), the same 1-based
+/// ipiv, and the same info on singular or indefinite matrices.
+/// Values may differ by rounding from vendor LAPACKs that order
+/// operations differently.
+///
+/// Example:
+///
+///     double A[ 3*3 ], B[ 3 ];
+///     int64_t ipiv[ 3 ];
+///     int64_t info = lapack::fixed::gesv< 3, 1 >( A, 3, ipiv, B, 3 );
+///
+namespace fixed {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Pivot magnitude used by LAPACK's i_amax: $|x|$ for real,
+/// $|re(x)| + |im(x)|$ for complex.
+template <typename real_t>
+inline real_t abs1( real_t x )
+{
+    return std::abs( x );
+}
+
+template <typename real_t>
+inline real_t abs1( std::complex< real_t > x )
+{
+    return std::abs( real( x ) ) + std::abs( imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// Copies N-by-M matrix A into local array a, with a[ j ][ i ] = A(i, j).
+template <int64_t N, int64_t M, typename scalar_t>
+inline void load( scalar_t const* A, int64_t lda, scalar_t a[ M ][ N ] )
+{
+    for (int64_t j = 0; j < M; ++j)
+        for (int64_t i = 0; i < N; ++i)
+            a[ j ][ i ] = A[ i + j*lda ];
+}
+
+/// Copies local array a back to N-by-M matrix A.
+template <int64_t N, int64_t M, typename scalar_t>
+inline void store( scalar_t const a[ M ][ N ], scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < M; ++j)
+        for (int64_t i = 0; i < N; ++i)
+            A[ i + j*lda ] = a[ j ][ i ];
+}
+
+//------------------------------------------------------------------------------
+/// Swaps rows k and p of local N-by-M array a, for runtime p >= k.
+/// Loops over compile-time row indices so a stays in registers.
+template <int64_t N, int64_t M, typename scalar_t>
+inline void swap_rows( scalar_t a[ M ][ N ], int64_t k, int64_t p )
+{
+    for (int64_t i = k+1; i < N; ++i) {
+        if (i == p) {
+            for (int64_t j = 0; j < M; ++j) {
+                scalar_t tmp = a[ j ][ k ];
+                a[ j ][ k ] = a[ j ][ i ];
+                a[ j ][ i ] = tmp;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting of local array a,
+/// in the style of LAPACK's getf2. ipiv is 0-based.
+template <int64_t N, typename scalar_t>
+inline int64_t getrf( scalar_t a[ N ][ N ], int64_t ipiv[ N ] )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+
+    int64_t info = 0;
+    for (int64_t k = 0; k < N; ++k) {
+        // find pivot: first entry of largest abs1
+        int64_t p = k;
+        real_t amax = abs1( a[ k ][ k ] );
+        for (int64_t i = k+1; i < N; ++i) {
+            real_t v = abs1( a[ k ][ i ] );
+            if (v > amax) {
+                amax = v;
+                p = i;
+            }
+        }
+        ipiv[ k ] = p;
+
+        if (amax != 0) {
+            swap_rows< N, N >( a, k, p );
+
+            // compute multipliers, as getf2 does
+            scalar_t akk = a[ k ][ k ];
+            if (std::abs( akk ) >= sfmin) {
+                scalar_t r = scalar_t( 1 ) / akk;
+                for (int64_t i = k+1; i < N; ++i)
+                    a[ k ][ i ] *= r;
+            }
+            else {
+                for (int64_t i = k+1; i < N; ++i)
+                    a[ k ][ i ] /= akk;
+            }
+        }
+        else if (info == 0) {
+            info = k + 1;
+        }
+
+        // rank-1 update of trailing matrix
+        for (int64_t j = k+1; j < N; ++j)
+            for (int64_t i = k+1; i < N; ++i)
+                a[ j ][ i ] -= a[ k ][ i ] * a[ j ][ k ];
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves op(A) X = B using the LU factors in local array a,
+/// with 0-based pivots, overwriting local array b with X.
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline void getrs(
+    lapack::Op trans, scalar_t const a[ N ][ N ], int64_t const ipiv[ N ],
+    scalar_t b[ NRHS ][ N ] )
+{
+    using blas::conj;
+
+    if (trans == lapack::Op::NoTrans) {
+        // apply row interchanges
+        for (int64_t k = 0; k < N; ++k)
+            swap_rows< N, NRHS >( b, k, ipiv[ k ] );
+
+        for (int64_t c = 0; c < NRHS; ++c) {
+            // solve L Y = B, unit diagonal
+            for (int64_t k = 0; k < N; ++k)
+                for (int64_t i = k+1; i < N; ++i)
+                    b[ c ][ i ] -= a[ k ][ i ] * b[ c ][ k ];
+            // solve U X = Y
+            for (int64_t k = N-1; k >= 0; --k) {
+                b[ c ][ k ] /= a[ k ][ k ];
+                for (int64_t i = 0; i < k; ++i)
+                    b[ c ][ i ] -= a[ k ][ i ] * b[ c ][ k ];
+            }
+        }
+    }
+    else {
+        bool cj = (trans == lapack::Op::ConjTrans);
+        auto op = [cj]( scalar_t x ) { return cj ? conj( x ) : x; };
+
+        for (int64_t c = 0; c < NRHS; ++c) {
+            // solve op(U) Y = B
+            for (int64_t k = 0; k < N; ++k) {
+                scalar_t sum = b[ c ][ k ];
+                for (int64_t i = 0; i < k; ++i)
+                    sum -= op( a[ k ][ i ] ) * b[ c ][ i ];
+                b[ c ][ k ] = sum / op( a[ k ][ k ] );
+            }
+            // solve op(L) X = Y, unit diagonal
+            for (int64_t k = N-1; k >= 0; --k) {
+                scalar_t sum = b[ c ][ k ];
+                for (int64_t i = k+1; i < N; ++i)
+                    sum -= op( a[ k ][ i ] ) * b[ c ][ i ];
+                b[ c ][ k ] = sum;
+            }
+        }
+
+        // apply row interchanges in reverse order
+        for (int64_t k = N-1; k >= 0; --k)
+            swap_rows< N, NRHS >( b, k, ipiv[ k ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization of local array a, in the style of LAPACK's potf2.
+/// Only the uplo triangle is referenced.
+template <int64_t N, typename scalar_t>
+inline int64_t potrf( lapack::Uplo uplo, scalar_t a[ N ][ N ] )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    for (int64_t j = 0; j < N; ++j) {
+        if (uplo == lapack::Uplo::Lower) {
+            // L(j, j) = sqrt( A(j, j) - L(j, 0:j) L(j, 0:j)^H )
+            real_t ajj = real( a[ j ][ j ] );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( a[ k ][ j ] * conj( a[ k ][ j ] ) );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                a[ j ][ j ] = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            a[ j ][ j ] = ajj;
+
+            // L(j+1:N, j) = (A(j+1:N, j) - L(j+1:N, 0:j) L(j, 0:j)^H) / L(j, j)
+            for (int64_t i = j+1; i < N; ++i) {
+                scalar_t sum = a[ j ][ i ];
+                for (int64_t k = 0; k < j; ++k)
+                    sum -= a[ k ][ i ] * conj( a[ k ][ j ] );
+                a[ j ][ i ] = sum / ajj;
+            }
+        }
+        else {
+            // U(j, j) = sqrt( A(j, j) - U(0:j, j)^H U(0:j, j) )
+            real_t ajj = real( a[ j ][ j ] );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= real( conj( a[ j ][ k ] ) * a[ j ][ k ] );
+            if (ajj <= 0 || std::isnan( ajj )) {
+                a[ j ][ j ] = ajj;
+                return j + 1;
+            }
+            ajj = std::sqrt( ajj );
+            a[ j ][ j ] = ajj;
+
+            // U(j, j+1:N) = (A(j, j+1:N) - U(0:j, j)^H U(0:j, j+1:N)) / U(j, j)
+            for (int64_t i = j+1; i < N; ++i) {
+                scalar_t sum = a[ i ][ j ];
+                for (int64_t k = 0; k < j; ++k)
+                    sum -= conj( a[ j ][ k ] ) * a[ i ][ k ];
+                a[ i ][ j ] = sum / ajj;
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B using the Cholesky factor in local array a,
+/// overwriting local array b with X.
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline void potrs(
+    lapack::Uplo uplo, scalar_t const a[ N ][ N ], scalar_t b[ NRHS ][ N ] )
+{
+    using blas::conj;
+
+    for (int64_t c = 0; c < NRHS; ++c) {
+        if (uplo == lapack::Uplo::Lower) {
+            // solve L Y = B
+            for (int64_t k = 0; k < N; ++k) {
+                b[ c ][ k ] /= a[ k ][ k ];
+                for (int64_t i = k+1; i < N; ++i)
+                    b[ c ][ i ] -= a[ k ][ i ] * b[ c ][ k ];
+            }
+            // solve L^H X = Y
+            for (int64_t k = N-1; k >= 0; --k) {
+                scalar_t sum = b[ c ][ k ];
+                for (int64_t i = k+1; i < N; ++i)
+                    sum -= conj( a[ k ][ i ] ) * b[ c ][ i ];
+                b[ c ][ k ] = sum / a[ k ][ k ];
+            }
+        }
+        else {
+            // solve U^H Y = B
+            for (int64_t k = 0; k < N; ++k) {
+                scalar_t sum = b[ c ][ k ];
+                for (int64_t i = 0; i < k; ++i)
+                    sum -= conj( a[ k ][ i ] ) * b[ c ][ i ];
+                b[ c ][ k ] = sum / a[ k ][ k ];
+            }
+            // solve U X = Y
+            for (int64_t k = N-1; k >= 0; --k) {
+                b[ c ][ k ] /= a[ k ][ k ];
+                for (int64_t i = 0; i < k; ++i)
+                    b[ c ][ i ] -= a[ k ][ i ] * b[ c ][ k ];
+            }
+        }
+    }
+}
+
+/// Copies the uplo triangle of N-by-N matrix A into local array a.
+/// The other triangle of A is not read, and that of a is not set;
+/// internal::potrf and potrs reference only the uplo triangle.
+template <int64_t N, typename scalar_t>
+inline void load_triangle(
+    lapack::Uplo uplo, scalar_t const* A, int64_t lda, scalar_t a[ N ][ N ] )
+{
+    for (int64_t j = 0; j < N; ++j) {
+        int64_t i0 = (uplo == lapack::Uplo::Lower ? j : 0);
+        int64_t i1 = (uplo == lapack::Uplo::Lower ? N : j + 1);
+        for (int64_t i = i0; i < i1; ++i)
+            a[ j ][ i ] = A[ i + j*lda ];
+    }
+}
+
+/// Copies the uplo triangle of local array a back to A,
+/// leaving the other triangle of A untouched.
+template <int64_t N, typename scalar_t>
+inline void store_triangle(
+    lapack::Uplo uplo, scalar_t const a[ N ][ N ], scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < N; ++j) {
+        int64_t i0 = (uplo == lapack::Uplo::Lower ? j : 0);
+        int64_t i1 = (uplo == lapack::Uplo::Lower ? N : j + 1);
+        for (int64_t i = i0; i < i1; ++i)
+            A[ i + j*lda ] = a[ j ][ i ];
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of an N-by-N matrix A using partial
+/// pivoting with row interchanges, as `lapack::getrf` does.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On exit, the factors L and U from $A = P L U$;
+///     the unit diagonal of L is not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[out] ipiv
+///     The pivot indices, 1-based as in `lapack::getrf`;
+///     row i was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The
+///     factorization has been completed, but U is singular.
+///
+/// @ingroup gesv_fixed
+template <int64_t N, typename scalar_t>
+inline int64_t getrf( scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+
+    scalar_t a[ N ][ N ];
+    int64_t piv[ N ];
+    internal::load< N, N >( A, lda, a );
+    int64_t info = internal::getrf< N >( a, piv );
+    internal::store< N, N >( a, A, lda );
+    for (int64_t k = 0; k < N; ++k)
+        ipiv[ k ] = piv[ k ] + 1;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $op(A) X = B$ with an N-by-N matrix A, using the LU
+/// factorization computed by `lapack::fixed::getrf` or `lapack::getrf`.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @tparam NRHS
+///     The number of right hand sides. 1 <= NRHS <= 8.
+///
+/// @param[in] trans
+///     The form of the system: NoTrans, Trans, or ConjTrans.
+///
+/// @param[in] A
+///     The factors L and U, stored in an lda-by-N array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[in] ipiv
+///     The 1-based pivot indices from getrf.
+///
+/// @param[in,out] B
+///     On entry, the N-by-NRHS right hand side matrix B,
+///     stored in an ldb-by-NRHS array.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= N.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup gesv_fixed
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline int64_t getrs(
+    lapack::Op trans, scalar_t const* A, int64_t lda, int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+    static_assert( 1 <= NRHS && NRHS <= 8, "lapack::fixed requires 1 <= NRHS <= 8" );
+
+    scalar_t a[ N ][ N ];
+    scalar_t b[ NRHS ][ N ];
+    int64_t piv[ N ];
+    internal::load< N, N >( A, lda, a );
+    internal::load< N, NRHS >( B, ldb, b );
+    for (int64_t k = 0; k < N; ++k)
+        piv[ k ] = ipiv[ k ] - 1;
+    internal::getrs< N, NRHS >( trans, a, piv, b );
+    internal::store< N, NRHS >( b, B, ldb );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to $A X = B$ with an N-by-N matrix A,
+/// as `lapack::gesv` does: factors A = P L U using
+/// `lapack::fixed::getrf`, then, if A is nonsingular, solves for X.
+/// A and B are loaded once and kept in registers throughout.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @tparam NRHS
+///     The number of right hand sides. 1 <= NRHS <= 8.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On exit, the factors L and U.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[out] ipiv
+///     The 1-based pivot indices.
+///
+/// @param[in,out] B
+///     On entry, the N-by-NRHS right hand side matrix B,
+///     stored in an ldb-by-NRHS array.
+///     On exit, if return value = 0, the solution matrix X;
+///     otherwise B is unchanged.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= N.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero,
+///     so the solution could not be computed.
+///
+/// @ingroup gesv_fixed
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline int64_t gesv(
+    scalar_t* A, int64_t lda, int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+    static_assert( 1 <= NRHS && NRHS <= 8, "lapack::fixed requires 1 <= NRHS <= 8" );
+
+    scalar_t a[ N ][ N ];
+    int64_t piv[ N ];
+    internal::load< N, N >( A, lda, a );
+    int64_t info = internal::getrf< N >( a, piv );
+    internal::store< N, N >( a, A, lda );
+    for (int64_t k = 0; k < N; ++k)
+        ipiv[ k ] = piv[ k ] + 1;
+
+    if (info == 0) {
+        scalar_t b[ NRHS ][ N ];
+        internal::load< N, NRHS >( B, ldb, b );
+        internal::getrs< N, NRHS >( lapack::Op::NoTrans, a, piv, b );
+        internal::store< N, NRHS >( b, B, ldb );
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of an N-by-N Hermitian positive
+/// definite matrix A, as `lapack::potrf` does.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The N-by-N Hermitian matrix A, stored in an lda-by-N array.
+///     Only the uplo triangle is accessed.
+///     On exit, if return value = 0, the factor U or L
+///     from $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+/// @ingroup posv_fixed
+template <int64_t N, typename scalar_t>
+inline int64_t potrf( lapack::Uplo uplo, scalar_t* A, int64_t lda )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+
+    scalar_t a[ N ][ N ];
+    internal::load_triangle< N >( uplo, A, lda, a );
+    int64_t info = internal::potrf< N >( uplo, a );
+    internal::store_triangle< N >( uplo, a, A, lda );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$ with an N-by-N Hermitian positive definite matrix A,
+/// using the Cholesky factorization computed by `lapack::fixed::potrf`
+/// or `lapack::potrf`.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @tparam NRHS
+///     The number of right hand sides. 1 <= NRHS <= 8.
+///
+/// @param[in] uplo
+///     Whether A holds the upper factor U or lower factor L.
+///
+/// @param[in] A
+///     The Cholesky factor, stored in an lda-by-N array.
+///     Only the uplo triangle is accessed.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[in,out] B
+///     On entry, the N-by-NRHS right hand side matrix B,
+///     stored in an ldb-by-NRHS array.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= N.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_fixed
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline int64_t potrs(
+    lapack::Uplo uplo, scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+    static_assert( 1 <= NRHS && NRHS <= 8, "lapack::fixed requires 1 <= NRHS <= 8" );
+
+    scalar_t a[ N ][ N ];
+    scalar_t b[ NRHS ][ N ];
+    internal::load_triangle< N >( uplo, A, lda, a );
+    internal::load< N, NRHS >( B, ldb, b );
+    internal::potrs< N, NRHS >( uplo, a, b );
+    internal::store< N, NRHS >( b, B, ldb );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to $A X = B$ with an N-by-N Hermitian positive
+/// definite matrix A, as `lapack::posv` does.
+///
+/// @tparam N
+///     The order of the matrix A. 1 <= N <= 8.
+///
+/// @tparam NRHS
+///     The number of right hand sides. 1 <= NRHS <= 8.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The N-by-N Hermitian matrix A, stored in an lda-by-N array.
+///     Only the uplo triangle is accessed.
+///     On exit, if return value = 0, the factor U or L.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= N.
+///
+/// @param[in,out] B
+///     On entry, the N-by-NRHS right hand side matrix B,
+///     stored in an ldb-by-NRHS array.
+///     On exit, if return value = 0, the solution matrix X;
+///     otherwise B is unchanged.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= N.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, so the solution could not be computed.
+///
+/// @ingroup posv_fixed
+template <int64_t N, int64_t NRHS, typename scalar_t>
+inline int64_t posv(
+    lapack::Uplo uplo, scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 1 <= N && N <= 8, "lapack::fixed requires 1 <= N <= 8" );
+    static_assert( 1 <= NRHS && NRHS <= 8, "lapack::fixed requires 1 <= NRHS <= 8" );
+
+    scalar_t a[ N ][ N ];
+    internal::load_triangle< N >( uplo, A, lda, a );
+    int64_t info = internal::potrf< N >( uplo, a );
+    internal::store_triangle< N >( uplo, a, A, lda );
+
+    if (info == 0) {
+        scalar_t b[ NRHS ][ N ];
+        internal::load< N, NRHS >( B, ldb, b );
+        internal::potrs< N, NRHS >( uplo, a, b );
+        internal::store< N, NRHS >( b, B, ldb );
+    }
+    return info;
+}
+
+}  // namespace fixed
+}  // namespace lapack
+
+#endif // LAPACK_FIXED_HH
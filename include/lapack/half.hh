@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_HALF_HH
+#define LAPACK_HALF_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+inline uint32_t float_to_bits( float x )
+{
+    uint32_t bits;
+    std::memcpy( &bits, &x, sizeof( bits ) );
+    return bits;
+}
+
+inline float bits_to_float( uint32_t bits )
+{
+    float x;
+    std::memcpy( &x, &bits, sizeof( x ) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// Rounds float to the nearest IEEE binary16 value, ties to even.
+/// Values beyond the binary16 range round to infinity; NaN stays NaN.
+/// Branch-free, so loops over it vectorize. Requires IEEE float
+/// arithmetic with subnormals, i.e., not -ffast-math or flush-to-zero.
+inline uint16_t float_to_half_bits( float x )
+{
+    const float scale_to_inf  = 5.192296858534828e+33f;  // 2^112
+    const float scale_to_zero = 7.703719777548943e-34f;  // 2^-110
+
+    // Scaling up then down rounds overflow to inf.
+    float base = (std::abs( x ) * scale_to_inf) * scale_to_zero;
+
+    uint32_t w = float_to_bits( x );
+    uint32_t shl1_w = w + w;
+    uint32_t sign = w & 0x80000000u;
+    uint32_t bias = std::max( shl1_w & 0xff000000u, 0x71000000u );
+
+    // Adding 2^(e + 13) shifts the mantissa so the float addition
+    // rounds it to 10 bits, including for half subnormals.
+    base = bits_to_float( (bias >> 1) + 0x07800000u ) + base;
+    uint32_t bits = float_to_bits( base );
+    uint32_t exp_bits = (bits >> 13) & 0x00007c00u;
+    uint32_t mantissa_bits = bits & 0x00000fffu;
+    uint32_t nonsign = exp_bits + mantissa_bits;
+
+    // Select NaN with a mask rather than ?:, which compilers may not
+    // if-convert, preventing vectorization.
+    uint32_t nan_mask = 0u - uint32_t( shl1_w > 0xff000000u );
+    return uint16_t( (sign >> 16)
+                     | (0x7e00u & nan_mask) | (nonsign & ~nan_mask) );
+}
+
+//------------------------------------------------------------------------------
+/// Converts IEEE binary16 to float, which is exact. Branch-free.
+inline float half_bits_to_float( uint16_t h )
+{
+    const float exp_scale = 1.925929944387236e-34f;  // 2^-112
+
+    uint32_t w = uint32_t( h ) << 16;
+    uint32_t sign = w & 0x80000000u;
+    uint32_t two_w = w + w;
+
+    // Normal, inf, NaN: move exponent and mantissa into place, then rescale.
+    uint32_t exp_offset = 0xe0u << 23;
+    float normalized = bits_to_float( (two_w >> 4) + exp_offset ) * exp_scale;
+
+    // Subnormal: put mantissa in a float with exponent 2^-1, subtract 0.5.
+    uint32_t magic_mask = 126u << 23;
+    float denormalized = bits_to_float( (two_w >> 17) | magic_mask ) - 0.5f;
+
+    uint32_t denormalized_cutoff = 1u << 27;
+    uint32_t denormal_mask = 0u - uint32_t( two_w < denormalized_cutoff );
+    uint32_t result = sign
+                    | (float_to_bits( denormalized ) & denormal_mask)
+                    | (float_to_bits( normalized ) & ~denormal_mask);
+    return bits_to_float( result );
+}
+
+//------------------------------------------------------------------------------
+/// Rounds float to the nearest bfloat16 value, ties to even.
+/// NaN stays NaN (quiet). Branch-free except for the NaN select.
+inline uint16_t float_to_bfloat16_bits( float x )
+{
+    uint32_t w = float_to_bits( x );
+    uint32_t rounded = w + 0x7fffu + ((w >> 16) & 1u);
+    bool is_nan = (w & 0x7fffffffu) > 0x7f800000u;
+    return uint16_t( is_nan ? ((w >> 16) | 0x0040u) : (rounded >> 16) );
+}
+
+//------------------------------------------------------------------------------
+/// Converts bfloat16 to float, which is exact.
+inline float bfloat16_bits_to_float( uint16_t b )
+{
+    return bits_to_float( uint32_t( b ) << 16 );
+}
+
+}  // namespace internal
+
+//==============================================================================
+/// IEEE binary16 (half precision) storage type: 1 sign, 5 exponent,
+/// and 10 mantissa bits, with range up to 65504 and about 3 decimal digits.
+/// Arithmetic is not provided; half is for storage only, converted to
+/// and from float, e.g., by lapack::lag2h and lapack::lag2s.
+/// It is trivially copyable and the same size as uint16_t, so arrays of
+/// it can be exchanged with other half types (_Float16, __half, etc.)
+/// by reinterpreting the bits.
+///
+/// @ingroup util
+class float16
+{
+public:
+    float16() = default;
+
+    /// Rounds x to nearest, ties to even.
+    explicit float16( float x ):
+        bits_( internal::float_to_half_bits( x ) )
+    {}
+
+    explicit operator float() const
+    {
+        return internal::half_bits_to_float( bits_ );
+    }
+
+    static float16 from_bits( uint16_t bits )
+    {
+        float16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    uint16_t bits() const { return bits_; }
+
+    /// Largest finite value, 65504.
+    static constexpr float max() { return 65504.0f; }
+
+private:
+    uint16_t bits_;
+};
+
+//==============================================================================
+/// bfloat16 storage type: 1 sign, 8 exponent, and 7 mantissa bits,
+/// i.e., the top half of a float, with the range of float and about
+/// 2 decimal digits.
+/// As with lapack::float16, it is for storage only, converted to and
+/// from float, e.g., by lapack::lag2b and lapack::lag2s.
+///
+/// @ingroup util
+class bfloat16
+{
+public:
+    bfloat16() = default;
+
+    /// Rounds x to nearest, ties to even.
+    explicit bfloat16( float x ):
+        bits_( internal::float_to_bfloat16_bits( x ) )
+    {}
+
+    explicit operator float() const
+    {
+        return internal::bfloat16_bits_to_float( bits_ );
+    }
+
+    static bfloat16 from_bits( uint16_t bits )
+    {
+        bfloat16 x;
+        x.bits_ = bits;
+        return x;
+    }
+
+    uint16_t bits() const { return bits_; }
+
+    /// Largest finite value, (2 - 2^-7) 2^127, about 3.39e38.
+    static constexpr float max() { return 3.3895313892515355e+38f; }
+
+private:
+    uint16_t bits_;
+};
+
+static_assert( sizeof( float16 ) == 2, "float16 must be 2 bytes" );
+static_assert( sizeof( bfloat16 ) == 2, "bfloat16 must be 2 bytes" );
+
+}  // namespace lapack
+
+#endif // LAPACK_HALF_HH
@@ -0,0 +1,86 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_ILAENV_HH
+#define LAPACK_ILAENV_HH
+
+#include "lapack/util.hh"
+
+#include <string>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// @defgroup ilaenv ILAENV block size overrides
+///
+/// LAPACK routines get block sizes from ILAENV (e.g., ispec 1 = nb,
+/// 2 = nbmin, 3 = nx) and ILAENV2STAGE (ispec 1 = kd, 2 = ib for
+/// the 2-stage routines). When LAPACK++ is configured with
+/// ilaenv_override (CMake -Dilaenv_override=yes, or
+/// `configure.py ilaenv_override=1`), it defines its own ILAENV and
+/// ILAENV2STAGE, which return values from a tuning table and otherwise
+/// call the LAPACK library's versions. This works only if the linked
+/// LAPACK is a shared library that calls ILAENV through its symbol table,
+/// like reference LAPACK; MKL and OpenBLAS's native routines ignore it.
+/// If the LAPACK library's ILAENV can't be found, e.g., with a static
+/// LAPACK, queries without a table entry get reference ILAENV's defaults
+/// for routines it does not know, which give unblocked code.
+///
+/// Table entries are keyed by LAPACK routine name with precision
+/// (e.g., "dgeqrf", "zhetrd_2stage"), ispec, and size. A query uses the
+/// entry with the largest size <= the problem size, max( n1, n2 ) for
+/// ILAENV or n1 for ILAENV2STAGE; if there is none, the LAPACK default.
+///
+/// The table is loaded at startup from the file in LAPACKPP_ILAENV_TABLE,
+/// if set. The file has lines `<name> <ispec> <size> <value>`;
+/// `#` starts a comment. The tester's --tune mode generates it.
+/// If the file can't be loaded, the table starts empty, and the next
+/// call to ilaenv_set, ilaenv_get, ilaenv_hits, ilaenv_load, or
+/// ilaenv_save throws Error with the reason.
+///
+/// Since workspace sizes depend on block sizes, changing the table clears
+/// the workspace query cache (see work_query_cache_clear), which also
+/// drops the sizes cached in each Workspace.
+
+//------------------------------------------------------------------------------
+/// @return true if LAPACK++ was configured to override ILAENV.
+/// @ingroup ilaenv
+bool ilaenv_override();
+
+/// Sets the value returned for routine name, ispec, and problems of
+/// at least the given size. value <= 0 removes the entry.
+/// @ingroup ilaenv
+void ilaenv_set( std::string const& name, int64_t ispec, int64_t size,
+                 int64_t value );
+
+/// @return value for routine name, ispec, and problem size from the table,
+/// or -1 if the LAPACK default applies.
+/// @ingroup ilaenv
+int64_t ilaenv_get( std::string const& name, int64_t ispec, int64_t size );
+
+/// @return number of ILAENV or ILAENV2STAGE queries for routine name
+/// answered from the table, e.g., to check that the linked LAPACK
+/// calls the override.
+/// @ingroup ilaenv
+int64_t ilaenv_hits( std::string const& name );
+
+/// Removes all entries from the table and resets the ilaenv_hits counts.
+/// @ingroup ilaenv
+void ilaenv_clear();
+
+/// Adds entries from the file filename to the table, replacing existing
+/// entries with the same name, ispec, and size.
+/// Throws Error if the file cannot be read or has a syntax error.
+/// @ingroup ilaenv
+void ilaenv_load( std::string const& filename );
+
+/// Writes the table to the file filename.
+/// Throws Error if the file cannot be written.
+/// @ingroup ilaenv
+void ilaenv_save( std::string const& filename );
+
+}  // namespace lapack
+
+#endif // LAPACK_ILAENV_HH
@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_LAYOUT_HH
+#define LAPACK_LAYOUT_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+// Layout-aware overloads. With Layout::RowMajor, matrices are stored by rows,
+// as in C, and leading dimensions are row strides. Where possible, a
+// row-major problem is solved as an algebraically equivalent column-major
+// problem on the same storage (e.g., potrf with uplo swapped, QR as LQ,
+// gesvd with U and VT swapped), or by algorithms working on row-major
+// storage directly (getrf, getrs), so matrices are not transposed.
+// With Layout::ColMajor, these are the same as the routines without layout.
+
+// -----------------------------------------------------------------------------
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
+
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau );
+
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+// -----------------------------------------------------------------------------
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau );
+
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+// -----------------------------------------------------------------------------
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+// -----------------------------------------------------------------------------
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+}  // namespace lapack
+
+#endif // LAPACK_LAYOUT_HH
@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_PIVOT_HH
+#define LAPACK_PIVOT_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+/// Non-owning view of a pivot vector stored in LAPACK's native integer
+/// type, `lapack_int`. Pivot indices are 1-based, as computed by LAPACK.
+///
+/// With LP64 LAPACK (32-bit `lapack_int`), routines taking `int64_t`
+/// pivots, such as `lapack::getrf` and `lapack::getrs`, copy pivots to and
+/// from a temporary `lapack_int` array on every call. The overloads taking
+/// `lapack_int` pivots pass them to LAPACK directly. A PivotView converts
+/// to `lapack_int*`, so it selects those overloads, and with ILP64 it
+/// selects the `int64_t` versions, which are already zero-copy.
+///
+/// Example:
+///
+///     std::vector< lapack_int > ipiv( n );
+///     lapack::PivotView piv( ipiv.data(), n );
+///     lapack::getrf( n, n, A, lda, piv );
+///     lapack::getrs( lapack::Op::NoTrans, n, nrhs, A, lda, piv, B, ldb );
+///
+/// @ingroup util
+class PivotView
+{
+public:
+    PivotView( lapack_int* data, int64_t size ):
+        data_( data ),
+        size_( size )
+    {}
+
+    /// @return pointer to pivots, for passing to LAPACK++ routines.
+    operator lapack_int* () const { return data_; }
+
+    lapack_int* data() const { return data_; }
+
+    int64_t size() const { return size_; }
+
+    /// @return pivot i (0-based index), which is a 1-based row index.
+    int64_t operator [] ( int64_t i ) const { return data_[ i ]; }
+
+    /// Copies pivots to ipiv, an array of length size().
+    void copy_to( int64_t* ipiv ) const
+    {
+        std::copy( data_, data_ + size_, ipiv );
+    }
+
+    /// Copies pivots from ipiv, an array of length size().
+    void copy_from( int64_t const* ipiv )
+    {
+        std::copy( ipiv, ipiv + size_, data_ );
+    }
+
+private:
+    lapack_int* data_;
+    int64_t size_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_PIVOT_HH
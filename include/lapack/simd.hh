@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SIMD_HH
+#define LAPACK_SIMD_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// @defgroup simd SIMD instruction sets for native kernels
+///
+/// Native kernels, such as the matrix norms with Method::Native, have
+/// versions for several SIMD instruction sets. On x86-64 with GCC or Clang,
+/// the AVX2 and AVX-512 versions are compiled into the library regardless
+/// of compiler flags, and one is chosen when called, so one library
+/// runs on any processor.
+///
+/// By default, the best instruction set the processor supports is used.
+/// It can be overridden by the environment variable LAPACKPP_SIMD
+/// (generic, avx2, or avx512), read at the first call of a native kernel
+/// or SIMD function, or by `simd_set`, e.g., to compare kernels, or to
+/// avoid the lower clock rate of AVX-512 on some processors.
+
+// -----------------------------------------------------------------------------
+// SIMD instruction sets, e.g., simd_set( Simd::AVX2 )
+enum class Simd {
+    Generic     = 'G',  ///< portable C++, vectorized by the compiler
+    AVX2        = 'A',  ///< AVX2 and FMA, 256-bit vectors
+    AVX512      = 'Z',  ///< AVX-512F, 512-bit vectors
+};
+
+inline char simd2char( lapack::Simd simd )
+{
+    return char( simd );
+}
+
+inline lapack::Simd char2simd( char simd )
+{
+    simd = char( toupper( simd ));
+    lapack_error_if( simd != 'G' && simd != 'A' && simd != 'Z' );
+    return lapack::Simd( simd );
+}
+
+inline const char* simd2str( lapack::Simd simd )
+{
+    switch (simd) {
+        case lapack::Simd::Generic: return "generic";
+        case lapack::Simd::AVX2:    return "avx2";
+        case lapack::Simd::AVX512:  return "avx512";
+    }
+    return "?";
+}
+
+//------------------------------------------------------------------------------
+/// @return true if the library has kernels for simd and the processor
+/// supports it. Simd::Generic is always supported.
+/// @ingroup simd
+bool simd_supported( lapack::Simd simd );
+
+/// Sets the instruction set used by native kernels in all threads.
+/// Throws Error if simd is not supported.
+/// @ingroup simd
+void simd_set( lapack::Simd simd );
+
+/// @return instruction set used by native kernels.
+/// @ingroup simd
+lapack::Simd simd_get();
+
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_HH
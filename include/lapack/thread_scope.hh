@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_THREAD_SCOPE_HH
+#define LAPACK_THREAD_SCOPE_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// While in scope, sets the number of threads used by calls from this
+/// thread, then restores the previous settings when destroyed.
+/// This covers:
+///
+/// - the vendor BLAS/LAPACK library. For MKL, the setting is local to the
+///   calling thread (mkl_set_num_threads_local). For OpenBLAS, it is
+///   process-wide (openblas_set_num_threads): while scopes are active,
+///   the most recently created one wins, and the setting from before
+///   the first scope is restored when the last one ends.
+///
+/// - OpenMP in the calling thread (omp_set_num_threads), which also
+///   sets the threads used by LAPACK++ routines such as the batch and
+///   tiled routines.
+///
+/// The vendor library is detected when LAPACK++ is configured; with other
+/// libraries, only OpenMP is set. For example, to run many single-threaded
+/// solves concurrently from an application's own thread pool without
+/// oversubscribing cores, each pool thread does:
+///
+///     {
+///         lapack::ThreadScope scope( 1 );
+///         lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+///     }
+///
+/// Scopes may be nested; destroy them in reverse order of creation.
+///
+class ThreadScope
+{
+public:
+    /// Sets num_threads threads. If num_threads <= 0, leaves settings
+    /// unchanged, which makes the thread count easy to leave optional.
+    explicit ThreadScope( int num_threads );
+    ~ThreadScope();
+
+    ThreadScope( ThreadScope const& ) = delete;
+    ThreadScope& operator = ( ThreadScope const& ) = delete;
+
+private:
+    int num_threads_;
+    int saved_omp_;
+    int saved_blas_;
+    int64_t token_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_THREAD_SCOPE_HH
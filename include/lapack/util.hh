@@ -869,6 +869,72 @@ inline const char* rowcol2str( lapack::RowCol rowcol )
     return "?";
 }
 
+// -----------------------------------------------------------------------------
+// Algorithm variants, e.g., potrf( ..., method )
+enum class Method {
+    Lapack      = 'L',
+    Tiled       = 'T',
+    TSQR        = 'Q',
+    CALU        = 'C',
+    Native      = 'N',
+};
+
+inline char method2char( lapack::Method method )
+{
+    return char( method );
+}
+
+inline lapack::Method char2method( char method )
+{
+    method = char( toupper( method ));
+    lapack_error_if( method != 'L' && method != 'T' && method != 'Q'
+                     && method != 'C' && method != 'N' );
+    return lapack::Method( method );
+}
+
+inline const char* method2str( lapack::Method method )
+{
+    switch (method) {
+        case lapack::Method::Lapack: return "lapack";
+        case lapack::Method::Tiled:  return "tiled";
+        case lapack::Method::TSQR:   return "tsqr";
+        case lapack::Method::CALU:   return "calu";
+        case lapack::Method::Native: return "native";
+    }
+    return "?";
+}
+
+//------------------------------------------------------------------------------
+/// Factorization for lapack::solve_mixed.
+enum class Factorization {
+    LU          = 'L',  ///< getrf, for general A
+    Cholesky    = 'C',  ///< potrf, for Hermitian positive definite A
+    LDLT        = 'D',  ///< hetrf (sytrf for real), for Hermitian A
+};
+
+inline char factorization2char( lapack::Factorization factorization )
+{
+    return char( factorization );
+}
+
+inline lapack::Factorization char2factorization( char factorization )
+{
+    factorization = char( toupper( factorization ));
+    lapack_error_if( factorization != 'L' && factorization != 'C'
+                     && factorization != 'D' );
+    return lapack::Factorization( factorization );
+}
+
+inline const char* factorization2str( lapack::Factorization factorization )
+{
+    switch (factorization) {
+        case lapack::Factorization::LU:       return "lu";
+        case lapack::Factorization::Cholesky: return "cholesky";
+        case lapack::Factorization::LDLT:     return "ldlt";
+    }
+    return "?";
+}
+
 //------------------------------------------------------------------------------
 // For %lld printf-style printing, cast to llong; guaranteed >= 64 bits.
 using llong = long long;
@@ -0,0 +1,395 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORKSPACE_HH
+#define LAPACK_WORKSPACE_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace lapack {
+
+class Workspace;
+
+// =============================================================================
+namespace internal {
+
+// -----------------------------------------------------------------------------
+/// Key identifying a workspace query: LAPACK routine name, including
+/// precision prefix (e.g., "dgeqrf"), and the integer and character
+/// arguments that affect the workspace size (dimensions, job, uplo, etc.).
+/// The routine name must be a string literal; it is not copied.
+struct WorkKey
+{
+    static constexpr int max_args = 16;
+
+    WorkKey( const char* routine_, std::initializer_list< int64_t > args_ ):
+        routine( routine_ ),
+        nargs( 0 )
+    {
+        assert( args_.size() <= size_t( max_args ) );
+        for (int64_t a : args_) {
+            args[ nargs++ ] = a;
+        }
+    }
+
+    bool operator < ( WorkKey const& other ) const
+    {
+        int cmp = strcmp( routine, other.routine );
+        if (cmp != 0)
+            return cmp < 0;
+        if (nargs != other.nargs)
+            return nargs < other.nargs;
+        for (int i = 0; i < nargs; ++i) {
+            if (args[ i ] != other.args[ i ])
+                return args[ i ] < other.args[ i ];
+        }
+        return false;
+    }
+
+    const char* routine;
+    int64_t args[ max_args ];
+    int nargs;
+};
+
+// -----------------------------------------------------------------------------
+/// Result of a workspace query: lengths, in elements, of work, rwork,
+/// and iwork. Unused lengths are 0.
+struct WorkSizes
+{
+    int64_t lwork  = 0;
+    int64_t lrwork = 0;
+    int64_t liwork = 0;
+};
+
+// -----------------------------------------------------------------------------
+/// Alignment, in bytes, of each array carved out of a workspace buffer.
+constexpr size_t work_alignment = 64;
+
+/// @return bytes needed for n elements of type T, rounded up to
+/// work_alignment, so consecutive arrays stay aligned.
+template <typename T>
+inline size_t aligned_bytes( int64_t n )
+{
+    size_t bytes = (n > 0 ? size_t( n ) : 0) * sizeof(T);
+    return (bytes + work_alignment - 1) / work_alignment * work_alignment;
+}
+
+// -----------------------------------------------------------------------------
+/// Hands out work arrays to the wrappers, which take all their workspace,
+/// including 32-bit integer copies, through a WorkBuffer. Depending on how
+/// it is constructed, a WorkBuffer:
+///
+/// - counts bytes only: get() returns nullptr. This is how the
+///   *_work_size_bytes routines compute the workspace size.
+/// - allocates each array, aligned to work_alignment bytes and freed
+///   with the WorkBuffer. This is how the allocating wrappers get their
+///   workspace.
+/// - carves arrays from a user-supplied host workspace, each aligned to
+///   work_alignment bytes. The buffer itself need not be aligned.
+///   The array from get_rest() gets all remaining space, so routines with
+///   one queried size need no workspace query.
+///
+/// Optionally, queried sizes are also kept in a Workspace, so repeated
+/// calls with it do no queries even if the process-wide cache is disabled.
+class WorkBuffer
+{
+public:
+    enum class Mode {
+        Count,     ///< get() returns nullptr and counts bytes
+        Allocate,  ///< get() allocates each array
+        Carve,     ///< get() carves arrays from a host workspace
+    };
+
+    explicit WorkBuffer( Mode mode = Mode::Count, Workspace* ws = nullptr ):
+        work_( nullptr ),
+        work_size_( 0 ),
+        offset_( 0 ),
+        mode_( mode ),
+        ws_( ws )
+    {}
+
+    WorkBuffer( void* work, size_t work_size, Workspace* ws = nullptr ):
+        work_( (char*) work ),
+        work_size_( work_size ),
+        offset_( 0 ),
+        mode_( Mode::Carve ),
+        ws_( ws )
+    {
+        size_t misalign = uintptr_t( work ) % work_alignment;
+        if (misalign != 0)
+            offset_ = work_alignment - misalign;
+    }
+
+    /// @return true if get() only counts bytes and returns nullptr.
+    bool counts_only() const { return mode_ == Mode::Count; }
+
+    /// @return next n elements of type T from buffer,
+    /// or nullptr when only counting bytes.
+    template <typename T>
+    T* get( int64_t n )
+    {
+        size_t bytes = aligned_bytes< T >( n );
+        T* ptr = nullptr;
+        if (mode_ == Mode::Carve) {
+            lapack_error_if_msg( offset_ + bytes > work_size_,
+                                 "host_work_size %lld too small",
+                                 (long long) work_size_ );
+            ptr = (T*) (work_ + offset_);
+        }
+        else if (mode_ == Mode::Allocate && bytes > 0) {
+            // aligned like the NoConstructAllocator it replaces;
+            // operator new does not initialize the array
+            allocated_.emplace_back( (char*) ::operator new(
+                bytes, std::align_val_t( work_alignment ) ) );
+            ptr = (T*) allocated_.back().get();
+        }
+        offset_ += bytes;
+        return ptr;
+    }
+
+    /// Same as get( *n ), except when carving from a host workspace,
+    /// returns all of the remaining buffer and sets n to its length,
+    /// limited to the largest lapack_int. Must be the last array taken.
+    template <typename T, typename int_t>
+    T* get_rest( int_t* n )
+    {
+        if (mode_ == Mode::Carve) {
+            // whole multiple of work_alignment, as get() rounds up to that
+            size_t rest = offset_ < work_size_ ? work_size_ - offset_ : 0;
+            rest = rest / work_alignment * work_alignment;
+            size_t max_n = size_t( std::numeric_limits< int_t >::max() );
+            *n = int_t( std::min( rest / sizeof(T), max_n ) );
+        }
+        return get< T >( *n );
+    }
+
+    /// Copies [first, last) to dst, unless only counting bytes.
+    template <typename src_t, typename dst_t>
+    void copy( src_t first, src_t last, dst_t* dst )
+    {
+        if (mode_ != Mode::Count)
+            std::copy( first, last, dst );
+    }
+
+    /// @return pivots to pass to LAPACK for output pivots ipiv of length n:
+    /// ipiv itself if it is already lapack_int, otherwise a lapack_int
+    /// array of n elements from the buffer, which copy_pivots copies back.
+    template <typename ipiv_t>
+    lapack_int* get_pivots( int64_t n, ipiv_t* ipiv )
+    {
+        if constexpr (std::is_same< ipiv_t, lapack_int >::value)
+            return ipiv;
+        else
+            return get< lapack_int >( n );
+    }
+
+    /// Same as get_pivots, for input pivots: a lapack_int array from the
+    /// buffer gets a copy of ipiv, unless only counting bytes.
+    template <typename ipiv_t>
+    lapack_int const* get_pivots_in( int64_t n, ipiv_t const* ipiv )
+    {
+        if constexpr (std::is_same< ipiv_t, lapack_int >::value) {
+            return ipiv;
+        }
+        else {
+            lapack_int* ipiv_ = get< lapack_int >( n );
+            copy( ipiv, ipiv + n, ipiv_ );
+            return ipiv_;
+        }
+    }
+
+    /// Copies n pivots from ipiv_, from get_pivots, back to ipiv,
+    /// unless they are the same array.
+    template <typename ipiv_t>
+    void copy_pivots( int64_t n, lapack_int const* ipiv_, ipiv_t* ipiv )
+    {
+        if constexpr (! std::is_same< ipiv_t, lapack_int >::value)
+            copy( ipiv_, ipiv_ + n, ipiv );
+    }
+
+    /// Looks up workspace sizes for key, in the Workspace, if any,
+    /// then in the process-wide cache.
+    /// @return true if found, in which case sizes is set.
+    bool find( WorkKey const& key, WorkSizes* sizes ) const;
+
+    /// Same as find, except when carving from a host workspace, returns
+    /// true without setting sizes: the work array from get_rest() takes
+    /// the rest of the buffer, so its size need not be queried.
+    bool find_lwork( WorkKey const& key, WorkSizes* sizes ) const
+    {
+        return mode_ == Mode::Carve || find( key, sizes );
+    }
+
+    /// Caches workspace sizes from a query for key, in the Workspace,
+    /// if any, and in the process-wide cache.
+    void insert( WorkKey const& key, WorkSizes const& sizes );
+
+    /// @return bytes needed for arrays so far, including worst-case
+    /// padding to align an unaligned buffer; 0 if no arrays are needed.
+    size_t bytes() const
+    {
+        return offset_ == 0 ? 0 : offset_ + work_alignment - 1;
+    }
+
+private:
+    char*  work_;
+    size_t work_size_;
+    size_t offset_;
+    Mode   mode_;
+    Workspace* ws_;
+    /// Frees arrays from aligned operator new.
+    struct AlignedDelete
+    {
+        void operator () ( char* ptr ) const
+        {
+            ::operator delete( ptr, std::align_val_t( work_alignment ) );
+        }
+    };
+
+    std::vector< std::unique_ptr< char, AlignedDelete > > allocated_;
+};
+
+// -----------------------------------------------------------------------------
+// Process-wide cache of workspace queries; see work_query_cache_enable.
+// Lookups are lock free; inserts take a lock.
+bool work_query_find( WorkKey const& key, WorkSizes* sizes );
+void work_query_insert( WorkKey const& key, WorkSizes const& sizes );
+
+/// @return number of times work_query_cache_clear was called. Workspace
+/// compares it to drop sizes it cached before block sizes changed.
+uint64_t work_query_generation();
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// Counters for the process-wide workspace query cache.
+/// @ingroup workspace
+struct WorkQueryCacheStats
+{
+    int64_t hits    = 0;  ///< lookups answered from the cache
+    int64_t misses  = 0;  ///< lookups forwarded to LAPACK
+    int64_t entries = 0;  ///< distinct queries currently cached
+};
+
+// -----------------------------------------------------------------------------
+/// Enables or disables the process-wide workspace query cache.
+///
+/// Routines that need a work array normally call LAPACK twice: once
+/// with lwork = -1 to query the optimal size, then to compute.
+/// With the cache enabled (the default), the query result is
+/// remembered, keyed by routine, precision, and the integer and
+/// character arguments, so the query is done only once per problem shape.
+///
+/// The cache can also be disabled by setting the environment variable
+/// `LAPACKPP_WORK_QUERY_CACHE` to `0`, `off`, or `no`.
+///
+/// @ingroup workspace
+void work_query_cache_enable( bool enable );
+
+/// @return true if the workspace query cache is enabled.
+/// @ingroup workspace
+bool work_query_cache_enabled();
+
+/// Removes all entries from the workspace query cache and resets its
+/// counters. Called when the ILAENV table (see ilaenv_set) or backend
+/// bindings (see backend_set) change; call it if block sizes are changed
+/// at runtime by other means.
+/// @ingroup workspace
+void work_query_cache_clear();
+
+/// @return hit, miss, and entry counts of the workspace query cache.
+/// @ingroup workspace
+WorkQueryCacheStats work_query_cache_stats();
+
+// -----------------------------------------------------------------------------
+/// Reusable workspace for LAPACK routines that need work arrays.
+///
+/// Routines that take a Workspace remember the workspace sizes they
+/// queried, per routine, precision, and arguments, and carve their work
+/// arrays out of one 64-byte aligned buffer. The buffer grows
+/// monotonically and is never shrunk, so once a Workspace has seen a
+/// given problem shape, repeated calls do no workspace queries and no
+/// memory allocation, whether or not the process-wide query cache is
+/// enabled (see work_query_cache_enable).
+///
+/// Cached sizes are dropped when the workspace query cache is cleared,
+/// e.g., by ilaenv_set, since they depend on block sizes.
+///
+/// A Workspace is not thread safe; use one per thread.
+///
+/// Example:
+///
+///     lapack::Workspace ws;
+///     for (auto& prob : problems) {
+///         lapack::geqrf( m, n, prob.A, lda, prob.tau, ws );
+///     }
+///
+/// @ingroup workspace
+class Workspace
+{
+public:
+    Workspace();
+    explicit Workspace( size_t bytes );
+    ~Workspace();
+
+    Workspace( Workspace const& ) = delete;
+    Workspace& operator = ( Workspace const& ) = delete;
+
+    /// Ensures buffer holds at least bytes, growing it if needed.
+    /// Existing contents are not preserved when growing.
+    /// @return pointer to buffer, aligned to 64 bytes.
+    void* reserve( size_t bytes );
+
+    /// @return current buffer, or nullptr if nothing is allocated yet.
+    void* data() const { return data_; }
+
+    /// @return size of buffer in bytes.
+    size_t capacity() const { return capacity_; }
+
+    /// Frees buffer and forgets all cached workspace sizes.
+    void clear();
+
+    /// @return number of times the buffer has been (re)allocated.
+    int64_t num_allocations() const { return num_allocations_; }
+
+    /// @return number of workspace queries that missed the cache and
+    /// were forwarded to LAPACK.
+    int64_t num_queries() const { return num_queries_; }
+
+    /// Looks up cached workspace sizes for key. Sizes cached before
+    /// the last work_query_cache_clear are not found.
+    /// @return true if found, in which case sizes is set.
+    bool find( internal::WorkKey const& key, internal::WorkSizes* sizes ) const;
+
+    /// Caches workspace sizes for key, and counts a query.
+    /// First drops sizes cached before the last work_query_cache_clear.
+    void insert( internal::WorkKey const& key,
+                 internal::WorkSizes const& sizes );
+
+private:
+    void*   data_;
+    size_t  capacity_;
+    int64_t num_allocations_;
+    int64_t num_queries_;
+    uint64_t generation_;  ///< work_query_generation when sizes_ was filled
+    std::map< internal::WorkKey, internal::WorkSizes > sizes_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_WORKSPACE_HH
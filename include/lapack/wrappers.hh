@@ -7,6 +7,9 @@
 #define LAPACK_WRAPPERS_HH
 
 #include "lapack/util.hh"
+#include "lapack/workspace.hh"
+#include "lapack/pivot.hh"
+#include "lapack/half.hh"
 
 namespace lapack {
 
@@ -30,6 +33,42 @@ int64_t bbcsd(
     float* B22D,
     float* B22E );
 
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    size_t* host_work_size );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    void* host_work, size_t host_work_size );
+
 int64_t bbcsd(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     double* theta,
@@ -47,6 +86,42 @@ int64_t bbcsd(
     double* B22D,
     double* B22E );
 
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    size_t* host_work_size );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    void* host_work, size_t host_work_size );
+
 int64_t bbcsd(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     float* theta,
@@ -64,6 +139,42 @@ int64_t bbcsd(
     float* B22D,
     float* B22E );
 
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    size_t* host_work_size );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    void* host_work, size_t host_work_size );
+
 int64_t bbcsd(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     double* theta,
@@ -81,6 +192,42 @@ int64_t bbcsd(
     double* B22D,
     double* B22E );
 
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    size_t* host_work_size );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t bdsdc(
     lapack::Uplo uplo, lapack::Job compq, int64_t n,
@@ -150,6 +297,51 @@ int64_t bdsvdx(
     double* S,
     double* Z, int64_t ldz );
 
+// -----------------------------------------------------------------------------
+void conj_transpose(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
+
+void conj_transpose(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+void conj_transpose(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+void conj_transpose(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+void conj_transpose(
+    int64_t n, float* A, int64_t lda );
+
+void conj_transpose(
+    int64_t n, double* A, int64_t lda );
+
+void conj_transpose(
+    int64_t n, std::complex<float>* A, int64_t lda );
+
+void conj_transpose(
+    int64_t n, std::complex<double>* A, int64_t lda );
+
+void conj_transpose(
+    int64_t m, int64_t n, float* A );
+
+void conj_transpose(
+    int64_t m, int64_t n, double* A );
+
+void conj_transpose(
+    int64_t m, int64_t n, std::complex<float>* A );
+
+void conj_transpose(
+    int64_t m, int64_t n, std::complex<double>* A );
+
 // -----------------------------------------------------------------------------
 int64_t disna(
     lapack::JobCond jobcond, int64_t m, int64_t n,
@@ -424,6 +616,34 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+#ifndef LAPACK_ILP64
+
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    lapack_int* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    lapack_int* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t gbsvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
@@ -502,6 +722,30 @@ int64_t gbtrf(
     std::complex<double>* AB, int64_t ldab,
     int64_t* ipiv );
 
+#ifndef LAPACK_ILP64
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab,
+    lapack_int* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab,
+    lapack_int* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab,
+    lapack_int* ipiv );
+
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab,
+    lapack_int* ipiv );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t gbtrs(
     lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
@@ -527,6 +771,34 @@ int64_t gbtrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+#ifndef LAPACK_ILP64
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t gebak(
     lapack::Balance balance, lapack::Side side, int64_t n, int64_t ilo, int64_t ihi,
@@ -586,6 +858,24 @@ int64_t gebrd(
     float* tauq,
     float* taup );
 
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    size_t* host_work_size );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    void* host_work, size_t host_work_size );
+
 int64_t gebrd(
     int64_t m, int64_t n,
     double* A, int64_t lda,
@@ -594,6 +884,24 @@ int64_t gebrd(
     double* tauq,
     double* taup );
 
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    size_t* host_work_size );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    void* host_work, size_t host_work_size );
+
 int64_t gebrd(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -602,6 +910,24 @@ int64_t gebrd(
     std::complex<float>* tauq,
     std::complex<float>* taup );
 
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    size_t* host_work_size );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    void* host_work, size_t host_work_size );
+
 int64_t gebrd(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -610,12 +936,30 @@ int64_t gebrd(
     std::complex<double>* tauq,
     std::complex<double>* taup );
 
-// -----------------------------------------------------------------------------
-int64_t gecon(
-    lapack::Norm norm, int64_t n,
-    float const* A, int64_t lda,
-    float anorm, float* rcond );
-
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    size_t* host_work_size );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    float const* A, int64_t lda,
+    float anorm, float* rcond );
+
 int64_t gecon(
     lapack::Norm norm, int64_t n,
     double const* A, int64_t lda,
@@ -713,6 +1057,22 @@ int64_t gees(
     std::complex<float>* W,
     float* VS, int64_t ldvs );
 
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    size_t* host_work_size );
+
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size );
+
 int64_t gees(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
     double* A, int64_t lda,
@@ -720,6 +1080,22 @@ int64_t gees(
     std::complex<double>* W,
     double* VS, int64_t ldvs );
 
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    size_t* host_work_size );
+
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size );
+
 int64_t gees(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -727,6 +1103,22 @@ int64_t gees(
     std::complex<float>* W,
     std::complex<float>* VS, int64_t ldvs );
 
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    size_t* host_work_size );
+
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size );
+
 int64_t gees(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -734,6 +1126,22 @@ int64_t gees(
     std::complex<double>* W,
     std::complex<double>* VS, int64_t ldvs );
 
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    size_t* host_work_size );
+
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t geesx(
     lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
@@ -744,6 +1152,26 @@ int64_t geesx(
     float* rconde,
     float* rcondv );
 
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size );
+
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size );
+
 int64_t geesx(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
@@ -753,6 +1181,26 @@ int64_t geesx(
     double* rconde,
     double* rcondv );
 
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size );
+
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size );
+
 int64_t geesx(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -762,6 +1210,26 @@ int64_t geesx(
     float* rconde,
     float* rcondv );
 
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size );
+
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size );
+
 int64_t geesx(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -771,6 +1239,26 @@ int64_t geesx(
     double* rconde,
     double* rcondv );
 
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size );
+
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
@@ -779,6 +1267,22 @@ int64_t geev(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr );
 
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
@@ -786,6 +1290,22 @@ int64_t geev(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr );
 
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -793,6 +1313,22 @@ int64_t geev(
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr );
 
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
 int64_t geev(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -800,6 +1336,22 @@ int64_t geev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr );
 
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t geevx(
     lapack::Balance balance, lapack::Job jobvl, lapack::Job jobvr, lapack::Sense sense, int64_t n,
@@ -859,42 +1411,138 @@ int64_t gehrd(
     float* A, int64_t lda,
     float* tau );
 
+void gehrd_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gehrd(
     int64_t n, int64_t ilo, int64_t ihi,
     double* A, int64_t lda,
     double* tau );
 
+void gehrd_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gehrd(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
+void gehrd_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gehrd(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void gehrd_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gelq(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     float* T, int64_t tsize );
 
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t gelq(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* T, int64_t tsize );
 
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t gelq(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize );
 
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t gelq(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize );
 
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gelq2(
     int64_t m, int64_t n,
@@ -922,42 +1570,138 @@ int64_t gelqf(
     float* A, int64_t lda,
     float* tau );
 
-int64_t gelqf(
+void gelqf_work_size_bytes(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
-    double* tau );
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
 
 int64_t gelqf(
     int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau );
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
 
 int64_t gelqf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb );
 
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb );
 
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t gels(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
@@ -966,6 +1710,22 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank );
 
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
@@ -973,6 +1733,22 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank );
 
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
@@ -980,6 +1756,22 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank );
 
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
@@ -987,6 +1779,22 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank );
 
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
@@ -995,6 +1803,22 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank );
 
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
@@ -1002,6 +1826,22 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank );
 
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
@@ -1009,6 +1849,22 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank );
 
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
@@ -1016,6 +1872,22 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank );
 
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gelsy(
     int64_t m, int64_t n, int64_t nrhs,
@@ -1024,6 +1896,22 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank );
 
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsy(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
@@ -1031,6 +1919,22 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank );
 
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsy(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
@@ -1038,6 +1942,22 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank );
 
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 int64_t gelsy(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
@@ -1045,6 +1965,22 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank );
 
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    size_t* host_work_size );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gemlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -1052,24 +1988,80 @@ int64_t gemlq(
     float const* T, int64_t tsize,
     float* C, int64_t ldc );
 
+void gemlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t gemlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
     double const* T, int64_t tsize,
     double* C, int64_t ldc );
 
+void gemlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t gemlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* T, int64_t tsize,
     std::complex<float>* C, int64_t ldc );
 
+void gemlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t gemlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* T, int64_t tsize,
     std::complex<double>* C, int64_t ldc );
 
+void gemlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gemqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -1077,11 +2069,39 @@ int64_t gemqr(
     float const* T, int64_t tsize,
     float* C, int64_t ldc );
 
-int64_t gemqr(
+void gemqr_work_size_bytes(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* T, int64_t tsize,
-    double* C, int64_t ldc );
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc );
+
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
 int64_t gemqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -1089,12 +2109,68 @@ int64_t gemqr(
     std::complex<float> const* T, int64_t tsize,
     std::complex<float>* C, int64_t ldc );
 
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t gemqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* T, int64_t tsize,
     std::complex<double>* C, int64_t ldc );
 
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    lapack::Method method );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    lapack::Method method );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    lapack::Method method );
+
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    lapack::Method method );
+
 // -----------------------------------------------------------------------------
 int64_t gemqrt(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t nb,
@@ -1147,21 +2223,69 @@ int64_t geqlf(
     float* A, int64_t lda,
     float* tau );
 
+void geqlf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t geqlf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqlf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau );
 
+void geqlf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t geqlf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqlf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
+void geqlf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqlf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void geqlf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t geqp3(
     int64_t m, int64_t n,
@@ -1169,45 +2293,173 @@ int64_t geqp3(
     int64_t* jpvt,
     float* tau );
 
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqp3(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     int64_t* jpvt,
     double* tau );
 
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqp3(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* jpvt,
     std::complex<float>* tau );
 
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqp3(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
     std::complex<double>* tau );
 
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t geqr(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     float* T, int64_t tsize );
 
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t geqr(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* T, int64_t tsize );
 
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t geqr(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize );
 
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
 int64_t geqr(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize );
 
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    size_t* host_work_size );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    void* host_work, size_t host_work_size );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    lapack::Method method );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    lapack::Method method );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    lapack::Method method );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    lapack::Method method );
+
 // -----------------------------------------------------------------------------
 int64_t geqr2(
     int64_t m, int64_t n,
@@ -1235,52 +2487,172 @@ int64_t geqrf(
     float* A, int64_t lda,
     float* tau );
 
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqrf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau );
 
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
-// -----------------------------------------------------------------------------
-int64_t geqrfp(
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t geqrf(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* tau );
+    float* tau,
+    lapack::Workspace& ws );
 
-int64_t geqrfp(
+int64_t geqrf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* tau );
+    double* tau,
+    lapack::Workspace& ws );
 
-int64_t geqrfp(
+int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau );
+    std::complex<float>* tau,
+    lapack::Workspace& ws );
 
-int64_t geqrfp(
+int64_t geqrf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* tau );
+    std::complex<double>* tau,
+    lapack::Workspace& ws );
 
 // -----------------------------------------------------------------------------
-int64_t geqrt(
-    int64_t m, int64_t n, int64_t nb,
+int64_t geqrfp(
+    int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* T, int64_t ldt );
+    float* tau );
 
-int64_t geqrt(
-    int64_t m, int64_t n, int64_t nb,
-    double* A, int64_t lda,
-    double* T, int64_t ldt );
+void geqrfp_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+void geqrfp_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+void geqrfp_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+void geqrfp_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t geqrt(
+    int64_t m, int64_t n, int64_t nb,
+    float* A, int64_t lda,
+    float* T, int64_t ldt );
+
+int64_t geqrt(
+    int64_t m, int64_t n, int64_t nb,
+    double* A, int64_t lda,
+    double* T, int64_t ldt );
 
 int64_t geqrt(
     int64_t m, int64_t n, int64_t nb,
@@ -1463,21 +2835,69 @@ int64_t gerqf(
     float* A, int64_t lda,
     float* tau );
 
+void gerqf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gerqf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau );
 
+void gerqf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gerqf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
+void gerqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t gerqf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void gerqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
@@ -1486,6 +2906,22 @@ int64_t gesdd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt );
 
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     double* A, int64_t lda,
@@ -1493,6 +2929,22 @@ int64_t gesdd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt );
 
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -1500,6 +2952,22 @@ int64_t gesdd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt );
 
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -1507,6 +2975,22 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gesv(
     int64_t n, int64_t nrhs,
@@ -1548,6 +3032,34 @@ int64_t gesv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter );
 
+#ifndef LAPACK_ILP64
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t gesvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
@@ -1617,6 +3129,22 @@ int64_t gesvd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt );
 
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesvd(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     double* A, int64_t lda,
@@ -1624,6 +3152,22 @@ int64_t gesvd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt );
 
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesvd(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -1631,6 +3175,22 @@ int64_t gesvd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt );
 
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesvd(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -1638,6 +3198,22 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
@@ -1647,6 +3223,24 @@ int64_t gesvdx(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt );
 
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
@@ -1655,6 +3249,24 @@ int64_t gesvdx(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt );
 
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
@@ -1663,14 +3275,50 @@ int64_t gesvdx(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt );
 
-int64_t gesvdx(
+void gesvdx_work_size_bytes(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
-    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
     int64_t* ns,
     double* S,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size );
+
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* ns,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t getf2(
     int64_t m, int64_t n,
@@ -1713,6 +3361,54 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method );
+
+#ifndef LAPACK_ILP64
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t getrf2(
     int64_t m, int64_t n,
@@ -1740,21 +3436,141 @@ int64_t getri(
     float* A, int64_t lda,
     int64_t const* ipiv );
 
+void getri_work_size_bytes(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 int64_t getri(
     int64_t n,
     double* A, int64_t lda,
     int64_t const* ipiv );
 
+void getri_work_size_bytes(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 int64_t getri(
     int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv );
 
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 int64_t getri(
     int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv );
 
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+#ifndef LAPACK_ILP64
+
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv );
+
+void getri_work_size_bytes(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv );
+
+void getri_work_size_bytes(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv );
+
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv );
+
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size );
+
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t getrs(
     lapack::Op trans, int64_t n, int64_t nrhs,
@@ -1780,27 +3596,103 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+#ifndef LAPACK_ILP64
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb );
 
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb );
 
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t ggbak(
     lapack::Balance balance, lapack::Side side, int64_t n, int64_t ilo, int64_t ihi,
@@ -1874,38 +3766,18 @@ int64_t gges(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr );
 
-int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    int64_t* sdim,
-    std::complex<double>* alpha,
-    double* beta,
-    double* VSL, int64_t ldvsl,
-    double* VSR, int64_t ldvsr );
-
-int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
+void gges_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     int64_t* sdim,
     std::complex<float>* alpha,
-    std::complex<float>* beta,
-    std::complex<float>* VSL, int64_t ldvsl,
-    std::complex<float>* VSR, int64_t ldvsr );
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    size_t* host_work_size );
 
 int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    int64_t* sdim,
-    std::complex<double>* alpha,
-    std::complex<double>* beta,
-    std::complex<double>* VSL, int64_t ldvsl,
-    std::complex<double>* VSR, int64_t ldvsr );
-
-// -----------------------------------------------------------------------------
-int64_t gges3(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
@@ -1913,9 +3785,10 @@ int64_t gges3(
     std::complex<float>* alpha,
     float* beta,
     float* VSL, int64_t ldvsl,
-    float* VSR, int64_t ldvsr );
+    float* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
 
-int64_t gges3(
+int64_t gges(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
@@ -1925,17 +3798,61 @@ int64_t gges3(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr );
 
-int64_t gges3(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
+void gges_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     int64_t* sdim,
-    std::complex<float>* alpha,
-    std::complex<float>* beta,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    size_t* host_work_size );
+
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr );
 
-int64_t gges3(
+void gges_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    size_t* host_work_size );
+
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
+int64_t gges(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
@@ -1945,9 +3862,41 @@ int64_t gges3(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr );
 
+void gges_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    size_t* host_work_size );
+
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
-int64_t ggesx(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, lapack::Sense sense, int64_t n,
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr );
+
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     int64_t* sdim,
@@ -1955,11 +3904,31 @@ int64_t ggesx(
     float* beta,
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr,
-    float* rconde,
-    float* rcondv );
+    size_t* host_work_size );
 
-int64_t ggesx(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, lapack::Sense sense, int64_t n,
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr );
+
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     int64_t* sdim,
@@ -1967,11 +3936,31 @@ int64_t ggesx(
     double* beta,
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr,
-    double* rconde,
-    double* rcondv );
+    size_t* host_work_size );
 
-int64_t ggesx(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, lapack::Sense sense, int64_t n,
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr );
+
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     int64_t* sdim,
@@ -1979,11 +3968,31 @@ int64_t ggesx(
     std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr,
-    float* rconde,
-    float* rcondv );
+    size_t* host_work_size );
 
-int64_t ggesx(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, lapack::Sense sense, int64_t n,
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
+
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr );
+
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
     int64_t* sdim,
@@ -1991,6787 +4000,13674 @@ int64_t ggesx(
     std::complex<double>* beta,
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr,
-    double* rconde,
-    double* rcondv );
+    size_t* host_work_size );
+
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t ggev(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<float>* alpha,
     float* beta,
-    float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr );
-
-int64_t ggev(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    std::complex<double>* alpha,
-    double* beta,
-    double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr );
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv );
 
-int64_t ggev(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<float>* alpha,
-    std::complex<float>* beta,
-    std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr );
-
-int64_t ggev(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* alpha,
-    std::complex<double>* beta,
-    std::complex<double>* VL, int64_t ldvl,
-    std::complex<double>* VR, int64_t ldvr );
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t ggev3(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<float>* alpha,
     float* beta,
-    float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr );
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size );
 
-int64_t ggev3(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<double>* alpha,
     double* beta,
-    double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr );
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv );
 
-int64_t ggev3(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size );
+
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size );
+
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<float>* alpha,
     std::complex<float>* beta,
-    std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr );
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv );
 
-int64_t ggev3(
-    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size );
+
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size );
+
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
     std::complex<double>* alpha,
     std::complex<double>* beta,
-    std::complex<double>* VL, int64_t ldvl,
-    std::complex<double>* VR, int64_t ldvr );
-
-// -----------------------------------------------------------------------------
-int64_t ggglm(
-    int64_t n, int64_t m, int64_t p,
-    float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* D,
-    float* X,
-    float* Y );
-
-int64_t ggglm(
-    int64_t n, int64_t m, int64_t p,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* D,
-    double* X,
-    double* Y );
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv );
 
-int64_t ggglm(
-    int64_t n, int64_t m, int64_t p,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* D,
-    std::complex<float>* X,
-    std::complex<float>* Y );
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size );
 
-int64_t ggglm(
-    int64_t n, int64_t m, int64_t p,
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* D,
-    std::complex<double>* X,
-    std::complex<double>* Y );
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t gghrd(
-    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
-    float* Q, int64_t ldq,
-    float* Z, int64_t ldz );
-
-int64_t gghrd(
-    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* Q, int64_t ldq,
-    double* Z, int64_t ldz );
-
-int64_t gghrd(
-    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* Z, int64_t ldz );
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr );
 
-int64_t gghrd(
-    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* Z, int64_t ldz );
+void ggev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t gglse(
-    int64_t m, int64_t n, int64_t p,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
-    float* C,
-    float* D,
-    float* X );
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
 
-int64_t gglse(
-    int64_t m, int64_t n, int64_t p,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
-    double* C,
-    double* D,
-    double* X );
-
-int64_t gglse(
-    int64_t m, int64_t n, int64_t p,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* C,
-    std::complex<float>* D,
-    std::complex<float>* X );
-
-int64_t gglse(
-    int64_t m, int64_t n, int64_t p,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* C,
-    std::complex<double>* D,
-    std::complex<double>* X );
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr );
 
-// -----------------------------------------------------------------------------
-int64_t ggqrf(
-    int64_t n, int64_t m, int64_t p,
-    float* A, int64_t lda,
-    float* taua,
-    float* B, int64_t ldb,
-    float* taub );
+void ggev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    size_t* host_work_size );
 
-int64_t ggqrf(
-    int64_t n, int64_t m, int64_t p,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
-    double* taua,
     double* B, int64_t ldb,
-    double* taub );
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
 
-int64_t ggqrf(
-    int64_t n, int64_t m, int64_t p,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub );
-
-int64_t ggqrf(
-    int64_t n, int64_t m, int64_t p,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* taua,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub );
-
-// -----------------------------------------------------------------------------
-int64_t ggrqf(
-    int64_t m, int64_t p, int64_t n,
-    float* A, int64_t lda,
-    float* taua,
-    float* B, int64_t ldb,
-    float* taub );
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr );
 
-int64_t ggrqf(
-    int64_t m, int64_t p, int64_t n,
-    double* A, int64_t lda,
-    double* taua,
-    double* B, int64_t ldb,
-    double* taub );
+void ggev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    size_t* host_work_size );
 
-int64_t ggrqf(
-    int64_t m, int64_t p, int64_t n,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub );
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
 
-int64_t ggrqf(
-    int64_t m, int64_t p, int64_t n,
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* taua,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub );
-
-// -----------------------------------------------------------------------------
-int64_t ggsvd3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
-    int64_t* k,
-    int64_t* l,
-    float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* alpha,
-    float* beta,
-    float* U, int64_t ldu,
-    float* V, int64_t ldv,
-    float* Q, int64_t ldq );
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr );
 
-int64_t ggsvd3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
-    int64_t* k,
-    int64_t* l,
+void ggev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr );
+
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
-    double* alpha,
+    std::complex<double>* alpha,
     double* beta,
-    double* U, int64_t ldu,
-    double* V, int64_t ldv,
-    double* Q, int64_t ldq );
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr );
 
-int64_t ggsvd3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
-    int64_t* k,
-    int64_t* l,
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
-    float* alpha,
-    float* beta,
-    std::complex<float>* U, int64_t ldu,
-    std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq );
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr );
 
-int64_t ggsvd3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
-    int64_t* k,
-    int64_t* l,
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
-    double* alpha,
-    double* beta,
-    std::complex<double>* U, int64_t ldu,
-    std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq );
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr );
+
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    size_t* host_work_size );
+
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
     float* A, int64_t lda,
-    float* B, int64_t ldb, float tola, float tolb,
-    int64_t* k,
-    int64_t* l,
-    float* U, int64_t ldu,
-    float* V, int64_t ldv,
-    float* Q, int64_t ldq,
-    float* tau );
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb, double tola, double tolb,
-    int64_t* k,
-    int64_t* l,
-    double* U, int64_t ldu,
-    double* V, int64_t ldv,
-    double* Q, int64_t ldq,
-    double* tau );
+void ggglm_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    size_t* host_work_size );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb, float tola, float tolb,
-    int64_t* k,
-    int64_t* l,
-    std::complex<float>* U, int64_t ldu,
-    std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* tau );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    void* host_work, size_t host_work_size );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb, double tola, double tolb,
-    int64_t* k,
-    int64_t* l,
-    std::complex<double>* U, int64_t ldu,
-    std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* tau );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y );
 
-// -----------------------------------------------------------------------------
-int64_t gtcon(
-    lapack::Norm norm, int64_t n,
-    float const* DL,
-    float const* D,
-    float const* DU,
-    float const* DU2,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+void ggglm_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    size_t* host_work_size );
 
-int64_t gtcon(
-    lapack::Norm norm, int64_t n,
-    double const* DL,
-    double const* D,
-    double const* DU,
-    double const* DU2,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    void* host_work, size_t host_work_size );
 
-int64_t gtcon(
-    lapack::Norm norm, int64_t n,
-    std::complex<float> const* DL,
-    std::complex<float> const* D,
-    std::complex<float> const* DU,
-    std::complex<float> const* DU2,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y );
 
-int64_t gtcon(
-    lapack::Norm norm, int64_t n,
-    std::complex<double> const* DL,
-    std::complex<double> const* D,
-    std::complex<double> const* DU,
-    std::complex<double> const* DU2,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+void ggglm_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t gtrfs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    float const* DL,
-    float const* D,
-    float const* DU,
-    float const* DLF,
-    float const* DF,
-    float const* DUF,
-    float const* DU2,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    void* host_work, size_t host_work_size );
 
-int64_t gtrfs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    double const* DL,
-    double const* D,
-    double const* DU,
-    double const* DLF,
-    double const* DF,
-    double const* DUF,
-    double const* DU2,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y );
 
-int64_t gtrfs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<float> const* DL,
-    std::complex<float> const* D,
-    std::complex<float> const* DU,
-    std::complex<float> const* DLF,
-    std::complex<float> const* DF,
-    std::complex<float> const* DUF,
-    std::complex<float> const* DU2,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+void ggglm_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    size_t* host_work_size );
 
-int64_t gtrfs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<double> const* DL,
-    std::complex<double> const* D,
-    std::complex<double> const* DU,
-    std::complex<double> const* DLF,
-    std::complex<double> const* DF,
-    std::complex<double> const* DUF,
-    std::complex<double> const* DU2,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t gtsv(
-    int64_t n, int64_t nrhs,
-    float* DL,
-    float* D,
-    float* DU,
-    float* B, int64_t ldb );
+int64_t gghrd(
+    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz );
 
-int64_t gtsv(
-    int64_t n, int64_t nrhs,
-    double* DL,
-    double* D,
-    double* DU,
-    double* B, int64_t ldb );
+int64_t gghrd(
+    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz );
 
-int64_t gtsv(
-    int64_t n, int64_t nrhs,
-    std::complex<float>* DL,
-    std::complex<float>* D,
-    std::complex<float>* DU,
-    std::complex<float>* B, int64_t ldb );
+int64_t gghrd(
+    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz );
 
-int64_t gtsv(
-    int64_t n, int64_t nrhs,
-    std::complex<double>* DL,
-    std::complex<double>* D,
-    std::complex<double>* DU,
-    std::complex<double>* B, int64_t ldb );
+int64_t gghrd(
+    lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz );
 
 // -----------------------------------------------------------------------------
-int64_t gtsvx(
-    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
-    float const* DL,
-    float const* D,
-    float const* DU,
-    float* DLF,
-    float* DF,
-    float* DUF,
-    float* DU2,
-    int64_t* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X );
 
-int64_t gtsvx(
-    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
-    double const* DL,
-    double const* D,
-    double const* DU,
-    double* DLF,
-    double* DF,
-    double* DUF,
-    double* DU2,
-    int64_t* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    size_t* host_work_size );
 
-int64_t gtsvx(
-    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<float> const* DL,
-    std::complex<float> const* D,
-    std::complex<float> const* DU,
-    std::complex<float>* DLF,
-    std::complex<float>* DF,
-    std::complex<float>* DUF,
-    std::complex<float>* DU2,
-    int64_t* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    void* host_work, size_t host_work_size );
 
-int64_t gtsvx(
-    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<double> const* DL,
-    std::complex<double> const* D,
-    std::complex<double> const* DU,
-    std::complex<double>* DLF,
-    std::complex<double>* DF,
-    std::complex<double>* DUF,
-    std::complex<double>* DU2,
-    int64_t* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X );
 
-// -----------------------------------------------------------------------------
-int64_t gttrf(
-    int64_t n,
-    float* DL,
-    float* D,
-    float* DU,
-    float* DU2,
-    int64_t* ipiv );
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    size_t* host_work_size );
 
-int64_t gttrf(
-    int64_t n,
-    double* DL,
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
     double* D,
-    double* DU,
-    double* DU2,
-    int64_t* ipiv );
+    double* X,
+    void* host_work, size_t host_work_size );
 
-int64_t gttrf(
-    int64_t n,
-    std::complex<float>* DL,
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
     std::complex<float>* D,
-    std::complex<float>* DU,
-    std::complex<float>* DU2,
-    int64_t* ipiv );
+    std::complex<float>* X );
 
-int64_t gttrf(
-    int64_t n,
-    std::complex<double>* DL,
-    std::complex<double>* D,
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    size_t* host_work_size );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    void* host_work, size_t host_work_size );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X );
+
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    size_t* host_work_size );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub );
+
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    size_t* host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub );
+
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    size_t* host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub );
+
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    size_t* host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub );
+
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    size_t* host_work_size );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub );
+
+void ggrqf_work_size_bytes(
+    int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    size_t* host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub );
+
+void ggrqf_work_size_bytes(
+    int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    size_t* host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub );
+
+void ggrqf_work_size_bytes(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    size_t* host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    void* host_work, size_t host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub );
+
+void ggrqf_work_size_bytes(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    size_t* host_work_size );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq );
+
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    size_t* host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq );
+
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    size_t* host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq );
+
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    size_t* host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq );
+
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    size_t* host_work_size );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau );
+
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau );
+
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau );
+
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau );
+
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float const* DU2,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double const* DU2,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float> const* DU2,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double> const* DU2,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+int64_t gtrfs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float const* DLF,
+    float const* DF,
+    float const* DUF,
+    float const* DU2,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t gtrfs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double const* DLF,
+    double const* DF,
+    double const* DUF,
+    double const* DU2,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+int64_t gtrfs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float> const* DLF,
+    std::complex<float> const* DF,
+    std::complex<float> const* DUF,
+    std::complex<float> const* DU2,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t gtrfs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double> const* DLF,
+    std::complex<double> const* DF,
+    std::complex<double> const* DUF,
+    std::complex<double> const* DU2,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    float* DL,
+    float* D,
+    float* DU,
+    float* B, int64_t ldb );
+
+int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    double* DL,
+    double* D,
+    double* DU,
+    double* B, int64_t ldb );
+
+int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gtsv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL,
+    std::complex<double>* D,
+    std::complex<double>* DU,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t gtsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float* DLF,
+    float* DF,
+    float* DUF,
+    float* DU2,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t gtsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double* DLF,
+    double* DF,
+    double* DUF,
+    double* DU2,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+int64_t gtsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float>* DLF,
+    std::complex<float>* DF,
+    std::complex<float>* DUF,
+    std::complex<float>* DU2,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t gtsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double>* DLF,
+    std::complex<double>* DF,
+    std::complex<double>* DUF,
+    std::complex<double>* DU2,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t gttrf(
+    int64_t n,
+    float* DL,
+    float* D,
+    float* DU,
+    float* DU2,
+    int64_t* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    double* DL,
+    double* D,
+    double* DU,
+    double* DU2,
+    int64_t* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* DU2,
+    int64_t* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    std::complex<double>* DL,
+    std::complex<double>* D,
+    std::complex<double>* DU,
+    std::complex<double>* DU2,
+    int64_t* ipiv );
+
+#ifndef LAPACK_ILP64
+
+int64_t gttrf(
+    int64_t n,
+    float* DL,
+    float* D,
+    float* DU,
+    float* DU2,
+    lapack_int* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    double* DL,
+    double* D,
+    double* DU,
+    double* DU2,
+    lapack_int* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* DU2,
+    lapack_int* ipiv );
+
+int64_t gttrf(
+    int64_t n,
+    std::complex<double>* DL,
+    std::complex<double>* D,
     std::complex<double>* DU,
     std::complex<double>* DU2,
+    lapack_int* ipiv );
+
+#endif  // LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float const* DU2,
+    int64_t const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double const* DU2,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float> const* DU2,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double> const* DU2,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#ifndef LAPACK_ILP64
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float const* DU2,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double const* DU2,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float> const* DU2,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gttrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double> const* DU2,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void hbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void hbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float> const* BB, int64_t ldbb,
+    std::complex<float>* X, int64_t ldx );
+
+int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double> const* BB, int64_t ldbb,
+    std::complex<double>* X, int64_t ldx );
+
+// -----------------------------------------------------------------------------
+int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* D,
+    float* E,
+    std::complex<float>* Q, int64_t ldq );
+
+int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* D,
+    double* E,
+    std::complex<double>* Q, int64_t ldq );
+
+// -----------------------------------------------------------------------------
+int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+// hecon_rk wraps hecon_3
+int64_t hecon_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t hecon_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+int64_t heequb(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t heequb(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
+
+// -----------------------------------------------------------------------------
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+void heev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
+
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+void heev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
+
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+void heev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
+
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+void heev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
+
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    lapack::Workspace& ws );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    lapack::Workspace& ws );
+
+// -----------------------------------------------------------------------------
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+void heevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
+
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+void heevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
+
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void heevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void heevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
+
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
+
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
+
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void heevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void heevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+void hegv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size );
+
+int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+void hegv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size );
+
+int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+void hegv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+void hegv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+void hegvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+void hegvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void hegvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+void hegvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
+
+int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
+
+// -----------------------------------------------------------------------------
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+#ifndef LAPACK_ILP64
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+#endif  // LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+void hesvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size );
+
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size );
+
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+void hesvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size );
+
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void hesv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void hesv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void hesv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void hesv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
+
+void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
+
+// -----------------------------------------------------------------------------
+int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau );
+
+void hetrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau );
+
+void hetrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2 );
+
+void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    size_t* host_work_size );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2 );
+
+void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    size_t* host_work_size );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+#ifndef LAPACK_ILP64
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv );
+
+void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv );
+
+void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
+
+#endif  // LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv );
+
+void hetrf_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv );
+
+void hetrf_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv );
+
+int64_t hetri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv );
+
+void hetri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv );
+
+void hetri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+// hetri_rk wraps hetri_3
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv );
+
+void hetri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv );
+
+void hetri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#ifndef LAPACK_ILP64
+
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#endif  // LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs2(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+// hetrs_rk wraps hetrs_3
+int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hetrs_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+void hfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
+    std::complex<float> const* A, int64_t lda, float beta,
+    std::complex<float>* C );
+
+void hfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
+    std::complex<double> const* A, int64_t lda, double beta,
+    std::complex<double>* C );
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz );
+
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz );
+
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz );
+
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz );
+
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hpevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hpevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float> const* BP );
+
+int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double> const* BP );
+
+// -----------------------------------------------------------------------------
+int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float> const* AFP,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double> const* AFP,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float>* AFP,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double>* AFP,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* D,
+    float* E,
+    std::complex<float>* tau );
+
+int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* D,
+    double* E,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t* ipiv );
+
+int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
     int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
-int64_t gttrs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    float const* DL,
-    float const* D,
-    float const* DU,
-    float const* DU2,
-    int64_t const* ipiv,
-    float* B, int64_t ldb );
+// -----------------------------------------------------------------------------
+int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t const* ipiv );
+
+int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    int64_t const* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz );
+
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz );
+
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz );
+
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz );
+
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+// real types have no-op dummy inline functions, to facilitate templating
+inline void lacgv(
+    int64_t n,
+    float* X, int64_t incx )
+{}
+
+inline void lacgv(
+    int64_t n,
+    double* X, int64_t incx )
+{}
+
+void lacgv(
+    int64_t n,
+    std::complex<float>* X, int64_t incx );
+
+void lacgv(
+    int64_t n,
+    std::complex<double>* X, int64_t incx );
+
+// -----------------------------------------------------------------------------
+void lacp2(
+    lapack::Uplo uplo, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+void lacp2(
+    lapack::Uplo uplo, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    lapack::Method method );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    lapack::Method method );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    lapack::Method method );
+
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+int64_t laed4(
+    int64_t n, int64_t i,
+    float const* d,
+    float const* z,
+    float* delta,
+    float rho,
+    float* lambda );
+
+int64_t laed4(
+    int64_t n, int64_t i,
+    double const* d,
+    double const* z,
+    double* delta,
+    double rho,
+    double* lambda );
+
+// -----------------------------------------------------------------------------
+int64_t lag2b(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::bfloat16* H, int64_t ldh );
+
+int64_t lag2b(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::bfloat16* H, int64_t ldh );
+
+// -----------------------------------------------------------------------------
+int64_t lag2c(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<float>* SA, int64_t ldsa );
+
+// -----------------------------------------------------------------------------
+int64_t lag2d(
+    int64_t m, int64_t n,
+    float const* SA, int64_t ldsa,
+    double* A, int64_t lda );
+
+int64_t lag2d(
+    int64_t m, int64_t n,
+    lapack::float16 const* H, int64_t ldh,
+    double* A, int64_t lda );
+
+int64_t lag2d(
+    int64_t m, int64_t n,
+    lapack::bfloat16 const* H, int64_t ldh,
+    double* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t lag2h(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::float16* H, int64_t ldh );
+
+int64_t lag2h(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::float16* H, int64_t ldh );
+
+// -----------------------------------------------------------------------------
+int64_t lag2s(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    float* SA, int64_t ldsa );
+
+int64_t lag2s(
+    int64_t m, int64_t n,
+    lapack::float16 const* H, int64_t ldh,
+    float* A, int64_t lda );
+
+int64_t lag2s(
+    int64_t m, int64_t n,
+    lapack::bfloat16 const* H, int64_t ldh,
+    float* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t lag2z(
+    int64_t m, int64_t n,
+    std::complex<float> const* SA, int64_t ldsa,
+    std::complex<double>* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t lagge(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float const* D,
+    float* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagge(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double const* D,
+    double* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagge(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float const* D,
+    std::complex<float>* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagge(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double const* D,
+    std::complex<double>* A, int64_t lda,
+    int64_t* iseed );
+
+// -----------------------------------------------------------------------------
+int64_t laghe(
+    int64_t n, int64_t k,
+    float const* D,
+    std::complex<float>* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t laghe(
+    int64_t n, int64_t k,
+    double const* D,
+    std::complex<double>* A, int64_t lda,
+    int64_t* iseed );
+
+// -----------------------------------------------------------------------------
+int64_t lagsy(
+    int64_t n, int64_t k,
+    float const* D,
+    float* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagsy(
+    int64_t n, int64_t k,
+    double const* D,
+    double* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagsy(
+    int64_t n, int64_t k,
+    float const* D,
+    std::complex<float>* A, int64_t lda,
+    int64_t* iseed );
+
+int64_t lagsy(
+    int64_t n, int64_t k,
+    double const* D,
+    std::complex<double>* A, int64_t lda,
+    int64_t* iseed );
+
+// -----------------------------------------------------------------------------
+float langb(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    float const* AB, int64_t ldab );
+
+double langb(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    double const* AB, int64_t ldab );
+
+float langb(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float> const* AB, int64_t ldab );
+
+double langb(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double> const* AB, int64_t ldab );
+
+// -----------------------------------------------------------------------------
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    float const* A, int64_t lda );
+
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    double const* A, int64_t lda );
+
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda );
+
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda );
+
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method );
+
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method );
+
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method );
+
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+float langt(
+    lapack::Norm norm, int64_t n,
+    float const* DL,
+    float const* D,
+    float const* DU );
+
+double langt(
+    lapack::Norm norm, int64_t n,
+    double const* DL,
+    double const* D,
+    double const* DU );
+
+float langt(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU );
+
+double langt(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU );
+
+// -----------------------------------------------------------------------------
+float lanhb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab );
+
+double lanhb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab );
+
+// -----------------------------------------------------------------------------
+float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda );
+
+double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda );
+
+float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method );
+
+double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+float lanhp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP );
+
+double lanhp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP );
+
+// -----------------------------------------------------------------------------
+float lanhs(
+    lapack::Norm norm, int64_t n,
+    float const* A, int64_t lda );
+
+double lanhs(
+    lapack::Norm norm, int64_t n,
+    double const* A, int64_t lda );
+
+float lanhs(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* A, int64_t lda );
+
+double lanhs(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+float lanht(
+    lapack::Norm norm, int64_t n,
+    float const* D,
+    std::complex<float> const* E );
+
+double lanht(
+    lapack::Norm norm, int64_t n,
+    double const* D,
+    std::complex<double> const* E );
+
+// -----------------------------------------------------------------------------
+float lansb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab );
+
+// lanhb alias to lansb
+/// @ingroup norm
+inline float lanhb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab )
+{
+    return lansb( norm, uplo, n, kd, AB, ldab );
+}
+
+double lansb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab );
+
+// lanhb alias to lansb
+/// @ingroup norm
+inline double lanhb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab )
+{
+    return lansb( norm, uplo, n, kd, AB, ldab );
+}
+
+float lansb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab );
+
+double lansb(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab );
+
+// -----------------------------------------------------------------------------
+float lansp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* AP );
+
+// lanhp alias to lansp
+/// @ingroup norm
+inline float lanhp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* AP )
+{
+    return lansp( norm, uplo, n, AP );
+}
+
+double lansp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* AP );
+
+// lanhp alias to lansp
+/// @ingroup norm
+inline double lanhp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* AP )
+{
+    return lansp( norm, uplo, n, AP );
+}
+
+float lansp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP );
+
+double lansp(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP );
+
+// -----------------------------------------------------------------------------
+float lanst(
+    lapack::Norm norm, int64_t n,
+    float const* D,
+    float const* E );
+
+// lanht alias to lanst
+/// @ingroup norm
+inline float lanht(
+    lapack::Norm norm, int64_t n,
+    float const* D,
+    float const* E )
+{
+    return lanst( norm, n, D, E );
+}
+
+double lanst(
+    lapack::Norm norm, int64_t n,
+    double const* D,
+    double const* E );
+
+// lanht alias to lanst
+/// @ingroup norm
+inline double lanht(
+    lapack::Norm norm, int64_t n,
+    double const* D,
+    double const* E )
+{
+    return lanst( norm, n, D, E );
+}
+
+// -----------------------------------------------------------------------------
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda );
+
+// lanhe alias to lansy
+/// @ingroup norm
+inline float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda )
+{
+    return lansy( norm, uplo, n, A, lda );
+}
+
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda );
+
+// lanhe alias to lansy
+/// @ingroup norm
+inline double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda )
+{
+    return lansy( norm, uplo, n, A, lda );
+}
+
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda );
+
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda );
+
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method );
+
+// lanhe alias to lansy
+/// @ingroup norm
+inline float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method )
+{
+    return lansy( norm, uplo, n, A, lda, method );
+}
+
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method );
+
+// lanhe alias to lansy
+/// @ingroup norm
+inline double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method )
+{
+    return lansy( norm, uplo, n, A, lda, method );
+}
+
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method );
+
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+float lantb(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
+    float const* AB, int64_t ldab );
+
+double lantb(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
+    double const* AB, int64_t ldab );
+
+float lantb(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
+    std::complex<float> const* AB, int64_t ldab );
+
+double lantb(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
+    std::complex<double> const* AB, int64_t ldab );
+
+// -----------------------------------------------------------------------------
+float lantp(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    float const* AP );
+
+double lantp(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    double const* AP );
+
+float lantp(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<float> const* AP );
+
+double lantp(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
+    std::complex<double> const* AP );
+
+// -----------------------------------------------------------------------------
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    float const* A, int64_t lda );
+
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    double const* A, int64_t lda );
+
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda );
+
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda );
+
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method );
+
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method );
+
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method );
+
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+void lapmr(
+    bool forwrd, int64_t m, int64_t n,
+    float* X, int64_t ldx,
+    int64_t* K );
+
+void lapmr(
+    bool forwrd, int64_t m, int64_t n,
+    double* X, int64_t ldx,
+    int64_t* K );
+
+void lapmr(
+    bool forwrd, int64_t m, int64_t n,
+    std::complex<float>* X, int64_t ldx,
+    int64_t* K );
+
+void lapmr(
+    bool forwrd, int64_t m, int64_t n,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* K );
+
+// -----------------------------------------------------------------------------
+void lapmt(
+    bool forwrd, int64_t m, int64_t n,
+    float* X, int64_t ldx,
+    int64_t* K );
+
+void lapmt(
+    bool forwrd, int64_t m, int64_t n,
+    double* X, int64_t ldx,
+    int64_t* K );
+
+void lapmt(
+    bool forwrd, int64_t m, int64_t n,
+    std::complex<float>* X, int64_t ldx,
+    int64_t* K );
+
+void lapmt(
+    bool forwrd, int64_t m, int64_t n,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* K );
+
+// -----------------------------------------------------------------------------
+float lapy2(
+    float x, float y );
+
+double lapy2(
+    double x, double y );
+
+// -----------------------------------------------------------------------------
+float lapy3(
+    float x, float y, float z );
+
+double lapy3(
+    double x, double y, double z );
+
+// -----------------------------------------------------------------------------
+void larf(
+    lapack::Side side, int64_t m, int64_t n,
+    float const* V, int64_t incv, float tau,
+    float* C, int64_t ldc );
+
+void larf(
+    lapack::Side side, int64_t m, int64_t n,
+    double const* V, int64_t incv, double tau,
+    double* C, int64_t ldc );
+
+void larf(
+    lapack::Side side, int64_t m, int64_t n,
+    std::complex<float> const* V, int64_t incv, std::complex<float> tau,
+    std::complex<float>* C, int64_t ldc );
+
+void larf(
+    lapack::Side side, int64_t m, int64_t n,
+    std::complex<double> const* V, int64_t incv, std::complex<double> tau,
+    std::complex<double>* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+void larfb(
+    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
+    float const* V, int64_t ldv,
+    float const* T, int64_t ldt,
+    float* C, int64_t ldc );
+
+void larfb(
+    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
+    double const* V, int64_t ldv,
+    double const* T, int64_t ldt,
+    double* C, int64_t ldc );
+
+void larfb(
+    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* V, int64_t ldv,
+    std::complex<float> const* T, int64_t ldt,
+    std::complex<float>* C, int64_t ldc );
+
+void larfb(
+    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* V, int64_t ldv,
+    std::complex<double> const* T, int64_t ldt,
+    std::complex<double>* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+void larfg(
+    int64_t n,
+    float* alpha,
+    float* X, int64_t incx,
+    float* tau );
+
+void larfg(
+    int64_t n,
+    double* alpha,
+    double* X, int64_t incx,
+    double* tau );
+
+void larfg(
+    int64_t n,
+    std::complex<float>* alpha,
+    std::complex<float>* X, int64_t incx,
+    std::complex<float>* tau );
+
+void larfg(
+    int64_t n,
+    std::complex<double>* alpha,
+    std::complex<double>* X, int64_t incx,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+void larfgp(
+    int64_t n,
+    float* alpha,
+    float* X, int64_t incx,
+    float* tau );
+
+void larfgp(
+    int64_t n,
+    double* alpha,
+    double* X, int64_t incx,
+    double* tau );
+
+void larfgp(
+    int64_t n,
+    std::complex<float>* alpha,
+    std::complex<float>* X, int64_t incx,
+    std::complex<float>* tau );
+
+void larfgp(
+    int64_t n,
+    std::complex<double>* alpha,
+    std::complex<double>* X, int64_t incx,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+void larft(
+    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
+    float const* V, int64_t ldv,
+    float const* tau,
+    float* T, int64_t ldt );
+
+void larft(
+    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
+    double const* V, int64_t ldv,
+    double const* tau,
+    double* T, int64_t ldt );
+
+void larft(
+    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
+    std::complex<float> const* V, int64_t ldv,
+    std::complex<float> const* tau,
+    std::complex<float>* T, int64_t ldt );
+
+void larft(
+    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
+    std::complex<double> const* V, int64_t ldv,
+    std::complex<double> const* tau,
+    std::complex<double>* T, int64_t ldt );
+
+// -----------------------------------------------------------------------------
+void larfx(
+    lapack::Side side, int64_t m, int64_t n,
+    float const* V, float tau,
+    float* C, int64_t ldc );
+
+void larfx(
+    lapack::Side side, int64_t m, int64_t n,
+    double const* V, double tau,
+    double* C, int64_t ldc );
+
+void larfx(
+    lapack::Side side, int64_t m, int64_t n,
+    std::complex<float> const* V, std::complex<float> tau,
+    std::complex<float>* C, int64_t ldc );
+
+void larfx(
+    lapack::Side side, int64_t m, int64_t n,
+    std::complex<double> const* V, std::complex<double> tau,
+    std::complex<double>* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+void larfy(
+    lapack::Uplo uplo, int64_t n,
+    float const* V, int64_t incv, float tau,
+    float* C, int64_t ldc );
+
+void larfy(
+    lapack::Uplo uplo, int64_t n,
+    double const* V, int64_t incv, double tau,
+    double* C, int64_t ldc );
+
+void larfy(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* V, int64_t incv, std::complex<float> tau,
+    std::complex<float>* C, int64_t ldc );
+
+void larfy(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* V, int64_t incv, std::complex<double> tau,
+    std::complex<double>* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+void larnv(
+    int64_t idist,
+    int64_t* iseed, int64_t n,
+    float* X );
+
+void larnv(
+    int64_t idist,
+    int64_t* iseed, int64_t n,
+    double* X );
+
+void larnv(
+    int64_t idist,
+    int64_t* iseed, int64_t n,
+    std::complex<float>* X );
+
+void larnv(
+    int64_t idist,
+    int64_t* iseed, int64_t n,
+    std::complex<double>* X );
+
+// -----------------------------------------------------------------------------
+void lartg(
+    float f, float g,
+    float* cs,
+    float* sn,
+    float* r );
+
+void lartg(
+    double f, double g,
+    double* cs,
+    double* sn,
+    double* r );
+
+void lartg(
+    std::complex<float> f, std::complex<float> g,
+    float* cs,
+    std::complex<float>* sn,
+    std::complex<float>* r );
+
+void lartg(
+    std::complex<double> f, std::complex<double> g,
+    double* cs,
+    std::complex<double>* sn,
+    std::complex<double>* r );
+
+// -----------------------------------------------------------------------------
+void lartgp(
+    float f, float g,
+    float* cs,
+    float* sn,
+    float* r );
+
+void lartgp(
+    double f, double g,
+    double* cs,
+    double* sn,
+    double* r );
+
+// -----------------------------------------------------------------------------
+void lartgs(
+    float x, float y, float sigma,
+    float* cs,
+    float* sn );
+
+void lartgs(
+    double x, double y, double sigma,
+    double* cs,
+    double* sn );
+
+// -----------------------------------------------------------------------------
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
+    float* A, int64_t lda );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
+    double* A, int64_t lda );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack::Method method );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack::Method method );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method );
+
+int64_t lascl(
+    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float offdiag, float diag,
+    float* A, int64_t lda );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double offdiag, double diag,
+    double* A, int64_t lda );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> offdiag, std::complex<float> diag,
+    std::complex<float>* A, int64_t lda );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> offdiag, std::complex<double> diag,
+    std::complex<double>* A, int64_t lda );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float offdiag, float diag,
+    float* A, int64_t lda,
+    lapack::Method method );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double offdiag, double diag,
+    double* A, int64_t lda,
+    lapack::Method method );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> offdiag, std::complex<float> diag,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method );
+
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> offdiag, std::complex<double> diag,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method );
+
+// -----------------------------------------------------------------------------
+void lassq(
+    int64_t n,
+    float const* X, int64_t incx,
+    float* scale,
+    float* sumsq );
+
+void lassq(
+    int64_t n,
+    double const* X, int64_t incx,
+    double* scale,
+    double* sumsq );
+
+void lassq(
+    int64_t n,
+    std::complex<float> const* X, int64_t incx,
+    float* scale,
+    float* sumsq );
+
+void lassq(
+    int64_t n,
+    std::complex<double> const* X, int64_t incx,
+    double* scale,
+    double* sumsq );
+
+// -----------------------------------------------------------------------------
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
+    int64_t n,
+    double* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
+    int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+void laswp(
+    int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
+    int64_t const* ipiv, int64_t incx );
+
+// -----------------------------------------------------------------------------
+int64_t lauum(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+int64_t lauum(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+int64_t lauum(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t lauum(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t opgtr(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    float const* tau,
+    float* Q, int64_t ldq );
+
+// upgtr alias to opgtr
+inline int64_t upgtr(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    float const* tau,
+    float* Q, int64_t ldq )
+{
+    return opgtr( uplo, n, AP, tau, Q, ldq );
+}
+
+int64_t opgtr(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    double const* tau,
+    double* Q, int64_t ldq );
+
+// upgtr alias to opgtr
+inline int64_t upgtr(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    double const* tau,
+    double* Q, int64_t ldq )
+{
+    return opgtr( uplo, n, AP, tau, Q, ldq );
+}
+
+// -----------------------------------------------------------------------------
+int64_t opmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* AP,
+    float const* tau,
+    float* C, int64_t ldc );
+
+// upmtr alias to opmtr
+inline int64_t upmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* AP,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return opmtr( side, uplo, trans, m, n, AP, tau, C, ldc );
+}
+
+int64_t opmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* AP,
+    double const* tau,
+    double* C, int64_t ldc );
+
+// upmtr alias to opmtr
+inline int64_t upmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* AP,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return opmtr( side, uplo, trans, m, n, AP, tau, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t );
+
+void orcsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    size_t* host_work_size );
+
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size );
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t );
+}
+
+// uncsd2by1 alias to orcsd2by1
+inline void uncsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    size_t* host_work_size )
+{
+    orcsd2by1_work_size_bytes( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                               host_work_size );
+}
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                      host_work, host_work_size );
+}
+
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t );
+
+void orcsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    size_t* host_work_size );
+
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size );
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t );
+}
+
+// uncsd2by1 alias to orcsd2by1
+inline void uncsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    size_t* host_work_size )
+{
+    orcsd2by1_work_size_bytes( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                               host_work_size );
+}
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                      host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orgbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgbr( vect, m, n, k, A, lda, tau );
+}
+
+// ungbr alias to orgbr
+inline void ungbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orgbr_work_size_bytes( vect, m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgbr( vect, m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orgbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orgbr( vect, m, n, k, A, lda, tau );
+}
+
+// ungbr alias to orgbr
+inline void ungbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orgbr_work_size_bytes( vect, m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgbr( vect, m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orghr( n, ilo, ihi, A, lda, tau );
+}
+
+// unghr alias to orghr
+inline void unghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orghr_work_size_bytes( n, ilo, ihi, A, lda, tau, host_work_size );
+}
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orghr( n, ilo, ihi, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orghr( n, ilo, ihi, A, lda, tau );
+}
+
+// unghr alias to orghr
+inline void unghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orghr_work_size_bytes( n, ilo, ihi, A, lda, tau, host_work_size );
+}
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orghr( n, ilo, ihi, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orglq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orglq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orglq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// unglq alias to orglq
+inline int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orglq( m, n, k, A, lda, tau );
+}
+
+// unglq alias to orglq
+inline void unglq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orglq_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// unglq alias to orglq
+inline int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orglq( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orglq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orglq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orglq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// unglq alias to orglq
+inline int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orglq( m, n, k, A, lda, tau );
+}
+
+// unglq alias to orglq
+inline void unglq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orglq_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// unglq alias to orglq
+inline int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orglq( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orgql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgql( m, n, k, A, lda, tau );
+}
+
+// ungql alias to orgql
+inline void ungql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orgql_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgql( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orgql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orgql( m, n, k, A, lda, tau );
+}
+
+// ungql alias to orgql
+inline void ungql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orgql_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgql( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orgqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgqr( m, n, k, A, lda, tau );
+}
+
+// ungqr alias to orgqr
+inline void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orgqr_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgqr( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orgqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orgqr( m, n, k, A, lda, tau );
+}
+
+// ungqr alias to orgqr
+inline void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orgqr_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgqr( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orgrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgrq( m, n, k, A, lda, tau );
+}
+
+// ungrq alias to orgrq
+inline void ungrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orgrq_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgrq( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orgrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orgrq( m, n, k, A, lda, tau );
+}
+
+// ungrq alias to orgrq
+inline void ungrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orgrq_work_size_bytes( m, n, k, A, lda, tau, host_work_size );
+}
+
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgrq( m, n, k, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau );
+
+void orgtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size );
+
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgtr( uplo, n, A, lda, tau );
+}
+
+// ungtr alias to orgtr
+inline void ungtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    orgtr_work_size_bytes( uplo, n, A, lda, tau, host_work_size );
+}
+
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgtr( uplo, n, A, lda, tau, host_work, host_work_size );
+}
+
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau );
+
+void orgtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size );
+
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size );
+
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return orgtr( uplo, n, A, lda, tau );
+}
+
+// ungtr alias to orgtr
+inline void ungtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    orgtr_work_size_bytes( uplo, n, A, lda, tau, host_work_size );
+}
+
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    return orgtr( uplo, n, A, lda, tau, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+void ormbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+}
+
+// unmbr alias to ormbr
+inline void unmbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormbr_work_size_bytes( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
+
+void ormbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+}
+
+// unmbr alias to ormbr
+inline void unmbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormbr_work_size_bytes( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+void ormhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+}
+
+// unmhr alias to ormhr
+inline void unmhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormhr_work_size_bytes( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
+
+void ormhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+}
+
+// unmhr alias to ormhr
+inline void unmhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormhr_work_size_bytes( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+void ormlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
+
+// unmlq alias to ormlq
+inline void unmlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormlq_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
+
+void ormlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
+
+// unmlq alias to ormlq
+inline void unmlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormlq_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+void ormql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t gttrs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    double const* DL,
-    double const* D,
-    double const* DU,
-    double const* DU2,
-    int64_t const* ipiv,
-    double* B, int64_t ldb );
+// unmql alias to ormql
+inline void unmql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormql_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t gttrs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<float> const* DL,
-    std::complex<float> const* D,
-    std::complex<float> const* DU,
-    std::complex<float> const* DU2,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
-int64_t gttrs(
-    lapack::Op trans, int64_t n, int64_t nrhs,
-    std::complex<double> const* DL,
-    std::complex<double> const* D,
-    std::complex<double> const* DU,
-    std::complex<double> const* DU2,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-// -----------------------------------------------------------------------------
-int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+void ormql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
 
-int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+// unmql alias to ormql
+inline void unmql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormql_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
+
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+void ormqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+// unmqr alias to ormqr
+inline void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormqr_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+void ormqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float> const* BB, int64_t ldbb,
-    std::complex<float>* X, int64_t ldx );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double> const* BB, int64_t ldbb,
-    std::complex<double>* X, int64_t ldx );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* BB, int64_t ldbb,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+// unmqr alias to ormqr
+inline void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormqr_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* BB, int64_t ldbb,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* BB, int64_t ldbb,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* BB, int64_t ldbb,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+void ormrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* BB, int64_t ldbb,
-    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* BB, int64_t ldbb,
-    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab,
-    float* D,
-    float* E,
-    std::complex<float>* Q, int64_t ldq );
+// unmrq alias to ormrq
+inline void unmrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormrq_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab,
-    double* D,
-    double* E,
-    std::complex<double>* Q, int64_t ldq );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+void ormrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-// hecon_rk wraps hecon_3
-int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+// unmrq alias to ormrq
+inline void unmrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormrq_work_size_bytes( side, trans, m, n, k, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* W );
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* W );
+void ormrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* W );
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* W );
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* W );
+// unmrz alias to ormrz
+inline void unmrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormrz_work_size_bytes( side, trans, m, n, k, l, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* W );
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* W );
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* W );
+void ormrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* isuppz );
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz );
+// unmrz alias to ormrz
+inline void unmrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormrz_work_size_bytes( side, trans, m, n, k, l, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* isuppz );
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+void ormtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+// unmtr alias to ormtr
+inline void unmtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormtr_work_size_bytes( side, uplo, trans, m, n, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    float* W );
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    double* W );
+void ormtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    float* W );
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
 
-int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    double* W );
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb,
-    float* W );
+// unmtr alias to ormtr
+inline void unmtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    ormtr_work_size_bytes( side, uplo, trans, m, n, A, lda, tau, C, ldc,
+                           host_work_size );
+}
 
-int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb,
-    double* W );
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab, float anorm,
+    float* rcond );
 
-int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab, double anorm,
+    double* rcond );
 
-// -----------------------------------------------------------------------------
-int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab, float anorm,
+    float* rcond );
 
-int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab,
     float* S,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+    float* scond,
+    float* amax );
 
-int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab,
     double* S,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+    double* scond,
+    double* amax );
 
-// -----------------------------------------------------------------------------
-int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float>* AF, int64_t ldaf,
-    int64_t* ipiv,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float const* AFB, int64_t ldafb,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double const* AFB, int64_t ldafb,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    std::complex<float> const* AFB, int64_t ldafb,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr );
 
-int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double>* AF, int64_t ldaf,
-    int64_t* ipiv,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    std::complex<double> const* AFB, int64_t ldafb,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
-
-int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
-
-// -----------------------------------------------------------------------------
-int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
-
-int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
-
-// -----------------------------------------------------------------------------
-int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
-
-int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
-
-// -----------------------------------------------------------------------------
-void heswapr(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
-
-void heswapr(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
-
-// -----------------------------------------------------------------------------
-int64_t hetrd(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* D,
-    float* E,
-    std::complex<float>* tau );
-
-int64_t hetrd(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* D,
-    double* E,
-    std::complex<double>* tau );
-
-// -----------------------------------------------------------------------------
-int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* D,
-    float* E,
-    std::complex<float>* tau,
-    std::complex<float>* hous2, int64_t lhous2 );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab );
 
-int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    double* D,
-    double* E,
-    std::complex<double>* tau,
-    std::complex<double>* hous2, int64_t lhous2 );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab );
 
-// -----------------------------------------------------------------------------
-int64_t hetrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab );
 
-int64_t hetrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab );
 
 // -----------------------------------------------------------------------------
-int64_t hetrf_aa(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* B, int64_t ldb );
 
-int64_t hetrf_aa(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t hetrf_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
-    int64_t* ipiv );
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t hetrf_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
-    int64_t* ipiv );
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t hetrf_rook(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* AFB, int64_t ldafb,
+    lapack::Equed* equed,
+    float* S,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-int64_t hetrf_rook(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* AFB, int64_t ldafb,
+    lapack::Equed* equed,
+    double* S,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-// -----------------------------------------------------------------------------
-int64_t hetri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv );
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* AFB, int64_t ldafb,
+    lapack::Equed* equed,
+    float* S,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-int64_t hetri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t const* ipiv );
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* AFB, int64_t ldafb,
+    lapack::Equed* equed,
+    double* S,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t hetri2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab );
 
-int64_t hetri2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t const* ipiv );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab );
 
-// -----------------------------------------------------------------------------
-// hetri_rk wraps hetri_3
-int64_t hetri_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab );
 
-int64_t hetri_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab );
 
 // -----------------------------------------------------------------------------
-int64_t hetrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float* B, int64_t ldb );
 
-int64_t hetrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t hetrs2(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv,
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
     std::complex<float>* B, int64_t ldb );
 
-int64_t hetrs2(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv,
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t hetrs_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    float* A );
 
-int64_t hetrs_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    double* A );
 
-// -----------------------------------------------------------------------------
-// hetrs_rk wraps hetrs_3
-int64_t hetrs_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A );
 
-int64_t hetrs_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A );
 
 // -----------------------------------------------------------------------------
-int64_t hetrs_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    float* A );
 
-int64_t hetrs_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    double* A );
 
-// -----------------------------------------------------------------------------
-void hfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
-    std::complex<float> const* A, int64_t lda, float beta,
-    std::complex<float>* C );
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A );
 
-void hfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
-    std::complex<double> const* A, int64_t lda, double beta,
-    std::complex<double>* C );
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A );
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
-    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    float* H, int64_t ldh,
-    float* T, int64_t ldt,
-    std::complex<float>* alpha,
-    float* beta,
-    float* Q, int64_t ldq,
-    float* Z, int64_t ldz );
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A,
+    float* B, int64_t ldb );
 
-int64_t hgeqz(
-    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    double* H, int64_t ldh,
-    double* T, int64_t ldt,
-    std::complex<double>* alpha,
-    double* beta,
-    double* Q, int64_t ldq,
-    double* Z, int64_t ldz );
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A,
+    double* B, int64_t ldb );
 
-int64_t hgeqz(
-    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<float>* H, int64_t ldh,
-    std::complex<float>* T, int64_t ldt,
-    std::complex<float>* alpha,
-    std::complex<float>* beta,
-    std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* Z, int64_t ldz );
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t hgeqz(
-    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<double>* H, int64_t ldh,
-    std::complex<double>* T, int64_t ldt,
-    std::complex<double>* alpha,
-    std::complex<double>* beta,
-    std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* Z, int64_t ldz );
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t hpcon(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP,
-    int64_t const* ipiv, float anorm,
+    float const* A, int64_t lda, float anorm,
     float* rcond );
 
-int64_t hpcon(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP,
-    int64_t const* ipiv, double anorm,
+    double const* A, int64_t lda, double anorm,
     double* rcond );
 
-// -----------------------------------------------------------------------------
-int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
-
-int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
-
-// -----------------------------------------------------------------------------
-int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda, float anorm,
+    float* rcond );
 
-int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+int64_t pocon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t poequ(
+    int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t poequ(
+    int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
-// -----------------------------------------------------------------------------
-int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    std::complex<float> const* BP );
+int64_t poequ(
+    int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    std::complex<double> const* BP );
+int64_t poequ(
+    int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t hpgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    std::complex<float>* BP,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t hpgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    std::complex<double>* BP,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
-// -----------------------------------------------------------------------------
-int64_t hpgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    std::complex<float>* BP,
-    float* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t hpgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    std::complex<double>* BP,
-    double* W,
-    std::complex<double>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t hpgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    std::complex<float>* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t porfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-int64_t hpgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    std::complex<double>* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t porfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-// -----------------------------------------------------------------------------
-int64_t hprfs(
+int64_t porfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float> const* AFP,
-    int64_t const* ipiv,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
     float* ferr,
     float* berr );
 
-int64_t hprfs(
+int64_t porfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double> const* AFP,
-    int64_t const* ipiv,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t hpsv(
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    float* S,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
+
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    double* S,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
+
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    float* S,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
+
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    double* S,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
+
+// -----------------------------------------------------------------------------
+int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    int64_t* ipiv,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
-int64_t hpsv(
+int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    int64_t* ipiv,
+    std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t hpsvx(
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
+// -----------------------------------------------------------------------------
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    float* S,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    double* S,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+int64_t posvx(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float>* AFP,
-    int64_t* ipiv,
-    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    float* S,
+    std::complex<float>* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
     float* rcond,
     float* ferr,
     float* berr );
 
-int64_t hpsvx(
+int64_t posvx(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double>* AFP,
-    int64_t* ipiv,
-    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    double* S,
+    std::complex<double>* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
     double* rcond,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t hptrd(
+int64_t potf2(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    float* D,
-    float* E,
-    std::complex<float>* tau );
+    float* A, int64_t lda );
 
-int64_t hptrd(
+int64_t potf2(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    double* D,
-    double* E,
-    std::complex<double>* tau );
+    double* A, int64_t lda );
 
-// -----------------------------------------------------------------------------
-int64_t hptrf(
+int64_t potf2(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t* ipiv );
+    std::complex<float>* A, int64_t lda );
 
-int64_t hptrf(
+int64_t potf2(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t* ipiv );
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-int64_t hptri(
+int64_t potrf(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t const* ipiv );
+    float* A, int64_t lda );
 
-int64_t hptri(
+int64_t potrf(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t const* ipiv );
+    double* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack::Method method );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack::Method method );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method );
+
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method );
 
 // -----------------------------------------------------------------------------
-int64_t hptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
 
-int64_t hptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
 
 // -----------------------------------------------------------------------------
-int64_t hseqr(
-    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    float* H, int64_t ldh,
-    std::complex<float>* W,
-    float* Z, int64_t ldz );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
 
-int64_t hseqr(
-    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    double* H, int64_t ldh,
-    std::complex<double>* W,
-    double* Z, int64_t ldz );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
 
-int64_t hseqr(
-    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<float>* H, int64_t ldh,
-    std::complex<float>* W,
-    std::complex<float>* Z, int64_t ldz );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
 
-int64_t hseqr(
-    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    std::complex<double>* H, int64_t ldh,
-    std::complex<double>* W,
-    std::complex<double>* Z, int64_t ldz );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
 
 // -----------------------------------------------------------------------------
-// real types have no-op dummy inline functions, to facilitate templating
-inline void lacgv(
-    int64_t n,
-    float* X, int64_t incx )
-{}
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-inline void lacgv(
-    int64_t n,
-    double* X, int64_t incx )
-{}
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-void lacgv(
-    int64_t n,
-    std::complex<float>* X, int64_t incx );
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-void lacgv(
-    int64_t n,
-    std::complex<double>* X, int64_t incx );
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-void lacp2(
-    lapack::Uplo uplo, int64_t m, int64_t n,
-    float const* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-void lacp2(
-    lapack::Uplo uplo, int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-void lacpy(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* A, int64_t lda,
     float* B, int64_t ldb );
 
-void lacpy(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* A, int64_t lda,
     double* B, int64_t ldb );
 
-void lacpy(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
-void lacpy(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t laed4(
-    int64_t n, int64_t i,
-    float const* d,
-    float const* z,
-    float* delta,
-    float rho,
-    float* lambda );
+int64_t ppcon(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP, float anorm,
+    float* rcond );
 
-int64_t laed4(
-    int64_t n, int64_t i,
-    double const* d,
-    double const* z,
-    double* delta,
-    double rho,
-    double* lambda );
+int64_t ppcon(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP, double anorm,
+    double* rcond );
 
-// -----------------------------------------------------------------------------
-int64_t lag2c(
-    int64_t m, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<float>* SA, int64_t ldsa );
+int64_t ppcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP, float anorm,
+    float* rcond );
+
+int64_t ppcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t lag2d(
-    int64_t m, int64_t n,
-    float const* SA, int64_t ldsa,
-    double* A, int64_t lda );
+int64_t ppequ(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t ppequ(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    double* S,
+    double* scond,
+    double* amax );
+
+int64_t ppequ(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t ppequ(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t lag2s(
-    int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    float* SA, int64_t ldsa );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-// -----------------------------------------------------------------------------
-int64_t lag2z(
-    int64_t m, int64_t n,
-    std::complex<float> const* SA, int64_t ldsa,
-    std::complex<double>* A, int64_t lda );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-// -----------------------------------------------------------------------------
-int64_t lagge(
-    int64_t m, int64_t n, int64_t kl, int64_t ku,
-    float const* D,
-    float* A, int64_t lda,
-    int64_t* iseed );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float> const* AFP,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-int64_t lagge(
-    int64_t m, int64_t n, int64_t kl, int64_t ku,
-    double const* D,
-    double* A, int64_t lda,
-    int64_t* iseed );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double> const* AFP,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-int64_t lagge(
-    int64_t m, int64_t n, int64_t kl, int64_t ku,
-    float const* D,
-    std::complex<float>* A, int64_t lda,
-    int64_t* iseed );
+// -----------------------------------------------------------------------------
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    float* B, int64_t ldb );
 
-int64_t lagge(
-    int64_t m, int64_t n, int64_t kl, int64_t ku,
-    double const* D,
-    std::complex<double>* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    double* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t laghe(
-    int64_t n, int64_t k,
-    float const* D,
-    std::complex<float>* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t laghe(
-    int64_t n, int64_t k,
-    double const* D,
-    std::complex<double>* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t lagsy(
-    int64_t n, int64_t k,
-    float const* D,
-    float* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    float* AFP,
+    lapack::Equed* equed,
+    float* S,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-int64_t lagsy(
-    int64_t n, int64_t k,
-    double const* D,
-    double* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    double* AFP,
+    lapack::Equed* equed,
+    double* S,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-int64_t lagsy(
-    int64_t n, int64_t k,
-    float const* D,
-    std::complex<float>* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    std::complex<float>* AFP,
+    lapack::Equed* equed,
+    float* S,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-int64_t lagsy(
-    int64_t n, int64_t k,
-    double const* D,
-    std::complex<double>* A, int64_t lda,
-    int64_t* iseed );
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    std::complex<double>* AFP,
+    lapack::Equed* equed,
+    double* S,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-float langb(
-    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
-    float const* AB, int64_t ldab );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP );
 
-double langb(
-    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
-    double const* AB, int64_t ldab );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP );
 
-float langb(
-    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
-    std::complex<float> const* AB, int64_t ldab );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP );
 
-double langb(
-    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
-    std::complex<double> const* AB, int64_t ldab );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP );
 
 // -----------------------------------------------------------------------------
-float lange(
-    lapack::Norm norm, int64_t m, int64_t n,
-    float const* A, int64_t lda );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP );
 
-double lange(
-    lapack::Norm norm, int64_t m, int64_t n,
-    double const* A, int64_t lda );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP );
 
-float lange(
-    lapack::Norm norm, int64_t m, int64_t n,
-    std::complex<float> const* A, int64_t lda );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP );
 
-double lange(
-    lapack::Norm norm, int64_t m, int64_t n,
-    std::complex<double> const* A, int64_t lda );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP );
 
 // -----------------------------------------------------------------------------
-float langt(
-    lapack::Norm norm, int64_t n,
-    float const* DL,
-    float const* D,
-    float const* DU );
+int64_t pptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float* B, int64_t ldb );
 
-double langt(
-    lapack::Norm norm, int64_t n,
-    double const* DL,
-    double const* D,
-    double const* DU );
+int64_t pptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double* B, int64_t ldb );
 
-float langt(
-    lapack::Norm norm, int64_t n,
-    std::complex<float> const* DL,
-    std::complex<float> const* D,
-    std::complex<float> const* DU );
+int64_t pptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float>* B, int64_t ldb );
 
-double langt(
-    lapack::Norm norm, int64_t n,
-    std::complex<double> const* DL,
-    std::complex<double> const* D,
-    std::complex<double> const* DU );
+int64_t pptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-float lanhb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab );
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, float tol );
+
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, double tol );
+
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, float tol );
 
-double lanhb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab );
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, double tol );
 
 // -----------------------------------------------------------------------------
-float lanhe(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda );
+int64_t ptcon(
+    int64_t n,
+    float const* D,
+    float const* E, float anorm,
+    float* rcond );
 
-double lanhe(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda );
+int64_t ptcon(
+    int64_t n,
+    double const* D,
+    double const* E, double anorm,
+    double* rcond );
 
-// -----------------------------------------------------------------------------
-float lanhp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP );
+int64_t ptcon(
+    int64_t n,
+    float const* D,
+    std::complex<float> const* E, float anorm,
+    float* rcond );
 
-double lanhp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP );
+int64_t ptcon(
+    int64_t n,
+    double const* D,
+    std::complex<double> const* E, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-float lanhs(
-    lapack::Norm norm, int64_t n,
-    float const* A, int64_t lda );
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
 
-double lanhs(
-    lapack::Norm norm, int64_t n,
-    double const* A, int64_t lda );
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
 
-float lanhs(
-    lapack::Norm norm, int64_t n,
-    std::complex<float> const* A, int64_t lda );
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
 
-double lanhs(
-    lapack::Norm norm, int64_t n,
-    std::complex<double> const* A, int64_t lda );
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
 
 // -----------------------------------------------------------------------------
-float lanht(
-    lapack::Norm norm, int64_t n,
+int64_t ptrfs(
+    int64_t n, int64_t nrhs,
     float const* D,
-    std::complex<float> const* E );
-
-double lanht(
-    lapack::Norm norm, int64_t n,
-    double const* D,
-    std::complex<double> const* E );
-
-// -----------------------------------------------------------------------------
-float lansb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab );
+    float const* E,
+    float const* DF,
+    float const* EF,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-// lanhb alias to lansb
-/// @ingroup norm
-inline float lanhb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab )
+// alias to match complex version (ignoring uplo)
+inline int64_t ptrfs(
+    lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
+    float const* DF,
+    float const* EF,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr )
 {
-    return lansb( norm, uplo, n, kd, AB, ldab );
+    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
 }
 
-double lansb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab );
+int64_t ptrfs(
+    int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double const* DF,
+    double const* EF,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-// lanhb alias to lansb
-/// @ingroup norm
-inline double lanhb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab )
+// alias to match complex version (ignoring uplo)
+inline int64_t ptrfs(
+    lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double const* DF,
+    double const* EF,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr )
 {
-    return lansb( norm, uplo, n, kd, AB, ldab );
+    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
 }
 
-float lansb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab );
+int64_t ptrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D,
+    std::complex<float> const* E,
+    float const* DF,
+    std::complex<float> const* EF,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-double lansb(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab );
+int64_t ptrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D,
+    std::complex<double> const* E,
+    double const* DF,
+    std::complex<double> const* EF,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-float lansp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    float const* AP );
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
+    float* D,
+    float* E,
+    float* B, int64_t ldb );
 
-// lanhp alias to lansp
-/// @ingroup norm
-inline float lanhp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    float const* AP )
-{
-    return lansp( norm, uplo, n, AP );
-}
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
+    double* D,
+    double* E,
+    double* B, int64_t ldb );
+
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
+    float* D,
+    std::complex<float>* E,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
+    double* D,
+    std::complex<double>* E,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
+    float* DF,
+    float* EF,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double* DF,
+    double* EF,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    float const* D,
+    std::complex<float> const* E,
+    float* DF,
+    std::complex<float>* EF,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    double const* D,
+    std::complex<double> const* E,
+    double* DF,
+    std::complex<double>* EF,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-double lansp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    double const* AP );
+// -----------------------------------------------------------------------------
+int64_t pttrf(
+    int64_t n,
+    float* D,
+    float* E );
 
-// lanhp alias to lansp
-/// @ingroup norm
-inline double lanhp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    double const* AP )
-{
-    return lansp( norm, uplo, n, AP );
-}
+int64_t pttrf(
+    int64_t n,
+    double* D,
+    double* E );
 
-float lansp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP );
+int64_t pttrf(
+    int64_t n,
+    float* D,
+    std::complex<float>* E );
 
-double lansp(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP );
+int64_t pttrf(
+    int64_t n,
+    double* D,
+    std::complex<double>* E );
 
 // -----------------------------------------------------------------------------
-float lanst(
-    lapack::Norm norm, int64_t n,
+int64_t pttrs(
+    int64_t n, int64_t nrhs,
     float const* D,
-    float const* E );
+    float const* E,
+    float* B, int64_t ldb );
 
-// lanht alias to lanst
-/// @ingroup norm
-inline float lanht(
-    lapack::Norm norm, int64_t n,
+// alias with uplo to match complex (it is ignored)
+inline int64_t pttrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* D,
-    float const* E )
+    float const* E,
+    float* B, int64_t ldb )
 {
-    return lanst( norm, n, D, E );
+    return pttrs( n, nrhs, D, E, B, ldb );
 }
 
-double lanst(
-    lapack::Norm norm, int64_t n,
+int64_t pttrs(
+    int64_t n, int64_t nrhs,
     double const* D,
-    double const* E );
+    double const* E,
+    double* B, int64_t ldb );
 
-// lanht alias to lanst
-/// @ingroup norm
-inline double lanht(
-    lapack::Norm norm, int64_t n,
+// alias with uplo to match complex (it is ignored)
+inline int64_t pttrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* D,
-    double const* E )
+    double const* E,
+    double* B, int64_t ldb )
 {
-    return lanst( norm, n, D, E );
+    return pttrs( n, nrhs, D, E, B, ldb );
 }
 
-// -----------------------------------------------------------------------------
-float lansy(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda );
+int64_t pttrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D,
+    std::complex<float> const* E,
+    std::complex<float>* B, int64_t ldb );
 
-// lanhe alias to lansy
-/// @ingroup norm
-inline float lanhe(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda )
-{
-    return lansy( norm, uplo, n, A, lda );
-}
+int64_t pttrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D,
+    std::complex<double> const* E,
+    std::complex<double>* B, int64_t ldb );
 
-double lansy(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda );
+// -----------------------------------------------------------------------------
+void qr_delete_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j );
 
-// lanhe alias to lansy
-/// @ingroup norm
-inline double lanhe(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda )
-{
-    return lansy( norm, uplo, n, A, lda );
-}
+void qr_delete_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j );
 
-float lansy(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda );
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j );
 
-double lansy(
-    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda );
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j );
 
 // -----------------------------------------------------------------------------
-float lantb(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
-    float const* AB, int64_t ldab );
+void qr_delete_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j );
 
-double lantb(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
-    double const* AB, int64_t ldab );
+void qr_delete_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j );
 
-float lantb(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
-    std::complex<float> const* AB, int64_t ldab );
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j );
 
-double lantb(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
-    std::complex<double> const* AB, int64_t ldab );
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j );
 
 // -----------------------------------------------------------------------------
-float lantp(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
-    float const* AP );
+void qr_insert_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x );
 
-double lantp(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
-    double const* AP );
+void qr_insert_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x );
 
-float lantp(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
-    std::complex<float> const* AP );
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x );
 
-double lantp(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
-    std::complex<double> const* AP );
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x );
 
 // -----------------------------------------------------------------------------
-float lantr(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
-    float const* A, int64_t lda );
+void qr_insert_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x );
 
-double lantr(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
-    double const* A, int64_t lda );
+void qr_insert_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x );
 
-float lantr(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
-    std::complex<float> const* A, int64_t lda );
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x );
 
-double lantr(
-    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
-    std::complex<double> const* A, int64_t lda );
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x );
 
 // -----------------------------------------------------------------------------
-void lapmr(
-    bool forwrd, int64_t m, int64_t n,
-    float* X, int64_t ldx,
-    int64_t* K );
+void qr_update(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* u, float const* v );
 
-void lapmr(
-    bool forwrd, int64_t m, int64_t n,
-    double* X, int64_t ldx,
-    int64_t* K );
+void qr_update(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* u, double const* v );
 
-void lapmr(
-    bool forwrd, int64_t m, int64_t n,
-    std::complex<float>* X, int64_t ldx,
-    int64_t* K );
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* u, std::complex<float> const* v );
 
-void lapmr(
-    bool forwrd, int64_t m, int64_t n,
-    std::complex<double>* X, int64_t ldx,
-    int64_t* K );
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* u, std::complex<double> const* v );
 
 // -----------------------------------------------------------------------------
-void lapmt(
-    bool forwrd, int64_t m, int64_t n,
-    float* X, int64_t ldx,
-    int64_t* K );
+int64_t sbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
 
-void lapmt(
-    bool forwrd, int64_t m, int64_t n,
-    double* X, int64_t ldx,
-    int64_t* K );
+// hbev alias to sbev
+inline int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-void lapmt(
-    bool forwrd, int64_t m, int64_t n,
-    std::complex<float>* X, int64_t ldx,
-    int64_t* K );
+int64_t sbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hbev alias to sbev
+inline int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
+
+void sbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-void lapmt(
-    bool forwrd, int64_t m, int64_t n,
-    std::complex<double>* X, int64_t ldx,
-    int64_t* K );
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-// -----------------------------------------------------------------------------
-float lapy2(
-    float x, float y );
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-double lapy2(
-    double x, double y );
+// hbev_2stage alias to sbev_2stage
+inline void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-float lapy3(
-    float x, float y, float z );
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work, host_work_size );
+}
 
-double lapy3(
-    double x, double y, double z );
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
 
-// -----------------------------------------------------------------------------
-void larf(
-    lapack::Side side, int64_t m, int64_t n,
-    float const* V, int64_t incv, float tau,
-    float* C, int64_t ldc );
+void sbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-void larf(
-    lapack::Side side, int64_t m, int64_t n,
-    double const* V, int64_t incv, double tau,
-    double* C, int64_t ldc );
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void larf(
-    lapack::Side side, int64_t m, int64_t n,
-    std::complex<float> const* V, int64_t incv, std::complex<float> tau,
-    std::complex<float>* C, int64_t ldc );
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-void larf(
-    lapack::Side side, int64_t m, int64_t n,
-    std::complex<double> const* V, int64_t incv, std::complex<double> tau,
-    std::complex<double>* C, int64_t ldc );
+// hbev_2stage alias to sbev_2stage
+inline void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 host_work_size );
+}
+
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-void larfb(
-    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
-    float const* V, int64_t ldv,
-    float const* T, int64_t ldt,
-    float* C, int64_t ldc );
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
 
-void larfb(
-    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
-    double const* V, int64_t ldv,
-    double const* T, int64_t ldt,
-    double* C, int64_t ldc );
+void sbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-void larfb(
-    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
-    std::complex<float> const* V, int64_t ldv,
-    std::complex<float> const* T, int64_t ldt,
-    std::complex<float>* C, int64_t ldc );
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void larfb(
-    lapack::Side side, lapack::Op trans, lapack::Direction direction, lapack::StoreV storev, int64_t m, int64_t n, int64_t k,
-    std::complex<double> const* V, int64_t ldv,
-    std::complex<double> const* T, int64_t ldt,
-    std::complex<double>* C, int64_t ldc );
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-// -----------------------------------------------------------------------------
-void larfg(
-    int64_t n,
-    float* alpha,
-    float* X, int64_t incx,
-    float* tau );
+// hbevd alias to sbevd
+inline void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbevd_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                           host_work_size );
+}
 
-void larfg(
-    int64_t n,
-    double* alpha,
-    double* X, int64_t incx,
-    double* tau );
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                  host_work, host_work_size );
+}
 
-void larfg(
-    int64_t n,
-    std::complex<float>* alpha,
-    std::complex<float>* X, int64_t incx,
-    std::complex<float>* tau );
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
 
-void larfg(
-    int64_t n,
-    std::complex<double>* alpha,
-    std::complex<double>* X, int64_t incx,
-    std::complex<double>* tau );
+void sbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-void larfgp(
-    int64_t n,
-    float* alpha,
-    float* X, int64_t incx,
-    float* tau );
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void larfgp(
-    int64_t n,
-    double* alpha,
-    double* X, int64_t incx,
-    double* tau );
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-void larfgp(
-    int64_t n,
-    std::complex<float>* alpha,
-    std::complex<float>* X, int64_t incx,
-    std::complex<float>* tau );
+// hbevd alias to sbevd
+inline void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbevd_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                           host_work_size );
+}
 
-void larfgp(
-    int64_t n,
-    std::complex<double>* alpha,
-    std::complex<double>* X, int64_t incx,
-    std::complex<double>* tau );
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                  host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-void larft(
-    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
-    float const* V, int64_t ldv,
-    float const* tau,
-    float* T, int64_t ldt );
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz );
 
-void larft(
-    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
-    double const* V, int64_t ldv,
-    double const* tau,
-    double* T, int64_t ldt );
+void sbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-void larft(
-    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
-    std::complex<float> const* V, int64_t ldv,
-    std::complex<float> const* tau,
-    std::complex<float>* T, int64_t ldt );
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void larft(
-    lapack::Direction direction, lapack::StoreV storev, int64_t n, int64_t k,
-    std::complex<double> const* V, int64_t ldv,
-    std::complex<double> const* tau,
-    std::complex<double>* T, int64_t ldt );
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-// -----------------------------------------------------------------------------
-void larfx(
-    lapack::Side side, int64_t m, int64_t n,
-    float const* V, float tau,
-    float* C, int64_t ldc );
+// hbevd_2stage alias to sbevd_2stage
+inline void hbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbevd_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                  host_work_size );
+}
 
-void larfx(
-    lapack::Side side, int64_t m, int64_t n,
-    double const* V, double tau,
-    double* C, int64_t ldc );
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                         host_work, host_work_size );
+}
 
-void larfx(
-    lapack::Side side, int64_t m, int64_t n,
-    std::complex<float> const* V, std::complex<float> tau,
-    std::complex<float>* C, int64_t ldc );
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
 
-void larfx(
-    lapack::Side side, int64_t m, int64_t n,
-    std::complex<double> const* V, std::complex<double> tau,
-    std::complex<double>* C, int64_t ldc );
+void sbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-void larfy(
-    lapack::Uplo uplo, int64_t n,
-    float const* V, int64_t incv, float tau,
-    float* C, int64_t ldc );
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void larfy(
-    lapack::Uplo uplo, int64_t n,
-    double const* V, int64_t incv, double tau,
-    double* C, int64_t ldc );
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-void larfy(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* V, int64_t incv, std::complex<float> tau,
-    std::complex<float>* C, int64_t ldc );
+// hbevd_2stage alias to sbevd_2stage
+inline void hbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbevd_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                  host_work_size );
+}
 
-void larfy(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* V, int64_t incv, std::complex<double> tau,
-    std::complex<double>* C, int64_t ldc );
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                         host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-void larnv(
-    int64_t idist,
-    int64_t* iseed, int64_t n,
-    float* X );
+int64_t sbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-void larnv(
-    int64_t idist,
-    int64_t* iseed, int64_t n,
-    double* X );
+// hbevx alias to sbevx
+inline int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
 
-void larnv(
-    int64_t idist,
-    int64_t* iseed, int64_t n,
-    std::complex<float>* X );
+int64_t sbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-void larnv(
-    int64_t idist,
-    int64_t* iseed, int64_t n,
-    std::complex<double>* X );
+// hbevx alias to sbevx
+inline int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
 
 // -----------------------------------------------------------------------------
-void lartg(
-    float f, float g,
-    float* cs,
-    float* sn,
-    float* r );
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-void lartg(
-    double f, double g,
-    double* cs,
-    double* sn,
-    double* r );
+void sbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
 
-void lartg(
-    std::complex<float> f, std::complex<float> g,
-    float* cs,
-    std::complex<float>* sn,
-    std::complex<float>* r );
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-void lartg(
-    std::complex<double> f, std::complex<double> g,
-    double* cs,
-    std::complex<double>* sn,
-    std::complex<double>* r );
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
 
-// -----------------------------------------------------------------------------
-void lartgp(
-    float f, float g,
-    float* cs,
-    float* sn,
-    float* r );
+// hbevx_2stage alias to sbevx_2stage
+inline void hbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    sbevx_2stage_work_size_bytes( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                                  host_work_size );
+}
 
-void lartgp(
-    double f, double g,
-    double* cs,
-    double* sn,
-    double* r );
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-void lartgs(
-    float x, float y, float sigma,
-    float* cs,
-    float* sn );
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-void lartgs(
-    double x, double y, double sigma,
-    double* cs,
-    double* sn );
+void sbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t lascl(
-    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
-    float* A, int64_t lda );
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-int64_t lascl(
-    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
-    double* A, int64_t lda );
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
 
-int64_t lascl(
-    lapack::MatrixType type, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda );
+// hbevx_2stage alias to sbevx_2stage
+inline void hbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    sbevx_2stage_work_size_bytes( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                                  host_work_size );
+}
 
-int64_t lascl(
-    lapack::MatrixType type, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
-    std::complex<double>* A, int64_t lda );
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-void laset(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
-    float offdiag, float diag,
-    float* A, int64_t lda );
+int64_t sbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float const* BB, int64_t ldbb,
+    float* X, int64_t ldx );
 
-void laset(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
-    double offdiag, double diag,
-    double* A, int64_t lda );
+// hbgst alias to sbgst
+inline int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float const* BB, int64_t ldbb,
+    float* X, int64_t ldx )
+{
+    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
+}
 
-void laset(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
-    std::complex<float> offdiag, std::complex<float> diag,
-    std::complex<float>* A, int64_t lda );
+int64_t sbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double const* BB, int64_t ldbb,
+    double* X, int64_t ldx );
 
-void laset(
-    lapack::MatrixType matrixtype, int64_t m, int64_t n,
-    std::complex<double> offdiag, std::complex<double> diag,
-    std::complex<double>* A, int64_t lda );
+// hbgst alias to sbgst
+inline int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double const* BB, int64_t ldbb,
+    double* X, int64_t ldx )
+{
+    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
+}
 
 // -----------------------------------------------------------------------------
-void lassq(
-    int64_t n,
-    float const* X, int64_t incx,
-    float* scale,
-    float* sumsq );
+int64_t sbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz );
 
-void lassq(
-    int64_t n,
-    double const* X, int64_t incx,
-    double* scale,
-    double* sumsq );
+// hbgv alias to sbgv
+inline int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
 
-void lassq(
-    int64_t n,
-    std::complex<float> const* X, int64_t incx,
-    float* scale,
-    float* sumsq );
+int64_t sbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz );
 
-void lassq(
-    int64_t n,
-    std::complex<double> const* X, int64_t incx,
-    double* scale,
-    double* sumsq );
+// hbgv alias to sbgv
+inline int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
 
 // -----------------------------------------------------------------------------
-void laswp(
-    int64_t n,
-    float* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz );
 
-void laswp(
-    int64_t n,
-    double* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+void sbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-void laswp(
-    int64_t n,
-    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-void laswp(
-    int64_t n,
-    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
-    int64_t const* ipiv, int64_t incx );
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
 
-// -----------------------------------------------------------------------------
-int64_t lauum(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+// hbgvd alias to sbgvd
+inline void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           host_work_size );
+}
 
-int64_t lauum(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work, host_work_size );
+}
 
-int64_t lauum(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz );
 
-int64_t lauum(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+void sbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t opgtr(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    float const* tau,
-    float* Q, int64_t ldq );
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-// upgtr alias to opgtr
-inline int64_t upgtr(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    float const* tau,
-    float* Q, int64_t ldq )
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
 {
-    return opgtr( uplo, n, AP, tau, Q, ldq );
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
 }
 
-int64_t opgtr(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP,
-    double const* tau,
-    double* Q, int64_t ldq );
+// hbgvd alias to sbgvd
+inline void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    sbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           host_work_size );
+}
 
-// upgtr alias to opgtr
-inline int64_t upgtr(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP,
-    double const* tau,
-    double* Q, int64_t ldq )
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
 {
-    return opgtr( uplo, n, AP, tau, Q, ldq );
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t opmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* AP,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t sbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-// upmtr alias to opmtr
-inline int64_t upmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* AP,
-    float const* tau,
-    float* C, int64_t ldc )
+// hbgvx alias to sbgvx
+inline int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return opmtr( side, uplo, trans, m, n, AP, tau, C, ldc );
+    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-int64_t opmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* AP,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t sbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-// upmtr alias to opmtr
-inline int64_t upmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* AP,
-    double const* tau,
-    double* C, int64_t ldc )
+// hbgvx alias to sbgvx
+inline int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return opmtr( side, uplo, trans, m, n, AP, tau, C, ldc );
+    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orcsd2by1(
-    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    float* X11, int64_t ldx11,
-    float* X21, int64_t ldx21,
-    float* theta,
-    float* U1, int64_t ldu1,
-    float* U2, int64_t ldu2,
-    float* V1T, int64_t ldv1t );
+int64_t sbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* D,
+    float* E,
+    float* Q, int64_t ldq );
 
-// uncsd2by1 alias to orcsd2by1
-inline int64_t uncsd2by1(
-    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    float* X11, int64_t ldx11,
-    float* X21, int64_t ldx21,
-    float* theta,
-    float* U1, int64_t ldu1,
-    float* U2, int64_t ldu2,
-    float* V1T, int64_t ldv1t )
+// hbtrd alias to sbtrd
+inline int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* D,
+    float* E,
+    float* Q, int64_t ldq )
 {
-    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t );
+    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
 }
 
-int64_t orcsd2by1(
-    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    double* X11, int64_t ldx11,
-    double* X21, int64_t ldx21,
-    double* theta,
-    double* U1, int64_t ldu1,
-    double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t );
+int64_t sbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* D,
+    double* E,
+    double* Q, int64_t ldq );
 
-// uncsd2by1 alias to orcsd2by1
-inline int64_t uncsd2by1(
-    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    double* X11, int64_t ldx11,
-    double* X21, int64_t ldx21,
-    double* theta,
-    double* U1, int64_t ldu1,
-    double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t )
+// hbtrd alias to sbtrd
+inline int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* D,
+    double* E,
+    double* Q, int64_t ldq )
 {
-    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t );
+    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orgbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+void sfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
+    float const* A, int64_t lda, float beta,
+    float* C );
 
-// ungbr alias to orgbr
-inline int64_t ungbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
-{
-    return orgbr( vect, m, n, k, A, lda, tau );
-}
+void sfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
+    double const* A, int64_t lda, double beta,
+    double* C );
 
-int64_t orgbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+// -----------------------------------------------------------------------------
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double const* tau );
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax = 30, bool fallback = true );
 
-// ungbr alias to orgbr
-inline int64_t ungbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
-{
-    return orgbr( vect, m, n, k, A, lda, tau );
-}
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter, int64_t itermax = 30, bool fallback = true );
 
-// -----------------------------------------------------------------------------
-int64_t orghr(
-    int64_t n, int64_t ilo, int64_t ihi,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::float16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax = 30, bool fallback = true );
 
-// unghr alias to orghr
-inline int64_t unghr(
-    int64_t n, int64_t ilo, int64_t ihi,
-    float* A, int64_t lda,
-    float const* tau )
-{
-    return orghr( n, ilo, ihi, A, lda, tau );
-}
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::bfloat16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax = 30, bool fallback = true );
 
-int64_t orghr(
-    int64_t n, int64_t ilo, int64_t ihi,
-    double* A, int64_t lda,
-    double const* tau );
+// -----------------------------------------------------------------------------
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
 
-// unghr alias to orghr
-inline int64_t unghr(
-    int64_t n, int64_t ilo, int64_t ihi,
-    double* A, int64_t lda,
-    double const* tau )
+// hpcon alias to spcon
+inline int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
 {
-    return orghr( n, ilo, ihi, A, lda, tau );
+    return spcon( uplo, n, AP, ipiv, anorm, rcond );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orglq(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
 
-// unglq alias to orglq
-inline int64_t unglq(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
+// hpcon alias to spcon
+inline int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond )
 {
-    return orglq( m, n, k, A, lda, tau );
+    return spcon( uplo, n, AP, ipiv, anorm, rcond );
 }
 
-int64_t orglq(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau );
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
 
-// unglq alias to orglq
-inline int64_t unglq(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
-{
-    return orglq( m, n, k, A, lda, tau );
-}
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t orgql(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t spev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz );
 
-// ungql alias to orgql
-inline int64_t ungql(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
+// hpev alias to spev
+inline int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz )
 {
-    return orgql( m, n, k, A, lda, tau );
+    return spev( jobz, uplo, n, AP, W, Z, ldz );
 }
 
-int64_t orgql(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau );
+int64_t spev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz );
 
-// ungql alias to orgql
-inline int64_t ungql(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
+// hpev alias to spev
+inline int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz )
 {
-    return orgql( m, n, k, A, lda, tau );
+    return spev( jobz, uplo, n, AP, W, Z, ldz );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orgqr(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz );
 
-// ungqr alias to orgqr
-inline int64_t ungqr(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
+void spevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz )
 {
-    return orgqr( m, n, k, A, lda, tau );
+    return spevd( jobz, uplo, n, AP, W, Z, ldz );
 }
 
-int64_t orgqr(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau );
+// hpevd alias to spevd
+inline void hpevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    spevd_work_size_bytes( jobz, uplo, n, AP, W, Z, ldz, host_work_size );
+}
 
-// ungqr alias to orgqr
-inline int64_t ungqr(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
 {
-    return orgqr( m, n, k, A, lda, tau );
+    return spevd( jobz, uplo, n, AP, W, Z, ldz, host_work, host_work_size );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orgrq(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz );
 
-// ungrq alias to orgrq
-inline int64_t ungrq(
-    int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
+void spevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz )
 {
-    return orgrq( m, n, k, A, lda, tau );
+    return spevd( jobz, uplo, n, AP, W, Z, ldz );
 }
 
-int64_t orgrq(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau );
+// hpevd alias to spevd
+inline void hpevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    spevd_work_size_bytes( jobz, uplo, n, AP, W, Z, ldz, host_work_size );
+}
 
-// ungrq alias to orgrq
-inline int64_t ungrq(
-    int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
 {
-    return orgrq( m, n, k, A, lda, tau );
+    return spevd( jobz, uplo, n, AP, W, Z, ldz, host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orgtr(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* tau );
+int64_t spevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-// ungtr alias to orgtr
-inline int64_t ungtr(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* tau )
+// hpevx alias to spevx
+inline int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return orgtr( uplo, n, A, lda, tau );
+    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-int64_t orgtr(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* tau );
+int64_t spevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-// ungtr alias to orgtr
-inline int64_t ungtr(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* tau )
+// hpevx alias to spevx
+inline int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return orgtr( uplo, n, A, lda, tau );
+    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t spgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float const* BP );
 
-// unmbr alias to ormbr
-inline int64_t unmbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hpgst alias to spgst
+inline int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float const* BP )
 {
-    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgst( itype, uplo, n, AP, BP );
 }
 
-int64_t ormbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t spgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double const* BP );
 
-// unmbr alias to ormbr
-inline int64_t unmbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgst alias to spgst
+inline int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double const* BP )
 {
-    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgst( itype, uplo, n, AP, BP );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t spgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz );
 
-// unmhr alias to ormhr
-inline int64_t unmhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hpgv alias to spgv
+inline int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz )
 {
-    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
 }
 
-int64_t ormhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t spgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz );
 
-// unmhr alias to ormhr
-inline int64_t unmhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgv alias to spgv
+inline int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz )
 {
-    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz );
 
-// unmlq alias to ormlq
-inline int64_t unmlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
-{
-    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
-}
+void spgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t ormlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-// unmlq alias to ormlq
-inline int64_t unmlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz )
 {
-    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
-
-// unmql alias to ormql
-inline int64_t unmql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
 {
-    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+    spgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           host_work_size );
 }
 
-int64_t ormql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
-
-// unmql alias to ormql
-inline int64_t unmql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
 {
-    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work, host_work_size );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz );
 
-// unmqr alias to ormqr
-inline int64_t unmqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
-{
-    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
-}
+void spgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t ormqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-// unmqr alias to ormqr
-inline int64_t unmqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz )
 {
-    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
-
-// unmrq alias to ormrq
-inline int64_t unmrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
 {
-    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    spgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           host_work_size );
 }
 
-int64_t ormrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
-
-// unmrq alias to ormrq
-inline int64_t unmrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
 {
-    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t spgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-// unmrz alias to ormrz
-inline int64_t unmrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hpgvx alias to spgvx
+inline int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-int64_t ormrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t spgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-// unmrz alias to ormrz
-inline int64_t unmrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hpgvx alias to spgvx
+inline int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-// unmtr alias to ormtr
-inline int64_t unmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// hprfs alias to sprfs
+inline int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr )
 {
-    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
 }
 
-int64_t ormtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-// unmtr alias to ormtr
-inline int64_t unmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// hprfs alias to sprfs
+inline int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr )
 {
-    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
 }
 
-// -----------------------------------------------------------------------------
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab, float anorm,
-    float* rcond );
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float> const* AFP,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab, double anorm,
-    double* rcond );
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double> const* AFP,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab, float anorm,
-    float* rcond );
+// -----------------------------------------------------------------------------
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab, double anorm,
-    double* rcond );
+// hpsv alias to spsv
+inline int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab,
-    double* S,
-    double* scond,
-    double* amax );
+// hpsv alias to spsv
+inline int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float const* AB, int64_t ldab,
-    float const* AFB, int64_t ldafb,
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float* AFP,
+    int64_t* ipiv,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
+    float* rcond,
     float* ferr,
     float* berr );
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double const* AB, int64_t ldab,
-    double const* AFB, int64_t ldafb,
+// hpsvx alias to spsvx
+inline int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float* AFP,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+}
+
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double* AFP,
+    int64_t* ipiv,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
+    double* rcond,
     double* ferr,
     double* berr );
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float> const* AB, int64_t ldab,
-    std::complex<float> const* AFB, int64_t ldafb,
+// hpsvx alias to spsvx
+inline int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double* AFP,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
+{
+    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+}
+
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float>* AFP,
+    int64_t* ipiv,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
+    float* rcond,
     float* ferr,
     float* berr );
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double> const* AB, int64_t ldab,
-    std::complex<double> const* AFB, int64_t ldafb,
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double>* AFP,
+    int64_t* ipiv,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
+    double* rcond,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab );
+int64_t sptrd(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* D,
+    float* E,
+    float* tau );
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab );
+// hptrd alias to sptrd
+inline int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* D,
+    float* E,
+    float* tau )
+{
+    return sptrd( uplo, n, AP, D, E, tau );
+}
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab );
+int64_t sptrd(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* D,
+    double* E,
+    double* tau );
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab );
+// hptrd alias to sptrd
+inline int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* D,
+    double* E,
+    double* tau )
+{
+    return sptrd( uplo, n, AP, D, E, tau );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float* AB, int64_t ldab,
-    float* B, int64_t ldb );
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t* ipiv );
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double* AB, int64_t ldab,
-    double* B, int64_t ldb );
+// hptrf alias to sptrf
+inline int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t* ipiv )
+{
+    return sptrf( uplo, n, AP, ipiv );
+}
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* B, int64_t ldb );
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t* ipiv );
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* B, int64_t ldb );
+// hptrf alias to sptrf
+inline int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t* ipiv )
+{
+    return sptrf( uplo, n, AP, ipiv );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float* AB, int64_t ldab,
-    float* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    float* S,
-    float* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t* ipiv );
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double* AB, int64_t ldab,
-    double* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    double* S,
-    double* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    int64_t* ipiv );
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    float* S,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+// -----------------------------------------------------------------------------
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t const* ipiv );
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    double* S,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// hptri alias to sptri
+inline int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t const* ipiv )
+{
+    return sptri( uplo, n, AP, ipiv );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab );
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t const* ipiv );
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab );
+// hptri alias to sptri
+inline int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t const* ipiv )
+{
+    return sptri( uplo, n, AP, ipiv );
+}
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab );
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t const* ipiv );
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab );
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    int64_t const* ipiv );
 
 // -----------------------------------------------------------------------------
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float const* AB, int64_t ldab,
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    int64_t const* ipiv,
     float* B, int64_t ldb );
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double const* AB, int64_t ldab,
+// hptrs alias to sptrs
+inline int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    int64_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    int64_t const* ipiv,
     double* B, int64_t ldb );
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float> const* AB, int64_t ldab,
+// hptrs alias to sptrs
+inline int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    int64_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb );
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double> const* AB, int64_t ldab,
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    float* A );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    double* A );
+void stedc_work_size_bytes(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
 
-// -----------------------------------------------------------------------------
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    float* A );
+void stedc_work_size_bytes(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    double* A );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A );
+void stedc_work_size_bytes(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A,
-    float* B, int64_t ldb );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A,
-    double* B, int64_t ldb );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A,
-    std::complex<float>* B, int64_t ldb );
+void stedc_work_size_bytes(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A,
-    std::complex<double>* B, int64_t ldb );
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda, float anorm,
-    float* rcond );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda, double anorm,
-    double* rcond );
+void stegr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda, float anorm,
-    float* rcond );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda, double anorm,
-    double* rcond );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
 
-// -----------------------------------------------------------------------------
-int64_t poequ(
-    int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+void stegr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t poequ(
-    int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-int64_t poequ(
-    int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void stegr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void stegr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t poequ(
-    int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t poequb(
+int64_t stein(
     int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-int64_t poequb(
+int64_t stein(
     int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
-int64_t poequb(
+int64_t stein(
     int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
 
-int64_t poequb(
+int64_t stein(
     int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
 
 // -----------------------------------------------------------------------------
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size );
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size );
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
 
-// -----------------------------------------------------------------------------
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size );
 
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size );
 
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    float* S,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
 
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    double* S,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    float* B, int64_t ldb );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size );
 
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* B, int64_t ldb );
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
+
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size );
 
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+// -----------------------------------------------------------------------------
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
 
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
 
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    int64_t* iter );
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
 
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    int64_t* iter );
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
 
 // -----------------------------------------------------------------------------
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    float* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    float* S,
-    float* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t sterf(
+    int64_t n,
+    float* D,
+    float* E );
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    double* S,
-    double* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+int64_t sterf(
+    int64_t n,
+    double* D,
+    double* E );
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    float* S,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+// -----------------------------------------------------------------------------
+int64_t stev(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    double* S,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+int64_t stev(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
 
 // -----------------------------------------------------------------------------
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+void stevd_work_size_bytes(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    size_t* host_work_size );
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+void stevd_work_size_bytes(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    size_t* host_work_size );
+
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+void stevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
 
-// -----------------------------------------------------------------------------
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+void stevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+// -----------------------------------------------------------------------------
+int64_t stevx(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+int64_t stevx(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
 
 // -----------------------------------------------------------------------------
-int64_t potri(
+template <typename scalar_t>
+int64_t sturm(
+    int64_t n, scalar_t const* diag,
+    scalar_t const* offd, scalar_t u);
+
+// -----------------------------------------------------------------------------
+int64_t sycon(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+    float const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
 
-int64_t potri(
+// hecon alias to sycon
+inline int64_t hecon(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+    float const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
+{
+    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+}
 
-int64_t potri(
+int64_t sycon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+    double const* A, int64_t lda,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
 
-int64_t potri(
+// hecon alias to sycon
+inline int64_t hecon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
-
-// -----------------------------------------------------------------------------
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float* B, int64_t ldb );
-
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* A, int64_t lda,
-    double* B, int64_t ldb );
+    int64_t const* ipiv, double anorm,
+    double* rcond )
+{
+    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+}
 
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+    int64_t const* ipiv, float anorm,
+    float* rcond );
 
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+    int64_t const* ipiv, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t ppcon(
+// sycon_rk wraps sycon_3
+int64_t sycon_rk(
     lapack::Uplo uplo, int64_t n,
-    float const* AP, float anorm,
+    float const* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv, float anorm,
     float* rcond );
 
-int64_t ppcon(
+// hecon_rk alias to sycon_rk
+inline int64_t hecon_rk(
     lapack::Uplo uplo, int64_t n,
-    double const* AP, double anorm,
+    float const* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
+{
+    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+}
+
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv, double anorm,
     double* rcond );
 
-int64_t ppcon(
+// hecon_rk alias to sycon_rk
+inline int64_t hecon_rk(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP, float anorm,
+    double const* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv, double anorm,
+    double* rcond )
+{
+    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+}
+
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv, float anorm,
     float* rcond );
 
-int64_t ppcon(
+int64_t sycon_rk(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP, double anorm,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv, double anorm,
     double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t ppequ(
+int64_t syequb(
     lapack::Uplo uplo, int64_t n,
-    float const* AP,
+    float const* A, int64_t lda,
     float* S,
     float* scond,
     float* amax );
 
-int64_t ppequ(
+// heequb alias to syequb
+inline int64_t heequb(
     lapack::Uplo uplo, int64_t n,
-    double const* AP,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax )
+{
+    return syequb( uplo, n, A, lda, S, scond, amax );
+}
+
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
     double* S,
     double* scond,
     double* amax );
 
-int64_t ppequ(
+// heequb alias to syequb
+inline int64_t heequb(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax )
+{
+    return syequb( uplo, n, A, lda, S, scond, amax );
+}
+
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
     float* S,
     float* scond,
     float* amax );
 
-int64_t ppequ(
+int64_t syequb(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP,
+    std::complex<double> const* A, int64_t lda,
     double* S,
     double* scond,
     double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float const* AFP,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double const* AFP,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
-
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float> const* AFP,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double> const* AFP,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
-
-// -----------------------------------------------------------------------------
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    float* B, int64_t ldb );
-
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    double* B, int64_t ldb );
-
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    std::complex<float>* B, int64_t ldb );
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
 
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    std::complex<double>* B, int64_t ldb );
+void syev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    float* AFP,
-    lapack::Equed* equed,
-    float* S,
-    float* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    double* AFP,
-    lapack::Equed* equed,
-    double* S,
-    double* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syev( jobz, uplo, n, A, lda, W );
+}
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    std::complex<float>* AFP,
-    lapack::Equed* equed,
-    float* S,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+// heev alias to syev
+inline void heev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size )
+{
+    syev_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    std::complex<double>* AFP,
-    lapack::Equed* equed,
-    double* S,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    return syev( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP );
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP );
+void syev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP );
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP );
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syev( jobz, uplo, n, A, lda, W );
+}
+
+// heev alias to syev
+inline void heev_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size )
+{
+    syev_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
+
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size )
+{
+    return syev( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP );
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP );
+void syev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP );
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP );
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float* B, int64_t ldb );
+// heev_2stage alias to syev_2stage
+inline void heev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size )
+{
+    syev_2stage_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double* B, int64_t ldb );
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float>* B, int64_t ldb );
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double>* B, int64_t ldb );
+void syev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t pstrf(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, float tol );
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
 
-int64_t pstrf(
-    lapack::Uplo uplo, int64_t n,
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, double tol );
+    double* W )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W );
+}
 
-int64_t pstrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, float tol );
+// heev_2stage alias to syev_2stage
+inline void heev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size )
+{
+    syev_2stage_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t pstrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, double tol );
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t ptcon(
-    int64_t n,
-    float const* D,
-    float const* E, float anorm,
-    float* rcond );
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
 
-int64_t ptcon(
-    int64_t n,
-    double const* D,
-    double const* E, double anorm,
-    double* rcond );
+void syevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
 
-int64_t ptcon(
-    int64_t n,
-    float const* D,
-    std::complex<float> const* E, float anorm,
-    float* rcond );
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-int64_t ptcon(
-    int64_t n,
-    double const* D,
-    std::complex<double> const* E, double anorm,
-    double* rcond );
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syevd( jobz, uplo, n, A, lda, W );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+// heevd alias to syevd
+inline void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size )
+{
+    syevd_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    return syevd( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    lapack::Workspace& ws );
 
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    lapack::Workspace& ws )
+{
+    return syevd( jobz, uplo, n, A, lda, W, ws );
+}
 
-// -----------------------------------------------------------------------------
-int64_t ptrfs(
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float const* DF,
-    float const* EF,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
 
-// alias to match complex version (ignoring uplo)
-inline int64_t ptrfs(
-    lapack::Uplo uplo,
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float const* DF,
-    float const* EF,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
+void syevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
+
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
+
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
 {
-    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
+    return syevd( jobz, uplo, n, A, lda, W );
 }
 
-int64_t ptrfs(
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double const* DF,
-    double const* EF,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+// heevd alias to syevd
+inline void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size )
+{
+    syevd_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-// alias to match complex version (ignoring uplo)
-inline int64_t ptrfs(
-    lapack::Uplo uplo,
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double const* DF,
-    double const* EF,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size )
 {
-    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
+    return syevd( jobz, uplo, n, A, lda, W, host_work, host_work_size );
 }
 
-int64_t ptrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
-    float const* DF,
-    std::complex<float> const* EF,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    lapack::Workspace& ws );
 
-int64_t ptrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
-    double const* DF,
-    std::complex<double> const* EF,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    lapack::Workspace& ws )
+{
+    return syevd( jobz, uplo, n, A, lda, W, ws );
+}
 
 // -----------------------------------------------------------------------------
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    float* D,
-    float* E,
-    float* B, int64_t ldb );
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
 
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    double* D,
-    double* E,
-    double* B, int64_t ldb );
+void syevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size );
 
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    float* D,
-    std::complex<float>* E,
-    std::complex<float>* B, int64_t ldb );
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    double* D,
-    std::complex<double>* E,
-    std::complex<double>* B, int64_t ldb );
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W );
+}
 
-// -----------------------------------------------------------------------------
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float* DF,
-    float* EF,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+// heevd_2stage alias to syevd_2stage
+inline void heevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    size_t* host_work_size )
+{
+    syevd_2stage_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double* DF,
-    double* EF,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
-    float* DF,
-    std::complex<float>* EF,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
-    double* DF,
-    std::complex<double>* EF,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+void syevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t pttrf(
-    int64_t n,
-    float* D,
-    float* E );
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size );
 
-int64_t pttrf(
-    int64_t n,
-    double* D,
-    double* E );
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W );
+}
 
-int64_t pttrf(
-    int64_t n,
-    float* D,
-    std::complex<float>* E );
+// heevd_2stage alias to syevd_2stage
+inline void heevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    size_t* host_work_size )
+{
+    syevd_2stage_work_size_bytes( jobz, uplo, n, A, lda, W, host_work_size );
+}
 
-int64_t pttrf(
-    int64_t n,
-    double* D,
-    std::complex<double>* E );
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W, host_work, host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void syevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t pttrs(
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float* B, int64_t ldb );
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-// alias with uplo to match complex (it is ignored)
-inline int64_t pttrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float* B, int64_t ldb )
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
 {
-    return pttrs( n, nrhs, D, E, B, ldb );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
-int64_t pttrs(
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double* B, int64_t ldb );
+// heevr alias to syevr
+inline void heevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    syevr_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                           host_work_size );
+}
 
-// alias with uplo to match complex (it is ignored)
-inline int64_t pttrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double* B, int64_t ldb )
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
 {
-    return pttrs( n, nrhs, D, E, B, ldb );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                  host_work, host_work_size );
 }
 
-int64_t pttrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
-    std::complex<float>* B, int64_t ldb );
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
 
-int64_t pttrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
-    std::complex<double>* B, int64_t ldb );
+void syevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-// hbev alias to sbev
-inline int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
 {
-    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
-int64_t sbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+// heevr alias to syevr
+inline void heevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz );
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    syevr_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                           host_work_size );
+}
 
-// hbev alias to sbev
-inline int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
 {
-    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                  host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz );
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
 
-// hbev_2stage alias to sbev_2stage
-inline int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
+void syevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz )
-{
-    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-int64_t sbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-// hbev_2stage alias to sbev_2stage
-inline int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
 {
-    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
+// heevr_2stage alias to syevr_2stage
+inline void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz );
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    syevr_2stage_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                                  host_work_size );
+}
 
-// hbevd alias to sbevd
-inline int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
 {
-    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                         host_work, host_work_size );
 }
 
-int64_t sbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz );
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
 
-// hbevd alias to sbevd
-inline int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+void syevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz )
-{
-    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size );
 
-// hbevd_2stage alias to sbevd_2stage
-inline int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
 {
-    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
 }
 
-int64_t sbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+// heevr_2stage alias to syevr_2stage
+inline void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz );
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    syevr_2stage_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                                  host_work_size );
+}
 
-// hbevd_2stage alias to sbevd_2stage
-inline int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
 {
-    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz,
+                         host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
     int64_t* ifail );
 
-// hbevx alias to sbevx
-inline int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+void syevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+    int64_t* ifail,
+    size_t* host_work_size );
 
-int64_t sbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-// hbevx alias to sbevx
-inline int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
+    float* W,
+    float* Z, int64_t ldz,
     int64_t* ifail )
 {
-    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+// heevx alias to syevx
+inline void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail );
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    syevx_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           host_work_size );
+}
 
-// hbevx_2stage alias to sbevx_2stage
-inline int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
 {
-    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work, host_work_size );
 }
 
-int64_t sbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
     int64_t* ifail );
 
-// hbevx_2stage alias to sbevx_2stage
-inline int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+void syevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
-
-// -----------------------------------------------------------------------------
-int64_t sbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float const* BB, int64_t ldbb,
-    float* X, int64_t ldx );
-
-// hbgst alias to sbgst
-inline int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float const* BB, int64_t ldbb,
-    float* X, int64_t ldx )
-{
-    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
-}
+    int64_t* ifail,
+    size_t* host_work_size );
 
-int64_t sbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double const* BB, int64_t ldbb,
-    double* X, int64_t ldx );
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-// hbgst alias to sbgst
-inline int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double const* BB, int64_t ldbb,
-    double* X, int64_t ldx )
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz );
-
-// hbgv alias to sbgv
-inline int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz )
+// heevx alias to syevx
+inline void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
 {
-    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+    syevx_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           host_work_size );
 }
 
-int64_t sbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz );
-
-// hbgv alias to sbgv
-inline int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
 {
-    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz );
+    float* Z, int64_t ldz,
+    int64_t* ifail );
 
-// hbgvd alias to sbgvd
-inline int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
+void syevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
     float* W,
-    float* Z, int64_t ldz )
-{
-    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
-}
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
 
-int64_t sbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-// hbgvd alias to sbgvd
-inline int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz )
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+// heevx_2stage alias to syevx_2stage
+inline void heevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail );
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    syevx_2stage_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                                  host_work_size );
+}
 
-// hbgvx alias to sbgvx
-inline int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
 {
-    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work, host_work_size );
 }
 
-int64_t sbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
     int64_t* ifail );
 
-// hbgvx alias to sbgvx
-inline int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+void syevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
-    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+// heevx_2stage alias to syevx_2stage
+inline void heevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    syevx_2stage_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                                  host_work_size );
+}
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* D,
-    float* E,
-    float* Q, int64_t ldq );
+int64_t sygst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* B, int64_t ldb );
 
-// hbtrd alias to sbtrd
-inline int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* D,
-    float* E,
-    float* Q, int64_t ldq )
+// hegst alias to sygst
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* B, int64_t ldb )
 {
-    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
+    return sygst( itype, uplo, n, A, lda, B, ldb );
 }
 
-int64_t sbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* D,
-    double* E,
-    double* Q, int64_t ldq );
+int64_t sygst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb );
 
-// hbtrd alias to sbtrd
-inline int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* D,
-    double* E,
-    double* Q, int64_t ldq )
+// hegst alias to sygst
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb )
 {
-    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
+    return sygst( itype, uplo, n, A, lda, B, ldb );
 }
 
 // -----------------------------------------------------------------------------
-void sfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
-    float const* A, int64_t lda, float beta,
-    float* C );
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
 
-void sfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
-    double const* A, int64_t lda, double beta,
-    double* C );
+void sygv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t spcon(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-// hpcon alias to spcon
-inline int64_t hpcon(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
 {
-    return spcon( uplo, n, AP, ipiv, anorm, rcond );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-int64_t spcon(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+// hegv alias to sygv
+inline void hegv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size )
+{
+    sygv_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                          host_work_size );
+}
 
-// hpcon alias to spcon
-inline int64_t hpcon(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size )
 {
-    return spcon( uplo, n, AP, ipiv, anorm, rcond );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                 host_work, host_work_size );
 }
 
-int64_t spcon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
 
-int64_t spcon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+void sygv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t spev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size );
 
-// hpev alias to spev
-inline int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz )
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
 {
-    return spev( jobz, uplo, n, AP, W, Z, ldz );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-int64_t spev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
+// hegv alias to sygv
+inline void hegv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz );
+    size_t* host_work_size )
+{
+    sygv_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                          host_work_size );
+}
 
-// hpev alias to spev
-inline int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz )
+    void* host_work, size_t host_work_size )
 {
-    return spev( jobz, uplo, n, AP, W, Z, ldz );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                 host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-int64_t spevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
 
-// hpevd alias to spevd
-inline int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
+void sygv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     float* W,
-    float* Z, int64_t ldz )
-{
-    return spevd( jobz, uplo, n, AP, W, Z, ldz );
-}
+    size_t* host_work_size );
 
-int64_t spevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
 
-// hpevd alias to spevd
-inline int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* W,
-    double* Z, int64_t ldz )
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
 {
-    return spevd( jobz, uplo, n, AP, W, Z, ldz );
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-// -----------------------------------------------------------------------------
-int64_t spevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
+// hegv_2stage alias to sygv_2stage
+inline void hegv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+    size_t* host_work_size )
+{
+    sygv_2stage_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                                 host_work_size );
+}
 
-// hpevx alias to spevx
-inline int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+    void* host_work, size_t host_work_size )
 {
-    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                        host_work, host_work_size );
 }
 
-int64_t spevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+void sygv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+    size_t* host_work_size );
 
-// hpevx alias to spevx
-inline int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+    void* host_work, size_t host_work_size );
+
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
 {
-    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-// -----------------------------------------------------------------------------
-int64_t spgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float const* BP );
+// hegv_2stage alias to sygv_2stage
+inline void hegv_2stage_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size )
+{
+    sygv_2stage_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                                 host_work_size );
+}
 
-// hpgst alias to spgst
-inline int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float const* BP )
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size )
 {
-    return spgst( itype, uplo, n, AP, BP );
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                        host_work, host_work_size );
 }
 
-int64_t spgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double const* BP );
+// -----------------------------------------------------------------------------
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
 
-// hpgst alias to spgst
-inline int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double const* BP )
+void sygvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size );
+
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
 {
-    return spgst( itype, uplo, n, AP, BP );
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-// -----------------------------------------------------------------------------
-int64_t spgv(
+// hegvd alias to sygvd
+inline void hegvd_work_size_bytes(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     float* W,
-    float* Z, int64_t ldz );
+    size_t* host_work_size )
+{
+    sygvd_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                           host_work_size );
+}
 
-// hpgv alias to spgv
-inline int64_t hpgv(
+// hegvd alias to sygvd
+inline int64_t hegvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
     float* W,
-    float* Z, int64_t ldz )
+    void* host_work, size_t host_work_size )
 {
-    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                  host_work, host_work_size );
 }
 
-int64_t spgv(
+int64_t sygvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+void sygvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz );
+    size_t* host_work_size );
 
-// hpgv alias to spgv
-inline int64_t hpgv(
+int64_t sygvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
     double* W,
-    double* Z, int64_t ldz )
+    void* host_work, size_t host_work_size );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
 {
-    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
 }
 
-// -----------------------------------------------------------------------------
-int64_t spgvd(
+// hegvd alias to sygvd
+inline void hegvd_work_size_bytes(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz );
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size )
+{
+    sygvd_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                           host_work_size );
+}
 
-// hpgvd alias to spgvd
-inline int64_t hpgvd(
+// hegvd alias to sygvd
+inline int64_t hegvd(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz )
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size )
 {
-    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                  host_work, host_work_size );
 }
 
-int64_t spgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz );
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+void sygvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
 
-// hpgvd alias to spgvd
-inline int64_t hpgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz )
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
 {
-    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-// -----------------------------------------------------------------------------
-int64_t spgvx(
+// hegvx alias to sygvx
+inline void hegvx_work_size_bytes(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail );
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    sygvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           host_work_size );
+}
 
-// hpgvx alias to spgvx
-inline int64_t hpgvx(
+// hegvx alias to sygvx
+inline int64_t hegvx(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
 {
-    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work, host_work_size );
 }
 
-int64_t spgvx(
+int64_t sygvx(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
     int64_t* ifail );
 
-// hpgvx alias to spgvx
-inline int64_t hpgvx(
+void sygvx_work_size_bytes(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size );
+
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size );
+
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
-    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float const* AFP,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-// hprfs alias to sprfs
-inline int64_t hprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float const* AFP,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
+// hegvx alias to sygvx
+inline void hegvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
 {
-    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
+    sygvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           host_work_size );
 }
 
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double const* AFP,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
-
-// hprfs alias to sprfs
-inline int64_t hprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double const* AFP,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
 {
-    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work, host_work_size );
 }
 
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float> const* AFP,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double> const* AFP,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
-
 // -----------------------------------------------------------------------------
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+}  // end namespace lapack
+namespace blas {
 
-// hpsv alias to spsv
-inline int64_t hpsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
-{
-    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
-}
+void syr(
+    blas::Layout layout,
+    blas::Uplo uplo, int64_t n, std::complex<float> alpha,
+    std::complex<float> const* X, int64_t incx,
+    std::complex<float>* A, int64_t lda );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+void syr(
+    blas::Layout layout,
+    blas::Uplo uplo, int64_t n, std::complex<double> alpha,
+    std::complex<double> const* X, int64_t incx,
+    std::complex<double>* A, int64_t lda );
 
-// hpsv alias to spsv
-inline int64_t hpsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
-{
-    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
-}
+void symv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const *A, int64_t lda,
+    std::complex<float> const *x, int64_t incx,
+    std::complex<float> beta,
+    std::complex<float> *y, int64_t incy );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+void symv(
+    blas::Layout layout,
+    blas::Uplo uplo,
+    int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const*A, int64_t lda,
+    std::complex<double> const *x, int64_t incx,
+    std::complex<double> beta,
+    std::complex<double> *y, int64_t incy );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+}  // end namespace blas
+namespace lapack {
 
 // -----------------------------------------------------------------------------
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float* AFP,
-    int64_t* ipiv,
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr );
 
-// hpsvx alias to spsvx
-inline int64_t hpsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float* AFP,
-    int64_t* ipiv,
+// herfs alias to syrfs
+inline int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr )
 {
-    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
 }
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double* AFP,
-    int64_t* ipiv,
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr );
 
-// hpsvx alias to spsvx
-inline int64_t hpsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double* AFP,
-    int64_t* ipiv,
+// herfs alias to syrfs
+inline int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr )
 {
-    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
 }
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float>* AFP,
-    int64_t* ipiv,
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr );
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double>* AFP,
-    int64_t* ipiv,
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t sptrd(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* D,
-    float* E,
-    float* tau );
-
-// hptrd alias to sptrd
-inline int64_t hptrd(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* D,
-    float* E,
-    float* tau )
-{
-    return sptrd( uplo, n, AP, D, E, tau );
-}
-
-int64_t sptrd(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* D,
-    double* E,
-    double* tau );
-
-// hptrd alias to sptrd
-inline int64_t hptrd(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* D,
-    double* E,
-    double* tau )
-{
-    return sptrd( uplo, n, AP, D, E, tau );
-}
-
-// -----------------------------------------------------------------------------
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t* ipiv );
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
 
-// hptrf alias to sptrf
-inline int64_t hptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t* ipiv )
+// herfsx alias to syrfsx
+inline int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
 {
-    return sptrf( uplo, n, AP, ipiv );
+    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
 }
 
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t* ipiv );
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
 
-// hptrf alias to sptrf
-inline int64_t hptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t* ipiv )
+// herfsx alias to syrfsx
+inline int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
 {
-    return sptrf( uplo, n, AP, ipiv );
+    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
 }
 
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t* ipiv );
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
 
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t* ipiv );
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
 
 // -----------------------------------------------------------------------------
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t const* ipiv );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-// hptri alias to sptri
-inline int64_t hptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t const* ipiv )
-{
-    return sptri( uplo, n, AP, ipiv );
-}
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t const* ipiv );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// hptri alias to sptri
-inline int64_t hptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t const* ipiv )
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return sptri( uplo, n, AP, ipiv );
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t const* ipiv );
-
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t const* ipiv );
-
-// -----------------------------------------------------------------------------
-int64_t sptrs(
+// hesv alias to sysv
+inline void hesv_work_size_bytes(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    int64_t const* ipiv,
-    float* B, int64_t ldb );
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb, host_work_size );
+}
 
-// hptrs alias to sptrs
-inline int64_t hptrs(
+// hesv alias to sysv
+inline int64_t hesv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    int64_t const* ipiv,
-    float* B, int64_t ldb )
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                 host_work, host_work_size );
 }
 
-int64_t sptrs(
+int64_t sysv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    int64_t const* ipiv,
+    double* A, int64_t lda,
+    int64_t* ipiv,
     double* B, int64_t ldb );
 
-// hptrs alias to sptrs
-inline int64_t hptrs(
+void sysv_work_size_bytes(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    int64_t const* ipiv,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
     double* B, int64_t ldb )
 {
-    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sptrs(
+// hesv alias to sysv
+inline void hesv_work_size_bytes(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    int64_t const* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb, host_work_size );
+}
 
-int64_t sptrs(
+// hesv alias to sysv
+inline int64_t hesv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    int64_t const* ipiv,
-    std::complex<double>* B, int64_t ldb );
-
-// -----------------------------------------------------------------------------
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
-
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
-
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
-
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                 host_work, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t stein(
-    int64_t n,
-    float const* D,
-    float const* E, int64_t m,
-    float const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t stein(
-    int64_t n,
-    double const* D,
-    double const* E, int64_t m,
-    double const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-int64_t stein(
-    int64_t n,
-    float const* D,
-    float const* E, int64_t m,
-    float const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+#ifndef LAPACK_ILP64
 
-int64_t stein(
-    int64_t n,
-    double const* D,
-    double const* E, int64_t m,
-    double const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu,
-    int64_t* m,
-    float* W,
-    std::complex<float>* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu,
-    int64_t* m,
-    double* W,
-    std::complex<double>* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+// hesv alias to sysv
+inline void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                 host_work, host_work_size );
+}
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb );
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sterf(
-    int64_t n,
-    float* D,
-    float* E );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
 
-int64_t sterf(
-    int64_t n,
-    double* D,
-    double* E );
+// hesv alias to sysv
+inline void hesv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb, host_work_size );
+}
 
-// -----------------------------------------------------------------------------
-int64_t stev(
-    lapack::Job jobz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                 host_work, host_work_size );
+}
 
-int64_t stev(
-    lapack::Job jobz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t stevd(
-    lapack::Job jobz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
 
-int64_t stevd(
-    lapack::Job jobz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t stevr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
-int64_t stevr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+void sysv_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t stevx(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-int64_t stevx(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+#endif  // LAPACK_ILP64
 
 // -----------------------------------------------------------------------------
-template <typename scalar_t>
-int64_t sturm(
-    int64_t n, scalar_t const* diag,
-    scalar_t const* offd, scalar_t u);
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
 
-// hecon alias to sycon
-inline int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+// hesv_aa alias to sysv_aa
+inline void hesv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             host_work_size );
+}
 
-// hecon alias to sycon
-inline int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work, host_work_size );
 }
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-// sycon_rk wraps sycon_3
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// hecon_rk alias to sycon_rk
-inline int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// hesv_aa alias to sysv_aa
+inline void hesv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
 {
-    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             host_work_size );
 }
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
-
-// hecon_rk alias to sycon_rk
-inline int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work, host_work_size );
 }
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-// heequb alias to syequb
-inline int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax )
+void sysv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return syequb( uplo, n, A, lda, S, scond, amax );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
 }
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+// hesv_rk alias to sysv_rk
+inline void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_rk_work_size_bytes( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                             host_work_size );
+}
 
-// heequb alias to syequb
-inline int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax )
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return syequb( uplo, n, A, lda, S, scond, amax );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                    host_work, host_work_size );
 }
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+void sysv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t syev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* W );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// heev alias to syev
-inline int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* W )
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
 {
-    return syev( jobz, uplo, n, A, lda, W );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
 }
 
-int64_t syev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk alias to sysv_rk
+inline void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_rk_work_size_bytes( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                             host_work_size );
+}
 
-// heev alias to syev
-inline int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return syev( jobz, uplo, n, A, lda, W );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                    host_work, host_work_size );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void sysv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void sysv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+void sysv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W );
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// heev_2stage alias to syev_2stage
-inline int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return syev_2stage( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t syev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* W );
-
-// heev_2stage alias to syev_2stage
-inline int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* W )
+// hesv_rook alias to sysv_rook
+inline void hesv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
 {
-    return syev_2stage( jobz, uplo, n, A, lda, W );
+    sysv_rook_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                               host_work_size );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* W );
-
-// heevd alias to syevd
-inline int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return syevd( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      host_work, host_work_size );
 }
 
-int64_t syevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-// heevd alias to syevd
-inline int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sysv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
-{
-    return syevd( jobz, uplo, n, A, lda, W );
-}
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t syevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* W );
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
 
-// heevd_2stage alias to syevd_2stage
-inline int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* W )
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
 {
-    return syevd_2stage( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t syevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline void hesv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    sysv_rook_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                               host_work_size );
+}
 
-// heevd_2stage alias to syevd_2stage
-inline int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
 {
-    return syevd_2stage( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      host_work, host_work_size );
 }
 
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+void sysv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void sysv_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
-int64_t syevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// heevr alias to syevr
-inline int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz )
-{
-    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
-}
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size );
 
-int64_t syevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size );
 
-// heevr alias to syevr
-inline int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
 {
-    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+// hesvx alias to sysvx
+inline void hesvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size )
+{
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr,
+                           host_work_size );
+}
 
-// heevr_2stage alias to syevr_2stage
-inline int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size )
 {
-    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr,
+                  host_work, host_work_size );
 }
 
-int64_t syevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-// heevr_2stage alias to syevr_2stage
-inline int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz )
-{
-    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
-}
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t syevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size );
 
-// heevx alias to syevx
-inline int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
 {
-    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
 }
 
-int64_t syevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
-
-// heevx alias to syevx
-inline int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+// hesvx alias to sysvx
+inline void hesvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size )
 {
-    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr,
+                           host_work_size );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
-
-// heevx_2stage alias to syevx_2stage
-inline int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size )
 {
-    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr,
+                  host_work, host_work_size );
 }
 
-int64_t syevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// heevx_2stage alias to syevx_2stage
-inline int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sygst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* B, int64_t ldb );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size );
 
-// hegst alias to sygst
-inline int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* B, int64_t ldb )
-{
-    return sygst( itype, uplo, n, A, lda, B, ldb );
-}
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-int64_t sygst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb );
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size );
 
-// hegst alias to sygst
-inline int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb )
-{
-    return sygst( itype, uplo, n, A, lda, B, ldb );
-}
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t sygv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t i1, int64_t i2 );
 
-// hegv alias to sygv
-inline int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
+// heswapr alias to syswapr
+inline void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t i1, int64_t i2 )
 {
-    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return syswapr( uplo, n, A, lda, i1, i2 );
 }
 
-int64_t sygv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t i1, int64_t i2 );
 
-// hegv alias to sygv
-inline int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+// heswapr alias to syswapr
+inline void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t i1, int64_t i2 )
 {
-    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return syswapr( uplo, n, A, lda, i1, i2 );
 }
 
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
+
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
+
 // -----------------------------------------------------------------------------
-int64_t sygv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+    float* D,
+    float* E,
+    float* tau );
 
-// hegv_2stage alias to sygv_2stage
-inline int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
-{
-    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
-}
+    float* D,
+    float* E,
+    float* tau,
+    size_t* host_work_size );
 
-int64_t sygv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    void* host_work, size_t host_work_size );
 
-// hegv_2stage alias to sygv_2stage
-inline int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau )
 {
-    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sygvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline void hetrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+    float* D,
+    float* E,
+    float* tau,
+    size_t* host_work_size )
+{
+    sytrd_work_size_bytes( uplo, n, A, lda, D, E, tau, host_work_size );
+}
 
-// hegvd alias to sygvd
-inline int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
+    float* D,
+    float* E,
+    float* tau,
+    void* host_work, size_t host_work_size )
 {
-    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau, host_work, host_work_size );
 }
 
-int64_t sygvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+    double* D,
+    double* E,
+    double* tau );
 
-// hegvd alias to sygvd
-inline int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
-{
-    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
-}
+    double* D,
+    double* E,
+    double* tau,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sygvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    void* host_work, size_t host_work_size );
 
-// hegvx alias to sygvx
-inline int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau )
 {
-    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sytrd( uplo, n, A, lda, D, E, tau );
 }
 
-int64_t sygvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline void hetrd_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+    double* D,
+    double* E,
+    double* tau,
+    size_t* host_work_size )
+{
+    sytrd_work_size_bytes( uplo, n, A, lda, D, E, tau, host_work_size );
+}
 
-// hegvx alias to sygvx
-inline int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+    double* D,
+    double* E,
+    double* tau,
+    void* host_work, size_t host_work_size )
 {
-    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sytrd( uplo, n, A, lda, D, E, tau, host_work, host_work_size );
 }
 
 // -----------------------------------------------------------------------------
-}  // end namespace lapack
-namespace blas {
-
-void syr(
-    blas::Layout layout,
-    blas::Uplo uplo, int64_t n, std::complex<float> alpha,
-    std::complex<float> const* X, int64_t incx,
-    std::complex<float>* A, int64_t lda );
-
-void syr(
-    blas::Layout layout,
-    blas::Uplo uplo, int64_t n, std::complex<double> alpha,
-    std::complex<double> const* X, int64_t incx,
-    std::complex<double>* A, int64_t lda );
-
-void symv(
-    blas::Layout layout,
-    blas::Uplo uplo,
-    int64_t n,
-    std::complex<float> alpha,
-    std::complex<float> const *A, int64_t lda,
-    std::complex<float> const *x, int64_t incx,
-    std::complex<float> beta,
-    std::complex<float> *y, int64_t incy );
-
-void symv(
-    blas::Layout layout,
-    blas::Uplo uplo,
-    int64_t n,
-    std::complex<double> alpha,
-    std::complex<double> const*A, int64_t lda,
-    std::complex<double> const *x, int64_t incx,
-    std::complex<double> beta,
-    std::complex<double> *y, int64_t incy );
-
-}  // end namespace blas
-namespace lapack {
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 );
 
-// -----------------------------------------------------------------------------
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+void sytrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    size_t* host_work_size );
 
-// herfs alias to syrfs
-inline int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size );
+
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 )
 {
-    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
 }
 
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+// hetrd_2stage alias to sytrd_2stage
+inline void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    size_t* host_work_size )
+{
+    sytrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                                  host_work_size );
+}
 
-// herfs alias to syrfs
-inline int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
 {
-    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work, host_work_size );
 }
 
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 );
 
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+void sytrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size );
 
-// herfsx alias to syrfsx
-inline int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params )
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
 {
-    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
 }
 
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
-
-// herfsx alias to syrfsx
-inline int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params )
+// hetrd_2stage alias to sytrd_2stage
+inline void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    size_t* host_work_size )
 {
-    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+    sytrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                                  host_work_size );
 }
 
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
-
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
+{
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work, host_work_size );
+}
 
 // -----------------------------------------------------------------------------
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb );
+    size_t* host_work_size );
 
-// hesv alias to sysv
-inline int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb )
+    void* host_work, size_t host_work_size );
+
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
 {
-    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
-
-// hesv alias to sysv
-inline int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
+// hetrf alias to sytrf
+inline void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    size_t* host_work_size )
 {
-    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    sytrf_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
 }
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    void* host_work, size_t host_work_size )
+{
+    return sytrf( uplo, n, A, lda, ipiv, host_work, host_work_size );
+}
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb );
+    size_t* host_work_size );
 
-// hesv_aa alias to sysv_aa
-inline int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb )
+    void* host_work, size_t host_work_size );
+
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
 {
-    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb );
+    size_t* host_work_size )
+{
+    sytrf_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// hesv_aa alias to sysv_aa
-inline int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    void* host_work, size_t host_work_size )
 {
-    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    size_t* host_work_size );
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    float* E,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb );
+    void* host_work, size_t host_work_size );
 
-// hesv_rk alias to sysv_rk
-inline int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+#ifndef LAPACK_ILP64
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
+    lapack_int* ipiv );
+
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
+
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv )
 {
-    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+// hetrf alias to sytrf
+inline void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// hesv_rk alias to sysv_rk
-inline int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv );
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
 
-// hesv_rook alias to sysv_rook
-inline int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv )
 {
-    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline void hetrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+    lapack_int* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// hesv_rook alias to sysv_rook
-inline int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    lapack_int* ipiv );
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    lapack_int* ipiv );
+
+void sytrf_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    void* host_work, size_t host_work_size );
+
+#endif  // LAPACK_ILP64
 
 // -----------------------------------------------------------------------------
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float* AF, int64_t ldaf,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+void sytrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+    size_t* host_work_size );
 
-// hesvx alias to sysvx
-inline int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float* AF, int64_t ldaf,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr )
+    void* host_work, size_t host_work_size );
+
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
 {
-    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return sytrf_aa( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double* AF, int64_t ldaf,
+// hetrf_aa alias to sytrf_aa
+inline void hetrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+    size_t* host_work_size )
+{
+    sytrf_aa_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// hesvx alias to sysvx
-inline int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double* AF, int64_t ldaf,
-    int64_t* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr )
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return sytrf_aa( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float>* AF, int64_t ldaf,
-    int64_t* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double>* AF, int64_t ldaf,
+void sytrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, int64_t i1, int64_t i2 );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-// heswapr alias to syswapr
-inline void heswapr(
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, int64_t i1, int64_t i2 )
+    double* A, int64_t lda,
+    int64_t* ipiv )
 {
-    return syswapr( uplo, n, A, lda, i1, i2 );
+    return sytrf_aa( uplo, n, A, lda, ipiv );
 }
 
-void syswapr(
+// hetrf_aa alias to sytrf_aa
+inline void hetrf_aa_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, int64_t i1, int64_t i2 );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_aa_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// heswapr alias to syswapr
-inline void heswapr(
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, int64_t i1, int64_t i2 )
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return syswapr( uplo, n, A, lda, i1, i2 );
+    return sytrf_aa( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
 
-void syswapr(
+void sytrf_aa_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void sytrf_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
-int64_t sytrd(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau );
+    int64_t* ipiv );
 
-// hetrd alias to sytrd
-inline int64_t hetrd(
+void sytrf_rk_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau )
-{
-    return sytrd( uplo, n, A, lda, D, E, tau );
-}
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-int64_t sytrd(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* D,
-    double* E,
-    double* tau );
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-// hetrd alias to sytrd
-inline int64_t hetrd(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* D,
-    double* E,
-    double* tau )
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv )
 {
-    return sytrd( uplo, n, A, lda, D, E, tau );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sytrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrf_rk alias to sytrf_rk
+inline void hetrf_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau,
-    float* hous2, int64_t lhous2 );
+    int64_t* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_rk_work_size_bytes( uplo, n, A, lda, E, ipiv, host_work_size );
+}
 
-// hetrd_2stage alias to sytrd_2stage
-inline int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau,
-    float* hous2, int64_t lhous2 )
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv, host_work, host_work_size );
 }
 
-int64_t sytrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 );
+    int64_t* ipiv );
 
-// hetrd_2stage alias to sytrd_2stage
-inline int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrf_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 )
-{
-    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
-}
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sytrf(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* ipiv );
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-// hetrf alias to sytrf
-inline int64_t hetrf(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
+    double* A, int64_t lda,
+    double* E,
     int64_t* ipiv )
 {
-    return sytrf( uplo, n, A, lda, ipiv );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
 
-int64_t sytrf(
+// hetrf_rk alias to sytrf_rk
+inline void hetrf_rk_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv );
+    double* E,
+    int64_t* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_rk_work_size_bytes( uplo, n, A, lda, E, ipiv, host_work_size );
+}
 
-// hetrf alias to sytrf
-inline int64_t hetrf(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv )
+    double* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sytrf( uplo, n, A, lda, ipiv );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv, host_work, host_work_size );
 }
 
-int64_t sytrf(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
     int64_t* ipiv );
 
-int64_t sytrf(
+void sytrf_rk_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sytrf_aa(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* ipiv );
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-// hetrf_aa alias to sytrf_aa
-inline int64_t hetrf_aa(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* ipiv )
-{
-    return sytrf_aa( uplo, n, A, lda, ipiv );
-}
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv );
 
-int64_t sytrf_aa(
+void sytrf_rk_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t* ipiv );
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-// hetrf_aa alias to sytrf_aa
-inline int64_t hetrf_aa(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t* ipiv )
-{
-    return sytrf_aa( uplo, n, A, lda, ipiv );
-}
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-int64_t sytrf_aa(
+// -----------------------------------------------------------------------------
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
+    float* A, int64_t lda,
     int64_t* ipiv );
 
-int64_t sytrf_aa(
+void sytrf_rook_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
-int64_t sytrf_rk(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
-// hetrf_rk alias to sytrf_rk
-inline int64_t hetrf_rk(
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
     int64_t* ipiv )
 {
-    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv );
 }
 
-int64_t sytrf_rk(
+// hetrf_rook alias to sytrf_rook
+inline void hetrf_rook_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv );
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_rook_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
-// hetrf_rk alias to sytrf_rk
-inline int64_t hetrf_rk(
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv )
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
-int64_t sytrf_rk(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
+    double* A, int64_t lda,
     int64_t* ipiv );
 
-int64_t sytrf_rk(
+void sytrf_rook_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
-    int64_t* ipiv );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
 
-// -----------------------------------------------------------------------------
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* ipiv );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
 
 // hetrf_rook alias to sytrf_rook
 inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
+    double* A, int64_t lda,
     int64_t* ipiv )
 {
     return sytrf_rook( uplo, n, A, lda, ipiv );
 }
 
-int64_t sytrf_rook(
+// hetrf_rook alias to sytrf_rook
+inline void hetrf_rook_work_size_bytes(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    size_t* host_work_size )
+{
+    sytrf_rook_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
 
 // hetrf_rook alias to sytrf_rook
 inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size )
 {
-    return sytrf_rook( uplo, n, A, lda, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv, host_work, host_work_size );
 }
 
 int64_t sytrf_rook(
@@ -8779,11 +17675,35 @@ int64_t sytrf_rook(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv );
 
+void sytrf_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+void sytrf_rook_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    size_t* host_work_size );
+
+int64_t sytrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t sytri(
     lapack::Uplo uplo, int64_t n,
@@ -8829,6 +17749,18 @@ int64_t sytri2(
     float* A, int64_t lda,
     int64_t const* ipiv );
 
+void sytri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 // hetri2 alias to sytri2
 inline int64_t hetri2(
     lapack::Uplo uplo, int64_t n,
@@ -8838,11 +17770,43 @@ inline int64_t hetri2(
     return sytri2( uplo, n, A, lda, ipiv );
 }
 
+// hetri2 alias to sytri2
+inline void hetri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    sytri2_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
+
+// hetri2 alias to sytri2
+inline int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    return sytri2( uplo, n, A, lda, ipiv, host_work, host_work_size );
+}
+
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t const* ipiv );
 
+void sytri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 // hetri2 alias to sytri2
 inline int64_t hetri2(
     lapack::Uplo uplo, int64_t n,
@@ -8852,16 +17816,60 @@ inline int64_t hetri2(
     return sytri2( uplo, n, A, lda, ipiv );
 }
 
+// hetri2 alias to sytri2
+inline void hetri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    sytri2_work_size_bytes( uplo, n, A, lda, ipiv, host_work_size );
+}
+
+// hetri2 alias to sytri2
+inline int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    return sytri2( uplo, n, A, lda, ipiv, host_work, host_work_size );
+}
+
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv );
 
+void sytri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv );
 
+void sytri2_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 // sytri_rk wraps sytri_3
 int64_t sytri_rk(
@@ -8870,6 +17878,20 @@ int64_t sytri_rk(
     float const* E,
     int64_t const* ipiv );
 
+void sytri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 // hetri_rk alias to sytri_rk
 inline int64_t hetri_rk(
     lapack::Uplo uplo, int64_t n,
@@ -8880,12 +17902,48 @@ inline int64_t hetri_rk(
     return sytri_rk( uplo, n, A, lda, E, ipiv );
 }
 
+// hetri_rk alias to sytri_rk
+inline void hetri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    sytri_rk_work_size_bytes( uplo, n, A, lda, E, ipiv, host_work_size );
+}
+
+// hetri_rk alias to sytri_rk
+inline int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    return sytri_rk( uplo, n, A, lda, E, ipiv, host_work, host_work_size );
+}
+
 int64_t sytri_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double const* E,
     int64_t const* ipiv );
 
+void sytri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
 // hetri_rk alias to sytri_rk
 inline int64_t hetri_rk(
     lapack::Uplo uplo, int64_t n,
@@ -8893,33 +17951,129 @@ inline int64_t hetri_rk(
     double const* E,
     int64_t const* ipiv )
 {
-    return sytri_rk( uplo, n, A, lda, E, ipiv );
+    return sytri_rk( uplo, n, A, lda, E, ipiv );
+}
+
+// hetri_rk alias to sytri_rk
+inline void hetri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    sytri_rk_work_size_bytes( uplo, n, A, lda, E, ipiv, host_work_size );
+}
+
+// hetri_rk alias to sytri_rk
+inline int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    return sytri_rk( uplo, n, A, lda, E, ipiv, host_work, host_work_size );
+}
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv );
+
+void sytri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv );
+
+void sytri_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    size_t* host_work_size );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hetrs alias to sytrs
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hetrs alias to sytrs
+inline int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sytri_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv );
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t sytri_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv );
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+#ifndef LAPACK_ILP64
 
-// -----------------------------------------------------------------------------
 int64_t sytrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     float* B, int64_t ldb );
 
 // hetrs alias to sytrs
 inline int64_t hetrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     float* B, int64_t ldb )
 {
     return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
@@ -8928,14 +18082,14 @@ inline int64_t hetrs(
 int64_t sytrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     double* B, int64_t ldb );
 
 // hetrs alias to sytrs
 inline int64_t hetrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     double* B, int64_t ldb )
 {
     return sytrs( uplo, n, nrhs, A, lda, ipiv, B, ldb );
@@ -8944,15 +18098,17 @@ inline int64_t hetrs(
 int64_t sytrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     std::complex<float>* B, int64_t ldb );
 
 int64_t sytrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv,
+    lapack_int const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+#endif  // LAPACK_ILP64
+
 // -----------------------------------------------------------------------------
 int64_t sytrs2(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -9304,6 +18460,24 @@ int64_t tgexc(
     float* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst );
 
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size );
+
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size );
+
 int64_t tgexc(
     bool wantq, bool wantz, int64_t n,
     double* A, int64_t lda,
@@ -9312,6 +18486,24 @@ int64_t tgexc(
     double* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst );
 
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size );
+
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size );
+
 int64_t tgexc(
     bool wantq, bool wantz, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -9320,6 +18512,24 @@ int64_t tgexc(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst );
 
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size );
+
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size );
+
 int64_t tgexc(
     bool wantq, bool wantz, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -9328,6 +18538,24 @@ int64_t tgexc(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst );
 
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size );
+
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t tgsen(
     int64_t ijob, bool wantq, bool wantz,
@@ -9341,6 +18569,32 @@ int64_t tgsen(
     int64_t* sdim,
     float* pl, float* pr, float* dif );
 
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr, float* dif,
+    size_t* host_work_size );
+
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr, float* dif,
+    void* host_work, size_t host_work_size );
+
 int64_t tgsen(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
@@ -9353,6 +18607,32 @@ int64_t tgsen(
     int64_t* sdim,
     double* pl, double* pr, double* dif );
 
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr, double* dif,
+    size_t* host_work_size );
+
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr, double* dif,
+    void* host_work, size_t host_work_size );
+
 int64_t tgsen(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
@@ -9365,6 +18645,32 @@ int64_t tgsen(
     int64_t* sdim,
     float* pl, float* pr, float* dif );
 
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr, float* dif,
+    size_t* host_work_size );
+
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr, float* dif,
+    void* host_work, size_t host_work_size );
+
 int64_t tgsen(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
@@ -9377,6 +18683,32 @@ int64_t tgsen(
     int64_t* sdim,
     double* pl, double* pr, double* dif );
 
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr, double* dif,
+    size_t* host_work_size );
+
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr, double* dif,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t tgsja(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
@@ -9434,6 +18766,30 @@ int64_t tgsyl(
     float* dif,
     float* scale );
 
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    size_t* host_work_size );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    void* host_work, size_t host_work_size );
+
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     double const* A, int64_t lda,
@@ -9445,16 +18801,87 @@ int64_t tgsyl(
     double* dif,
     double* scale );
 
-int64_t tgsyl(
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    size_t* host_work_size );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    void* host_work, size_t host_work_size );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale );
+
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    size_t* host_work_size );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    void* host_work, size_t host_work_size );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale );
+
+void tgsyl_work_size_bytes(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* C, int64_t ldc,
-    std::complex<float> const* D, int64_t ldd,
-    std::complex<float> const* E, int64_t lde,
-    std::complex<float>* F, int64_t ldf,
-    float* dif,
-    float* scale );
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    size_t* host_work_size );
 
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
@@ -9465,7 +18892,8 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale );
+    double* scale,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
 int64_t tpcon(
@@ -9800,6 +19228,51 @@ int64_t tpttr(
     std::complex<double> const* AP,
     std::complex<double>* A, int64_t lda );
 
+// -----------------------------------------------------------------------------
+void transpose(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
+
+void transpose(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+void transpose(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+void transpose(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+void transpose(
+    int64_t n, float* A, int64_t lda );
+
+void transpose(
+    int64_t n, double* A, int64_t lda );
+
+void transpose(
+    int64_t n, std::complex<float>* A, int64_t lda );
+
+void transpose(
+    int64_t n, std::complex<double>* A, int64_t lda );
+
+void transpose(
+    int64_t m, int64_t n, float* A );
+
+void transpose(
+    int64_t m, int64_t n, double* A );
+
+void transpose(
+    int64_t m, int64_t n, std::complex<float>* A );
+
+void transpose(
+    int64_t m, int64_t n, std::complex<double>* A );
+
 // -----------------------------------------------------------------------------
 int64_t trcon(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
@@ -9863,6 +19336,24 @@ int64_t trevc3(
     float* VR, int64_t ldvr,
     int64_t mm, int64_t* m );
 
+void trevc3_work_size_bytes(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    size_t* host_work_size );
+
+int64_t trevc3(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    void* host_work, size_t host_work_size );
+
 int64_t trevc3(
     lapack::Sides side, lapack::HowMany howmany,
     bool* select, int64_t n,
@@ -9871,6 +19362,24 @@ int64_t trevc3(
     double* VR, int64_t ldvr,
     int64_t mm, int64_t* m );
 
+void trevc3_work_size_bytes(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    size_t* host_work_size );
+
+int64_t trevc3(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    void* host_work, size_t host_work_size );
+
 int64_t trevc3(
     lapack::Sides side, lapack::HowMany howmany,
     bool const* select, int64_t n,
@@ -9879,6 +19388,24 @@ int64_t trevc3(
     std::complex<float>* VR, int64_t ldvr,
     int64_t mm, int64_t* m );
 
+void trevc3_work_size_bytes(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    size_t* host_work_size );
+
+int64_t trevc3(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    void* host_work, size_t host_work_size );
+
 int64_t trevc3(
     lapack::Sides side, lapack::HowMany howmany,
     bool const* select, int64_t n,
@@ -9887,6 +19414,24 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr,
     int64_t mm, int64_t* m );
 
+void trevc3_work_size_bytes(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    size_t* host_work_size );
+
+int64_t trevc3(
+    lapack::Sides side, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    int64_t mm, int64_t* m,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t trexc(
     lapack::Job compq, int64_t n,
@@ -9956,6 +19501,28 @@ int64_t trsen(
     float* s,
     float* sep );
 
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    size_t* host_work_size );
+
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    void* host_work, size_t host_work_size );
+
 int64_t trsen(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
@@ -9966,6 +19533,28 @@ int64_t trsen(
     double* s,
     double* sep );
 
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    size_t* host_work_size );
+
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    void* host_work, size_t host_work_size );
+
 int64_t trsen(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
@@ -9976,6 +19565,28 @@ int64_t trsen(
     float* s,
     float* sep );
 
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    size_t* host_work_size );
+
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    void* host_work, size_t host_work_size );
+
 int64_t trsen(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
@@ -9986,6 +19597,28 @@ int64_t trsen(
     double* s,
     double* sep );
 
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    size_t* host_work_size );
+
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
@@ -10072,53 +19705,173 @@ int64_t tzrzf(
     float* A, int64_t lda,
     float* tau );
 
+void tzrzf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t tzrzf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* tau );
 
+void tzrzf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t tzrzf(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau );
 
+void tzrzf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t tzrzf(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void tzrzf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t ungbr(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void ungbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t ungbr(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
+int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unghr(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void unghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+void unghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
 int64_t unghr(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
+// -----------------------------------------------------------------------------
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau );
+
+void unglq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
-// -----------------------------------------------------------------------------
-int64_t unglq(
+void unglq_work_size_bytes(
     int64_t m, int64_t n, int64_t k,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float> const* tau );
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
 
 int64_t unglq(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
-    std::complex<double> const* tau );
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
 
 // -----------------------------------------------------------------------------
 int64_t ungql(
@@ -10126,44 +19879,140 @@ int64_t ungql(
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void ungql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t ungql(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungql_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
+int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t ungqr(
     int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t ungqr(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
+int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t ungrq(
     int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void ungrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t ungrq(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungrq_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
+int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t ungtr(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
+void ungtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    size_t* host_work_size );
+
+int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    void* host_work, size_t host_work_size );
+
 int64_t ungtr(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungtr_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    size_t* host_work_size );
+
+int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmbr(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10171,12 +20020,40 @@ int64_t unmbr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmbr(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmhr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
@@ -10184,12 +20061,40 @@ int64_t unmhr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmhr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10197,12 +20102,40 @@ int64_t unmlq(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmlq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmql(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10210,12 +20143,40 @@ int64_t unmql(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmql(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmql_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10223,12 +20184,40 @@ int64_t unmqr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmrq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10236,12 +20225,40 @@ int64_t unmrq(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmrq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmrq_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmrz(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
@@ -10249,12 +20266,40 @@ int64_t unmrz(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmrz(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmrz_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t unmtr(
     lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
@@ -10262,12 +20307,40 @@ int64_t unmtr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc );
 
+void unmtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 int64_t unmtr(
     lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmtr_work_size_bytes(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size );
+
+int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size );
+
 // -----------------------------------------------------------------------------
 int64_t upgtr(
     lapack::Uplo uplo, int64_t n,
@@ -0,0 +1,276 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/backend.hh"
+#include "lapack/workspace.hh"
+#include "backend_dispatch.hh"
+
+#include <cstdlib>
+#include <forward_list>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#ifndef _WIN32
+    #include <dlfcn.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Backends and routine bindings, set up from the environment on first use.
+/// Handles are never closed and entries never freed, since functions
+/// may still be cached.
+struct Registry
+{
+    std::mutex mutex;
+    std::map< std::string, void* > libraries;
+    std::map< std::string, std::string > routines;
+    std::forward_list< internal::BackendEntry > entries;
+    std::atomic< int64_t > generation { 0 };
+};
+
+const char* const linked_name = "linked";
+
+//------------------------------------------------------------------------------
+std::string trim( std::string const& str )
+{
+    const char* space = " \t\r\n";
+    size_t begin = str.find_first_not_of( space );
+    if (begin == std::string::npos)
+        return "";
+    size_t end = str.find_last_not_of( space );
+    return str.substr( begin, end - begin + 1 );
+}
+
+//------------------------------------------------------------------------------
+/// Calls func( key, value ) for each "key=value" entry in
+/// ";"-separated list. Throws Error on entries without "=".
+template <typename Func>
+void parse_list( const char* var, Func&& func )
+{
+    const char* value = std::getenv( var );
+    if (value == nullptr)
+        return;
+
+    std::istringstream list( value );
+    std::string entry;
+    while (std::getline( list, entry, ';' )) {
+        entry = trim( entry );
+        if (entry.empty())
+            continue;
+        size_t eq = entry.find( '=' );
+        if (eq == std::string::npos) {
+            throw Error( std::string( var ) + ": expected name=value, got '"
+                         + entry + "'" );
+        }
+        func( trim( entry.substr( 0, eq ) ), trim( entry.substr( eq + 1 ) ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Versions without locking, for use while the registry is locked.
+
+/// Invalidates cached functions and cached workspace sizes, since the
+/// newly bound routines may request different workspace.
+void rebind_locked( Registry& reg )
+{
+    reg.generation += 1;
+    work_query_cache_clear();
+}
+
+void load_locked( Registry& reg, std::string const& name,
+                  std::string const& path )
+{
+    if (name.empty() || name == linked_name)
+        throw Error( "invalid backend name '" + name + "'" );
+
+    #ifndef _WIN32
+        // Prefer the library's own symbols, so its LAPACK calls its own BLAS
+        // rather than the linked one.
+        int flags = RTLD_NOW | RTLD_LOCAL;
+        #ifdef RTLD_DEEPBIND
+            flags |= RTLD_DEEPBIND;
+        #endif
+        void* handle = dlopen( path.c_str(), flags );
+        if (handle == nullptr) {
+            const char* msg = dlerror();
+            throw Error( "cannot load backend " + name + " from " + path + ": "
+                         + (msg ? msg : "unknown error") );
+        }
+        reg.libraries[ name ] = handle;
+        rebind_locked( reg );
+    #else
+        throw Error( "runtime backends are not supported on Windows" );
+    #endif
+}
+
+void set_locked( Registry& reg, std::string const& routine,
+                 std::string const& name )
+{
+    if (name.empty()) {
+        reg.routines.erase( routine );
+    }
+    else {
+        if (name != linked_name && reg.libraries.count( name ) == 0)
+            throw Error( "unknown backend '" + name + "'" );
+        reg.routines[ routine ] = name;
+    }
+    rebind_locked( reg );
+}
+
+void config_locked( Registry& reg, std::string const& filename )
+{
+    std::ifstream file( filename );
+    if (! file)
+        throw Error( "cannot read backend config " + filename );
+
+    std::string line;
+    int64_t line_num = 0;
+    while (std::getline( file, line )) {
+        ++line_num;
+        line = line.substr( 0, line.find( '#' ) );
+        std::istringstream words( line );
+        std::string kind, key, value, extra;
+        if (! (words >> kind))
+            continue;
+        if (! (words >> key >> value) || (words >> extra)
+            || (kind != "library" && kind != "routine")) {
+            throw Error( filename + ":" + std::to_string( line_num )
+                         + ": expected 'library <name> <path>' or"
+                         " 'routine <routine> <name>'" );
+        }
+        if (kind == "library")
+            load_locked( reg, key, value );
+        else
+            set_locked( reg, key, value );
+    }
+}
+
+std::string get_locked( Registry const& reg, std::string const& routine )
+{
+    // exact name, name without precision, then default
+    std::vector< std::string > keys { routine };
+    if (routine.size() > 1 && std::string( "sdcz" ).find( routine[ 0 ] )
+                              != std::string::npos)
+        keys.push_back( routine.substr( 1 ) );
+    keys.push_back( "default" );
+
+    for (auto const& key : keys) {
+        auto iter = reg.routines.find( key );
+        if (iter != reg.routines.end())
+            return iter->second;
+    }
+    return linked_name;
+}
+
+//------------------------------------------------------------------------------
+Registry& registry()
+{
+    static Registry reg;
+    static std::once_flag once;
+    std::call_once( once, [] {
+        std::lock_guard< std::mutex > lock( reg.mutex );
+        const char* filename = std::getenv( "LAPACKPP_BACKEND_CONFIG" );
+        if (filename != nullptr && filename[ 0 ] != '\0')
+            config_locked( reg, filename );
+        parse_list( "LAPACKPP_BACKEND_LIBRARIES",
+            [&]( std::string const& name, std::string const& path ) {
+                load_locked( reg, name, path );
+            } );
+        parse_list( "LAPACKPP_BACKEND_ROUTINES",
+            [&]( std::string const& routine, std::string const& name ) {
+                set_locked( reg, routine, name );
+            } );
+    } );
+    return reg;
+}
+
+}  // namespace
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+int64_t backend_generation()
+{
+    return registry().generation.load( std::memory_order_acquire );
+}
+
+//------------------------------------------------------------------------------
+/// @return entry with the symbol from the backend that routine name is
+/// bound to, or nullptr if it is bound to the linked library, and the
+/// generation of the bindings it was looked up in.
+/// Throws Error if the backend lacks the symbol.
+BackendEntry const* backend_lookup( const char* name, const char* symbol )
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    std::string backend = get_locked( reg, name );
+
+    void* func = nullptr;
+    if (backend != linked_name) {
+        #ifndef _WIN32
+            func = dlsym( reg.libraries.at( backend ), symbol );
+        #endif
+        if (func == nullptr) {
+            throw Error( std::string( "backend " ) + backend + " lacks "
+                         + symbol + " for " + name );
+        }
+    }
+    reg.entries.push_front(
+        BackendEntry { reg.generation.load( std::memory_order_relaxed ), func } );
+    return &reg.entries.front();
+}
+
+}  // namespace internal
+
+//==============================================================================
+void backend_load( std::string const& name, std::string const& path )
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    load_locked( reg, name, path );
+}
+
+//------------------------------------------------------------------------------
+void backend_set( std::string const& routine, std::string const& name )
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    set_locked( reg, routine, name );
+}
+
+//------------------------------------------------------------------------------
+std::string backend_get( std::string const& routine )
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    return get_locked( reg, routine );
+}
+
+//------------------------------------------------------------------------------
+std::vector< std::string > backend_names()
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    std::vector< std::string > names { linked_name };
+    for (auto const& lib : reg.libraries)
+        names.push_back( lib.first );
+    return names;
+}
+
+//------------------------------------------------------------------------------
+void backend_config( std::string const& filename )
+{
+    Registry& reg = registry();
+    std::lock_guard< std::mutex > lock( reg.mutex );
+    config_locked( reg, filename );
+}
+
+}  // namespace lapack
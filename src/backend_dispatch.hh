@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BACKEND_DISPATCH_HH
+#define LAPACK_BACKEND_DISPATCH_HH
+
+// Include after lapack/fortran.h. Redefines the LAPACK_xyz macros of
+// dispatched routines so unchanged call sites, e.g., LAPACK_dgetrf( ... ),
+// call the function bound at runtime (see lapack/backend.hh).
+
+#include "lapack/backend.hh"
+#include "lapack/fortran.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Function bound to a routine, and the generation of the bindings it was
+/// looked up in. Immutable, so both are read consistently.
+struct BackendEntry
+{
+    int64_t generation;
+    void* func;
+};
+
+//------------------------------------------------------------------------------
+/// Per call site cache of the bound function. Valid while its generation
+/// matches backend_generation(), which changes whenever bindings change.
+struct BackendCache
+{
+    std::atomic< BackendEntry const* > entry { nullptr };
+};
+
+int64_t backend_generation();
+
+BackendEntry const* backend_lookup( const char* name, const char* symbol );
+
+//------------------------------------------------------------------------------
+/// @return function bound to routine name (e.g., "dgetrf"), looked up as
+/// symbol in its backend, or linked if bound to the linked library.
+template <typename Func>
+Func backend_function(
+    BackendCache& cache, const char* name, const char* symbol, Func linked )
+{
+    BackendEntry const* entry = cache.entry.load( std::memory_order_acquire );
+    if (entry == nullptr || entry->generation != backend_generation()) {
+        entry = backend_lookup( name, symbol );
+        cache.entry.store( entry, std::memory_order_release );
+    }
+    return entry->func ? reinterpret_cast< Func >( entry->func ) : linked;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#define LAPACK_BACKEND_STR_( x ) #x
+#define LAPACK_BACKEND_STR( x ) LAPACK_BACKEND_STR_( x )
+
+/// Expression giving the function pointer bound to Fortran routine lower.
+#define LAPACK_BACKEND( lower, UPPER ) \
+    ([]() { \
+        static lapack::internal::BackendCache cache_; \
+        return lapack::internal::backend_function( \
+            cache_, #lower, LAPACK_BACKEND_STR( LAPACK_GLOBAL( lower, UPPER ) ), \
+            &LAPACK_GLOBAL( lower, UPPER ) ); \
+    }())
+
+//------------------------------------------------------------------------------
+// Dispatched routines. Routines with character arguments redefine the _base
+// macro, which the LAPACK_xyz( ... ) macro calls with any string lengths.
+
+// LU
+#undef  LAPACK_sgesv
+#define LAPACK_sgesv LAPACK_BACKEND( sgesv, SGESV )
+#undef  LAPACK_dgesv
+#define LAPACK_dgesv LAPACK_BACKEND( dgesv, DGESV )
+#undef  LAPACK_cgesv
+#define LAPACK_cgesv LAPACK_BACKEND( cgesv, CGESV )
+#undef  LAPACK_zgesv
+#define LAPACK_zgesv LAPACK_BACKEND( zgesv, ZGESV )
+
+#undef  LAPACK_sgetrf
+#define LAPACK_sgetrf LAPACK_BACKEND( sgetrf, SGETRF )
+#undef  LAPACK_dgetrf
+#define LAPACK_dgetrf LAPACK_BACKEND( dgetrf, DGETRF )
+#undef  LAPACK_cgetrf
+#define LAPACK_cgetrf LAPACK_BACKEND( cgetrf, CGETRF )
+#undef  LAPACK_zgetrf
+#define LAPACK_zgetrf LAPACK_BACKEND( zgetrf, ZGETRF )
+
+#undef  LAPACK_sgetrs_base
+#define LAPACK_sgetrs_base LAPACK_BACKEND( sgetrs, SGETRS )
+#undef  LAPACK_dgetrs_base
+#define LAPACK_dgetrs_base LAPACK_BACKEND( dgetrs, DGETRS )
+#undef  LAPACK_cgetrs_base
+#define LAPACK_cgetrs_base LAPACK_BACKEND( cgetrs, CGETRS )
+#undef  LAPACK_zgetrs_base
+#define LAPACK_zgetrs_base LAPACK_BACKEND( zgetrs, ZGETRS )
+
+// Cholesky
+#undef  LAPACK_sposv_base
+#define LAPACK_sposv_base LAPACK_BACKEND( sposv, SPOSV )
+#undef  LAPACK_dposv_base
+#define LAPACK_dposv_base LAPACK_BACKEND( dposv, DPOSV )
+#undef  LAPACK_cposv_base
+#define LAPACK_cposv_base LAPACK_BACKEND( cposv, CPOSV )
+#undef  LAPACK_zposv_base
+#define LAPACK_zposv_base LAPACK_BACKEND( zposv, ZPOSV )
+
+#undef  LAPACK_spotrf_base
+#define LAPACK_spotrf_base LAPACK_BACKEND( spotrf, SPOTRF )
+#undef  LAPACK_dpotrf_base
+#define LAPACK_dpotrf_base LAPACK_BACKEND( dpotrf, DPOTRF )
+#undef  LAPACK_cpotrf_base
+#define LAPACK_cpotrf_base LAPACK_BACKEND( cpotrf, CPOTRF )
+#undef  LAPACK_zpotrf_base
+#define LAPACK_zpotrf_base LAPACK_BACKEND( zpotrf, ZPOTRF )
+
+#undef  LAPACK_spotrs_base
+#define LAPACK_spotrs_base LAPACK_BACKEND( spotrs, SPOTRS )
+#undef  LAPACK_dpotrs_base
+#define LAPACK_dpotrs_base LAPACK_BACKEND( dpotrs, DPOTRS )
+#undef  LAPACK_cpotrs_base
+#define LAPACK_cpotrs_base LAPACK_BACKEND( cpotrs, CPOTRS )
+#undef  LAPACK_zpotrs_base
+#define LAPACK_zpotrs_base LAPACK_BACKEND( zpotrs, ZPOTRS )
+
+// QR and least squares
+#undef  LAPACK_sgeqrf
+#define LAPACK_sgeqrf LAPACK_BACKEND( sgeqrf, SGEQRF )
+#undef  LAPACK_dgeqrf
+#define LAPACK_dgeqrf LAPACK_BACKEND( dgeqrf, DGEQRF )
+#undef  LAPACK_cgeqrf
+#define LAPACK_cgeqrf LAPACK_BACKEND( cgeqrf, CGEQRF )
+#undef  LAPACK_zgeqrf
+#define LAPACK_zgeqrf LAPACK_BACKEND( zgeqrf, ZGEQRF )
+
+#undef  LAPACK_sgels_base
+#define LAPACK_sgels_base LAPACK_BACKEND( sgels, SGELS )
+#undef  LAPACK_dgels_base
+#define LAPACK_dgels_base LAPACK_BACKEND( dgels, DGELS )
+#undef  LAPACK_cgels_base
+#define LAPACK_cgels_base LAPACK_BACKEND( cgels, CGELS )
+#undef  LAPACK_zgels_base
+#define LAPACK_zgels_base LAPACK_BACKEND( zgels, ZGELS )
+
+// SVD
+#undef  LAPACK_sgesvd_base
+#define LAPACK_sgesvd_base LAPACK_BACKEND( sgesvd, SGESVD )
+#undef  LAPACK_dgesvd_base
+#define LAPACK_dgesvd_base LAPACK_BACKEND( dgesvd, DGESVD )
+#undef  LAPACK_cgesvd_base
+#define LAPACK_cgesvd_base LAPACK_BACKEND( cgesvd, CGESVD )
+#undef  LAPACK_zgesvd_base
+#define LAPACK_zgesvd_base LAPACK_BACKEND( zgesvd, ZGESVD )
+
+#undef  LAPACK_sgesdd_base
+#define LAPACK_sgesdd_base LAPACK_BACKEND( sgesdd, SGESDD )
+#undef  LAPACK_dgesdd_base
+#define LAPACK_dgesdd_base LAPACK_BACKEND( dgesdd, DGESDD )
+#undef  LAPACK_cgesdd_base
+#define LAPACK_cgesdd_base LAPACK_BACKEND( cgesdd, CGESDD )
+#undef  LAPACK_zgesdd_base
+#define LAPACK_zgesdd_base LAPACK_BACKEND( zgesdd, ZGESDD )
+
+// symmetric/Hermitian eigenvalues
+#undef  LAPACK_ssyevd_base
+#define LAPACK_ssyevd_base LAPACK_BACKEND( ssyevd, SSYEVD )
+#undef  LAPACK_dsyevd_base
+#define LAPACK_dsyevd_base LAPACK_BACKEND( dsyevd, DSYEVD )
+#undef  LAPACK_cheevd_base
+#define LAPACK_cheevd_base LAPACK_BACKEND( cheevd, CHEEVD )
+#undef  LAPACK_zheevd_base
+#define LAPACK_zheevd_base LAPACK_BACKEND( zheevd, ZHEEVD )
+
+#endif // LAPACK_BACKEND_DISPATCH_HH
@@ -0,0 +1,150 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_INTERNAL_HH
+#define LAPACK_BATCH_INTERNAL_HH
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return v[ i ] if v has an entry per problem,
+/// or v[ 0 ] if v has one entry shared by all problems.
+template <typename T>
+inline T extract( std::vector< T > const& v, size_t i )
+{
+    return v.size() == 1 ? v[ 0 ] : v[ i ];
+}
+
+//------------------------------------------------------------------------------
+/// Throws Error unless v has 1 or batch_size entries.
+template <typename T>
+inline void check_batch_arg(
+    std::vector< T > const& v, size_t batch_size, const char* name )
+{
+    lapack_error_if_msg( v.size() != 1 && v.size() != batch_size,
+                         "%s has %lld entries; expected 1 or batch_size %lld",
+                         name, llong( v.size() ), llong( batch_size ) );
+}
+
+//------------------------------------------------------------------------------
+// Process-wide vendor BLAS thread count, shared with ThreadScope;
+// defined in thread_scope.cc. No-ops without MKL or OpenBLAS.
+int64_t blas_threads_push( int num_threads );
+void blas_threads_pop( int64_t token );
+
+//------------------------------------------------------------------------------
+/// While in scope, sets the vendor BLAS (MKL or OpenBLAS) to one thread,
+/// so problems in a batch can run in parallel, one per core, without
+/// oversubscribing cores. Restores the previous setting when destroyed.
+/// The setting is process-wide, so construct this outside the parallel
+/// region. Does nothing if OpenMP has only one thread, since then
+/// problems run sequentially and can use threaded BLAS.
+class SingleThreadBlas
+{
+public:
+    SingleThreadBlas():
+        token_( -1 )
+    {
+        #ifdef _OPENMP
+            if (omp_get_max_threads() > 1 && ! omp_in_parallel()) {
+                token_ = blas_threads_push( 1 );
+            }
+        #endif
+    }
+
+    ~SingleThreadBlas()
+    {
+        if (token_ >= 0)
+            blas_threads_pop( token_ );
+    }
+
+    SingleThreadBlas( SingleThreadBlas const& ) = delete;
+    SingleThreadBlas& operator = ( SingleThreadBlas const& ) = delete;
+
+private:
+    int64_t token_;
+};
+
+//------------------------------------------------------------------------------
+/// @return maximum number of OpenMP threads, or 1 without OpenMP.
+inline int batch_max_threads()
+{
+    #ifdef _OPENMP
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+/// @return OpenMP thread number, or 0 without OpenMP.
+inline int batch_thread_num()
+{
+    #ifdef _OPENMP
+        return omp_get_thread_num();
+    #else
+        return 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Calls func( i, work ) for each problem i in [0, batch_size),
+/// in parallel using OpenMP with dynamic scheduling, since problems may
+/// differ in size. work is per-thread scratch space of work_size bytes,
+/// aligned to 64 bytes, reused by all the problems a thread solves.
+/// Scratch for all threads is one allocation, made before the
+/// parallel region, so it cannot fail inside the region.
+///
+/// Arguments must be checked beforehand: func must not throw.
+template <typename Func>
+void batch_for_work( size_t batch_size, size_t work_size, Func&& func )
+{
+    SingleThreadBlas blas_threads;
+
+    // round up so each thread's scratch is aligned and on its own cache lines
+    const size_t align = 64;
+    size_t stride = (work_size + align - 1) / align * align;
+    lapack::vector< char > work( blas::max( size_t( 1 ),
+                                            stride * batch_max_threads() ) );
+
+    #pragma omp parallel
+    {
+        void* work_thread = &work[ stride * batch_thread_num() ];
+
+        #pragma omp for schedule( dynamic )
+        for (int64_t i = 0; i < int64_t( batch_size ); ++i) {
+            func( i, work_thread );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Calls func( i, ipiv_ ) for each problem i in [0, batch_size),
+/// in parallel, as batch_for_work. ipiv_ is per-thread scratch space
+/// for max_ipiv 32-bit pivots, reused by all the problems a thread solves.
+///
+/// Arguments must be checked beforehand: func must not throw.
+template <typename Func>
+void batch_for( size_t batch_size, int64_t max_ipiv, Func&& func )
+{
+    batch_for_work( batch_size, max_ipiv * sizeof( lapack_int ),
+        [&]( int64_t i, void* work ) {
+            func( i, (lapack_int*) work );
+        } );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_INTERNAL_HH
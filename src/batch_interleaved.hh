@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_INTERLEAVED_HH
+#define LAPACK_BATCH_INTERLEAVED_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+
+// Kernels for batches stored in interleaved (batch-innermost) layout:
+// element (r, c) of problem k is at A[ k + (r + c*lda)*batch_size ].
+// Each kernel works on a chunk of problems [k0, k1), k1 - k0 <= chunk_size,
+// with the innermost loop over problems in the chunk. That loop is
+// contiguous in memory and has no dependencies, so the compiler can
+// vectorize across the batch, which pays off for tiny matrices where
+// vectorizing within a problem cannot.
+
+namespace lapack {
+namespace internal {
+
+/// Number of problems per chunk in interleaved kernels.
+/// Large enough to fill vector registers, small enough that a chunk's
+/// per-problem scratch stays on the stack.
+const int64_t interleaved_chunk_size = 64;
+
+//------------------------------------------------------------------------------
+/// Calls func( k0, k1 ) for each chunk [k0, k1) of [0, batch_size),
+/// in parallel using OpenMP. Chunks are the same size,
+/// so static scheduling suffices.
+///
+/// Arguments must be checked beforehand: func must not throw.
+template <typename Func>
+void interleaved_for( size_t batch_size, Func&& func )
+{
+    const int64_t chunk = interleaved_chunk_size;
+    int64_t nchunks = (int64_t( batch_size ) + chunk - 1) / chunk;
+
+    #pragma omp parallel for schedule( static )
+    for (int64_t c = 0; c < nchunks; ++c) {
+        int64_t k0 = c*chunk;
+        int64_t k1 = blas::min( k0 + chunk, int64_t( batch_size ) );
+        func( k0, k1 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Unblocked Cholesky factorization of problems [k0, k1) of an interleaved
+/// batch, as in `lapack::potrf`. Sets info[k] for each problem.
+/// If problem k is not positive definite, its info is set as in potrf
+/// and the rest of its factorization is skipped: each update selects the
+/// old value for it, so other problems in the chunk proceed in lockstep.
+/// A select, unlike multiplying by 0, leaves the problem unchanged even
+/// if it holds Inf or NaN.
+///
+/// @param[out] ok
+///     Array of length k1 - k0. On exit, ok[k - k0] is 1 if problem k
+///     was factored successfully, otherwise 0.
+///
+template <typename scalar_t>
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t batch_size,
+    int64_t k0, int64_t k1, int64_t* info,
+    blas::real_type< scalar_t >* ok )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    const int64_t nb = k1 - k0;
+    real_t scale[ interleaved_chunk_size ];
+
+    // Pointer to element (r, c) of problem k0.
+    auto Aptr = [&]( int64_t r, int64_t c ) {
+        return A + k0 + (r + c*lda)*batch_size;
+    };
+
+    for (int64_t kk = 0; kk < nb; ++kk) {
+        info[ k0 + kk ] = 0;
+        ok[ kk ] = 1;
+    }
+
+    for (int64_t j = 0; j < n; ++j) {
+        // diagonal; failed problems get scale 1 and ok 0,
+        // leaving them unchanged from here on
+        scalar_t* Ajj = Aptr( j, j );
+        for (int64_t kk = 0; kk < nb; ++kk) {
+            real_t ajj = real( Ajj[ kk ] );
+            if (ok[ kk ] != 0 && ajj > 0) {
+                ajj = std::sqrt( ajj );
+                Ajj[ kk ] = ajj;
+                scale[ kk ] = 1 / ajj;
+            }
+            else {
+                if (ok[ kk ] != 0)
+                    info[ k0 + kk ] = j + 1;
+                ok[ kk ] = 0;
+                scale[ kk ] = 1;
+            }
+        }
+
+        if (uplo == lapack::Uplo::Lower) {
+            // L(j+1:n, j) = A(j+1:n, j) / L(j, j)
+            for (int64_t i = j+1; i < n; ++i) {
+                scalar_t* Aij = Aptr( i, j );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Aij[ kk ] *= scale[ kk ];
+            }
+            // A(j+1:n, j+1:n) -= L(j+1:n, j) L(j+1:n, j)^H, lower triangle
+            for (int64_t l = j+1; l < n; ++l) {
+                scalar_t const* Alj = Aptr( l, j );
+                for (int64_t i = l; i < n; ++i) {
+                    scalar_t const* Aij = Aptr( i, j );
+                    scalar_t* Ail = Aptr( i, l );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        Ail[ kk ] = ok[ kk ] != 0
+                                  ? Ail[ kk ] - Aij[ kk ] * conj( Alj[ kk ] )
+                                  : Ail[ kk ];
+                }
+            }
+        }
+        else {
+            // U(j, j+1:n) = A(j, j+1:n) / U(j, j)
+            for (int64_t i = j+1; i < n; ++i) {
+                scalar_t* Aji = Aptr( j, i );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Aji[ kk ] *= scale[ kk ];
+            }
+            // A(j+1:n, j+1:n) -= U(j, j+1:n)^H U(j, j+1:n), upper triangle
+            for (int64_t i = j+1; i < n; ++i) {
+                scalar_t const* Aji = Aptr( j, i );
+                for (int64_t l = j+1; l <= i; ++l) {
+                    scalar_t const* Ajl = Aptr( j, l );
+                    scalar_t* Ali = Aptr( l, i );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        Ali[ kk ] = ok[ kk ] != 0
+                                  ? Ali[ kk ] - conj( Ajl[ kk ] ) * Aji[ kk ]
+                                  : Ali[ kk ];
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves problems [k0, k1) of an interleaved batch using Cholesky factors
+/// from potrf_interleaved, as in `lapack::potrs`.
+/// Problems with ok[k - k0] == 0 are skipped, by selecting the old value
+/// in each update, leaving B unchanged even if A holds Inf or NaN.
+///
+template <typename scalar_t>
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb, int64_t batch_size,
+    int64_t k0, int64_t k1,
+    blas::real_type< scalar_t > const* ok )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    const int64_t nb = k1 - k0;
+    real_t   scale[ interleaved_chunk_size ];
+    scalar_t sum  [ interleaved_chunk_size ];
+
+    auto Aptr = [&]( int64_t r, int64_t c ) {
+        return A + k0 + (r + c*lda)*batch_size;
+    };
+    auto Bptr = [&]( int64_t r, int64_t c ) {
+        return B + k0 + (r + c*ldb)*batch_size;
+    };
+    // Failed problems get scale 1 and ok 0, leaving them unchanged.
+    auto set_scale = [&]( int64_t j ) {
+        scalar_t const* Ajj = Aptr( j, j );
+        for (int64_t kk = 0; kk < nb; ++kk)
+            scale[ kk ] = ok[ kk ] != 0 ? 1 / real( Ajj[ kk ] ) : 1;
+    };
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        if (uplo == lapack::Uplo::Lower) {
+            // solve L Y = B, column oriented
+            for (int64_t j = 0; j < n; ++j) {
+                set_scale( j );
+                scalar_t* Bj = Bptr( j, c );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Bj[ kk ] *= scale[ kk ];
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = Aptr( i, j );
+                    scalar_t* Bi = Bptr( i, c );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        Bi[ kk ] = ok[ kk ] != 0
+                                 ? Bi[ kk ] - Aij[ kk ] * Bj[ kk ]
+                                 : Bi[ kk ];
+                }
+            }
+            // solve L^H X = Y, row oriented
+            for (int64_t j = n-1; j >= 0; --j) {
+                set_scale( j );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    sum[ kk ] = 0;
+                for (int64_t i = j+1; i < n; ++i) {
+                    scalar_t const* Aij = Aptr( i, j );
+                    scalar_t const* Bi = Bptr( i, c );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        sum[ kk ] += conj( Aij[ kk ] ) * Bi[ kk ];
+                }
+                scalar_t* Bj = Bptr( j, c );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Bj[ kk ] = ok[ kk ] != 0
+                             ? (Bj[ kk ] - sum[ kk ]) * scale[ kk ]
+                             : Bj[ kk ];
+            }
+        }
+        else {
+            // solve U^H Y = B, row oriented
+            for (int64_t j = 0; j < n; ++j) {
+                set_scale( j );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    sum[ kk ] = 0;
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = Aptr( i, j );
+                    scalar_t const* Bi = Bptr( i, c );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        sum[ kk ] += conj( Aij[ kk ] ) * Bi[ kk ];
+                }
+                scalar_t* Bj = Bptr( j, c );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Bj[ kk ] = ok[ kk ] != 0
+                             ? (Bj[ kk ] - sum[ kk ]) * scale[ kk ]
+                             : Bj[ kk ];
+            }
+            // solve U X = Y, column oriented
+            for (int64_t j = n-1; j >= 0; --j) {
+                set_scale( j );
+                scalar_t* Bj = Bptr( j, c );
+                for (int64_t kk = 0; kk < nb; ++kk)
+                    Bj[ kk ] *= scale[ kk ];
+                for (int64_t i = 0; i < j; ++i) {
+                    scalar_t const* Aij = Aptr( i, j );
+                    scalar_t* Bi = Bptr( i, c );
+                    for (int64_t kk = 0; kk < nb; ++kk)
+                        Bi[ kk ] = ok[ kk ] != 0
+                                 ? Bi[ kk ] - Aij[ kk ] * Bj[ kk ]
+                                 : Bi[ kk ];
+                }
+            }
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_INTERLEAVED_HH
@@ -17,9 +17,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup bbcsd
-int64_t bbcsd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t bbcsd_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     float* theta,
     float* phi,
@@ -34,7 +38,8 @@ int64_t bbcsd(
     float* B21D,
     float* B21E,
     float* B22D,
-    float* B22E )
+    float* B22E,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -60,34 +65,42 @@ int64_t bbcsd(
     lapack_int ldv2t_ = (lapack_int) ldv2t;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sbbcsd", { jobu1_, jobu2_, jobv1t_, jobv2t_, trans_, m_, p_, q_, ldu1_, ldu2_, ldv1t_, ldv2t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sbbcsd(
+            &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+            theta,
+            phi,
+            U1, &ldu1_,
+            U2, &ldu2_,
+            V1T, &ldv1t_,
+            V2T, &ldv2t_,
+            B11D,
+            B11E,
+            B12D,
+            B12E,
+            B21D,
+            B21E,
+            B22D,
+            B22E,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -105,7 +118,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -114,8 +127,7 @@ int64_t bbcsd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup bbcsd
-int64_t bbcsd(
+int64_t bbcsd_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     double* theta,
     double* phi,
@@ -130,7 +142,8 @@ int64_t bbcsd(
     double* B21D,
     double* B21E,
     double* B22D,
-    double* B22E )
+    double* B22E,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -156,34 +169,42 @@ int64_t bbcsd(
     lapack_int ldv2t_ = (lapack_int) ldv2t;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dbbcsd", { jobu1_, jobu2_, jobv1t_, jobv2t_, trans_, m_, p_, q_, ldu1_, ldu2_, ldv1t_, ldv2t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dbbcsd(
+            &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+            theta,
+            phi,
+            U1, &ldu1_,
+            U2, &ldu2_,
+            V1T, &ldv1t_,
+            V2T, &ldv2t_,
+            B11D,
+            B11E,
+            B12D,
+            B12E,
+            B21D,
+            B21E,
+            B22D,
+            B22E,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -201,7 +222,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -210,8 +231,7 @@ int64_t bbcsd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup bbcsd
-int64_t bbcsd(
+int64_t bbcsd_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     float* theta,
     float* phi,
@@ -226,7 +246,8 @@ int64_t bbcsd(
     float* B21D,
     float* B21E,
     float* B22D,
-    float* B22E )
+    float* B22E,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -252,9 +273,43 @@ int64_t bbcsd(
     lapack_int ldv2t_ = (lapack_int) ldv2t;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cbbcsd", { jobu1_, jobu2_, jobv1t_, jobv2t_, trans_, m_, p_, q_, ldu1_, ldu2_, ldv1t_, ldv2t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cbbcsd(
+            &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+            theta,
+            phi,
+            (lapack_complex_float*) U1, &ldu1_,
+            (lapack_complex_float*) U2, &ldu2_,
+            (lapack_complex_float*) V1T, &ldv1t_,
+            (lapack_complex_float*) V2T, &ldv2t_,
+            B11D,
+            B11E,
+            B12D,
+            B12E,
+            B21D,
+            B21E,
+            B22D,
+            B22E,
+            qry_rwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lrwork = real(qry_rwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lrwork_ = sizes.lrwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -271,24 +326,102 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        qry_rwork, &ineg_one, &info_
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< float > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+int64_t bbcsd_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int info_ = 0;
 
-    LAPACK_cbbcsd(
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zbbcsd", { jobu1_, jobu2_, jobv1t_, jobv2t_, trans_, m_, p_, q_, ldu1_, ldu2_, ldv1t_, ldv2t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zbbcsd(
+            &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+            theta,
+            phi,
+            (lapack_complex_double*) U1, &ldu1_,
+            (lapack_complex_double*) U2, &ldu2_,
+            (lapack_complex_double*) V1T, &ldv1t_,
+            (lapack_complex_double*) V2T, &ldv2t_,
+            B11D,
+            B11E,
+            B12D,
+            B12E,
+            B21D,
+            B21E,
+            B22D,
+            B22E,
+            qry_rwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lrwork = real(qry_rwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lrwork_ = sizes.lrwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
         phi,
-        (lapack_complex_float*) U1, &ldu1_,
-        (lapack_complex_float*) U2, &ldu2_,
-        (lapack_complex_float*) V1T, &ldv1t_,
-        (lapack_complex_float*) V2T, &ldv2t_,
+        (lapack_complex_double*) U1, &ldu1_,
+        (lapack_complex_double*) U2, &ldu2_,
+        (lapack_complex_double*) V1T, &ldv1t_,
+        (lapack_complex_double*) V2T, &ldv2t_,
         B11D,
         B11E,
         B12D,
@@ -297,7 +430,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -305,6 +438,101 @@ int64_t bbcsd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E )
+{
+    size_t host_work_size;
+    bbcsd_work_size_bytes( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                           phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t,
+                           B11D, B11E, B12D, B12E, B21D, B21E, B22D, B22E,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return bbcsd( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                  U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D,
+                  B12E, B21D, B21E, B22D, B22E,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E )
+{
+    size_t host_work_size;
+    bbcsd_work_size_bytes( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                           phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t,
+                           B11D, B11E, B12D, B12E, B21D, B21E, B22D, B22E,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return bbcsd( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                  U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D,
+                  B12E, B21D, B21E, B22D, B22E,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E )
+{
+    size_t host_work_size;
+    bbcsd_work_size_bytes( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                           phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t,
+                           B11D, B11E, B12D, B12E, B21D, B21E, B22D, B22E,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return bbcsd( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                  U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D,
+                  B12E, B21D, B21E, B22D, B22E,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the CS decomposition of a unitary matrix in
 /// bidiagonal-block form,
@@ -509,81 +737,255 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu1_ = job_csd2char( jobu1 );
-    char jobu2_ = job_csd2char( jobu2 );
-    char jobv1t_ = job_csd2char( jobv1t );
-    char jobv2t_ = job_csd2char( jobv2t );
-    char trans_ = op2char( trans );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int p_ = (lapack_int) p;
-    lapack_int q_ = (lapack_int) q;
-    lapack_int ldu1_ = (lapack_int) ldu1;
-    lapack_int ldu2_ = (lapack_int) ldu2;
-    lapack_int ldv1t_ = (lapack_int) ldv1t;
-    lapack_int ldv2t_ = (lapack_int) ldv2t;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    bbcsd_work_size_bytes( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                           phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t,
+                           B11D, B11E, B12D, B12E, B21D, B21E, B22D, B22E,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return bbcsd( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                  U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D,
+                  B12E, B21D, B21E, B22D, B22E,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1,
+                ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E,
+                B21D, B21E, B22D, B22E, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1,
+                ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E,
+                B21D, B21E, B22D, B22E, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1,
+                ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E,
+                B21D, B21E, B22D, B22E, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::bbcsd`. Arguments are the same as for
+/// `lapack::bbcsd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup bbcsd
+void bbcsd_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1,
+                ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E,
+                B21D, B21E, B22D, B22E, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                       phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D,
+                       B11E, B12D, B12E, B21D, B21E, B22D, B22E, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                       phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D,
+                       B11E, B12D, B12E, B21D, B21E, B22D, B22E, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                       phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D,
+                       B11E, B12D, B12E, B21D, B21E, B22D, B22E, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::bbcsd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::bbcsd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::bbcsd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::bbcsd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::bbcsd_work_size_bytes` for the same arguments.
+///
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta,
+                       phi, U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D,
+                       B11E, B12D, B12E, B21D, B21E, B22D, B22E, work_buffer );
 }
 
 }  // namespace lapack
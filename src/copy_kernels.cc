@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "copy_kernels.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Portable kernels. Standard C++ has no non-temporal stores,
+// so stream is ignored.
+
+template <typename scalar_t>
+void copy( int64_t n, scalar_t const* x, scalar_t* y, bool stream )
+{
+    std::memcpy( y, x, n * sizeof( scalar_t ) );
+}
+
+template <typename scalar_t>
+void set( int64_t n, scalar_t alpha, scalar_t* y, bool stream )
+{
+    std::fill( y, y + n, alpha );
+}
+
+template <typename scalar_t>
+void scale( int64_t n, blas::real_type< scalar_t > alpha, scalar_t* x_ )
+{
+    // complex is scaled as 2n real entries
+    using real_t = blas::real_type< scalar_t >;
+    real_t* x = reinterpret_cast< real_t* >( x_ );
+    int64_t nn = (blas::is_complex< scalar_t >::value ? 2*n : n);
+    for (int64_t i = 0; i < nn; ++i)
+        x[ i ] *= alpha;
+}
+
+void fence()
+{}
+
+template <typename scalar_t>
+CopyKernels< scalar_t > const generic_kernels = {
+    copy< scalar_t >,
+    set< scalar_t >,
+    scale< scalar_t >,
+    fence,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels_generic()
+{
+    return generic_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels()
+{
+    switch (simd_get()) {
+        #if defined( LAPACK_SIMD_X86 )
+            case Simd::AVX512:
+                return copy_kernels_avx512< scalar_t >();
+
+            case Simd::AVX2:
+                return copy_kernels_avx2< scalar_t >();
+        #endif
+
+        default:
+            return copy_kernels_generic< scalar_t >();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template CopyKernels< float > const& copy_kernels();
+template CopyKernels< double > const& copy_kernels();
+template CopyKernels< std::complex<float> > const& copy_kernels();
+template CopyKernels< std::complex<double> > const& copy_kernels();
+
+template CopyKernels< float > const& copy_kernels_generic();
+template CopyKernels< double > const& copy_kernels_generic();
+template CopyKernels< std::complex<float> > const& copy_kernels_generic();
+template CopyKernels< std::complex<double> > const& copy_kernels_generic();
+
+}  // namespace internal
+}  // namespace lapack
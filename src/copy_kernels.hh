@@ -0,0 +1,57 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_COPY_KERNELS_HH
+#define LAPACK_COPY_KERNELS_HH
+
+#include "lapack/util.hh"
+#include "simd_kernels.hh"
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Column kernels for native lacpy, laset, and lascl, one table per
+/// instruction set. With stream, stores are non-temporal where the
+/// instruction set allows. Since those are weakly ordered, each thread
+/// calls fence after its last streaming copy or set, once per chunk of
+/// columns rather than per column, so the data is visible to other threads.
+template <typename scalar_t>
+struct CopyKernels
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Sets y_i = x_i.
+    void (*copy)( int64_t n, scalar_t const* x, scalar_t* y, bool stream );
+
+    /// Sets y_i = alpha.
+    void (*set)( int64_t n, scalar_t alpha, scalar_t* y, bool stream );
+
+    /// Sets x_i = alpha x_i, rounded once, as LAPACK's lascl does.
+    void (*scale)( int64_t n, real_t alpha, scalar_t* x );
+
+    /// Orders preceding streaming stores before later stores.
+    void (*fence)();
+};
+
+/// @return kernels for the instruction set from simd_get().
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels();
+
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels_generic();
+
+#if defined( LAPACK_SIMD_X86 )
+    template <typename scalar_t>
+    CopyKernels< scalar_t > const& copy_kernels_avx2();
+
+    template <typename scalar_t>
+    CopyKernels< scalar_t > const& copy_kernels_avx512();
+#endif
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_COPY_KERNELS_HH
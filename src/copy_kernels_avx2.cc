@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "copy_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Streaming stores need 32-byte aligned destinations. Heads are stored
+// normally until y is aligned, so leading dimensions needn't be aligned.
+
+constexpr int64_t vbytes = 32;
+
+/// @return number of bytes from y to the next 32-byte boundary.
+inline int64_t head_bytes( void const* y )
+{
+    return int64_t( -reinterpret_cast< std::uintptr_t >( y ) & (vbytes - 1) );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+void copy( int64_t n, scalar_t const* x_, scalar_t* y_, bool stream )
+{
+    if (! stream) {
+        std::memcpy( y_, x_, n * sizeof( scalar_t ) );
+        return;
+    }
+
+    char const* x = reinterpret_cast< char const* >( x_ );
+    char* y = reinterpret_cast< char* >( y_ );
+    int64_t bytes = n * sizeof( scalar_t );
+
+    int64_t head = std::min( bytes, head_bytes( y ) );
+    std::memcpy( y, x, head );
+    x += head;
+    y += head;
+    bytes -= head;
+
+    for (; bytes >= 4*vbytes; bytes -= 4*vbytes) {
+        __m256i v0 = _mm256_loadu_si256( (__m256i const*) (x            ) );
+        __m256i v1 = _mm256_loadu_si256( (__m256i const*) (x +   vbytes) );
+        __m256i v2 = _mm256_loadu_si256( (__m256i const*) (x + 2*vbytes) );
+        __m256i v3 = _mm256_loadu_si256( (__m256i const*) (x + 3*vbytes) );
+        _mm256_stream_si256( (__m256i*) (y            ), v0 );
+        _mm256_stream_si256( (__m256i*) (y +   vbytes), v1 );
+        _mm256_stream_si256( (__m256i*) (y + 2*vbytes), v2 );
+        _mm256_stream_si256( (__m256i*) (y + 3*vbytes), v3 );
+        x += 4*vbytes;
+        y += 4*vbytes;
+    }
+    for (; bytes >= vbytes; bytes -= vbytes) {
+        _mm256_stream_si256( (__m256i*) y,
+                             _mm256_loadu_si256( (__m256i const*) x ) );
+        x += vbytes;
+        y += vbytes;
+    }
+    std::memcpy( y, x, bytes );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+void set( int64_t n, scalar_t alpha, scalar_t* y, bool stream )
+{
+    // sizeof( scalar_t ) divides 32, so once y is aligned,
+    // every vector holds the same pattern.
+    constexpr int nv = vbytes / sizeof( scalar_t );
+
+    int64_t i = 0;
+    if (stream) {
+        // If y isn't aligned to sizeof( scalar_t ) bytes, e.g.,
+        // complex<double> on 8 bytes, it never reaches 32 bytes.
+        int64_t head = head_bytes( y );
+        if (head % sizeof( scalar_t ) == 0) {
+            for (; i < n && head > 0; ++i, head -= sizeof( scalar_t ))
+                y[ i ] = alpha;
+        }
+        else {
+            stream = false;
+        }
+    }
+
+    alignas( vbytes ) scalar_t pattern[ nv ];
+    for (int k = 0; k < nv; ++k)
+        pattern[ k ] = alpha;
+    __m256i v = _mm256_load_si256( (__m256i const*) pattern );
+
+    if (stream) {
+        for (; i + 4*nv <= n; i += 4*nv) {
+            _mm256_stream_si256( (__m256i*) &y[ i        ], v );
+            _mm256_stream_si256( (__m256i*) &y[ i +   nv ], v );
+            _mm256_stream_si256( (__m256i*) &y[ i + 2*nv ], v );
+            _mm256_stream_si256( (__m256i*) &y[ i + 3*nv ], v );
+        }
+        for (; i + nv <= n; i += nv)
+            _mm256_stream_si256( (__m256i*) &y[ i ], v );
+    }
+    else {
+        for (; i + nv <= n; i += nv)
+            _mm256_storeu_si256( (__m256i*) &y[ i ], v );
+    }
+    for (; i < n; ++i)
+        y[ i ] = alpha;
+}
+
+//------------------------------------------------------------------------------
+LAPACK_TARGET_AVX2
+void fence()
+{
+    _mm_sfence();
+}
+
+//------------------------------------------------------------------------------
+LAPACK_TARGET_AVX2 inline __m256  vload( float  const* x ) { return _mm256_loadu_ps( x ); }
+LAPACK_TARGET_AVX2 inline __m256d vload( double const* x ) { return _mm256_loadu_pd( x ); }
+
+LAPACK_TARGET_AVX2 inline void vstore( float*  x, __m256  v ) { _mm256_storeu_ps( x, v ); }
+LAPACK_TARGET_AVX2 inline void vstore( double* x, __m256d v ) { _mm256_storeu_pd( x, v ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vset1( float  a ) { return _mm256_set1_ps( a ); }
+LAPACK_TARGET_AVX2 inline __m256d vset1( double a ) { return _mm256_set1_pd( a ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vmul( __m256  a, __m256  b ) { return _mm256_mul_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vmul( __m256d a, __m256d b ) { return _mm256_mul_pd( a, b ); }
+
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+void scale( int64_t n, blas::real_type< scalar_t > alpha, scalar_t* x_ )
+{
+    // complex is scaled as 2n real entries
+    using real_t = blas::real_type< scalar_t >;
+    constexpr int nv = vbytes / sizeof( real_t );
+    real_t* x = reinterpret_cast< real_t* >( x_ );
+    int64_t nn = (blas::is_complex< scalar_t >::value ? 2*n : n);
+
+    auto va = vset1( alpha );
+    int64_t i = 0;
+    for (; i + 2*nv <= nn; i += 2*nv) {
+        auto v0 = vload( &x[ i      ] );
+        auto v1 = vload( &x[ i + nv ] );
+        vstore( &x[ i      ], vmul( v0, va ) );
+        vstore( &x[ i + nv ], vmul( v1, va ) );
+    }
+    for (; i + nv <= nn; i += nv)
+        vstore( &x[ i ], vmul( vload( &x[ i ] ), va ) );
+    for (; i < nn; ++i)
+        x[ i ] *= alpha;
+}
+
+template <typename scalar_t>
+CopyKernels< scalar_t > const avx2_kernels = {
+    copy< scalar_t >,
+    set< scalar_t >,
+    scale< scalar_t >,
+    fence,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels_avx2()
+{
+    return avx2_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template CopyKernels< float > const& copy_kernels_avx2();
+template CopyKernels< double > const& copy_kernels_avx2();
+template CopyKernels< std::complex<float> > const& copy_kernels_avx2();
+template CopyKernels< std::complex<double> > const& copy_kernels_avx2();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "copy_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// GCC 12's AVX-512 headers trigger false uninitialized warnings
+// from _mm512_undefined_pd when inlined.
+#if defined( __GNUC__ ) && ! defined( __clang__ )
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Streaming stores need 64-byte aligned destinations, i.e., whole
+// cache lines. Heads are stored normally until y is aligned.
+
+constexpr int64_t vbytes = 64;
+
+/// @return number of bytes from y to the next 64-byte boundary.
+inline int64_t head_bytes( void const* y )
+{
+    return int64_t( -reinterpret_cast< std::uintptr_t >( y ) & (vbytes - 1) );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+void copy( int64_t n, scalar_t const* x_, scalar_t* y_, bool stream )
+{
+    if (! stream) {
+        std::memcpy( y_, x_, n * sizeof( scalar_t ) );
+        return;
+    }
+
+    char const* x = reinterpret_cast< char const* >( x_ );
+    char* y = reinterpret_cast< char* >( y_ );
+    int64_t bytes = n * sizeof( scalar_t );
+
+    int64_t head = std::min( bytes, head_bytes( y ) );
+    std::memcpy( y, x, head );
+    x += head;
+    y += head;
+    bytes -= head;
+
+    for (; bytes >= 4*vbytes; bytes -= 4*vbytes) {
+        __m512i v0 = _mm512_loadu_si512( x            );
+        __m512i v1 = _mm512_loadu_si512( x +   vbytes );
+        __m512i v2 = _mm512_loadu_si512( x + 2*vbytes );
+        __m512i v3 = _mm512_loadu_si512( x + 3*vbytes );
+        _mm512_stream_si512( (__m512i*) (y            ), v0 );
+        _mm512_stream_si512( (__m512i*) (y +   vbytes), v1 );
+        _mm512_stream_si512( (__m512i*) (y + 2*vbytes), v2 );
+        _mm512_stream_si512( (__m512i*) (y + 3*vbytes), v3 );
+        x += 4*vbytes;
+        y += 4*vbytes;
+    }
+    for (; bytes >= vbytes; bytes -= vbytes) {
+        _mm512_stream_si512( (__m512i*) y, _mm512_loadu_si512( x ) );
+        x += vbytes;
+        y += vbytes;
+    }
+    std::memcpy( y, x, bytes );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+void set( int64_t n, scalar_t alpha, scalar_t* y, bool stream )
+{
+    // sizeof( scalar_t ) divides 64, so once y is aligned,
+    // every vector holds the same pattern.
+    constexpr int nv = vbytes / sizeof( scalar_t );
+
+    int64_t i = 0;
+    if (stream) {
+        // If y isn't aligned to sizeof( scalar_t ) bytes, e.g.,
+        // complex<double> on 8 bytes, it never reaches 64 bytes.
+        int64_t head = head_bytes( y );
+        if (head % sizeof( scalar_t ) == 0) {
+            for (; i < n && head > 0; ++i, head -= sizeof( scalar_t ))
+                y[ i ] = alpha;
+        }
+        else {
+            stream = false;
+        }
+    }
+
+    alignas( vbytes ) scalar_t pattern[ nv ];
+    for (int k = 0; k < nv; ++k)
+        pattern[ k ] = alpha;
+    __m512i v = _mm512_load_si512( pattern );
+
+    if (stream) {
+        for (; i + 4*nv <= n; i += 4*nv) {
+            _mm512_stream_si512( (__m512i*) &y[ i        ], v );
+            _mm512_stream_si512( (__m512i*) &y[ i +   nv ], v );
+            _mm512_stream_si512( (__m512i*) &y[ i + 2*nv ], v );
+            _mm512_stream_si512( (__m512i*) &y[ i + 3*nv ], v );
+        }
+        for (; i + nv <= n; i += nv)
+            _mm512_stream_si512( (__m512i*) &y[ i ], v );
+    }
+    else {
+        for (; i + nv <= n; i += nv)
+            _mm512_storeu_si512( &y[ i ], v );
+    }
+    for (; i < n; ++i)
+        y[ i ] = alpha;
+}
+
+//------------------------------------------------------------------------------
+LAPACK_TARGET_AVX512
+void fence()
+{
+    _mm_sfence();
+}
+
+//------------------------------------------------------------------------------
+// Vector operations, overloaded on __m512 (16 floats) and __m512d (8 doubles).
+// Tails use masked loads and stores.
+
+template <typename real_t> struct Vec;
+
+template <>
+struct Vec< float > {
+    using mask = __mmask16;
+    static constexpr int size = 16;
+};
+
+template <>
+struct Vec< double > {
+    using mask = __mmask8;
+    static constexpr int size = 8;
+};
+
+/// @return mask of the first k < size entries.
+template <typename real_t>
+inline typename Vec< real_t >::mask tail_mask( int64_t k )
+{
+    return typename Vec< real_t >::mask( (1u << k) - 1 );
+}
+
+LAPACK_TARGET_AVX512 inline __m512  vload( float  const* x ) { return _mm512_loadu_ps( x ); }
+LAPACK_TARGET_AVX512 inline __m512d vload( double const* x ) { return _mm512_loadu_pd( x ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vload( __mmask16 k, float  const* x ) { return _mm512_maskz_loadu_ps( k, x ); }
+LAPACK_TARGET_AVX512 inline __m512d vload( __mmask8  k, double const* x ) { return _mm512_maskz_loadu_pd( k, x ); }
+
+LAPACK_TARGET_AVX512 inline void vstore( float*  x, __m512  v ) { _mm512_storeu_ps( x, v ); }
+LAPACK_TARGET_AVX512 inline void vstore( double* x, __m512d v ) { _mm512_storeu_pd( x, v ); }
+
+LAPACK_TARGET_AVX512 inline void vstore( __mmask16 k, float*  x, __m512  v ) { _mm512_mask_storeu_ps( x, k, v ); }
+LAPACK_TARGET_AVX512 inline void vstore( __mmask8  k, double* x, __m512d v ) { _mm512_mask_storeu_pd( x, k, v ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vset1( float  a ) { return _mm512_set1_ps( a ); }
+LAPACK_TARGET_AVX512 inline __m512d vset1( double a ) { return _mm512_set1_pd( a ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vmul( __m512  a, __m512  b ) { return _mm512_mul_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vmul( __m512d a, __m512d b ) { return _mm512_mul_pd( a, b ); }
+
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+void scale( int64_t n, blas::real_type< scalar_t > alpha, scalar_t* x_ )
+{
+    // complex is scaled as 2n real entries
+    using real_t = blas::real_type< scalar_t >;
+    constexpr int nv = Vec< real_t >::size;
+    real_t* x = reinterpret_cast< real_t* >( x_ );
+    int64_t nn = (blas::is_complex< scalar_t >::value ? 2*n : n);
+
+    auto va = vset1( alpha );
+    int64_t i = 0;
+    for (; i + 2*nv <= nn; i += 2*nv) {
+        auto v0 = vload( &x[ i      ] );
+        auto v1 = vload( &x[ i + nv ] );
+        vstore( &x[ i      ], vmul( v0, va ) );
+        vstore( &x[ i + nv ], vmul( v1, va ) );
+    }
+    for (; i + nv <= nn; i += nv)
+        vstore( &x[ i ], vmul( vload( &x[ i ] ), va ) );
+    if (i < nn) {
+        auto k = tail_mask< real_t >( nn - i );
+        vstore( k, &x[ i ], vmul( vload( k, &x[ i ] ), va ) );
+    }
+}
+
+template <typename scalar_t>
+CopyKernels< scalar_t > const avx512_kernels = {
+    copy< scalar_t >,
+    set< scalar_t >,
+    scale< scalar_t >,
+    fence,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+CopyKernels< scalar_t > const& copy_kernels_avx512()
+{
+    return avx512_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template CopyKernels< float > const& copy_kernels_avx512();
+template CopyKernels< double > const& copy_kernels_avx512();
+template CopyKernels< std::complex<float> > const& copy_kernels_avx512();
+template CopyKernels< std::complex<double> > const& copy_kernels_avx512();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
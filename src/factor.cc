@@ -0,0 +1,538 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+using blas::conj;
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Number of right-hand sides QR::solve applies at once, bounding its
+/// workspace.
+const int64_t rhs_block = 256;
+
+//------------------------------------------------------------------------------
+/// Copies m-by-n A into storage, growing it if needed.
+/// @return copy, with leading dimension max( 1, m ).
+template <typename scalar_t>
+scalar_t* copy_in(
+    Workspace& storage, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    int64_t ld = max( 1, m );
+    scalar_t* F = (scalar_t*) storage.reserve( sizeof(scalar_t) * ld * n );
+    lapack::lacpy( MatrixType::General, m, n, A, lda, F, ld );
+    return F;
+}
+
+//------------------------------------------------------------------------------
+/// @return array of n pivots as int64_t in storage, growing it if needed,
+/// for routines without lapack_int pivot versions. Copies ipiv, if given.
+int64_t* pivots_int64(
+    Workspace& storage, int64_t n, lapack_int const* ipiv = nullptr )
+{
+    int64_t* ipiv64
+        = (int64_t*) storage.reserve( sizeof(int64_t) * max( 1, n ) );
+    if (ipiv != nullptr)
+        std::copy( ipiv, ipiv + n, ipiv64 );
+    return ipiv64;
+}
+
+//------------------------------------------------------------------------------
+/// Fills the opposite triangle of n-by-n Hermitian A from the uplo triangle.
+template <typename scalar_t>
+void hermitian_fill(
+    lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (uplo == Uplo::Lower)
+                A[ j + i*lda ] = conj( A[ i + j*lda ] );
+            else
+                A[ i + j*lda ] = conj( A[ j + i*lda ] );
+        }
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+// LU
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LU< scalar_t >::LU():
+    n_( 0 ),
+    info_( 0 ),
+    anorm_one_( 0 ),
+    anorm_inf_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LU< scalar_t >::LU( int64_t n, scalar_t const* A, int64_t lda ):
+    LU()
+{
+    factor( n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LU< scalar_t >::factor( int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    n_ = n;
+    anorm_one_ = lapack::lange( Norm::One, n, n, A, lda );
+    anorm_inf_ = lapack::lange( Norm::Inf, n, n, A, lda );
+    scalar_t* F = copy_in( storage_, n, n, A, lda );
+    ipiv_.resize( max( 1, n ) );  // non-null data(), even for n = 0
+    info_ = lapack::getrf( n, n, F, ld(), ipiv_.data() );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void LU< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb, lapack::Op trans )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is singular, info %lld",
+                         llong( info_ ) );
+
+    lapack::getrs( trans, n_, nrhs, data(), ld(), ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LU< scalar_t >::rcond( lapack::Norm norm )
+{
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+
+    real_t rcond_ = 0;
+    if (info_ == 0) {
+        real_t anorm = (norm == Norm::One ? anorm_one_ : anorm_inf_);
+        lapack::gecon( norm, n_, data(), ld(), anorm, &rcond_ );
+    }
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+scalar_t LU< scalar_t >::det() const
+{
+    // det( P ) = (-1)^{number of interchanges}; det( L ) = 1.
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    scalar_t det_ = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        det_ *= F[ i + i*ldf ];
+        if (ipiv_[ i ] != i + 1)
+            det_ = -det_;
+    }
+    return det_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void LU< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is singular, info %lld",
+                         llong( info_ ) );
+
+    // The workspace query gives lwork = 0 for n = 0, which getri rejects.
+    if (n_ == 0)
+        return;
+
+    lapack::lacpy( MatrixType::General, n_, n_, data(), ld(), Ainv, ldainv );
+    int64_t* ipiv64 = pivots_int64( ipiv64_, n_, ipiv_.data() );
+    size_t work_size;
+    lapack::getri_work_size_bytes( n_, Ainv, ldainv, ipiv64, &work_size );
+    void* work = ws_.reserve( work_size );
+    lapack::getri( n_, Ainv, ldainv, ipiv64, work, work_size );
+}
+
+//==============================================================================
+// Cholesky
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Cholesky< scalar_t >::Cholesky():
+    uplo_( Uplo::Lower ),
+    n_( 0 ),
+    info_( 0 ),
+    anorm_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Cholesky< scalar_t >::Cholesky(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda ):
+    Cholesky()
+{
+    factor( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::factor(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    uplo_ = uplo;
+    n_ = n;
+    anorm_ = lapack::lanhe( Norm::One, uplo, n, A, lda );
+    scalar_t* F = copy_in( storage_, n, n, A, lda );
+    info_ = lapack::potrf( uplo, n, F, ld() );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void Cholesky< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is not positive definite,"
+                         " info %lld", llong( info_ ) );
+
+    lapack::potrs( uplo_, n_, nrhs, data(), ld(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > Cholesky< scalar_t >::rcond()
+{
+    lapack_error_if_msg( info_ != 0, "matrix is not positive definite,"
+                         " info %lld", llong( info_ ) );
+
+    real_t rcond_ = 0;
+    lapack::pocon( uplo_, n_, data(), ld(), anorm_, &rcond_ );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > Cholesky< scalar_t >::det() const
+{
+    lapack_error_if_msg( info_ != 0, "matrix is not positive definite,"
+                         " info %lld", llong( info_ ) );
+
+    // det( A ) = det( L )^2, with real diagonal.
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    real_t det_ = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        real_t fii = real( F[ i + i*ldf ] );
+        det_ *= fii * fii;
+    }
+    return det_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void Cholesky< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is not positive definite,"
+                         " info %lld", llong( info_ ) );
+
+    MatrixType type = (uplo_ == Uplo::Lower ? MatrixType::Lower
+                                             : MatrixType::Upper);
+    lapack::lacpy( type, n_, n_, data(), ld(), Ainv, ldainv );
+    lapack::potri( uplo_, n_, Ainv, ldainv );
+    hermitian_fill( uplo_, n_, Ainv, ldainv );
+}
+
+//==============================================================================
+// LDLT
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LDLT< scalar_t >::LDLT():
+    uplo_( Uplo::Lower ),
+    n_( 0 ),
+    info_( 0 ),
+    anorm_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LDLT< scalar_t >::LDLT(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda ):
+    LDLT()
+{
+    factor( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::factor(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    uplo_ = uplo;
+    n_ = n;
+    anorm_ = lapack::lanhe( Norm::One, uplo, n, A, lda );
+    scalar_t* F = copy_in( storage_, n, n, A, lda );
+    ipiv_.resize( max( 1, n ) );  // non-null data(), even for n = 0
+
+    // As in getri, the workspace query gives lwork = 0 for n = 0.
+    info_ = 0;
+    if (n == 0)
+        return info_;
+
+    int64_t* ipiv64 = pivots_int64( ipiv64_, n );
+    size_t work_size;
+    lapack::hetrf_work_size_bytes( uplo, n, F, ld(), ipiv64, &work_size );
+    void* work = ws_.reserve( work_size );
+    info_ = lapack::hetrf( uplo, n, F, ld(), ipiv64, work, work_size );
+    std::copy( ipiv64, ipiv64 + n, ipiv_.begin() );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void LDLT< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is singular, info %lld",
+                         llong( info_ ) );
+
+    lapack::hetrs( uplo_, n_, nrhs, data(), ld(), ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LDLT< scalar_t >::rcond()
+{
+    real_t rcond_ = 0;
+    if (info_ == 0) {
+        int64_t* ipiv64 = pivots_int64( ipiv64_, n_, ipiv_.data() );
+        lapack::hecon( uplo_, n_, data(), ld(), ipiv64, anorm_, &rcond_ );
+    }
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LDLT< scalar_t >::det() const
+{
+    // det( A ) = det( D ), since det( L ) = 1 and det( P )^2 = 1.
+    // 2-by-2 blocks have ipiv( k ) = ipiv( k+1 ) < 0.
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    real_t det_ = 1;
+    int64_t k = 0;
+    while (k < n_) {
+        if (ipiv_[ k ] > 0 || k == n_ - 1) {
+            det_ *= real( F[ k + k*ldf ] );
+            k += 1;
+        }
+        else {
+            scalar_t offdiag = (uplo_ == Uplo::Lower ? F[ (k+1) + k*ldf ]
+                                                     : F[ k + (k+1)*ldf ]);
+            real_t abs_offdiag = std::abs( offdiag );
+            det_ *= real( F[ k + k*ldf ] ) * real( F[ (k+1) + (k+1)*ldf ] )
+                    - abs_offdiag * abs_offdiag;
+            k += 2;
+        }
+    }
+    return det_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void LDLT< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    lapack_error_if_msg( info_ != 0, "matrix is singular, info %lld",
+                         llong( info_ ) );
+
+    if (n_ == 0)
+        return;
+
+    lapack::lacpy( MatrixType::General, n_, n_, data(), ld(), Ainv, ldainv );
+    int64_t* ipiv64 = pivots_int64( ipiv64_, n_, ipiv_.data() );
+    size_t work_size;
+    lapack::hetri2_work_size_bytes( uplo_, n_, Ainv, ldainv, ipiv64,
+                                    &work_size );
+    void* work = ws_.reserve( work_size );
+    lapack::hetri2( uplo_, n_, Ainv, ldainv, ipiv64, work, work_size );
+    hermitian_fill( uplo_, n_, Ainv, ldainv );
+}
+
+//==============================================================================
+// QR
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+QR< scalar_t >::QR():
+    m_( 0 ),
+    n_( 0 ),
+    info_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+QR< scalar_t >::QR( int64_t m, int64_t n, scalar_t const* A, int64_t lda ):
+    QR()
+{
+    factor( m, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t QR< scalar_t >::factor(
+    int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( m < n );
+    lapack_error_if( lda < max( 1, m ) );
+
+    m_ = m;
+    n_ = n;
+    scalar_t* F = copy_in( storage_, m, n, A, lda );
+    tau_.resize( n );
+    info_ = lapack::geqrf( m, n, F, ld(), tau_.data(), ws_ );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void QR< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, m_ ) );
+
+    // Check before B is modified.
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    for (int64_t i = 0; i < n_; ++i) {
+        lapack_error_if_msg( F[ i + i*ldf ] == scalar_t( 0 ),
+                             "R is singular, R( %lld, %lld ) = 0",
+                             llong( i+1 ), llong( i+1 ) );
+    }
+
+    // B = Q^H B, then solve R X = B( 0:n-1, : ).
+    for (int64_t j = 0; j < nrhs; j += rhs_block) {
+        int64_t jb = min( rhs_block, nrhs - j );
+        scalar_t* Bj = &B[ j*ldb ];
+        size_t work_size;
+        lapack::unmqr_work_size_bytes(
+            Side::Left, Op::ConjTrans, m_, jb, n_, F, ldf, tau_.data(),
+            Bj, ldb, &work_size );
+        void* work = ws_.reserve( work_size );
+        lapack::unmqr(
+            Side::Left, Op::ConjTrans, m_, jb, n_, F, ldf, tau_.data(),
+            Bj, ldb, work, work_size );
+        lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                       n_, jb, F, ldf, Bj, ldb );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > QR< scalar_t >::rcond( lapack::Norm norm )
+{
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+
+    real_t rcond_ = 0;
+    lapack::trcon( norm, Uplo::Upper, Diag::NonUnit, n_, data(), ld(),
+                   &rcond_ );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+scalar_t QR< scalar_t >::det() const
+{
+    lapack_error_if_msg( m_ != n_, "matrix is not square, m %lld != n %lld",
+                         llong( m_ ), llong( n_ ) );
+
+    // Q = H_1 ... H_n, with H_i = I - tau_i v_i v_i^H and v_i( i ) = 1,
+    // so det( H_i ) = 1 - tau_i ||v_i||^2, which is -1 or 1 for real.
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    scalar_t det_ = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        real_t vnorm = 0;
+        if (i < m_ - 1)
+            vnorm = blas::nrm2( m_ - i - 1, &F[ (i+1) + i*ldf ], 1 );
+        det_ *= F[ i + i*ldf ] * (scalar_t( 1 ) - tau_[ i ]*(1 + vnorm*vnorm));
+    }
+    return det_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void QR< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    scalar_t const* F = data();
+    int64_t ldf = ld();
+    for (int64_t i = 0; i < n_; ++i) {
+        lapack_error_if_msg( F[ i + i*ldf ] == scalar_t( 0 ),
+                             "R is singular, R( %lld, %lld ) = 0",
+                             llong( i+1 ), llong( i+1 ) );
+    }
+
+    // A^+ = R^{-1} [ I 0 ] Q^H, applying Q^H from the right.
+    lapack::laset( MatrixType::General, n_, m_, 0, 1, Ainv, ldainv );
+    size_t work_size;
+    lapack::unmqr_work_size_bytes(
+        Side::Right, Op::ConjTrans, n_, m_, n_, F, ldf, tau_.data(),
+        Ainv, ldainv, &work_size );
+    void* work = ws_.reserve( work_size );
+    lapack::unmqr(
+        Side::Right, Op::ConjTrans, n_, m_, n_, F, ldf, tau_.data(),
+        Ainv, ldainv, work, work_size );
+    lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                   n_, m_, F, ldf, Ainv, ldainv );
+}
+
+//==============================================================================
+// Explicit instantiations.
+
+template class LU< float >;
+template class LU< double >;
+template class LU< std::complex<float> >;
+template class LU< std::complex<double> >;
+
+template class Cholesky< float >;
+template class Cholesky< double >;
+template class Cholesky< std::complex<float> >;
+template class Cholesky< std::complex<double> >;
+
+template class LDLT< float >;
+template class LDLT< double >;
+template class LDLT< std::complex<float> >;
+template class LDLT< std::complex<double> >;
+
+template class QR< float >;
+template class QR< double >;
+template class QR< std::complex<float> >;
+template class QR< std::complex<double> >;
+
+}  // namespace lapack
@@ -281,4 +281,157 @@ int64_t gbsv(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_sgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_dgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_cgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv,
+        (lapack_complex_float*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gbsv` that returns pivots ipiv in LAPACK's native
+/// integer type, `lapack_int`, passing them to LAPACK without conversion.
+/// Declared only when `lapack_int` is 32-bit (LP64); with ILP64, the
+/// `int64_t` version is already zero-copy. See `lapack::PivotView`.
+///
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_zgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv,
+        (lapack_complex_double*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
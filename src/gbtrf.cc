@@ -251,4 +251,141 @@ int64_t gbtrf(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int info_ = 0;
+
+    LAPACK_sgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int info_ = 0;
+
+    LAPACK_dgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int info_ = 0;
+
+    LAPACK_cgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gbtrf` that returns pivots ipiv in LAPACK's native
+/// integer type, `lapack_int`, passing them to LAPACK without conversion.
+/// Declared only when `lapack_int` is 32-bit (LP64); with ILP64, the
+/// `int64_t` version is already zero-copy. See `lapack::PivotView`.
+///
+/// @ingroup gbsv_computational
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ku) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kl_ = (lapack_int) kl;
+    lapack_int ku_ = (lapack_int) ku;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int info_ = 0;
+
+    LAPACK_zgbtrf(
+        &m_, &n_, &kl_, &ku_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,15 +14,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd_computational
-int64_t gebrd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gebrd_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     float* D,
     float* E,
     float* tauq,
-    float* taup )
+    float* taup,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,24 +40,32 @@ int64_t gebrd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgebrd", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgebrd(
+            &m_, &n_,
+            A, &lda_,
+            D,
+            E,
+            tauq,
+            taup,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgebrd(
         &m_, &n_,
@@ -62,7 +74,7 @@ int64_t gebrd(
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -70,14 +82,14 @@ int64_t gebrd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd_computational
-int64_t gebrd(
+int64_t gebrd_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* D,
     double* E,
     double* tauq,
-    double* taup )
+    double* taup,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -90,24 +102,32 @@ int64_t gebrd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgebrd", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgebrd(
+            &m_, &n_,
+            A, &lda_,
+            D,
+            E,
+            tauq,
+            taup,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgebrd(
         &m_, &n_,
@@ -116,7 +136,7 @@ int64_t gebrd(
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -124,14 +144,14 @@ int64_t gebrd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd_computational
-int64_t gebrd(
+int64_t gebrd_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
     float* E,
     std::complex<float>* tauq,
-    std::complex<float>* taup )
+    std::complex<float>* taup,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -144,9 +164,33 @@ int64_t gebrd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgebrd", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgebrd(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            D,
+            E,
+            (lapack_complex_float*) tauq,
+            (lapack_complex_float*) taup,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgebrd(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -154,29 +198,122 @@ int64_t gebrd(
         E,
         (lapack_complex_float*) tauq,
         (lapack_complex_float*) taup,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gebrd_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
 
-    LAPACK_cgebrd(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgebrd", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgebrd(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            D,
+            E,
+            (lapack_complex_double*) tauq,
+            (lapack_complex_double*) taup,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgebrd(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         D,
         E,
-        (lapack_complex_float*) tauq,
-        (lapack_complex_float*) taup,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) tauq,
+        (lapack_complex_double*) taup,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Reduces a general m-by-n matrix A to upper or lower
 /// bidiagonal form B by a unitary transformation: $Q^H A P = B$.
@@ -315,48 +452,160 @@ int64_t gebrd(
     std::complex<double>* tauq,
     std::complex<double>* taup )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgebrd(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tauq,
-        (lapack_complex_double*) taup,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgebrd(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tauq,
-        (lapack_complex_double*) taup,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gebrd`. Arguments are the same as for
+/// `lapack::gebrd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd_computational
+void gebrd_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gebrd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gebrd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gebrd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gebrd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gebrd_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup, work_buffer );
 }
 
 }  // namespace lapack
@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t gees(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gees_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
     float* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
-    float* VS, int64_t ldvs )
+    float* VS, int64_t ldvs,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -38,41 +44,49 @@ int64_t gees(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    float* WR = work_buffer.get< float >( max( 1, n ) );
+    float* WI = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgees(
-        &jobvs_, &sort_,
-        select, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_,
-        qry_work, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgees", { jobvs_, sort_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgees(
+            &jobvs_, &sort_,
+            select, &n_,
+            A, &lda_, &sdim_,
+            WR,
+            WI,
+            VS, &ldvs_,
+            qry_work, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgees(
         &jobvs_, &sort_,
         select, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         VS, &ldvs_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -86,12 +100,13 @@ int64_t gees(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
+int64_t gees_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
     double* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    double* VS, int64_t ldvs )
+    double* VS, int64_t ldvs,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -108,41 +123,49 @@ int64_t gees(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    double* WR = work_buffer.get< double >( max( 1, n ) );
+    double* WI = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgees(
-        &jobvs_, &sort_,
-        select, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_,
-        qry_work, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgees", { jobvs_, sort_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgees(
+            &jobvs_, &sort_,
+            select, &n_,
+            A, &lda_, &sdim_,
+            WR,
+            WI,
+            VS, &ldvs_,
+            qry_work, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgees(
         &jobvs_, &sort_,
         select, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         VS, &ldvs_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -156,12 +179,13 @@ int64_t gees(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
+int64_t gees_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
-    std::complex<float>* VS, int64_t ldvs )
+    std::complex<float>* VS, int64_t ldvs,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -177,30 +201,38 @@ int64_t gees(
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgees(
-        &jobvs_, &sort_,
-        (LAPACK_C_SELECT1) select, &n_,
-        (lapack_complex_float*) A, &lda_, &sdim_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VS, &ldvs_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgees", { jobvs_, sort_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgees(
+            &jobvs_, &sort_,
+            (LAPACK_C_SELECT1) select, &n_,
+            (lapack_complex_float*) A, &lda_, &sdim_,
+            (lapack_complex_float*) W,
+            (lapack_complex_float*) VS, &ldvs_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgees(
         &jobvs_, &sort_,
@@ -208,9 +240,9 @@ int64_t gees(
         (lapack_complex_float*) A, &lda_, &sdim_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VS, &ldvs_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -220,12 +252,13 @@ int64_t gees(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
+int64_t gees_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    std::complex<double>* VS, int64_t ldvs )
+    std::complex<double>* VS, int64_t ldvs,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -241,30 +274,38 @@ int64_t gees(
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgees(
-        &jobvs_, &sort_,
-        (LAPACK_Z_SELECT1) select, &n_,
-        (lapack_complex_double*) A, &lda_, &sdim_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VS, &ldvs_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgees", { jobvs_, sort_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgees(
+            &jobvs_, &sort_,
+            (LAPACK_Z_SELECT1) select, &n_,
+            (lapack_complex_double*) A, &lda_, &sdim_,
+            (lapack_complex_double*) W,
+            (lapack_complex_double*) VS, &ldvs_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgees(
         &jobvs_, &sort_,
@@ -272,9 +313,9 @@ int64_t gees(
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -283,4 +324,186 @@ int64_t gees(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs )
+{
+    size_t host_work_size;
+    gees_work_size_bytes( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gees( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs )
+{
+    size_t host_work_size;
+    gees_work_size_bytes( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gees( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs )
+{
+    size_t host_work_size;
+    gees_work_size_bytes( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gees( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs )
+{
+    size_t host_work_size;
+    gees_work_size_bytes( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gees( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+               work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+               work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+               work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+               work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work_buffer );
+}
+
 }  // namespace lapack
@@ -15,15 +15,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t geesx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t geesx_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
     float* VS, int64_t ldvs,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -41,46 +47,55 @@ int64_t geesx(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
-
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeesx(
-        &jobvs_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_, rconde, rcondv,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    float* WR = work_buffer.get< float >( max( 1, n ) );
+    float* WI = work_buffer.get< float >( max( 1, n ) );
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sgeesx", { jobvs_, sort_, sense_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeesx(
+            &jobvs_, &sort_,
+            select, &sense_, &n_,
+            A, &lda_, &sdim_,
+            WR,
+            WI,
+            VS, &ldvs_, rconde, rcondv,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -94,14 +109,15 @@ int64_t geesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+int64_t geesx_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     double* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -119,46 +135,55 @@ int64_t geesx(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
-
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeesx(
-        &jobvs_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_, rconde, rcondv,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    double* WR = work_buffer.get< double >( max( 1, n ) );
+    double* WI = work_buffer.get< double >( max( 1, n ) );
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dgeesx", { jobvs_, sort_, sense_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeesx(
+            &jobvs_, &sort_,
+            select, &sense_, &n_,
+            A, &lda_, &sdim_,
+            WR,
+            WI,
+            VS, &ldvs_, rconde, rcondv,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -172,14 +197,15 @@ int64_t geesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+int64_t geesx_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
     std::complex<float>* VS, int64_t ldvs,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -196,30 +222,38 @@ int64_t geesx(
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeesx(
-        &jobvs_, &sort_,
-        (LAPACK_C_SELECT1) select, &sense_, &n_,
-        (lapack_complex_float*) A, &lda_, &sdim_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cgeesx", { jobvs_, sort_, sense_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeesx(
+            &jobvs_, &sort_,
+            (LAPACK_C_SELECT1) select, &sense_, &n_,
+            (lapack_complex_float*) A, &lda_, &sdim_,
+            (lapack_complex_float*) W,
+            (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( (n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgeesx(
         &jobvs_, &sort_,
@@ -227,9 +261,9 @@ int64_t geesx(
         (lapack_complex_float*) A, &lda_, &sdim_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -239,14 +273,15 @@ int64_t geesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+int64_t geesx_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     std::complex<double>* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -263,30 +298,38 @@ int64_t geesx(
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeesx(
-        &jobvs_, &sort_,
-        (LAPACK_Z_SELECT1) select, &sense_, &n_,
-        (lapack_complex_double*) A, &lda_, &sdim_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zgeesx", { jobvs_, sort_, sense_, n_, lda_, ldvs_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeesx(
+            &jobvs_, &sort_,
+            (LAPACK_Z_SELECT1) select, &sense_, &n_,
+            (lapack_complex_double*) A, &lda_, &sdim_,
+            (lapack_complex_double*) W,
+            (lapack_complex_double*) VS, &ldvs_, rconde, rcondv,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( (n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgeesx(
         &jobvs_, &sort_,
@@ -294,9 +337,9 @@ int64_t geesx(
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -305,4 +348,210 @@ int64_t geesx(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv )
+{
+    size_t host_work_size;
+    geesx_work_size_bytes( jobvs, sort, select, sense, n, A, lda, sdim, W,
+                           VS, ldvs, rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geesx( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                  rconde, rcondv, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    size_t host_work_size;
+    geesx_work_size_bytes( jobvs, sort, select, sense, n, A, lda, sdim, W,
+                           VS, ldvs, rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geesx( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                  rconde, rcondv, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv )
+{
+    size_t host_work_size;
+    geesx_work_size_bytes( jobvs, sort, select, sense, n, A, lda, sdim, W,
+                           VS, ldvs, rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geesx( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                  rconde, rcondv, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    size_t host_work_size;
+    geesx_work_size_bytes( jobvs, sort, select, sense, n, A, lda, sdim, W,
+                           VS, ldvs, rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geesx( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                  rconde, rcondv, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                rconde, rcondv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                rconde, rcondv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                rconde, rcondv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size_bytes(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                rconde, rcondv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS,
+                       ldvs, rconde, rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS,
+                       ldvs, rconde, rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS,
+                       ldvs, rconde, rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS,
+                       ldvs, rconde, rcondv, work_buffer );
+}
+
 }  // namespace lapack
@@ -15,14 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup geev
-int64_t geev(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t geev_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     std::complex<float>* W,
     float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr )
+    float* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,35 +45,43 @@ int64_t geev(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    float* WR = work_buffer.get< float >( max( 1, n ) );
+    float* WI = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgeev", { jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeev(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            WR, WI,
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
-        &WR[0], &WI[0],
+        WR, WI,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -81,13 +94,13 @@ int64_t geev(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev
-int64_t geev(
+int64_t geev_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     std::complex<double>* W,
     double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr )
+    double* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -105,35 +118,43 @@ int64_t geev(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    double* WR = work_buffer.get< double >( max( 1, n ) );
+    double* WI = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgeev", { jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeev(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            WR, WI,
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
-        &WR[0], &WI[0],
+        WR, WI,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -146,13 +167,13 @@ int64_t geev(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev
-int64_t geev(
+int64_t geev_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* W,
     std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr )
+    std::complex<float>* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -169,36 +190,113 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgeev", { jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeev(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) W,
+            (lapack_complex_float*) VL, &ldvl_,
+            (lapack_complex_float*) VR, &ldvr_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (2*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgeev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int info_ = 0;
 
-    LAPACK_cgeev(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgeev", { jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeev(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) W,
+            (lapack_complex_double*) VL, &ldvl_,
+            (lapack_complex_double*) VR, &ldvr_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (2*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgeev(
         &jobvl_, &jobvr_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -206,6 +304,59 @@ int64_t geev(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    geev_work_size_bytes( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geev( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    geev_work_size_bytes( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geev( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    geev_work_size_bytes( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geev( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                 host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes for an n-by-n nonsymmetric matrix A, the
 /// eigenvalues and, optionally, the left and/or right eigenvectors.
@@ -315,56 +466,159 @@ int64_t geev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobvl_ = job2char( jobvl );
-    char jobvr_ = job2char( jobvr );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    geev_work_size_bytes( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return geev( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                 host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::geev`. Arguments are the same as for
+/// `lapack::geev`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup geev
+void geev_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::geev` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::geev_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::geev( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::geev`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::geev_work_size_bytes` for the same arguments.
+///
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work_buffer );
 }
 
 }  // namespace lapack
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -17,11 +16,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t gelq(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gelq_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* T, int64_t tsize )
+    float* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,27 +41,35 @@ int64_t gelq(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelq(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgelq", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgelq(
+            &m_, &n_,
+            A, &lda_,
+            T, &tsize_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -64,10 +77,11 @@ int64_t gelq(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+int64_t gelq_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* T, int64_t tsize )
+    double* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -82,27 +96,35 @@ int64_t gelq(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelq(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgelq", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgelq(
+            &m_, &n_,
+            A, &lda_,
+            T, &tsize_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -110,10 +132,11 @@ int64_t gelq(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+int64_t gelq_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* T, int64_t tsize )
+    std::complex<float>* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -128,27 +151,35 @@ int64_t gelq(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelq(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgelq", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgelq(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) T, &tsize_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgelq(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -156,10 +187,11 @@ int64_t gelq(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+int64_t gelq_work(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* T, int64_t tsize )
+    std::complex<double>* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -174,33 +206,179 @@ int64_t gelq(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelq(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgelq", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgelq(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) T, &tsize_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelq_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelq_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelq_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelq_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelq_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,12 +14,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gelqf
-int64_t gelqf(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gelqf_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* tau )
+    float* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,27 +37,35 @@ int64_t gelqf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgelqf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgelqf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgelqf(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -61,11 +73,11 @@ int64_t gelqf(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gelqf
-int64_t gelqf(
+int64_t gelqf_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* tau )
+    double* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -78,27 +90,35 @@ int64_t gelqf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgelqf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgelqf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgelqf(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -106,11 +126,11 @@ int64_t gelqf(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gelqf
-int64_t gelqf(
+int64_t gelqf_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -123,33 +143,132 @@ int64_t gelqf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgelqf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgelqf(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgelqf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelqf_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
 
-    LAPACK_cgelqf(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgelqf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgelqf(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgelqf(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes an LQ factorization of an m-by-n matrix A:
 /// $A = L Q$.
@@ -206,42 +325,136 @@ int64_t gelqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelqf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelqf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelqf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelqf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgelqf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gelqf`. Arguments are the same as for
+/// `lapack::gelqf`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gelqf
+void gelqf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelqf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gelqf` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gelqf_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gelqf( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gelqf`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gelqf_work_size_bytes` for the same arguments.
+///
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelqf_work( m, n, A, lda, tau, work_buffer );
 }
 
 }  // namespace lapack
@@ -5,7 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "backend_dispatch.hh"
 
 #include <vector>
 
@@ -15,12 +15,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gels(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gels_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* B, int64_t ldb )
+    float* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -42,28 +47,36 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgels", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgels(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -72,11 +85,11 @@ int64_t gels(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gels(
+int64_t gels_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* B, int64_t ldb )
+    double* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -98,28 +111,36 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgels", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgels(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -128,11 +149,11 @@ int64_t gels(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gels(
+int64_t gels_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -150,28 +171,96 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgels", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgels(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
 
-    LAPACK_cgels(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgels", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgels(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgels(
         &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -179,6 +268,44 @@ int64_t gels(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Solves overdetermined or underdetermined complex linear systems
 /// involving an m-by-n matrix A, or its conjugate-transpose, using a QR
@@ -276,49 +403,136 @@ int64_t gels(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char trans_ = op2char( trans );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gels`. Arguments are the same as for
+/// `lapack::gels`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gels
+void gels_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gels` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gels_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gels( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gels`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gels_work_size_bytes` for the same arguments.
+///
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
 }
 
 }  // namespace lapack
@@ -0,0 +1,355 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems and
+/// queries their workspace, then solves them in parallel,
+/// each thread reusing one workspace for all its problems.
+/// @ingroup gels_internal
+///
+template <typename scalar_t>
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( trans, batch_size, "trans" );
+    internal::check_batch_arg( m,     batch_size, "m" );
+    internal::check_batch_arg( n,     batch_size, "n" );
+    internal::check_batch_arg( nrhs,  batch_size, "nrhs" );
+    internal::check_batch_arg( lda,   batch_size, "lda" );
+    internal::check_batch_arg( ldb,   batch_size, "ldb" );
+    lapack_error_if( Aarray.size() != batch_size );
+    lapack_error_if( Barray.size() != batch_size );
+    lapack_error_if( info.size()   != batch_size );
+
+    // workspace queries are cached, so are cheap for repeated sizes;
+    // the query also rejects invalid trans
+    size_t work_size = 0;
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Op trans_i = internal::extract( trans, i );
+        int64_t m_i    = internal::extract( m,    i );
+        int64_t n_i    = internal::extract( n,    i );
+        int64_t nrhs_i = internal::extract( nrhs, i );
+        int64_t lda_i  = internal::extract( lda,  i );
+        int64_t ldb_i  = internal::extract( ldb,  i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        lapack_error_if( ldb_i < max( 1, max( m_i, n_i ) ) );
+        size_t work_size_i;
+        lapack::gels_work_size_bytes( trans_i, m_i, n_i, nrhs_i,
+                                      Aarray[ i ], lda_i, Barray[ i ], ldb_i,
+                                      &work_size_i );
+        work_size = max( work_size, work_size_i );
+    }
+
+    internal::batch_for_work( batch_size, work_size,
+        [&]( int64_t i, void* work ) {
+            info[ i ] = lapack::gels( internal::extract( trans, i ),
+                                      internal::extract( m,     i ),
+                                      internal::extract( n,     i ),
+                                      internal::extract( nrhs,  i ),
+                                      Aarray[ i ], internal::extract( lda, i ),
+                                      Barray[ i ], internal::extract( ldb, i ),
+                                      work, work_size );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments and queries workspace,
+/// then solves strided problems in parallel,
+/// each thread reusing one workspace for all its problems.
+/// @ingroup gels_internal
+///
+template <typename scalar_t>
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, max( m, n ) ) );
+    lapack_error_if( strideA < lda*n );
+    lapack_error_if( strideB < ldb*nrhs );
+
+    // the query also rejects invalid trans
+    size_t work_size;
+    lapack::gels_work_size_bytes( trans, m, n, nrhs, A, lda, B, ldb,
+                                  &work_size );
+
+    internal::batch_for_work( batch_size, work_size,
+        [&]( int64_t i, void* work ) {
+            info[ i ] = lapack::gels( trans, m, n, nrhs,
+                                      A + i*strideA, lda,
+                                      B + i*strideB, ldb,
+                                      work, work_size );
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Solves a batch of overdetermined or underdetermined linear systems
+/// involving m-by-n matrices $A_i$, or their conjugate-transposes,
+/// using QR or LQ factorizations, as in `lapack::gels`.
+/// Each $A_i$ is assumed to have full rank.
+///
+/// Problems are solved in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// Workspace is queried once per distinct problem size and allocated
+/// once for the whole batch; each thread reuses its part for all its
+/// problems.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     Whether each system involves $A_i$ or its (conjugate) transpose;
+///     see `lapack::gels`.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix $B_i$. nrhs[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the m[i]-by-n[i]
+///     matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     On exit, details of its QR or LQ factorization,
+///     as in `lapack::gels`.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, m[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Barray[i] is the
+///     max(m[i], n[i])-by-nrhs[i] matrix $B_i$,
+///     stored in an ldb[i]-by-nrhs[i] array.
+///     On entry, the right hand side vectors.
+///     On exit, if info[i] = 0, the solution vectors, as in `lapack::gels`.
+///
+/// @param[in] ldb
+///     The leading dimension of each array $B_i$.
+///     ldb[i] >= max(1, m[i], n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::gels` for problem i:
+///     - = 0: successful exit.
+///     - > 0: if info[i] = j, the j-th diagonal element of the
+///       triangular factor of $A_i$ is zero, so $A_i$ does not have
+///       full rank and the solution could not be computed.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is solved.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gels_batch
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gels_batch
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gels_batch
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gels_batch
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//==============================================================================
+/// Solves a batch of overdetermined or underdetermined linear systems,
+/// stored at a fixed stride.
+/// Same as `lapack::gels_batch`, but all problems have the same size,
+/// $A_i$ starts at A + i*strideA, and $B_i$ starts at B + i*strideB.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     Whether the systems involve $A_i$ or its (conjugate) transpose;
+///     see `lapack::gels`.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of each matrix $B_i$. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, details of their factorizations.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, m).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The batch of right hand sides, stored in an ldb-by-nrhs-by-batch_size
+///     array. On exit, the solutions.
+///
+/// @param[in] ldb
+///     The leading dimension of each $B_i$. ldb >= max(1, m, n).
+///
+/// @param[in] strideB
+///     Distance between the first elements of $B_i$ and $B_{i+1}$.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::gels` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gels_batch
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gels_batch_strided( trans, m, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gels_batch
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gels_batch_strided( trans, m, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gels_batch
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gels_batch_strided( trans, m, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gels_batch
+void gels_batch_strided(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gels_batch_strided( trans, m, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+}  // namespace lapack
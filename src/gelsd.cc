@@ -15,14 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gelsd_work(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,34 +45,43 @@ int64_t gelsd(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sgelsd", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgelsd(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            S, &rcond, &rank_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = qry_iwork[0];
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
+        work, &lwork_,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -76,13 +90,13 @@ int64_t gelsd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsd(
+int64_t gelsd_work(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* S, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -100,34 +114,43 @@ int64_t gelsd(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dgelsd", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgelsd(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            S, &rcond, &rank_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = qry_iwork[0];
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
+        work, &lwork_,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -136,13 +159,13 @@ int64_t gelsd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsd(
+int64_t gelsd_work(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -160,39 +183,124 @@ int64_t gelsd(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cgelsd", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgelsd(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            S, &rcond, &rank_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = qry_rwork[0];
+        sizes.liwork = qry_iwork[0];
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgelsd(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    *rank = rank_;
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelsd_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
 
-    LAPACK_cgelsd(
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zgelsd", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgelsd(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            S, &rcond, &rank_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = qry_rwork[0];
+        sizes.liwork = qry_iwork[0];
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgelsd(
         &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -200,6 +308,59 @@ int64_t gelsd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsd_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsd( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsd_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsd( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsd_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsd( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the minimum-norm solution to a real linear least
 /// squares problem:
@@ -290,60 +451,159 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gelsd_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsd( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gelsd`. Arguments are the same as for
+/// `lapack::gelsd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gels
+void gelsd_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gelsd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gelsd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gelsd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gelsd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gelsd_work_size_bytes` for the same arguments.
+///
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsd_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
 }
 
 }  // namespace lapack
@@ -15,14 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelss(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gelss_work(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,29 +45,37 @@ int64_t gelss(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgelss", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgelss(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            S, &rcond, &rank_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgelss(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -71,13 +84,13 @@ int64_t gelss(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelss(
+int64_t gelss_work(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* S, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -95,29 +108,37 @@ int64_t gelss(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgelss", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgelss(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            S, &rcond, &rank_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgelss(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -126,13 +147,13 @@ int64_t gelss(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelss(
+int64_t gelss_work(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -150,33 +171,108 @@ int64_t gelss(
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgelss", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgelss(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            S, &rcond, &rank_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (5*min(m,n)) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgelss(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *rank = rank_;
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+int64_t gelss_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
 
-    LAPACK_cgelss(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgelss", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgelss(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            S, &rcond, &rank_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (5*min(m,n)) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgelss(
         &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -184,6 +280,59 @@ int64_t gelss(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelss_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelss( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelss_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelss( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelss_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelss( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the minimum norm solution to a complex linear
 /// least squares problem:
@@ -260,54 +409,159 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gelss_work_size_bytes( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelss( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelss(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgelss(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gelss`. Arguments are the same as for
+/// `lapack::gelss`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gels
+void gelss_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gelss` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gelss_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gelss( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gelss`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gelss_work_size_bytes` for the same arguments.
+///
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work_buffer );
 }
 
 }  // namespace lapack
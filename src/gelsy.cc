@@ -15,14 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsy(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gelsy_work(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     int64_t* jpvt, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -37,57 +42,67 @@ int64_t gelsy(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgelsy", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgelsy(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            jpvt_ptr, &rcond, &rank_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     *rank = rank_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsy(
+int64_t gelsy_work(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     int64_t* jpvt, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -102,57 +117,67 @@ int64_t gelsy(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgelsy", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgelsy(
+            &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            jpvt_ptr, &rcond, &rank_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     *rank = rank_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gels
-int64_t gelsy(
+int64_t gelsy_work(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     int64_t* jpvt, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -167,53 +192,195 @@ int64_t gelsy(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int rank_ = (lapack_int) *rank;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgelsy", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgelsy(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            jpvt_ptr, &rcond, &rank_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (2*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+int64_t gelsy_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
 
-    LAPACK_cgelsy(
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgelsy", { m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgelsy(
+            &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            jpvt_ptr, &rcond, &rank_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (2*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgelsy(
         &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     *rank = rank_;
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsy_work_size_bytes( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsy( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsy_work_size_bytes( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsy( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank )
+{
+    size_t host_work_size;
+    gelsy_work_size_bytes( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsy( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the minimum-norm solution to a complex linear least
 /// squares problem:
@@ -322,64 +489,159 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gelsy_work_size_bytes( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gelsy( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gelsy`. Arguments are the same as for
+/// `lapack::gelsy`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gels
+void gelsy_work_size_bytes(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gelsy` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gelsy_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gelsy( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gelsy`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gelsy_work_size_bytes` for the same arguments.
+///
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work_buffer );
 }
 
 }  // namespace lapack
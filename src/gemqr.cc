@@ -17,12 +17,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
     float const* T, int64_t tsize,
-    float* C, int64_t ldc )
+    float* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -43,30 +49,38 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgemqr(
-        &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgemqr", { side_, trans_, m_, n_, k_, lda_, tsize_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgemqr(
+            &side_, &trans_, &m_, &n_, &k_,
+            A, &lda_,
+            T, &tsize_,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -75,11 +89,12 @@ int64_t gemqr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
     double const* T, int64_t tsize,
-    double* C, int64_t ldc )
+    double* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -100,30 +115,38 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgemqr(
-        &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgemqr", { side_, trans_, m_, n_, k_, lda_, tsize_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgemqr(
+            &side_, &trans_, &m_, &n_, &k_,
+            A, &lda_,
+            T, &tsize_,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -132,11 +155,12 @@ int64_t gemqr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* T, int64_t tsize,
-    std::complex<float>* C, int64_t ldc )
+    std::complex<float>* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -157,30 +181,38 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgemqr(
-        &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgemqr", { side_, trans_, m_, n_, k_, lda_, tsize_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgemqr(
+            &side_, &trans_, &m_, &n_, &k_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) T, &tsize_,
+            (lapack_complex_float*) C, &ldc_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
         (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -189,11 +221,12 @@ int64_t gemqr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* T, int64_t tsize,
-    std::complex<double>* C, int64_t ldc )
+    std::complex<double>* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -214,30 +247,38 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgemqr(
-        &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgemqr", { side_, trans_, m_, n_, k_, lda_, tsize_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgemqr(
+            &side_, &trans_, &m_, &n_, &k_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) T, &tsize_,
+            (lapack_complex_double*) C, &ldc_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
         (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -245,6 +286,172 @@ int64_t gemqr(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc )
+{
+    size_t host_work_size;
+    gemqr_work_size_bytes( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    size_t host_work_size;
+    gemqr_work_size_bytes( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    size_t host_work_size;
+    gemqr_work_size_bytes( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    size_t host_work_size;
+    gemqr_work_size_bytes( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gemqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,12 +14,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t geqp3_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     int64_t* jpvt,
-    float* tau )
+    float* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -31,53 +36,64 @@ int64_t geqp3(
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqp3(
-        &m_, &n_,
-        A, &lda_,
-        jpvt_ptr,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgeqp3", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeqp3(
+            &m_, &n_,
+            A, &lda_,
+            jpvt_ptr,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+int64_t geqp3_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     int64_t* jpvt,
-    double* tau )
+    double* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -88,53 +104,64 @@ int64_t geqp3(
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqp3(
-        &m_, &n_,
-        A, &lda_,
-        jpvt_ptr,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgeqp3", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeqp3(
+            &m_, &n_,
+            A, &lda_,
+            jpvt_ptr,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+int64_t geqp3_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -145,57 +172,68 @@ int64_t geqp3(
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqp3(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        jpvt_ptr,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgeqp3", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeqp3(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            jpvt_ptr,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (2*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+int64_t geqp3_work(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -206,49 +244,209 @@ int64_t geqp3(
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
+        lapack_int* jpvt_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &jpvt[0], &jpvt[(n)], jpvt_ );
+        lapack_int* jpvt_ptr = jpvt_;
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqp3(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        jpvt_ptr,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgeqp3", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeqp3(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            jpvt_ptr,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (2*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        std::copy( jpvt_, jpvt_ + (n), jpvt );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqp3_work( m, n, A, lda, jpvt, tau, work_buffer );
+}
+
 }  // namespace lapack
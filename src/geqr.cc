@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -17,12 +16,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t geqr_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* T, int64_t tsize )
+    float* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -37,31 +41,39 @@ int64_t geqr(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgeqr", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (tsize < 0 || ! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeqr(
+            &m_, &n_,
+            A, &lda_,
+            T, &tsize_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        // tsize == -1 or -2 is query
+        if (tsize < 0) {
+            return info_;
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgeqr(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -69,11 +81,11 @@ int64_t geqr(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqr(
+int64_t geqr_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* T, int64_t tsize )
+    double* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -88,31 +100,39 @@ int64_t geqr(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgeqr", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (tsize < 0 || ! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeqr(
+            &m_, &n_,
+            A, &lda_,
+            T, &tsize_,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        // tsize == -1 or -2 is query
+        if (tsize < 0) {
+            return info_;
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgeqr(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -120,11 +140,11 @@ int64_t geqr(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqr(
+int64_t geqr_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* T, int64_t tsize )
+    std::complex<float>* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -139,37 +159,142 @@ int64_t geqr(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgeqr", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (tsize < 0 || ! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeqr(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) T, &tsize_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        // tsize == -1 or -2 is query
+        if (tsize < 0) {
+            return info_;
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgeqr(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqr_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int info_ = 0;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgeqr", { m_, n_, lda_, tsize_ } );
+    internal::WorkSizes sizes;
+    if (tsize < 0 || ! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeqr(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) T, &tsize_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        // tsize == -1 or -2 is query
+        if (tsize < 0) {
+            return info_;
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    LAPACK_cgeqr(
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgeqr(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) T, &tsize_,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes a QR factorization of an m-by-n matrix A:
 /// \[
@@ -266,48 +391,136 @@ int64_t geqr(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int tsize_ = (lapack_int) tsize;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqr(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqr_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqr_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgeqr(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqr_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::geqr`. Arguments are the same as for
+/// `lapack::geqr`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup geqrf
+void geqr_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqr_work( m, n, A, lda, T, tsize, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::geqr` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::geqr_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::geqr( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::geqr`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::geqr_work_size_bytes` for the same arguments.
+///
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqr_work( m, n, A, lda, T, tsize, work_buffer );
 }
 
 }  // namespace lapack
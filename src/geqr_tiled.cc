@@ -0,0 +1,783 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch.hh"
+#include "task_graph.hh"
+
+#if LAPACK_VERSION >= 30700  // >= 3.7
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Layout of T for the tiled QR, shared by geqr and gemqr.
+/// T has a 5 entry header { tsize, nb, ib, m, n }, followed by
+/// the ib-by-kb triangular factor T(i, k) of each tile A(i, k), i >= k,
+/// at column ( i*min(m,n) + k*nb ) of an ib-by-( mt*min(m,n) ) array.
+/// @ingroup geqrf_internal
+///
+struct QrTiledLayout
+{
+    static const int64_t header = 5;
+
+    QrTiledLayout( int64_t m_, int64_t n_, int64_t nb_, int64_t ib_ ):
+        m( m_ ), n( n_ ), nb( nb_ ), ib( ib_ ),
+        mt( (m_ + nb_ - 1) / nb_ ),
+        nt( (n_ + nb_ - 1) / nb_ ),
+        kt( min( mt, nt ) )
+    {}
+
+    int64_t tsize() const
+    {
+        return header + ib * mt * min( m, n );
+    }
+
+    int64_t t_offset( int64_t i, int64_t k ) const
+    {
+        return header + (i*min( m, n ) + k*nb) * ib;
+    }
+
+    int64_t m, n, nb, ib, mt, nt, kt;
+};
+
+//------------------------------------------------------------------------------
+/// Tiled QR factorization, as a DAG of tile tasks on a work-stealing
+/// thread pool. Each block column k is reduced by geqrt on the diagonal
+/// tile, then tpqrt couples its R with each tile below it (flat tree);
+/// gemqrt and tpmqrt apply the same transforms to the tiles to the right.
+/// Vendor BLAS is set to one thread while tasks run.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void geqr_tiled(
+    QrTiledLayout const& layout,
+    scalar_t* A, int64_t lda,
+    scalar_t* T, int num_threads )
+{
+    using blas::Op;
+    using blas::Side;
+
+    int64_t m = layout.m, n = layout.n, nb = layout.nb, ib = layout.ib;
+    int64_t mt = layout.mt, nt = layout.nt;
+
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return A + i*nb + j*nb*lda;
+    };
+    auto Ttile = [&]( int64_t i, int64_t k ) {
+        return T + layout.t_offset( i, k );
+    };
+    // Tile keys, plus one key per diagonal tile for its reflectors V,
+    // so applying V doesn't conflict with tpqrt updating R.
+    auto key = [&]( int64_t i, int64_t j ) {
+        return i + j*mt;
+    };
+    auto vkey = [&]( int64_t k ) {
+        return mt*nt + k;
+    };
+
+    internal::TaskGraph graph;
+
+    for (int64_t k = 0; k < layout.kt; ++k) {
+        int64_t mb = min( nb, m - k*nb );
+        int64_t kb = min( nb, n - k*nb );
+        int64_t kk = min( mb, kb );
+        scalar_t* Akk = tile( k, k );
+        scalar_t* Tkk = Ttile( k, k );
+
+        graph.add( [=] {
+            lapack::geqrt( mb, kb, min( ib, kk ), Akk, lda, Tkk, ib );
+        }, {}, { key( k, k ), vkey( k ) }, true );
+
+        for (int64_t j = k+1; j < nt; ++j) {
+            int64_t jb = min( nb, n - j*nb );
+            scalar_t* Akj = tile( k, j );
+            graph.add( [=] {
+                lapack::gemqrt( Side::Left, Op::ConjTrans, mb, jb, kk,
+                                min( ib, kk ), Akk, lda, Tkk, ib, Akj, lda );
+            }, { vkey( k ) }, key( k, j ), j == k+1 );
+        }
+
+        for (int64_t i = k+1; i < mt; ++i) {
+            int64_t mi = min( nb, m - i*nb );
+            scalar_t* Aik = tile( i, k );
+            scalar_t* Tik = Ttile( i, k );
+
+            graph.add( [=] {
+                lapack::tpqrt( mi, kb, 0, min( ib, kb ),
+                               Akk, lda, Aik, lda, Tik, ib );
+            }, {}, { key( k, k ), key( i, k ) }, true );
+
+            for (int64_t j = k+1; j < nt; ++j) {
+                int64_t jb = min( nb, n - j*nb );
+                scalar_t* Akj = tile( k, j );
+                scalar_t* Aij = tile( i, j );
+                graph.add( [=] {
+                    lapack::tpmqrt( Side::Left, Op::ConjTrans, mi, jb, kb, 0,
+                                    min( ib, kb ), Aik, lda, Tik, ib,
+                                    Akj, lda, Aij, lda );
+                }, { key( i, k ) }, { key( k, j ), key( i, j ) }, j == k+1 );
+            }
+        }
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+}
+
+//------------------------------------------------------------------------------
+/// Multiplies C by Q from the tiled QR, as a DAG of tile tasks.
+/// Tiles of C in different block columns (side = Left) or block rows
+/// (side = Right) are independent, so they are updated in parallel.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void gemqr_tiled(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n, int64_t k,
+    QrTiledLayout const& layout,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T,
+    scalar_t* C, int64_t ldc, int num_threads )
+{
+    using blas::Op;
+    using blas::Side;
+
+    int64_t nb = layout.nb, ib = layout.ib, mt = layout.mt;
+    int64_t mq = (side == Side::Left ? m : n);
+    int64_t kt = (k + nb - 1) / nb;
+
+    // C is split into nb tiles along the dimension Q applies to,
+    // and into nb-wide independent strips along the other dimension.
+    int64_t ns = (side == Side::Left ? n : m);
+    int64_t st = (ns + nb - 1) / nb;
+
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return A + i*nb + j*nb*lda;
+    };
+    auto Ttile = [&]( int64_t i, int64_t j ) {
+        return T + layout.t_offset( i, j );
+    };
+    auto Ctile = [&]( int64_t i, int64_t s ) {
+        return side == Side::Left ? C + i*nb + s*nb*ldc
+                                  : C + s*nb + i*nb*ldc;
+    };
+    auto key = [&]( int64_t i, int64_t s ) {
+        return i + s*mt;
+    };
+
+    // Q = Q_0 Q_1 ... Q_{kt-1}, with Q_p = G(p, p) G(p+1, p) ... G(mt-1, p).
+    // Q^H C and C Q apply the G's in factorization order; Q C and C Q^H
+    // in reverse order.
+    bool forward = (side == Side::Left) == (trans != Op::NoTrans);
+
+    internal::TaskGraph graph;
+
+    auto add_diag = [&]( int64_t p ) {
+        int64_t mb = min( nb, mq - p*nb );
+        int64_t kb = min( nb, k - p*nb );
+        scalar_t const* Akk = tile( p, p );
+        scalar_t const* Tkk = Ttile( p, p );
+        for (int64_t s = 0; s < st; ++s) {
+            int64_t sb = min( nb, ns - s*nb );
+            scalar_t* Cks = Ctile( p, s );
+            int64_t cm = (side == Side::Left ? mb : sb);
+            int64_t cn = (side == Side::Left ? sb : mb);
+            graph.add( [=] {
+                lapack::gemqrt( side, trans, cm, cn, kb, min( ib, kb ),
+                                Akk, lda, Tkk, ib, Cks, ldc );
+            }, {}, key( p, s ) );
+        }
+    };
+    auto add_offdiag = [&]( int64_t i, int64_t p ) {
+        int64_t mb = min( nb, mq - i*nb );
+        int64_t kb = min( nb, k - p*nb );
+        scalar_t const* Aik = tile( i, p );
+        scalar_t const* Tik = Ttile( i, p );
+        for (int64_t s = 0; s < st; ++s) {
+            int64_t sb = min( nb, ns - s*nb );
+            scalar_t* Cks = Ctile( p, s );
+            scalar_t* Cis = Ctile( i, s );
+            int64_t cm = (side == Side::Left ? mb : sb);
+            int64_t cn = (side == Side::Left ? sb : mb);
+            graph.add( [=] {
+                lapack::tpmqrt( side, trans, cm, cn, kb, 0, min( ib, kb ),
+                                Aik, lda, Tik, ib, Cks, ldc, Cis, ldc );
+            }, {}, { key( p, s ), key( i, s ) } );
+        }
+    };
+
+    if (forward) {
+        for (int64_t p = 0; p < kt; ++p) {
+            add_diag( p );
+            for (int64_t i = p+1; i < mt; ++i)
+                add_offdiag( i, p );
+        }
+    }
+    else {
+        for (int64_t p = kt-1; p >= 0; --p) {
+            for (int64_t i = mt-1; i > p; --i)
+                add_offdiag( i, p );
+            add_diag( p );
+        }
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+}
+
+//------------------------------------------------------------------------------
+/// Layout of T for TSQR, shared by geqr and gemqr.
+/// A is split into p blocks of rows, block b being rows
+/// [ b*m/p, (b+1)*m/p ). T has a 5 entry header { tsize, p, ib, m, n },
+/// followed by the ib-by-min(m,n) triangular factors of the p leaves,
+/// then of the p-1 tree nodes, where node b couples block b into
+/// block b - s at level s.
+/// @ingroup geqrf_internal
+///
+struct QrTsqrLayout
+{
+    static const int64_t header = 5;
+
+    QrTsqrLayout( int64_t m_, int64_t n_, int64_t p_, int64_t ib_ ):
+        m( m_ ), n( n_ ), p( p_ ), ib( ib_ ),
+        k( min( m_, n_ ) )
+    {}
+
+    int64_t tsize() const
+    {
+        return header + 2 * p * ib * k;
+    }
+
+    int64_t row( int64_t b ) const
+    {
+        return b * m / p;
+    }
+
+    int64_t leaf_offset( int64_t b ) const
+    {
+        return header + b * ib * k;
+    }
+
+    int64_t node_offset( int64_t b ) const
+    {
+        return header + (p + b) * ib * k;
+    }
+
+    int64_t m, n, p, ib, k;
+};
+
+//------------------------------------------------------------------------------
+/// @return number of row blocks for TSQR of an m-by-n matrix:
+/// one per thread, each with at least 2n rows.
+inline int64_t tsqr_blocks( int64_t m, int64_t n, int num_threads )
+{
+    if (n == 0)
+        return 1;
+    return max( 1, min( int64_t( num_threads ), m / (2*n) ) );
+}
+
+//------------------------------------------------------------------------------
+/// Tall-skinny QR (TSQR). Each block of rows is factored by geqrt,
+/// in parallel, then pairs of R factors are combined up a binary
+/// tree by tpqrt on triangle-on-triangle pairs (l = n), leaving R in the
+/// first block. Vendor BLAS is set to one thread while tasks run.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void geqr_tsqr(
+    QrTsqrLayout const& layout,
+    scalar_t* A, int64_t lda,
+    scalar_t* T, int num_threads )
+{
+    int64_t n = layout.n, p = layout.p, ib = layout.ib, k = layout.k;
+
+    internal::TaskGraph graph;
+
+    for (int64_t b = 0; b < p; ++b) {
+        int64_t mb = layout.row( b+1 ) - layout.row( b );
+        scalar_t* Ab = A + layout.row( b );
+        scalar_t* Tb = T + layout.leaf_offset( b );
+        graph.add( [=] {
+            lapack::geqrt( mb, n, min( ib, k ), Ab, lda, Tb, ib );
+        }, {}, b );
+    }
+
+    // With p > 1, each block has m >= 2n rows, so k = n.
+    for (int64_t s = 1; s < p; s *= 2) {
+        for (int64_t b = 0; b + s < p; b += 2*s) {
+            scalar_t* Ab = A + layout.row( b );
+            scalar_t* Bb = A + layout.row( b+s );
+            scalar_t* Tb = T + layout.node_offset( b+s );
+            graph.add( [=] {
+                lapack::tpqrt( n, n, n, min( ib, n ), Ab, lda, Bb, lda, Tb, ib );
+            }, {}, { b, b+s }, true );
+        }
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+}
+
+//------------------------------------------------------------------------------
+/// Multiplies C by Q from TSQR, as a DAG of tasks on blocks of C
+/// matching the row blocks of A, split into strips along the other
+/// dimension of C, which are independent.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void gemqr_tsqr(
+    lapack::Side side, lapack::Op trans,
+    int64_t m, int64_t n,
+    QrTsqrLayout const& layout,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T,
+    scalar_t* C, int64_t ldc, int num_threads )
+{
+    using blas::Op;
+    using blas::Side;
+
+    int64_t p = layout.p, ib = layout.ib, k = layout.k;
+
+    int64_t ns = (side == Side::Left ? n : m);
+    int64_t nb = internal::tiled_nb( ns, num_threads );
+    int64_t st = (ns + nb - 1) / nb;
+
+    // Block b of rows (side = Left) or columns (side = Right) of C,
+    // in strip s.
+    auto Cblock = [&]( int64_t b, int64_t s ) {
+        return side == Side::Left ? C + layout.row( b ) + s*nb*ldc
+                                  : C + s*nb + layout.row( b )*ldc;
+    };
+    auto key = [&]( int64_t b, int64_t s ) {
+        return b + s*p;
+    };
+
+    internal::TaskGraph graph;
+
+    auto add_leaves = [&]() {
+        for (int64_t b = 0; b < p; ++b) {
+            int64_t mb = layout.row( b+1 ) - layout.row( b );
+            scalar_t const* Ab = A + layout.row( b );
+            scalar_t const* Tb = T + layout.leaf_offset( b );
+            for (int64_t s = 0; s < st; ++s) {
+                int64_t sb = min( nb, ns - s*nb );
+                scalar_t* Cbs = Cblock( b, s );
+                int64_t cm = (side == Side::Left ? mb : sb);
+                int64_t cn = (side == Side::Left ? sb : mb);
+                graph.add( [=] {
+                    lapack::gemqrt( side, trans, cm, cn, k, min( ib, k ),
+                                    Ab, lda, Tb, ib, Cbs, ldc );
+                }, {}, key( b, s ) );
+            }
+        }
+    };
+    auto add_level = [&]( int64_t lev ) {
+        for (int64_t b = 0; b + lev < p; b += 2*lev) {
+            scalar_t const* Vb = A + layout.row( b+lev );
+            scalar_t const* Tb = T + layout.node_offset( b+lev );
+            for (int64_t s = 0; s < st; ++s) {
+                int64_t sb = min( nb, ns - s*nb );
+                scalar_t* C1 = Cblock( b, s );
+                scalar_t* C2 = Cblock( b+lev, s );
+                int64_t cm = (side == Side::Left ? k : sb);
+                int64_t cn = (side == Side::Left ? sb : k);
+                graph.add( [=] {
+                    lapack::tpmqrt( side, trans, cm, cn, k, k, min( ib, k ),
+                                    Vb, lda, Tb, ib, C1, ldc, C2, ldc );
+                }, {}, { key( b, s ), key( b+lev, s ) } );
+            }
+        }
+    };
+
+    // Q = L Q_1 Q_2 ..., with leaves L and tree levels Q_s. Q^H C and C Q
+    // apply leaves first, then levels up the tree; Q C and C Q^H reverse it.
+    int64_t top = 1;
+    while (top < p)
+        top *= 2;
+    if ((side == Side::Left) == (trans != Op::NoTrans)) {
+        add_leaves();
+        for (int64_t lev = 1; lev < p; lev *= 2)
+            add_level( lev );
+    }
+    else {
+        for (int64_t lev = top / 2; lev >= 1; lev /= 2)
+            add_level( lev );
+        add_leaves();
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+}
+
+//------------------------------------------------------------------------------
+/// QR factorization using the given method.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t geqr(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* T, int64_t tsize,
+    lapack::Method method )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Tiled &&
+                     method != Method::TSQR );
+
+    if (method == Method::Lapack) {
+        return lapack::geqr( m, n, A, lda, T, tsize );
+    }
+
+    // Header entry T[ 1 ] is nb for Tiled, p for TSQR.
+    int num_threads = internal::batch_max_threads();
+    int64_t nb = internal::tiled_nb( n, num_threads );
+    int64_t p  = tsqr_blocks( m, n, num_threads );
+    int64_t ib = (method == Method::Tiled ? min( nb, 32 ) : min( n, 32 ));
+    ib = max( ib, 1 );
+    QrTiledLayout tiled( m, n, nb, ib );
+    QrTsqrLayout  tsqr( m, n, p, ib );
+    int64_t tsize_need = (method == Method::Tiled ? tiled.tsize() : tsqr.tsize());
+    int64_t h1 = (method == Method::Tiled ? nb : p);
+
+    if (tsize == -1 || tsize == -2) {
+        T[ 0 ] = scalar_t( tsize_need );
+        T[ 1 ] = scalar_t( h1 );
+        T[ 2 ] = scalar_t( ib );
+        return 0;
+    }
+    lapack_error_if( tsize < tsize_need );
+
+    T[ 0 ] = scalar_t( tsize_need );
+    T[ 1 ] = scalar_t( h1 );
+    T[ 2 ] = scalar_t( ib );
+    T[ 3 ] = scalar_t( m );
+    T[ 4 ] = scalar_t( n );
+    if (min( m, n ) > 0) {
+        if (method == Method::Tiled)
+            geqr_tiled( tiled, A, lda, T, num_threads );
+        else
+            geqr_tsqr( tsqr, A, lda, T, num_threads );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Multiply by Q from geqr, using the given method.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T, int64_t tsize,
+    scalar_t* C, int64_t ldc,
+    lapack::Method method )
+{
+    int64_t mq = (side == Side::Left ? m : n);
+    lapack_error_if( side != Side::Left &&
+                     side != Side::Right );
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > mq );
+    lapack_error_if( lda < max( 1, mq ) );
+    lapack_error_if( tsize < 5 );
+    lapack_error_if( ldc < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Tiled &&
+                     method != Method::TSQR );
+
+    if (method == Method::Lapack) {
+        return lapack::gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc );
+    }
+
+    // T must come from geqr with the same method on an mq-by-k or wider A.
+    int64_t h1 = int64_t( std::real( T[ 1 ] ) );
+    int64_t ib = int64_t( std::real( T[ 2 ] ) );
+    int64_t mA = int64_t( std::real( T[ 3 ] ) );
+    int64_t nA = int64_t( std::real( T[ 4 ] ) );
+    lapack_error_if_msg( h1 < 1 || ib < 1 || mA != mq || min( mA, nA ) != k,
+                         "T is not from geqr with method %s",
+                         method2str( method ) );
+
+    if (method == Method::Tiled) {
+        lapack_error_if( ib > h1 );
+        QrTiledLayout layout( mA, nA, h1, ib );
+        lapack_error_if( tsize < layout.tsize() );
+        if (m > 0 && n > 0 && k > 0) {
+            gemqr_tiled( side, trans, m, n, k, layout, A, lda, T, C, ldc,
+                         internal::batch_max_threads() );
+        }
+    }
+    else {
+        lapack_error_if( h1 > 1 && mA < 2*h1*nA );
+        QrTsqrLayout layout( mA, nA, h1, ib );
+        lapack_error_if( tsize < layout.tsize() );
+        if (m > 0 && n > 0 && k > 0) {
+            gemqr_tsqr( side, trans, m, n, layout, A, lda, T, C, ldc,
+                        internal::batch_max_threads() );
+        }
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes a QR factorization of an m-by-n matrix A, as `lapack::geqr`
+/// does, using the given method:
+///
+/// - Method::Lapack: calls LAPACK geqr, which uses a tall-skinny
+///   algorithm when m is much larger than n, and geqrt otherwise.
+///
+/// - Method::Tiled: splits A into nb-by-nb tiles and runs tile kernels
+///   (geqrt, gemqrt, tpqrt, tpmqrt) as a DAG of tasks on a work-stealing
+///   pool of threads, with the vendor BLAS set to one thread. Each
+///   diagonal tile is factored, then its R is coupled with each tile
+///   below it in turn, so trailing updates of one block column overlap
+///   the factorization of the next. This helps scaling on many cores for
+///   square and tall matrices.
+///
+/// - Method::TSQR: for tall-skinny matrices, m >> n. Splits the rows
+///   of A into one block per thread, each with at least 2n rows, and
+///   factors the blocks in parallel with geqrt, then combines pairs of
+///   R factors up a binary tree with tpqrt, so a reduction over p blocks
+///   takes log2(p) steps. R ends up in the first n rows of A.
+///
+/// Tiled and TSQR use the OpenMP max threads (e.g., from
+/// `$OMP_NUM_THREADS`).
+///
+/// R agrees with Method::Lapack up to rounding and the sign (for complex,
+/// a unit-modulus factor) of each row.
+/// Q is stored as Householder vectors in A and triangular factors in T,
+/// in a format specific to each method: apply Q using `lapack::gemqr`
+/// with the same method.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, the elements on and above the diagonal of the array
+///     contain the min(m,n)-by-n upper trapezoidal matrix R;
+///     the elements below the diagonal represent Q.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] T
+///     The array T of length max(5,tsize).
+///     On exit, if return value = 0, T[0] returns the needed tsize;
+///     the rest of T represents Q, together with A.
+///
+/// @param[in] tsize
+///     The length of the array T.
+///     If tsize = -1 or -2, then a workspace query is assumed; the routine
+///     only calculates the size of T, returned in T[0].
+///     For Method::Tiled and TSQR, the minimum and optimal sizes are the
+///     same, and depend on the number of threads, so query with the same
+///     number of threads as the factorization.
+///
+/// @param[in] method
+///     Method::Lapack, Method::Tiled, or Method::TSQR.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    lapack::Method method )
+{
+    return impl::geqr( m, n, A, lda, T, tsize, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    lapack::Method method )
+{
+    return impl::geqr( m, n, A, lda, T, tsize, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    lapack::Method method )
+{
+    return impl::geqr( m, n, A, lda, T, tsize, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf
+int64_t geqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    lapack::Method method )
+{
+    return impl::geqr( m, n, A, lda, T, tsize, method );
+}
+
+//==============================================================================
+/// Multiplies the general m-by-n matrix C by Q from `lapack::geqr`,
+/// as `lapack::gemqr` does, using the given method, which must be the
+/// method used in geqr:
+///
+/// - Method::Lapack: calls LAPACK gemqr.
+///
+/// - Method::Tiled: applies the tile transforms as a DAG of tasks
+///   (gemqrt, tpmqrt) on a work-stealing pool of threads. Blocks of
+///   nb columns (side = Left) or nb rows (side = Right) of C are
+///   updated in parallel.
+///
+/// - Method::TSQR: applies the leaf transforms to blocks of C in
+///   parallel, and the tree transforms level by level, pairs at each
+///   level in parallel.
+///
+/// Computes
+///
+/// - $Q   C$ if side = Left  and trans = NoTrans,
+/// - $Q^H C$ if side = Left  and trans = ConjTrans,
+/// - $C Q  $ if side = Right and trans = NoTrans,
+/// - $C Q^H$ if side = Right and trans = ConjTrans.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, lapack::Op::Trans and lapack::Op::ConjTrans are
+/// interchangeable.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply Q or $Q^H$ from the Left;
+///     - lapack::Side::Right: apply Q or $Q^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply Q;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q^H$.
+///
+/// @param[in] m
+///     The number of rows of the matrix C. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix C. n >= 0.
+///
+/// @param[in] k
+///     The number of elementary reflectors, min(m,n) of the matrix
+///     factored by geqr.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] A
+///     The array A, as returned by geqr.
+///     - If side = Left,  the m-by-k matrix A, stored in an lda-by-k array;
+///     - if side = Right, the n-by-k matrix A, stored in an lda-by-k array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] T
+///     The array T of length tsize, as returned by geqr.
+///
+/// @param[in] tsize
+///     The length of the array T. tsize >= 5.
+///
+/// @param[in,out] C
+///     The m-by-n matrix C, stored in an ldc-by-n array.
+///     On exit, C is overwritten by Q C, $Q^H C$, C Q, or $C Q^H$.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1,m).
+///
+/// @param[in] method
+///     Method::Lapack, Method::Tiled, or Method::TSQR.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    lapack::Method method )
+{
+    return impl::gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                        method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    lapack::Method method )
+{
+    return impl::gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                        method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    lapack::Method method )
+{
+    return impl::gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                        method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    lapack::Method method )
+{
+    return impl::gemqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                        method );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.7
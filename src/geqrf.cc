@@ -5,7 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "backend_dispatch.hh"
 
 #include <vector>
 
@@ -15,12 +15,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqrf(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t geqrf_work(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* tau )
+    float* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,27 +38,35 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgeqrf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgeqrf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgeqrf(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -61,11 +74,11 @@ int64_t geqrf(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqrf(
+int64_t geqrf_work(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* tau )
+    double* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -78,27 +91,35 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgeqrf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgeqrf(
+            &m_, &n_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgeqrf(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -106,11 +127,11 @@ int64_t geqrf(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geqrf
-int64_t geqrf(
+int64_t geqrf_work(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -123,33 +144,132 @@ int64_t geqrf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgeqrf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgeqrf(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgeqrf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqrf_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgeqrf", { m_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgeqrf(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_cgeqrf(
+    LAPACK_zgeqrf(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes a QR factorization of an m-by-n matrix A:
 /// $A = Q R$.
@@ -208,42 +328,222 @@ int64_t geqrf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqrf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqrf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqrf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgeqrf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqrf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::geqrf`. Arguments are the same as for
+/// `lapack::geqrf`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup geqrf
+void geqrf_work_size_bytes(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    geqrf_work( m, n, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::geqrf` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::geqrf_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::geqrf( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::geqrf`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::geqrf_work_size_bytes` for the same arguments.
+///
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    geqrf_work( m, n, A, lda, tau, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    geqrf_work( m, n, A, lda, tau, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    geqrf_work( m, n, A, lda, tau, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes a QR factorization of an m-by-n matrix A,
+/// using a reusable workspace.
+/// Same as the version without ws, except workspace sizes are cached
+/// in ws, and work arrays are taken from ws, so repeated calls with the
+/// same dimensions do no workspace queries or memory allocation.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in,out] ws
+///     Workspace, reused across calls. See lapack::Workspace.
+///
+/// See geqrf() for the remaining arguments.
+///
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    geqrf_work( m, n, A, lda, tau, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return geqrf_work( m, n, A, lda, tau, work_buffer );
 }
 
 }  // namespace lapack
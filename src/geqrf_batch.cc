@@ -0,0 +1,290 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems and
+/// queries their workspace, then factors them in parallel,
+/// each thread reusing one workspace for all its problems.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( m,   batch_size, "m" );
+    internal::check_batch_arg( n,   batch_size, "n" );
+    internal::check_batch_arg( lda, batch_size, "lda" );
+    lapack_error_if( Aarray.size()    != batch_size );
+    lapack_error_if( tau_array.size() != batch_size );
+    lapack_error_if( info.size()      != batch_size );
+
+    // workspace queries are cached, so are cheap for repeated sizes
+    size_t work_size = 0;
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t m_i   = internal::extract( m,   i );
+        int64_t n_i   = internal::extract( n,   i );
+        int64_t lda_i = internal::extract( lda, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        size_t work_size_i;
+        lapack::geqrf_work_size_bytes( m_i, n_i, Aarray[ i ], lda_i,
+                                       tau_array[ i ], &work_size_i );
+        work_size = max( work_size, work_size_i );
+    }
+
+    internal::batch_for_work( batch_size, work_size,
+        [&]( int64_t i, void* work ) {
+            info[ i ] = lapack::geqrf( internal::extract( m, i ),
+                                       internal::extract( n, i ),
+                                       Aarray[ i ], internal::extract( lda, i ),
+                                       tau_array[ i ], work, work_size );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments and queries workspace,
+/// then factors strided problems in parallel,
+/// each thread reusing one workspace for all its problems.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( strideA < lda*n );
+    lapack_error_if( stride_tau < min( m, n ) );
+
+    size_t work_size;
+    lapack::geqrf_work_size_bytes( m, n, A, lda, tau, &work_size );
+
+    internal::batch_for_work( batch_size, work_size,
+        [&]( int64_t i, void* work ) {
+            info[ i ] = lapack::geqrf( m, n, A + i*strideA, lda,
+                                       tau + i*stride_tau, work, work_size );
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the QR factorizations of a batch of m-by-n matrices,
+/// $A_i = Q_i R_i$, as in `lapack::geqrf`.
+///
+/// Problems are factored in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// Workspace is queried once per distinct problem size and allocated
+/// once for the whole batch; each thread reuses its part for all its
+/// problems.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m[i] >= 0.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the m[i]-by-n[i]
+///     matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     On exit, $R_i$ and the Householder vectors representing $Q_i$,
+///     as in `lapack::geqrf`.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, m[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[out] tau_array
+///     Array of batch_size pointers. tau_array[i] is the vector of
+///     length min(m[i], n[i]) of scalar factors of the
+///     Householder reflectors of problem i.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::geqrf` for problem i, which is 0.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is factored.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_size, info );
+}
+
+//==============================================================================
+/// Computes the QR factorizations of a batch of m-by-n matrices,
+/// stored at a fixed stride.
+/// Same as `lapack::geqrf_batch`, but all problems have the same size,
+/// $A_i$ starts at A + i*strideA, and its scalar factors start at
+/// tau + i*stride_tau.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, the factorizations, as in `lapack::geqrf`.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, m).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[out] tau
+///     The scalar factors of the Householder reflectors,
+///     stored in a stride_tau-by-batch_size array.
+///
+/// @param[in] stride_tau
+///     Distance between the scalar factors of consecutive problems.
+///     stride_tau >= min(m, n).
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::geqrf` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup geqrf_batch
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info )
+{
+    impl::geqrf_batch_strided( m, n, A, lda, strideA, tau, stride_tau,
+                               batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_batch
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info )
+{
+    impl::geqrf_batch_strided( m, n, A, lda, strideA, tau, stride_tau,
+                               batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_batch
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info )
+{
+    impl::geqrf_batch_strided( m, n, A, lda, strideA, tau, stride_tau,
+                               batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_batch
+void geqrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    size_t batch_size, int64_t* info )
+{
+    impl::geqrf_batch_strided( m, n, A, lda, strideA, tau, stride_tau,
+                               batch_size, info );
+}
+
+}  // namespace lapack
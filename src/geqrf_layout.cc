@@ -0,0 +1,466 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/layout.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+// A row-major m-by-n matrix A is the column-major n-by-m matrix A^T in
+// the same storage. If A^T = L Q is an LQ factorization, then
+// A = Q^T L^T is a QR factorization, with R = L^T. The reflectors of the
+// LQ factorization, stored in rows of A^T, are columns of A, exactly as
+// geqrf stores them. For complex, H^T = I - conj(tau) conj(v) v^T
+// for H = I - tau v v^H, so tau is conjugated; the stored vectors already
+// match, since gelqf stores conj(v). Likewise with QR and LQ swapped.
+// So row-major QR is column-major LQ, and vice versa; no data moves.
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Conjugates the k entries of tau in place. No-op for real.
+template <typename scalar_t>
+void conj_tau( int64_t k, scalar_t* tau )
+{
+    if constexpr (blas::is_complex< scalar_t >::value) {
+        for (int64_t i = 0; i < k; ++i)
+            tau[ i ] = conj( tau[ i ] );
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::geqrf( m, n, A, lda, tau );
+
+    int64_t info = lapack::gelqf( n, m, A, lda, tau );
+    conj_tau( min( m, n ), tau );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::gelqf( m, n, A, lda, tau );
+
+    int64_t info = lapack::geqrf( n, m, A, lda, tau );
+    conj_tau( min( m, n ), tau );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// For complex, conjugates a copy of tau, since tau is const.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* tau )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::ungqr( m, n, k, A, lda, tau );
+
+    if constexpr (blas::is_complex< scalar_t >::value) {
+        lapack_error_if( k < 0 );
+        std::vector< scalar_t > tau_conj( tau, tau + k );
+        conj_tau( k, tau_conj.data() );
+        return lapack::unglq( n, m, k, A, lda, tau_conj.data() );
+    }
+    else {
+        return lapack::unglq( n, m, k, A, lda, tau );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* tau )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::unglq( m, n, k, A, lda, tau );
+
+    if constexpr (blas::is_complex< scalar_t >::value) {
+        lapack_error_if( k < 0 );
+        std::vector< scalar_t > tau_conj( tau, tau + k );
+        conj_tau( k, tau_conj.data() );
+        return lapack::ungqr( n, m, k, A, lda, tau_conj.data() );
+    }
+    else {
+        return lapack::ungqr( n, m, k, A, lda, tau );
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes a QR factorization of an m-by-n matrix A stored in either
+/// layout, as in `lapack::geqrf`:
+///     $A = Q R.$
+///
+/// A row-major matrix is factored in place, without transposing it,
+/// by an LQ factorization of the same storage as a column-major matrix.
+/// The result has the same form as from geqrf, with R in the upper
+/// triangle and the reflectors below it, in row-major storage.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array (column-major)
+///     or an m-by-lda array (row-major).
+///     On exit, the elements on and above the diagonal of the array
+///     contain the min(m,n)-by-n upper trapezoidal matrix R;
+///     the elements below the diagonal, with the array tau, represent the
+///     unitary matrix Q as a product of min(m,n) elementary reflectors.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[out] tau
+///     The vector tau of length min(m,n).
+///     The scalar factors of the elementary reflectors.
+///
+/// @return = 0: successful exit
+///
+/// @see ungqr with layout, to generate Q.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+//==============================================================================
+/// Computes an LQ factorization of an m-by-n matrix A stored in either
+/// layout, as in `lapack::gelqf`:
+///     $A = L Q.$
+///
+/// A row-major matrix is factored in place, without transposing it,
+/// by a QR factorization of the same storage as a column-major matrix.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array (column-major)
+///     or an m-by-lda array (row-major).
+///     On exit, the elements on and below the diagonal of the array
+///     contain the m-by-min(m,n) lower trapezoidal matrix L;
+///     the elements above the diagonal, with the array tau, represent the
+///     unitary matrix Q as a product of min(m,n) elementary reflectors.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[out] tau
+///     The vector tau of length min(m,n).
+///     The scalar factors of the elementary reflectors.
+///
+/// @return = 0: successful exit
+///
+/// @see unglq with layout, to generate Q.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+//==============================================================================
+/// Generates an m-by-n matrix Q with orthonormal columns, the first n
+/// columns of a product of k elementary reflectors as returned by the
+/// layout version of `lapack::geqrf`, with A stored in either layout,
+/// as in `lapack::ungqr`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix Q. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix Q. m >= n >= 0.
+///
+/// @param[in] k
+///     The number of elementary reflectors whose product defines the
+///     matrix Q. n >= k >= 0.
+///
+/// @param[in,out] A
+///     On entry, the reflectors as returned by geqrf with the same layout.
+///     On exit, the m-by-n matrix Q.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[in] tau
+///     The vector tau of length k, as returned by geqrf.
+///
+/// @return = 0: successful exit
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup geqrf
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return impl::ungqr( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return impl::ungqr( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau )
+{
+    return impl::ungqr( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf
+int64_t ungqr(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau )
+{
+    return impl::ungqr( layout, m, n, k, A, lda, tau );
+}
+
+//==============================================================================
+/// Generates an m-by-n matrix Q with orthonormal rows, the first m
+/// rows of a product of k elementary reflectors as returned by the
+/// layout version of `lapack::gelqf`, with A stored in either layout,
+/// as in `lapack::unglq`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix Q. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix Q. n >= m.
+///
+/// @param[in] k
+///     The number of elementary reflectors whose product defines the
+///     matrix Q. m >= k >= 0.
+///
+/// @param[in,out] A
+///     On entry, the reflectors as returned by gelqf with the same layout.
+///     On exit, the m-by-n matrix Q.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[in] tau
+///     The vector tau of length k, as returned by gelqf.
+///
+/// @return = 0: successful exit
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gelqf
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return impl::unglq( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gelqf
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    return impl::unglq( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gelqf
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau )
+{
+    return impl::unglq( layout, m, n, k, A, lda, tau );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gelqf
+int64_t unglq(
+    lapack::Layout layout, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau )
+{
+    return impl::unglq( layout, m, n, k, A, lda, tau );
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "backend_dispatch.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -15,14 +16,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesdd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gesdd_work(
     lapack::Job jobz, int64_t m, int64_t n,
     float* A, int64_t lda,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,27 +46,35 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sgesdd", { jobz_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgesdd(
+            &jobz_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (8*min(m,n)) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgesdd(
         &jobz_, &m_, &n_,
@@ -68,8 +82,8 @@ int64_t gesdd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -78,13 +92,13 @@ int64_t gesdd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesdd(
+int64_t gesdd_work(
     lapack::Job jobz, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -102,27 +116,35 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dgesdd", { jobz_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgesdd(
+            &jobz_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (8*min(m,n)) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgesdd(
         &jobz_, &m_, &n_,
@@ -130,8 +152,8 @@ int64_t gesdd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -140,13 +162,13 @@ int64_t gesdd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesdd(
+int64_t gesdd_work(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -164,26 +186,121 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cgesdd", { jobz_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1] = { 0 };
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgesdd(
+            &jobz_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            S,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) VT, &ldvt_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = qry_rwork[0];
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    if (lrwork_ == 0) {
+        // if query doesn't work, this is from documentation
+        lapack_int mx = max( m, n );
+        lapack_int mn = min( m, n );
+        if (jobz == lapack::Job::NoVec) {
+            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
+        }
+        else {
+            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+        }
+        lrwork_ = max( 1, lrwork_ );
+    }
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (8*min(m,n)) );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgesdd(
         &jobz_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zgesdd", { jobz_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1] = { 0 };
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgesdd(
+            &jobz_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            S,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) VT, &ldvt_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = qry_rwork[0];
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
     if (lrwork_ == 0) {
         // if query doesn't work, this is from documentation
         lapack_int mx = max( m, n );
@@ -197,20 +314,22 @@ int64_t gesdd(
         lrwork_ = max( 1, lrwork_ );
     }
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (8*min(m,n)) );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_cgesdd(
+    LAPACK_zgesdd(
         &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -218,6 +337,59 @@ int64_t gesdd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesdd_work_size_bytes( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesdd_work_size_bytes( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesdd_work_size_bytes( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the singular value decomposition (SVD) of a
 /// m-by-n matrix A, optionally computing the left and/or right singular
@@ -333,74 +505,155 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gesdd_work_size_bytes( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    if (lrwork_ == 0) {
-        // if query doesn't work, this is from documentation
-        lapack_int mx = max( m, n );
-        lapack_int mn = min( m, n );
-        if (jobz == lapack::Job::NoVec) {
-            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
-        }
-        else {
-            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
-        }
-        lrwork_ = max( 1, lrwork_ );
-    }
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gesdd`. Arguments are the same as for
+/// `lapack::gesdd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd
+void gesdd_work_size_bytes(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gesdd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gesdd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gesdd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gesdd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gesdd_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
 }
 
 }  // namespace lapack
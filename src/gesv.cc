@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "backend_dispatch.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -233,6 +234,7 @@ int64_t gesv(
 }
 
 // -----------------------------------------------------------------------------
+/// @ingroup gesv
 int64_t gesv(
     int64_t n, int64_t nrhs,
     double* A, int64_t lda,
@@ -261,12 +263,12 @@ int64_t gesv(
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int ldx_ = (lapack_int) ldx;
-    lapack_int iter_ = (lapack_int) *iter;
+    lapack_int iter_ = 0;
     lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< double > work( (n)*(nrhs) );
-    lapack::vector< float > swork( (n*(n+nrhs)) );
+    lapack::vector< double > work( max( 1, n*nrhs ) );
+    lapack::vector< float > swork( max( 1, n*(n + nrhs) ) );
 
     LAPACK_dsgesv(
         &n_, &nrhs_,
@@ -287,6 +289,88 @@ int64_t gesv(
 }
 
 // -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using mixed-precision iterative refinement (LAPACK dsgesv, zcgesv).
+///
+/// This overload, with separate B and X, first factors A in single
+/// precision with getrf, then uses this factorization within an iterative
+/// refinement procedure to produce a solution with double precision
+/// normwise backward error quality. If the approach fails, it falls back
+/// to a double precision factorization and solve, as in gesv.
+///
+/// The iterative refinement is not going to be a winning strategy if
+/// the ratio of single precision performance over double precision
+/// performance is too small, or for small n.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`.
+/// See also lapack::solve_mixed, which also supports potrf and hetrf,
+/// and takes the iteration limit and whether to fall back.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the n-by-n coefficient matrix A.
+///     On exit, if iterative refinement has been successfully used
+///     (return value = 0 and iter >= 0), then A is unchanged;
+///     if double precision factorization has been used
+///     (return value = 0 and iter < 0), then A contains the factors
+///     L and U from the factorization $A = P L U$;
+///     the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices that define the permutation matrix P;
+///     row i of the matrix was interchanged with row ipiv(i).
+///     Corresponds either to the single precision factorization
+///     (if return value = 0 and iter >= 0) or the double precision
+///     factorization (if return value = 0 and iter < 0).
+///
+/// @param[in] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     The n-by-nrhs right hand side matrix B.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     If return value = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - < 0: iterative refinement has failed, double precision
+///         factorization has been performed
+///         - -1: the routine fell back to full precision for
+///             implementation- or machine-specific reasons
+///         - -2: narrowing the precision induced an overflow,
+///             the routine fell back to full precision
+///         - -3: failure of single precision getrf
+///         - -31: stop the iterative refinement after the 30th iteration
+///     - > 0: iterative refinement has been successfully used.
+///         Returns the number of iterations
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) computed in double precision is
+///              exactly zero. The factorization has been completed,
+///              but the factor U is exactly singular, so the solution
+///              could not be computed.
+///
+/// @ingroup gesv
 int64_t gesv(
     int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
@@ -315,13 +399,13 @@ int64_t gesv(
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int ldx_ = (lapack_int) ldx;
-    lapack_int iter_ = (lapack_int) *iter;
+    lapack_int iter_ = 0;
     lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( (n)*(nrhs) );
-    lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
-    lapack::vector< double > rwork( (n) );
+    lapack::vector< std::complex<double> > work( max( 1, n*nrhs ) );
+    lapack::vector< std::complex<float> > swork( max( 1, n*(n + nrhs) ) );
+    lapack::vector< double > rwork( max( 1, n ) );
 
     LAPACK_zcgesv(
         &n_, &nrhs_,
@@ -342,4 +426,141 @@ int64_t gesv(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_sgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_dgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_cgesv(
+        &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv,
+        (lapack_complex_float*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gesv` that returns pivots ipiv in LAPACK's native
+/// integer type, `lapack_int`, passing them to LAPACK without conversion.
+/// Declared only when `lapack_int` is 32-bit (LP64); with ILP64, the
+/// `int64_t` version is already zero-copy. See `lapack::PivotView`.
+///
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_zgesv(
+        &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv,
+        (lapack_complex_double*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,351 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems,
+/// then solves them in parallel.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( n,    batch_size, "n" );
+    internal::check_batch_arg( nrhs, batch_size, "nrhs" );
+    internal::check_batch_arg( lda,  batch_size, "lda" );
+    internal::check_batch_arg( ldb,  batch_size, "ldb" );
+    lapack_error_if( Aarray.size()     != batch_size );
+    lapack_error_if( ipiv_array.size() != batch_size );
+    lapack_error_if( Barray.size()     != batch_size );
+    lapack_error_if( info.size()       != batch_size );
+
+    int64_t max_ipiv = 0;
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t n_i    = internal::extract( n,    i );
+        int64_t nrhs_i = internal::extract( nrhs, i );
+        int64_t lda_i  = internal::extract( lda,  i );
+        int64_t ldb_i  = internal::extract( ldb,  i );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( ldb_i < max( 1, n_i ) );
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( nrhs_i > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( lda_i  > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( ldb_i  > std::numeric_limits<lapack_int>::max() );
+        }
+        max_ipiv = max( max_ipiv, n_i );
+    }
+
+    internal::batch_for( batch_size, max_ipiv,
+        [&]( int64_t i, lapack_int* ipiv_ ) {
+            int64_t n_i    = internal::extract( n,    i );
+            int64_t nrhs_i = internal::extract( nrhs, i );
+            int64_t lda_i  = internal::extract( lda,  i );
+            int64_t ldb_i  = internal::extract( ldb,  i );
+            #ifndef LAPACK_ILP64
+                // solve with 32-bit pivots, then copy out
+                info[ i ] = lapack::gesv( n_i, nrhs_i,
+                                          Aarray[ i ], lda_i, ipiv_,
+                                          Barray[ i ], ldb_i );
+                std::copy( ipiv_, ipiv_ + n_i, ipiv_array[ i ] );
+            #else
+                blas_unused( ipiv_ );
+                info[ i ] = lapack::gesv( n_i, nrhs_i,
+                                          Aarray[ i ], lda_i, ipiv_array[ i ],
+                                          Barray[ i ], ldb_i );
+            #endif
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then solves strided problems in parallel.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideA < lda*n );
+    lapack_error_if( stride_ipiv < n );
+    lapack_error_if( strideB < ldb*nrhs );
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( nrhs > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda  > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( ldb  > std::numeric_limits<lapack_int>::max() );
+    }
+
+    internal::batch_for( batch_size, n,
+        [&]( int64_t i, lapack_int* ipiv_ ) {
+            scalar_t* A_i    = A    + i*strideA;
+            int64_t*  ipiv_i = ipiv + i*stride_ipiv;
+            scalar_t* B_i    = B    + i*strideB;
+            #ifndef LAPACK_ILP64
+                // solve with 32-bit pivots, then copy out
+                info[ i ] = lapack::gesv( n, nrhs, A_i, lda, ipiv_, B_i, ldb );
+                std::copy( ipiv_, ipiv_ + n, ipiv_i );
+            #else
+                blas_unused( ipiv_ );
+                info[ i ] = lapack::gesv( n, nrhs, A_i, lda, ipiv_i, B_i, ldb );
+            #endif
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$, with general n-by-n matrices $A_i$, as in `lapack::gesv`.
+///
+/// Problems are solved in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// This suits large batches of small systems.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix $B_i$. nrhs[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the n[i]-by-n[i]
+///     matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     On exit, the factors $L_i$ and $U_i$ from $A_i = P_i L_i U_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[out] ipiv_array
+///     Array of batch_size pointers. ipiv_array[i] is the vector of
+///     length n[i] of pivot indices of problem i.
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Barray[i] is the n[i]-by-nrhs[i]
+///     matrix $B_i$, stored in an ldb[i]-by-nrhs[i] array.
+///     On entry, the right hand side matrix $B_i$.
+///     On exit, if info[i] = 0, the solution matrix $X_i$.
+///
+/// @param[in] ldb
+///     The leading dimension of each array $B_i$. ldb[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::gesv` for problem i:
+///     - = 0: successful exit.
+///     - > 0: if info[i] = j, $U_i(j,j)$ is exactly zero,
+///       so the solution $X_i$ could not be computed.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is solved.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_batch
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gesv_batch( n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_batch
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gesv_batch( n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_batch
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gesv_batch( n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_batch
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::gesv_batch( n, nrhs, Aarray, lda, ipiv_array, Barray, ldb,
+                      batch_size, info );
+}
+
+//==============================================================================
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$, stored at a fixed stride.
+/// Same as `lapack::gesv_batch`, but all problems have the same size,
+/// $A_i$ starts at A + i*strideA, its pivots start at ipiv + i*stride_ipiv,
+/// and $B_i$ starts at B + i*strideB.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of each matrix $B_i$. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, the factors $L_i$ and $U_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, n).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[out] ipiv
+///     The pivot indices, stored in a stride_ipiv-by-batch_size array.
+///
+/// @param[in] stride_ipiv
+///     Distance between the pivots of consecutive problems.
+///     stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The batch of right hand sides, stored in an ldb-by-nrhs-by-batch_size
+///     array. On exit, the solutions $X_i$.
+///
+/// @param[in] ldb
+///     The leading dimension of each $B_i$. ldb >= max(1, n).
+///
+/// @param[in] strideB
+///     Distance between the first elements of $B_i$ and $B_{i+1}$.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::gesv` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_batch
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gesv_batch_strided( n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_batch
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gesv_batch_strided( n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_batch
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gesv_batch_strided( n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_batch
+void gesv_batch_strided(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::gesv_batch_strided( n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                              B, ldb, strideB, batch_size, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,521 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/layout.hh"
+
+#include <limits>
+#include <utility>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Applies row interchanges ipiv[ k1 : k2-1 ] (1-based) to the n columns
+/// of row-major A, in order. Rows are contiguous, so each interchange
+/// is a unit-stride swap.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void swap_rows_rowmajor(
+    int64_t n, scalar_t* A, int64_t lda,
+    int64_t k1, int64_t k2, int64_t const* ipiv )
+{
+    if (n == 0)
+        return;
+    for (int64_t i = k1; i < k2; ++i) {
+        int64_t p = ipiv[ i ] - 1;
+        if (p != i)
+            blas::swap( n, &A[ i*lda ], 1, &A[ p*lda ], 1 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Recursive LU factorization with partial pivoting of the m-by-n
+/// row-major matrix A, as in LAPACK's getrf2 but operating directly on
+/// row-major storage. Updates use BLAS in row-major layout, and row
+/// interchanges swap contiguous rows, so A is never transposed.
+/// ipiv is 1-based, relative to A.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf_rowmajor(
+    int64_t m, int64_t n, scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+
+    const scalar_t one = 1;
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+
+    int64_t mn = min( m, n );
+    if (mn == 0)
+        return 0;
+
+    if (m == 1) {
+        // one row: no pivoting
+        ipiv[ 0 ] = 1;
+        return A[ 0 ] == scalar_t( 0 ) ? 1 : 0;
+    }
+
+    if (n == 1) {
+        // one column, stride lda: pivot, swap, scale
+        int64_t p = blas::iamax( m, A, lda );
+        ipiv[ 0 ] = p + 1;
+        if (A[ p*lda ] == scalar_t( 0 ))
+            return 1;
+        if (p != 0)
+            std::swap( A[ 0 ], A[ p*lda ] );
+        if (std::abs( A[ 0 ] ) >= sfmin) {
+            blas::scal( m-1, one / A[ 0 ], &A[ lda ], lda );
+        }
+        else {
+            for (int64_t i = 1; i < m; ++i)
+                A[ i*lda ] /= A[ 0 ];
+        }
+        return 0;
+    }
+
+    //        [ A11 | A12 ]  n1 rows
+    // A   =  [ ----+---- ]
+    //        [ A21 | A22 ]  m - n1 rows
+    //          n1    n2 cols
+    int64_t n1 = mn / 2;
+    int64_t n2 = n - n1;
+    scalar_t* A12 = &A[ n1 ];
+    scalar_t* A21 = &A[ n1*lda ];
+    scalar_t* A22 = &A[ n1 + n1*lda ];
+
+    int64_t info = getrf_rowmajor( m, n1, A, lda, ipiv );
+
+    // update [ A12; A22 ]
+    swap_rows_rowmajor( n2, A12, lda, 0, n1, ipiv );
+    blas::trsm( Layout::RowMajor, blas::Side::Left, blas::Uplo::Lower,
+                Op::NoTrans, blas::Diag::Unit,
+                n1, n2, one, A, lda, A12, lda );
+    blas::gemm( Layout::RowMajor, Op::NoTrans, Op::NoTrans,
+                m - n1, n2, n1,
+                -one, A21, lda,
+                      A12, lda,
+                 one, A22, lda );
+
+    int64_t info2 = getrf_rowmajor( m - n1, n2, A22, lda, &ipiv[ n1 ] );
+    if (info == 0 && info2 > 0)
+        info = info2 + n1;
+
+    // adjust pivots and apply them to A21
+    for (int64_t i = n1; i < mn; ++i)
+        ipiv[ i ] += n1;
+    swap_rows_rowmajor( n1, A, lda, n1, mn, ipiv );
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// Row-major LU with row pivoting is not an algebraic rearrangement of
+/// column-major LU (which would pivot columns), so the row-major case
+/// uses getrf_rowmajor rather than transposing A.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::getrf( m, n, A, lda, ipiv );
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ipiv == nullptr && min( m, n ) > 0 );
+
+    return getrf_rowmajor( m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// Solves with the factors from getrf using BLAS triangular solves in the
+/// given layout; row interchanges of row-major B swap contiguous rows.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::Side;
+    using blas::Uplo;
+    using blas::Diag;
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::getrs( trans, n, nrhs, A, lda, ipiv, B, ldb );
+
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    const scalar_t one = 1;
+    if (trans == Op::NoTrans) {
+        // A = P L U: apply P^T, solve L Y = B, then U X = Y.
+        swap_rows_rowmajor( nrhs, B, ldb, 0, n, ipiv );
+        blas::trsm( layout, Side::Left, Uplo::Lower, trans, Diag::Unit,
+                    n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( layout, Side::Left, Uplo::Upper, trans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+    }
+    else {
+        // op(A) = op(U) op(L) P^T: solve op(U) Y = B, then op(L) Z = Y,
+        // then apply P, i.e., the interchanges in reverse order.
+        blas::trsm( layout, Side::Left, Uplo::Upper, trans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( layout, Side::Left, Uplo::Lower, trans, Diag::Unit,
+                    n, nrhs, one, A, lda, B, ldb );
+        for (int64_t i = n - 1; i >= 0; --i) {
+            int64_t p = ipiv[ i ] - 1;
+            if (p != i)
+                blas::swap( nrhs, &B[ i*ldb ], 1, &B[ p*ldb ], 1 );
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+
+    // check all arguments before factoring
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = impl::getrf( layout, n, n, A, lda, ipiv );
+    if (info == 0)
+        impl::getrs( layout, Op::NoTrans, n, nrhs, A, lda, ipiv, B, ldb );
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes an LU factorization of a general m-by-n matrix A stored in
+/// either layout, using partial pivoting with row interchanges,
+/// as in `lapack::getrf`:
+///     $A = P L U$
+/// where P is a permutation matrix, L is lower triangular with unit
+/// diagonal elements (lower trapezoidal if m > n), and U is upper
+/// triangular (upper trapezoidal if m < n).
+///
+/// A row-major matrix is factored in place by a recursive algorithm that
+/// works directly on row-major storage, without transposing A.
+/// The factors and pivots are the same as from column-major getrf
+/// applied to the same matrix, up to rounding and ties in pivoting.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array (column-major)
+///     or an m-by-lda array (row-major).
+///     On exit, the factors L and U from the factorization
+///     $A = P L U;$ the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The factorization
+///     has been completed, but the factor U is exactly
+///     singular, and division by zero will occur if it is used
+///     to solve a system of equations.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+//==============================================================================
+/// Solves a system of linear equations
+///     $A X = B,$
+///     $A^T X = B,$ or
+///     $A^H X = B$
+/// with a general n-by-n matrix A using the LU factorization computed
+/// by `lapack::getrf` with the same layout. B is stored in the same layout
+/// as A; row-major matrices are solved in place, without transposing.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage of A and B, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] trans
+///     Specifies the form of the system of equations:
+///     - lapack::Op::NoTrans:   $A   X = B$ (No transpose)
+///     - lapack::Op::Trans:     $A^T X = B$ (Transpose)
+///     - lapack::Op::ConjTrans: $A^H X = B$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The factors L and U from the factorization $A = P L U$
+///     as computed by `lapack::getrf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices from `lapack::getrf`.
+///
+/// @param[in,out] B
+///     The n-by-nrhs right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     ldb >= max(1,n) (column-major) or max(1,nrhs) (row-major).
+///
+/// @return = 0: successful exit
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//==============================================================================
+/// Computes the solution to a system of linear equations
+///     $A X = B,$
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// stored in either layout, as in `lapack::gesv`.
+/// Row-major matrices are factored and solved in place, without
+/// transposing; see the layout versions of `lapack::getrf`
+/// and `lapack::getrs`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage of A and B, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     On entry, the n-by-n coefficient matrix A.
+///     On exit, the factors L and U from the factorization
+///     $A = P L U;$ the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices that define the permutation matrix P;
+///     row i of the matrix was interchanged with row ipiv(i).
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, if return value = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     ldb >= max(1,n) (column-major) or max(1,nrhs) (row-major).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The factorization
+///     has been completed, but the factor U is exactly
+///     singular, so the solution could not be computed.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "backend_dispatch.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -15,14 +16,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gesvd_work(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     float* A, int64_t lda,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -41,24 +47,32 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgesvd", { jobu_, jobvt_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    std::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -66,7 +80,7 @@ int64_t gesvd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -75,13 +89,13 @@ int64_t gesvd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvd(
+int64_t gesvd_work(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -100,24 +114,32 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgesvd", { jobu_, jobvt_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            A, &lda_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    std::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -125,7 +147,7 @@ int64_t gesvd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -134,13 +156,13 @@ int64_t gesvd(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvd(
+int64_t gesvd_work(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -159,36 +181,115 @@ int64_t gesvd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgesvd", { jobu_, jobvt_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            S,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) VT, &ldvt_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (5*min(m,n)) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
-    std::vector< float > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+int64_t gesvd_work(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
 
-    LAPACK_cgesvd(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgesvd", { jobu_, jobvt_, m_, n_, lda_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgesvd(
+            &jobu_, &jobvt_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            S,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) VT, &ldvt_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (5*min(m,n)) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgesvd(
         &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -196,6 +297,59 @@ int64_t gesvd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the singular value decomposition (SVD) of a
 /// m-by-n matrix A, optionally computing the left and/or right singular
@@ -314,58 +468,159 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu_ = job2char( jobu );
-    char jobvt_ = job2char( jobvt );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
-    std::vector< double > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gesvd`. Arguments are the same as for
+/// `lapack::gesvd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gesvd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gesvd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gesvd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gesvd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gesvd_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work_buffer );
 }
 
 }  // namespace lapack
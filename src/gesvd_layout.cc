@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/layout.hh"
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// A row-major m-by-n matrix A is the column-major n-by-m matrix A^T in
+/// the same storage. If A^T = U' S V'^H, then A = conj(V') S U'^T, so
+/// U = conj(V') and V^H = U'^T. In row-major storage, U is stored as the
+/// column-major U^T = V'^H, which is VT' exactly, and V^H is stored as
+/// the column-major conj(V) = U'. So row-major gesvd is column-major gesvd
+/// of A^T with the roles of U and VT (and jobu and jobvt) swapped;
+/// no data moves and nothing is conjugated.
+/// @ingroup gesvd_internal
+///
+template <typename scalar_t>
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor) {
+        return lapack::gesvd( jobu, jobvt, m, n, A, lda, S,
+                              U, ldu, VT, ldvt );
+    }
+    else {
+        return lapack::gesvd( jobvt, jobu, n, m, A, lda, S,
+                              VT, ldvt, U, ldu );
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the singular value decomposition (SVD) of an m-by-n matrix A
+/// stored in either layout, as in `lapack::gesvd`:
+///     $A = U \Sigma V^H.$
+///
+/// A row-major matrix is decomposed without transposing it: the same
+/// storage is a column-major $A^T$, whose SVD gives the SVD of A with the
+/// roles of U and $V^H$ swapped. U and VT are returned in the given layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage of A, U, and VT, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] jobu
+///     Specifies options for computing all or part of the matrix U,
+///     as in `lapack::gesvd`.
+///     With Job::OverwriteVec, the first min(m,n) columns of U are
+///     overwritten on A, in the given layout.
+///
+/// @param[in] jobvt
+///     Specifies options for computing all or part of the matrix $V^H$,
+///     as in `lapack::gesvd`.
+///     With Job::OverwriteVec, the first min(m,n) rows of $V^H$ are
+///     overwritten on A, in the given layout.
+///     jobvt and jobu cannot both be OverwriteVec.
+///
+/// @param[in] m
+///     The number of rows of the input matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the input matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array (column-major)
+///     or an m-by-lda array (row-major).
+///     On exit, destroyed, or U or $V^H$ as described above.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     lda >= max(1,m) (column-major) or max(1,n) (row-major).
+///
+/// @param[out] S
+///     The vector S of length min(m,n).
+///     The singular values of A, sorted so that S(i) >= S(i+1).
+///
+/// @param[out] U
+///     The m-by-m matrix U (jobu = AllVec), or its first min(m,n)
+///     columns (jobu = SomeVec). Not referenced otherwise.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U. ldu >= 1; if jobu = SomeVec
+///     or AllVec, ldu >= m (column-major), or ldu >= m for AllVec and
+///     ldu >= min(m,n) for SomeVec (row-major).
+///
+/// @param[out] VT
+///     The n-by-n matrix $V^H$ (jobvt = AllVec), or its first min(m,n)
+///     rows (jobvt = SomeVec). Not referenced otherwise.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT. ldvt >= 1; if jobvt = AllVec,
+///     ldvt >= n; if jobvt = SomeVec, ldvt >= min(m,n) (column-major)
+///     or ldvt >= n (row-major).
+///
+/// @return = 0: successful exit.
+/// @return > 0: the bidiagonal QR iteration did not converge;
+///     see `lapack::gesvd`.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S,
+                        U, ldu, VT, ldvt );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S,
+                        U, ldu, VT, ldvt );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S,
+                        U, ldu, VT, ldvt );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S,
+                        U, ldu, VT, ldvt );
+}
+
+}  // namespace lapack
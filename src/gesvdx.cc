@@ -17,15 +17,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvdx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gesvdx_work(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
     int64_t* nfound,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -50,27 +55,35 @@ int64_t gesvdx(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgesvdx", { jobu_, jobvt_, range_, m_, n_, lda_, il_, iu_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgesvdx(
+            &jobu_, &jobvt_, &range_, &m_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (12*min(m,n)) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
@@ -78,8 +91,8 @@ int64_t gesvdx(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -89,14 +102,14 @@ int64_t gesvdx(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvdx(
+int64_t gesvdx_work(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
     int64_t* nfound,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -121,27 +134,35 @@ int64_t gesvdx(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgesvdx", { jobu_, jobvt_, range_, m_, n_, lda_, il_, iu_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgesvdx(
+            &jobu_, &jobvt_, &range_, &m_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+            S,
+            U, &ldu_,
+            VT, &ldvt_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (12*min(m,n)) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
@@ -149,8 +170,8 @@ int64_t gesvdx(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -160,14 +181,14 @@ int64_t gesvdx(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd
-int64_t gesvdx(
+int64_t gesvdx_work(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
     int64_t* nfound,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -192,43 +213,137 @@ int64_t gesvdx(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgesvdx", { jobu_, jobvt_, range_, m_, n_, lda_, il_, iu_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgesvdx(
+            &jobu_, &jobvt_, &range_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+            S,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) VT, &ldvt_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // from docs
+    int64_t lrwork = min(m,n)*(min(m,n)*2 + 15*min(m,n));
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (max( 1, lrwork )) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (12*min(m,n)) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gesvdx_work(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu_ = job2char( jobu );
+    char jobvt_ = job2char( jobvt );
+    char range_ = range2char( range );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgesvdx", { jobu_, jobvt_, range_, m_, n_, lda_, il_, iu_, ldu_, ldvt_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgesvdx(
+            &jobu_, &jobvt_, &range_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+            S,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) VT, &ldvt_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
     // from docs
     int64_t lrwork = min(m,n)*(min(m,n)*2 + 15*min(m,n));
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, lrwork )) );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (max( 1, lrwork )) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (12*min(m,n)) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_cgesvdx(
+    LAPACK_zgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
         S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -237,6 +352,62 @@ int64_t gesvdx(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvdx_work_size_bytes( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                            nfound, S, U, ldu, VT, ldvt, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvdx( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                   U, ldu, VT, ldvt, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvdx_work_size_bytes( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                            nfound, S, U, ldu, VT, ldvt, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvdx( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                   U, ldu, VT, ldvt, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    size_t host_work_size;
+    gesvdx_work_size_bytes( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                            nfound, S, U, ldu, VT, ldvt, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvdx( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                   U, ldu, VT, ldvt, host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the singular value decomposition (SVD) of a
 /// m-by-n matrix A, optionally computing the left and/or right singular
@@ -374,72 +545,171 @@ int64_t gesvdx(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu_ = job2char( jobu );
-    char jobvt_ = job2char( jobvt );
-    char range_ = range2char( range );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int il_ = (lapack_int) il;
-    lapack_int iu_ = (lapack_int) iu;
-    lapack_int nfound_ = (lapack_int) *nfound;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    gesvdx_work_size_bytes( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                            nfound, S, U, ldu, VT, ldvt, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gesvdx( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                   U, ldu, VT, ldvt, host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                 U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // from docs
-    int64_t lrwork = min(m,n)*(min(m,n)*2 + 15*min(m,n));
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                 U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, lrwork )) );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                 U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    return info_;
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gesvdx`. Arguments are the same as for
+/// `lapack::gesvdx`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd
+void gesvdx_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S,
+                 U, ldu, VT, ldvt, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                        nfound, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                        nfound, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                        nfound, S, U, ldu, VT, ldvt, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gesvdx` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gesvdx_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gesvdx( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gesvdx`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gesvdx_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gesvdx_work( jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu,
+                        nfound, S, U, ldu, VT, ldvt, work_buffer );
 }
 
 }  // namespace lapack
@@ -0,0 +1,304 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems,
+/// then factors them in parallel.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( m,   batch_size, "m" );
+    internal::check_batch_arg( n,   batch_size, "n" );
+    internal::check_batch_arg( lda, batch_size, "lda" );
+    lapack_error_if( Aarray.size()     != batch_size );
+    lapack_error_if( ipiv_array.size() != batch_size );
+    lapack_error_if( info.size()       != batch_size );
+
+    int64_t max_ipiv = 0;
+    for (size_t i = 0; i < batch_size; ++i) {
+        int64_t m_i   = internal::extract( m,   i );
+        int64_t n_i   = internal::extract( n,   i );
+        int64_t lda_i = internal::extract( lda, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( n_i   > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( lda_i > std::numeric_limits<lapack_int>::max() );
+        }
+        max_ipiv = max( max_ipiv, min( m_i, n_i ) );
+    }
+
+    internal::batch_for( batch_size, max_ipiv,
+        [&]( int64_t i, lapack_int* ipiv_ ) {
+            int64_t m_i   = internal::extract( m,   i );
+            int64_t n_i   = internal::extract( n,   i );
+            int64_t lda_i = internal::extract( lda, i );
+            #ifndef LAPACK_ILP64
+                // factor with 32-bit pivots, then copy out
+                info[ i ] = lapack::getrf( m_i, n_i, Aarray[ i ], lda_i, ipiv_ );
+                std::copy( ipiv_, ipiv_ + min( m_i, n_i ), ipiv_array[ i ] );
+            #else
+                blas_unused( ipiv_ );
+                info[ i ] = lapack::getrf( m_i, n_i, Aarray[ i ], lda_i,
+                                           ipiv_array[ i ] );
+            #endif
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then factors strided problems in parallel.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( strideA < lda*n );
+    lapack_error_if( stride_ipiv < min( m, n ) );
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( n   > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda > std::numeric_limits<lapack_int>::max() );
+    }
+
+    internal::batch_for( batch_size, min( m, n ),
+        [&]( int64_t i, lapack_int* ipiv_ ) {
+            scalar_t* A_i    = A    + i*strideA;
+            int64_t*  ipiv_i = ipiv + i*stride_ipiv;
+            #ifndef LAPACK_ILP64
+                // factor with 32-bit pivots, then copy out
+                info[ i ] = lapack::getrf( m, n, A_i, lda, ipiv_ );
+                std::copy( ipiv_, ipiv_ + min( m, n ), ipiv_i );
+            #else
+                blas_unused( ipiv_ );
+                info[ i ] = lapack::getrf( m, n, A_i, lda, ipiv_i );
+            #endif
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// $A_i = P_i L_i U_i$, as in `lapack::getrf`.
+///
+/// Problems are factored in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// This suits large batches of small matrices, where per-problem
+/// parallelism in BLAS is ineffective.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m[i] >= 0.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the m[i]-by-n[i]
+///     matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     On exit, the factors $L_i$ and $U_i$; the unit diagonal elements
+///     of $L_i$ are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, m[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[out] ipiv_array
+///     Array of batch_size pointers. ipiv_array[i] is the vector of
+///     length min(m[i], n[i]) of pivot indices of problem i.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::getrf` for problem i:
+///     - = 0: successful exit.
+///     - > 0: if info[i] = j, $U_i(j,j)$ is exactly zero.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is factored.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_batch
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_batch
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_batch
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_batch
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//==============================================================================
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// $A_i = P_i L_i U_i$, stored at a fixed stride.
+/// Same as `lapack::getrf_batch`, but all problems have the same size,
+/// matrix $A_i$ starts at A + i*strideA, and its pivots start at
+/// ipiv + i*stride_ipiv.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix $A_i$. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix $A_i$. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, the factors $L_i$ and $U_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, m).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[out] ipiv
+///     The pivot indices, stored in a stride_ipiv-by-batch_size array.
+///
+/// @param[in] stride_ipiv
+///     Distance between the pivots of consecutive problems.
+///     stride_ipiv >= min(m, n).
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::getrf` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gesv_batch
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info )
+{
+    impl::getrf_batch_strided(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_batch
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info )
+{
+    impl::getrf_batch_strided(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_batch
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info )
+{
+    impl::getrf_batch_strided(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_batch
+void getrf_batch_strided(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch_size, int64_t* info )
+{
+    impl::getrf_batch_strided(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+}  // namespace lapack
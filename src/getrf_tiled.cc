@@ -0,0 +1,520 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch.hh"
+#include "task_graph.hh"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Applies row interchanges ipiv[ k1 : k2-1 ] (1-based) to the n columns
+/// of A, in order, as `lapack::laswp` does with incx = 1.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+void swap_rows(
+    int64_t n, scalar_t* A, int64_t lda,
+    int64_t k1, int64_t k2, int64_t const* ipiv )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Aj = &A[ j*lda ];
+        for (int64_t i = k1; i < k2; ++i) {
+            int64_t p = ipiv[ i ] - 1;
+            if (p != i)
+                std::swap( Aj[ i ], Aj[ p ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Recursive LU panel factorization with partial pivoting, as in LAPACK's
+/// getrf2: factors the left half, updates and factors the right half.
+/// Runs on the calling thread: it is a task on a TaskGraph worker, and the
+/// other workers meanwhile update the trailing matrix, so opening an OpenMP
+/// region here would oversubscribe the cores.
+/// ipiv is 1-based, relative to A.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf_panel(
+    int64_t m, int64_t n, scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+
+    const scalar_t one = 1;
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+
+    int64_t mn = min( m, n );
+    if (mn == 0)
+        return 0;
+
+    if (m == 1) {
+        // one row: no pivoting
+        ipiv[ 0 ] = 1;
+        return A[ 0 ] == scalar_t( 0 ) ? 1 : 0;
+    }
+
+    if (n == 1) {
+        // one column: pivot, swap, scale
+        int64_t p = blas::iamax( m, A, 1 );
+        ipiv[ 0 ] = p + 1;
+        if (A[ p ] == scalar_t( 0 ))
+            return 1;
+        if (p != 0)
+            std::swap( A[ 0 ], A[ p ] );
+        if (m > 1) {
+            if (std::abs( A[ 0 ] ) >= sfmin) {
+                blas::scal( m-1, one / A[ 0 ], &A[ 1 ], 1 );
+            }
+            else {
+                for (int64_t i = 1; i < m; ++i)
+                    A[ i ] /= A[ 0 ];
+            }
+        }
+        return 0;
+    }
+
+    //        [ A11 | A12 ]  n1 rows
+    // A   =  [ ----+---- ]
+    //        [ A21 | A22 ]  m - n1 rows
+    //          n1    n2 cols
+    int64_t n1 = mn / 2;
+    int64_t n2 = n - n1;
+    scalar_t* A12 = &A[ n1*lda ];
+    scalar_t* A21 = &A[ n1 ];
+    scalar_t* A22 = &A[ n1 + n1*lda ];
+
+    int64_t info = getrf_panel( m, n1, A, lda, ipiv );
+
+    // update [ A12; A22 ]
+    swap_rows( n2, A12, lda, 0, n1, ipiv );
+    blas::trsm( Layout::ColMajor, blas::Side::Left, blas::Uplo::Lower,
+                Op::NoTrans, blas::Diag::Unit,
+                n1, n2, one, A, lda, A12, lda );
+
+    // A22 -= A21 A12
+    int64_t m2 = m - n1;
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                m2, n2, n1,
+                -one, A21, lda,
+                      A12, lda,
+                 one, A22, lda );
+
+    int64_t info2 = getrf_panel( m2, n2, A22, lda, &ipiv[ n1 ] );
+    if (info == 0 && info2 > 0)
+        info = info2 + n1;
+
+    // adjust pivots and apply them to A21
+    for (int64_t i = n1; i < mn; ++i)
+        ipiv[ i ] += n1;
+    swap_rows( n1, A, lda, n1, mn, ipiv );
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Recursive LU factorization without pivoting of the n-by-n matrix A.
+/// @return 0, or i > 0 if U(i, i) is exactly zero.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf_nopiv( int64_t n, scalar_t* A, int64_t lda )
+{
+    using blas::Layout;
+    using blas::Op;
+
+    const scalar_t one = 1;
+
+    if (n == 0)
+        return 0;
+    if (n == 1)
+        return A[ 0 ] == scalar_t( 0 ) ? 1 : 0;
+
+    int64_t n1 = n / 2;
+    int64_t n2 = n - n1;
+    scalar_t* A12 = &A[ n1*lda ];
+    scalar_t* A21 = &A[ n1 ];
+    scalar_t* A22 = &A[ n1 + n1*lda ];
+
+    int64_t info = getrf_nopiv( n1, A, lda );
+    blas::trsm( Layout::ColMajor, blas::Side::Right, blas::Uplo::Upper,
+                Op::NoTrans, blas::Diag::NonUnit,
+                n2, n1, one, A, lda, A21, lda );
+    blas::trsm( Layout::ColMajor, blas::Side::Left, blas::Uplo::Lower,
+                Op::NoTrans, blas::Diag::Unit,
+                n1, n2, one, A, lda, A12, lda );
+    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                n2, n2, n1,
+                -one, A21, lda,
+                      A12, lda,
+                 one, A22, lda );
+    int64_t info2 = getrf_nopiv( n2, A22, lda );
+    if (info == 0 && info2 > 0)
+        info = info2 + n1;
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// LU panel factorization with tournament pivoting (CALU).
+/// The rows of the m-by-n panel are split into up to nleaves blocks.
+/// Each block selects n candidate pivot rows by partial pivoting on a
+/// copy of the block; pairs of candidate sets then play off up a binary
+/// tree, again by partial pivoting on their stacked rows, until n pivot
+/// rows remain. Those rows are swapped to the top, recorded in ipiv as
+/// sequential interchanges as in getrf, and the panel is factored
+/// without further pivoting. This reads the panel once for pivot
+/// selection, instead of a reduction over all m rows per column.
+/// Falls back to getrf_panel if the panel is too short to split,
+/// or if the selected rows are exactly singular.
+/// Like getrf_panel, runs on the calling thread.
+/// ipiv is 1-based, relative to A.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf_panel_calu(
+    int64_t m, int64_t n, scalar_t* A, int64_t lda, int64_t* ipiv,
+    int64_t nleaves )
+{
+    using blas::Layout;
+    using blas::Op;
+
+    const scalar_t one = 1;
+
+    int64_t p = min( nleaves, m / (2*max( n, 1 )) );
+    if (p < 2 || n > m)
+        return getrf_panel( m, n, A, lda, ipiv );
+
+    // Candidate rows of A for each block, as 0-based row indices.
+    std::vector< std::vector< int64_t > > cand( p );
+
+    // Selects n of the rows in rows by partial pivoting on a copy,
+    // in pivot order. @return getrf info.
+    auto select = []( int64_t n_, scalar_t const* A_, int64_t lda_,
+                      std::vector< int64_t >& rows ) {
+        int64_t mr = rows.size();
+        std::vector< scalar_t > W( mr * n_ );
+        std::vector< int64_t > piv( n_ );
+        for (int64_t j = 0; j < n_; ++j)
+            for (int64_t i = 0; i < mr; ++i)
+                W[ i + j*mr ] = A_[ rows[ i ] + j*lda_ ];
+        int64_t iinfo = lapack::getrf( mr, n_, W.data(), mr, piv.data() );
+        for (int64_t i = 0; i < n_; ++i)
+            std::swap( rows[ i ], rows[ piv[ i ] - 1 ] );
+        rows.resize( n_ );
+        return iinfo;
+    };
+
+    // Leaves: blocks of rows [ b*m/p, (b+1)*m/p ), each with >= 2n rows.
+    for (int64_t b = 0; b < p; ++b) {
+        int64_t i1 = b*m/p;
+        int64_t i2 = (b+1)*m/p;
+        cand[ b ].resize( i2 - i1 );
+        for (int64_t i = i1; i < i2; ++i)
+            cand[ b ][ i - i1 ] = i;
+        select( n, A, lda, cand[ b ] );
+    }
+
+    // Binary tree of play-offs; the root's info decides singularity.
+    int64_t info = 0;
+    for (int64_t s = 1; s < p; s *= 2) {
+        int64_t npairs = (p - s + 2*s - 1) / (2*s);
+        for (int64_t q = 0; q < npairs; ++q) {
+            int64_t b = 2*s*q;
+            cand[ b ].insert( cand[ b ].end(),
+                              cand[ b+s ].begin(), cand[ b+s ].end() );
+            int64_t iinfo = select( n, A, lda, cand[ b ] );
+            if (b == 0 && 2*s >= p)
+                info = iinfo;
+        }
+    }
+    if (info != 0)
+        return getrf_panel( m, n, A, lda, ipiv );
+
+    // Express the pivot rows as sequential interchanges, as getrf does.
+    std::vector< int64_t > perm( m ), where( m );
+    for (int64_t i = 0; i < m; ++i) {
+        perm[ i ] = i;
+        where[ i ] = i;
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        int64_t r = where[ cand[ 0 ][ i ] ];
+        ipiv[ i ] = r + 1;
+        std::swap( perm[ i ], perm[ r ] );
+        where[ perm[ i ] ] = i;
+        where[ perm[ r ] ] = r;
+    }
+    swap_rows( n, A, lda, 0, n, ipiv );
+
+    // Factor the top n-by-n block, then L21 = A21 U11^{-1}.
+    info = getrf_nopiv( n, A, lda );
+    blas::trsm( Layout::ColMajor, blas::Side::Right, blas::Uplo::Upper,
+                Op::NoTrans, blas::Diag::NonUnit,
+                m - n, n, one, A, lda, &A[ n ], lda );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Tiled LU factorization, as a DAG of tasks on block columns run on
+/// a work-stealing thread pool. Panels use partial pivoting
+/// (Method::Tiled) or tournament pivoting (Method::CALU).
+/// Vendor BLAS is set to one thread while tasks run, and tasks do not
+/// open nested OpenMP regions, so the graph uses num_threads threads.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf_tiled(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t* ipiv,
+    int64_t nb, int num_threads, lapack::Method method )
+{
+    using blas::Layout;
+    using blas::Op;
+
+    const scalar_t one = 1;
+
+    int64_t mn = min( m, n );
+    int64_t mt = (m  + nb - 1) / nb;
+    int64_t nt = (n  + nb - 1) / nb;
+    int64_t kt = (mn + nb - 1) / nb;
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return A + i*nb + j*nb*lda;
+    };
+    // Keys: block column j is j, which panel and row-swap tasks write;
+    // tile (i, j) is nt + i + j*mt, which gemm tasks write.
+    // Gemm tasks read their block column, so the next write to a block
+    // column waits for all gemms on it.
+    auto col = [&]( int64_t j ) {
+        return j;
+    };
+    auto tile_key = [&]( int64_t i, int64_t j ) {
+        return nt + i + j*mt;
+    };
+
+    // Panels run in order, so the first to find a zero pivot sets info.
+    int64_t info = 0;
+    internal::TaskGraph graph;
+
+    for (int64_t k = 0; k < kt; ++k) {
+        int64_t kb = min( nb, n - k*nb );
+        int64_t k0 = k*nb;
+        int64_t k1 = min( k0 + kb, mn );
+
+        // Panel: factor A(k0:m, k0:k0+kb), with global pivots, on one
+        // worker; CALU uses a tournament of one leaf per thread.
+        graph.add( [=, &info] {
+            int64_t iinfo = method == Method::CALU
+                ? getrf_panel_calu( m - k0, kb, tile( k, k ), lda,
+                                    &ipiv[ k0 ], num_threads )
+                : getrf_panel( m - k0, kb, tile( k, k ), lda,
+                               &ipiv[ k0 ] );
+            if (info == 0 && iinfo > 0)
+                info = iinfo + k0;
+            for (int64_t i = k0; i < k1; ++i)
+                ipiv[ i ] += k0;
+        }, { }, col( k ), true );
+
+        // Trailing block columns. Updates to block column k+1 have
+        // priority, so the next panel can start while the rest of the
+        // trailing matrix is being updated (look-ahead).
+        for (int64_t j = k+1; j < nt; ++j) {
+            int64_t jb = min( nb, n - j*nb );
+            bool priority = (j == k+1);
+
+            // Swap rows of block column j, then A(k, j) = L(k, k)^{-1} A(k, j)
+            graph.add( [=] {
+                swap_rows( jb, &A[ j*nb*lda ], lda, k0, k1, ipiv );
+                blas::trsm( Layout::ColMajor, blas::Side::Left, blas::Uplo::Lower,
+                            Op::NoTrans, blas::Diag::Unit,
+                            k1 - k0, jb, one, tile( k, k ), lda, tile( k, j ), lda );
+            }, { col( k ) }, col( j ), priority );
+
+            // A(i, j) -= A(i, k) A(k, j)
+            for (int64_t i = k+1; i < mt; ++i) {
+                int64_t ib = min( nb, m - i*nb );
+                graph.add( [=] {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                ib, jb, k1 - k0,
+                                -one, tile( i, k ), lda,
+                                      tile( k, j ), lda,
+                                 one, tile( i, j ), lda );
+                }, { col( k ), col( j ) }, tile_key( i, j ), priority );
+            }
+        }
+    }
+
+    // Apply later panels' row swaps to the left of each panel.
+    // This is deferred to the end, off the critical path.
+    for (int64_t j = 0; j < kt - 1; ++j) {
+        int64_t j1 = min( (j+1)*nb, mn );
+        std::vector< int64_t > reads;
+        for (int64_t k = j+1; k < kt; ++k)
+            reads.push_back( col( k ) );
+        graph.add( [=] {
+            swap_rows( nb, &A[ j*nb*lda ], lda, j1, mn, ipiv );
+        }, reads, col( j ) );
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// LU factorization using the given method.
+/// @ingroup gesv_internal
+///
+template <typename scalar_t>
+int64_t getrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Tiled &&
+                     method != Method::CALU );
+
+    int num_threads = internal::batch_max_threads();
+    int64_t nb = internal::tiled_nb( n, num_threads );
+    if (method == Method::Lapack
+        || (method == Method::Tiled && min( m, n ) <= nb)) {
+        return lapack::getrf( m, n, A, lda, ipiv );
+    }
+    return getrf_tiled( m, n, A, lda, ipiv, nb, num_threads, method );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes an LU factorization of a general m-by-n matrix A
+/// using partial pivoting with row interchanges, as `lapack::getrf` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK getrf, using the threading of the
+///   vendor library.
+///
+/// - Method::Tiled: splits A into nb-wide block columns and runs the
+///   factorization as a DAG of tasks on a work-stealing pool of threads,
+///   with the vendor BLAS set to one thread. Each panel is factored by a
+///   recursive algorithm whose trailing updates run in parallel over row
+///   blocks. Updates to the next block column have priority, so the next
+///   panel is factored while the rest of the trailing matrix is still
+///   being updated (look-ahead), rather than waiting at a fork-join
+///   barrier. Row swaps to the left of each panel are deferred to the end.
+///   The number of threads is the OpenMP max threads
+///   (e.g., from `$OMP_NUM_THREADS`).
+///   If min(m, n) is at most one block, this calls LAPACK getrf.
+///
+/// - Method::CALU: as Method::Tiled, but each panel uses tournament
+///   pivoting, for tall matrices (m >> n) where the partial pivoting
+///   panel is memory bound. The rows of the panel are split into
+///   blocks, one per thread, each with at least 2*nb rows. Each block
+///   selects nb candidate pivot rows by partial pivoting, and pairs of
+///   candidate sets are reduced up a binary tree to the nb pivot rows,
+///   so the panel is read once to choose its pivots. The panel is then
+///   factored without further pivoting. Pivots differ from partial
+///   pivoting, but are stable in practice, with a growth factor close
+///   to partial pivoting's.
+///
+/// Lapack and Tiled choose pivots the same way; in rare cases of near
+/// ties in magnitude, rounding differences can select a different pivot.
+/// All methods return ipiv as sequential row interchanges, so ipiv is
+/// LAPACK-compatible and can be passed to `lapack::getrs`,
+/// `lapack::laswp`, etc.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, the factors L and U from the factorization
+///     A = P*L*U; the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @param[in] method
+///     Method::Lapack, Method::Tiled, or Method::CALU.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The factorization
+///     has been completed, but the factor U is exactly
+///     singular, and division by zero will occur if it is used
+///     to solve a system of equations.
+///
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method )
+{
+    return impl::getrf( m, n, A, lda, ipiv, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method )
+{
+    return impl::getrf( m, n, A, lda, ipiv, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method )
+{
+    return impl::getrf( m, n, A, lda, ipiv, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    lapack::Method method )
+{
+    return impl::getrf( m, n, A, lda, ipiv, method );
+}
+
+}  // namespace lapack
@@ -15,12 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesv_computational
-int64_t getri(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+template <typename ipiv_t>
+int64_t getri_work(
     int64_t n,
     float* A, int64_t lda,
-    int64_t const* ipiv )
+    ipiv_t const* ipiv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -29,37 +35,40 @@ int64_t getri(
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
+
+    // 32-bit copy, unless ipiv is already lapack_int
+    lapack_int const* ipiv_ptr = work_buffer.get_pivots_in( (n), ipiv );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgetri(
-        &n_,
-        A, &lda_,
-        ipiv_ptr,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgetri", { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgetri(
+            &n_,
+            A, &lda_,
+            ipiv_ptr,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -67,11 +76,12 @@ int64_t getri(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesv_computational
-int64_t getri(
+template <typename ipiv_t>
+int64_t getri_work(
     int64_t n,
     double* A, int64_t lda,
-    int64_t const* ipiv )
+    ipiv_t const* ipiv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -80,37 +90,40 @@ int64_t getri(
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
+
+    // 32-bit copy, unless ipiv is already lapack_int
+    lapack_int const* ipiv_ptr = work_buffer.get_pivots_in( (n), ipiv );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgetri(
-        &n_,
-        A, &lda_,
-        ipiv_ptr,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgetri", { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgetri(
+            &n_,
+            A, &lda_,
+            ipiv_ptr,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -118,11 +131,12 @@ int64_t getri(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup gesv_computational
-int64_t getri(
+template <typename ipiv_t>
+int64_t getri_work(
     int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv )
+    ipiv_t const* ipiv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -131,43 +145,139 @@ int64_t getri(
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
+
+    // 32-bit copy, unless ipiv is already lapack_int
+    lapack_int const* ipiv_ptr = work_buffer.get_pivots_in( (n), ipiv );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgetri", { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgetri(
+            &n_,
+            (lapack_complex_float*) A, &lda_,
+            ipiv_ptr,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+template <typename ipiv_t>
+int64_t getri_work(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    ipiv_t const* ipiv,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // 32-bit copy, unless ipiv is already lapack_int
+    lapack_int const* ipiv_ptr = work_buffer.get_pivots_in( (n), ipiv );
+    lapack_int info_ = 0;
 
-    LAPACK_cgetri(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgetri", { n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgetri(
+            &n_,
+            (lapack_complex_double*) A, &lda_,
+            ipiv_ptr,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgetri(
         &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the inverse of a matrix using the LU factorization
 /// computed by `lapack::getrf`.
@@ -207,48 +317,299 @@ int64_t getri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::getri`. Arguments are the same as for
+/// `lapack::getri`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::getri` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::getri_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::getri( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::getri`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::getri_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::getri` that takes pivots ipiv in LAPACK's native
+/// integer type, `lapack_int`, passing them to LAPACK without conversion.
+/// Declared only when `lapack_int` is 32-bit (LP64); with ILP64, the
+/// `int64_t` version is already zero-copy. See `lapack::PivotView`.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::getri_work_size_bytes` for `lapack_int` pivots.
+///
+/// @ingroup gesv_computational
+void getri_work_size_bytes(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getri_work( n, A, lda, ipiv, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::getri` with `lapack_int` pivots that takes its
+/// workspace from host_work instead of allocating it; see the
+/// `int64_t` version.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getri_work( n, A, lda, ipiv, work_buffer );
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -17,11 +17,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t getsls(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t getsls_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* B, int64_t ldb )
+    float* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -43,41 +49,49 @@ int64_t getsls(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgetsls", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
 
-    // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
-    lapack_int ineg_two = -2;
-    LAPACK_sgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_two, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+        // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
+        lapack_int ineg_two = -2;
+        LAPACK_sgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_two, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        work_buffer.insert( key, sizes );
     }
-    lwork_ = max( lwork_, real(qry_work[0]) );
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -86,10 +100,11 @@ int64_t getsls(
 }
 
 // -----------------------------------------------------------------------------
-int64_t getsls(
+int64_t getsls_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* B, int64_t ldb )
+    double* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -111,41 +126,49 @@ int64_t getsls(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgetsls", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
 
-    // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
-    lapack_int ineg_two = -2;
-    LAPACK_dgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_two, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+        // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
+        lapack_int ineg_two = -2;
+        LAPACK_dgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            A, &lda_,
+            B, &ldb_,
+            qry_work, &ineg_two, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        work_buffer.insert( key, sizes );
     }
-    lwork_ = max( lwork_, real(qry_work[0]) );
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -154,10 +177,11 @@ int64_t getsls(
 }
 
 // -----------------------------------------------------------------------------
-int64_t getsls(
+int64_t getsls_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -175,41 +199,49 @@ int64_t getsls(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgetsls", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
 
-    // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
-    lapack_int ineg_two = -2;
-    LAPACK_cgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_two, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+        // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
+        lapack_int ineg_two = -2;
+        LAPACK_cgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) qry_work, &ineg_two, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        work_buffer.insert( key, sizes );
     }
-    lwork_ = max( lwork_, real(qry_work[0]) );
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -218,10 +250,11 @@ int64_t getsls(
 }
 
 // -----------------------------------------------------------------------------
-int64_t getsls(
+int64_t getsls_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -239,41 +272,49 @@ int64_t getsls(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgetsls", { trans_, m_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
 
-    // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
-    lapack_int ineg_two = -2;
-    LAPACK_zgetsls(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_two, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+        // LAPACK bug: min work can be > opt work for m < n, e.g. m = 2, n = 3.
+        lapack_int ineg_two = -2;
+        LAPACK_zgetsls(
+            &trans_, &m_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_two, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        work_buffer.insert( key, sizes );
     }
-    lwork_ = max( lwork_, real(qry_work[0]) );
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -281,6 +322,156 @@ int64_t getsls(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    size_t host_work_size;
+    getsls_work_size_bytes( trans, m, n, nrhs, A, lda, B, ldb,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return getsls( trans, m, n, nrhs, A, lda, B, ldb,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    size_t host_work_size;
+    getsls_work_size_bytes( trans, m, n, nrhs, A, lda, B, ldb,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return getsls( trans, m, n, nrhs, A, lda, B, ldb,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    size_t host_work_size;
+    getsls_work_size_bytes( trans, m, n, nrhs, A, lda, B, ldb,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return getsls( trans, m, n, nrhs, A, lda, B, ldb,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    size_t host_work_size;
+    getsls_work_size_bytes( trans, m, n, nrhs, A, lda, B, ldb,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return getsls( trans, m, n, nrhs, A, lda, B, ldb,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size_bytes(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return getsls_work( trans, m, n, nrhs, A, lda, B, ldb, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
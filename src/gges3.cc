@@ -17,8 +17,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t gges3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gges3_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_s_select3 select, int64_t n,
     float* A, int64_t lda,
@@ -27,7 +32,8 @@ int64_t gges3(
     std::complex<float>* alpha,
     float* beta,
     float* VSL, int64_t ldvsl,
-    float* VSR, int64_t ldvsr )
+    float* VSR, int64_t ldvsr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -49,47 +55,55 @@ int64_t gges3(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > alphar( max( 1, n ) );
-    lapack::vector< float > alphai( max( 1, n ) );
+    float* alphar = work_buffer.get< float >( max( 1, n ) );
+    float* alphai = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        qry_work, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgges3", { jobvsl_, jobvsr_, sort_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgges3(
+            &jobvsl_, &jobvsr_, &sort_,
+            select, &n_,
+            A, &lda_,
+            B, &ldb_, &sdim_,
+            alphar,
+            alphai,
+            beta,
+            VSL, &ldvsl_,
+            VSR, &ldvsr_,
+            qry_work, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -103,7 +117,7 @@ int64_t gges3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+int64_t gges3_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, int64_t n,
     double* A, int64_t lda,
@@ -112,7 +126,8 @@ int64_t gges3(
     std::complex<double>* alpha,
     double* beta,
     double* VSL, int64_t ldvsl,
-    double* VSR, int64_t ldvsr )
+    double* VSR, int64_t ldvsr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -134,47 +149,55 @@ int64_t gges3(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
+    double* alphar = work_buffer.get< double >( max( 1, n ) );
+    double* alphai = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        qry_work, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgges3", { jobvsl_, jobvsr_, sort_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgges3(
+            &jobvsl_, &jobvsr_, &sort_,
+            select, &n_,
+            A, &lda_,
+            B, &ldb_, &sdim_,
+            alphar,
+            alphai,
+            beta,
+            VSL, &ldvsl_,
+            VSR, &ldvsr_,
+            qry_work, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -188,7 +211,7 @@ int64_t gges3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+int64_t gges3_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -197,7 +220,8 @@ int64_t gges3(
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
-    std::complex<float>* VSR, int64_t ldvsr )
+    std::complex<float>* VSR, int64_t ldvsr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -218,33 +242,41 @@ int64_t gges3(
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_C_SELECT2) select, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &sdim_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VSL, &ldvsl_,
-        (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgges3", { jobvsl_, jobvsr_, sort_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgges3(
+            &jobvsl_, &jobvsr_, &sort_,
+            (LAPACK_C_SELECT2) select, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_, &sdim_,
+            (lapack_complex_float*) alpha,
+            (lapack_complex_float*) beta,
+            (lapack_complex_float*) VSL, &ldvsl_,
+            (lapack_complex_float*) VSR, &ldvsr_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (8*n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cgges3(
         &jobvsl_, &jobvsr_, &sort_,
@@ -255,9 +287,9 @@ int64_t gges3(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) VSL, &ldvsl_,
         (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -267,7 +299,7 @@ int64_t gges3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+int64_t gges3_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -276,7 +308,8 @@ int64_t gges3(
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VSL, int64_t ldvsl,
-    std::complex<double>* VSR, int64_t ldvsr )
+    std::complex<double>* VSR, int64_t ldvsr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -297,33 +330,41 @@ int64_t gges3(
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_Z_SELECT2) select, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_, &sdim_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) VSL, &ldvsl_,
-        (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgges3", { jobvsl_, jobvsr_, sort_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgges3(
+            &jobvsl_, &jobvsr_, &sort_,
+            (LAPACK_Z_SELECT2) select, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_, &sdim_,
+            (lapack_complex_double*) alpha,
+            (lapack_complex_double*) beta,
+            (lapack_complex_double*) VSL, &ldvsl_,
+            (lapack_complex_double*) VSR, &ldvsr_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (8*n) );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zgges3(
         &jobvsl_, &jobvsr_, &sort_,
@@ -334,9 +375,9 @@ int64_t gges3(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VSL, &ldvsl_,
         (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -345,6 +386,244 @@ int64_t gges3(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr )
+{
+    size_t host_work_size;
+    gges3_work_size_bytes( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                           sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gges3( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                  beta, VSL, ldvsl, VSR, ldvsr,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr )
+{
+    size_t host_work_size;
+    gges3_work_size_bytes( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                           sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gges3( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                  beta, VSL, ldvsl, VSR, ldvsr,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr )
+{
+    size_t host_work_size;
+    gges3_work_size_bytes( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                           sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gges3( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                  beta, VSL, ldvsl, VSR, ldvsr,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr )
+{
+    size_t host_work_size;
+    gges3_work_size_bytes( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                           sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return gges3( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                  beta, VSL, ldvsl, VSR, ldvsr,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha,
+                beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.6
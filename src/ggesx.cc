@@ -15,8 +15,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ggesx_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_s_select3 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
@@ -27,7 +32,8 @@ int64_t ggesx(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -50,56 +56,65 @@ int64_t ggesx(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > alphar( max( 1, n ) );
-    lapack::vector< float > alphai( max( 1, n ) );
-
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    float* alphar = work_buffer.get< float >( max( 1, n ) );
+    float* alphai = work_buffer.get< float >( max( 1, n ) );
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sggesx", { jobvsl_, jobvsr_, sort_, sense_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sggesx(
+            &jobvsl_, &jobvsr_, &sort_,
+            select, &sense_, &n_,
+            A, &lda_,
+            B, &ldb_, &sdim_,
+            alphar,
+            alphai,
+            beta,
+            VSL, &ldvsl_,
+            VSR, &ldvsr_,
+            rconde,
+            rcondv,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
         rconde,
         rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -113,7 +128,7 @@ int64_t ggesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+int64_t ggesx_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
@@ -124,7 +139,8 @@ int64_t ggesx(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -147,56 +163,65 @@ int64_t ggesx(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
-
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    double* alphar = work_buffer.get< double >( max( 1, n ) );
+    double* alphai = work_buffer.get< double >( max( 1, n ) );
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dggesx", { jobvsl_, jobvsr_, sort_, sense_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dggesx(
+            &jobvsl_, &jobvsr_, &sort_,
+            select, &sense_, &n_,
+            A, &lda_,
+            B, &ldb_, &sdim_,
+            alphar,
+            alphai,
+            beta,
+            VSL, &ldvsl_,
+            VSR, &ldvsr_,
+            rconde,
+            rcondv,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
         rconde,
         rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -210,7 +235,7 @@ int64_t ggesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+int64_t ggesx_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -221,7 +246,8 @@ int64_t ggesx(
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -243,39 +269,48 @@ int64_t ggesx(
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_C_SELECT2) select, &sense_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &sdim_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VSL, &ldvsl_,
-        (lapack_complex_float*) VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cggesx", { jobvsl_, jobvsr_, sort_, sense_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cggesx(
+            &jobvsl_, &jobvsr_, &sort_,
+            (LAPACK_C_SELECT2) select, &sense_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_, &sdim_,
+            (lapack_complex_float*) alpha,
+            (lapack_complex_float*) beta,
+            (lapack_complex_float*) VSL, &ldvsl_,
+            (lapack_complex_float*) VSR, &ldvsr_,
+            rconde,
+            rcondv,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( (8*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cggesx(
         &jobvsl_, &jobvsr_, &sort_,
@@ -288,10 +323,10 @@ int64_t ggesx(
         (lapack_complex_float*) VSR, &ldvsr_,
         rconde,
         rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -301,7 +336,7 @@ int64_t ggesx(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+int64_t ggesx_work(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -312,7 +347,8 @@ int64_t ggesx(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -334,39 +370,48 @@ int64_t ggesx(
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_Z_SELECT2) select, &sense_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_, &sdim_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) VSL, &ldvsl_,
-        (lapack_complex_double*) VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &ineg_one,
-        qry_bwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zggesx", { jobvsl_, jobvsr_, sort_, sense_, n_, lda_, ldb_, ldvsl_, ldvsr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int qry_bwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zggesx(
+            &jobvsl_, &jobvsr_, &sort_,
+            (LAPACK_Z_SELECT2) select, &sense_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_, &sdim_,
+            (lapack_complex_double*) alpha,
+            (lapack_complex_double*) beta,
+            (lapack_complex_double*) VSL, &ldvsl_,
+            (lapack_complex_double*) VSR, &ldvsr_,
+            rconde,
+            rcondv,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &ineg_one,
+            qry_bwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( (8*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    lapack_int* bwork = work_buffer.get< lapack_int >( (n) );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zggesx(
         &jobvsl_, &jobvsr_, &sort_,
@@ -379,10 +424,10 @@ int64_t ggesx(
         (lapack_complex_double*) VSR, &ldvsr_,
         rconde,
         rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
+        bwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -391,4 +436,274 @@ int64_t ggesx(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv )
+{
+    size_t host_work_size;
+    ggesx_work_size_bytes( jobvsl, jobvsr, sort, select, sense, n, A, lda,
+                           B, ldb, sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggesx( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                  alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    size_t host_work_size;
+    ggesx_work_size_bytes( jobvsl, jobvsr, sort, select, sense, n, A, lda,
+                           B, ldb, sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggesx( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                  alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv )
+{
+    size_t host_work_size;
+    ggesx_work_size_bytes( jobvsl, jobvsr, sort, select, sense, n, A, lda,
+                           B, ldb, sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggesx( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                  alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    size_t host_work_size;
+    ggesx_work_size_bytes( jobvsl, jobvsr, sort, select, sense, n, A, lda,
+                           B, ldb, sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                           rconde, rcondv, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggesx( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                  alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size_bytes(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim,
+                alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv, work_buffer );
+}
+
 }  // namespace lapack
@@ -17,15 +17,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ggev3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ggev3_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     std::complex<float>* alpha,
     float* beta,
     float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr )
+    float* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -45,39 +51,47 @@ int64_t ggev3(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > alphar( max( 1, n ) );
-    lapack::vector< float > alphai( max( 1, n ) );
+    float* alphar = work_buffer.get< float >( max( 1, n ) );
+    float* alphai = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggev3(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        &alphar[0], &alphai[0],
-        beta,
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sggev3", { jobvl_, jobvr_, n_, lda_, ldb_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sggev3(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            alphar, alphai,
+            beta,
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sggev3(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         B, &ldb_,
-        &alphar[0], &alphai[0],
+        alphar, alphai,
         beta,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -90,14 +104,15 @@ int64_t ggev3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggev3(
+int64_t ggev3_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     std::complex<double>* alpha,
     double* beta,
     double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr )
+    double* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -117,39 +132,47 @@ int64_t ggev3(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
+    double* alphar = work_buffer.get< double >( max( 1, n ) );
+    double* alphai = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggev3(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        &alphar[0], &alphai[0],
-        beta,
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dggev3", { jobvl_, jobvr_, n_, lda_, ldb_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dggev3(
+            &jobvl_, &jobvr_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            alphar, alphai,
+            beta,
+            VL, &ldvl_,
+            VR, &ldvr_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dggev3(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
         B, &ldb_,
-        &alphar[0], &alphai[0],
+        alphar, alphai,
         beta,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -162,14 +185,15 @@ int64_t ggev3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggev3(
+int64_t ggev3_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr )
+    std::complex<float>* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -188,29 +212,37 @@ int64_t ggev3(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggev3(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cggev3", { jobvl_, jobvr_, n_, lda_, ldb_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cggev3(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) alpha,
+            (lapack_complex_float*) beta,
+            (lapack_complex_float*) VL, &ldvl_,
+            (lapack_complex_float*) VR, &ldvr_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (8*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cggev3(
         &jobvl_, &jobvr_, &n_,
@@ -220,8 +252,8 @@ int64_t ggev3(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -230,14 +262,15 @@ int64_t ggev3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggev3(
+int64_t ggev3_work(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VL, int64_t ldvl,
-    std::complex<double>* VR, int64_t ldvr )
+    std::complex<double>* VR, int64_t ldvr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -256,29 +289,37 @@ int64_t ggev3(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggev3(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zggev3", { jobvl_, jobvr_, n_, lda_, ldb_, ldvl_, ldvr_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zggev3(
+            &jobvl_, &jobvr_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) alpha,
+            (lapack_complex_double*) beta,
+            (lapack_complex_double*) VL, &ldvl_,
+            (lapack_complex_double*) VR, &ldvr_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (8*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zggev3(
         &jobvl_, &jobvr_, &n_,
@@ -288,8 +329,8 @@ int64_t ggev3(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VL, &ldvl_,
         (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -297,6 +338,212 @@ int64_t ggev3(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    ggev3_work_size_bytes( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta,
+                           VL, ldvl, VR, ldvr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggev3( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                  VR, ldvr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    ggev3_work_size_bytes( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta,
+                           VL, ldvl, VR, ldvr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggev3( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                  VR, ldvr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    ggev3_work_size_bytes( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta,
+                           VL, ldvl, VR, ldvr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggev3( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                  VR, ldvr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr )
+{
+    size_t host_work_size;
+    ggev3_work_size_bytes( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta,
+                           VL, ldvl, VR, ldvr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggev3( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                  VR, ldvr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR,
+                ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR,
+                ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR,
+                ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggev3_work_size_bytes(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR,
+                ldvr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                       VR, ldvr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                       VR, ldvr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                       VR, ldvr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggev3(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggev3_work( jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl,
+                       VR, ldvr, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.6
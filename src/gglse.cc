@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,15 +14,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup ggls
-int64_t gglse(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t gglse_work(
     int64_t m, int64_t n, int64_t p,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     float* C,
     float* D,
-    float* X )
+    float* X,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,24 +44,32 @@ int64_t gglse(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sgglse", { m_, n_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sgglse(
+            &m_, &n_, &p_,
+            A, &lda_,
+            B, &ldb_,
+            C,
+            D,
+            X,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sgglse(
         &m_, &n_, &p_,
@@ -66,7 +78,7 @@ int64_t gglse(
         C,
         D,
         X,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -74,14 +86,14 @@ int64_t gglse(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup ggls
-int64_t gglse(
+int64_t gglse_work(
     int64_t m, int64_t n, int64_t p,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* C,
     double* D,
-    double* X )
+    double* X,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -98,24 +110,32 @@ int64_t gglse(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dgglse", { m_, n_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dgglse(
+            &m_, &n_, &p_,
+            A, &lda_,
+            B, &ldb_,
+            C,
+            D,
+            X,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dgglse(
         &m_, &n_, &p_,
@@ -124,7 +144,7 @@ int64_t gglse(
         C,
         D,
         X,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -132,14 +152,14 @@ int64_t gglse(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup ggls
-int64_t gglse(
+int64_t gglse_work(
     int64_t m, int64_t n, int64_t p,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* C,
     std::complex<float>* D,
-    std::complex<float>* X )
+    std::complex<float>* X,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -156,9 +176,33 @@ int64_t gglse(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cgglse", { m_, n_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cgglse(
+            &m_, &n_, &p_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) C,
+            (lapack_complex_float*) D,
+            (lapack_complex_float*) X,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cgglse(
         &m_, &n_, &p_,
         (lapack_complex_float*) A, &lda_,
@@ -166,29 +210,126 @@ int64_t gglse(
         (lapack_complex_float*) C,
         (lapack_complex_float*) D,
         (lapack_complex_float*) X,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gglse_work(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
 
-    LAPACK_cgglse(
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zgglse", { m_, n_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zgglse(
+            &m_, &n_, &p_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) C,
+            (lapack_complex_double*) D,
+            (lapack_complex_double*) X,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zgglse(
         &m_, &n_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C,
-        (lapack_complex_float*) D,
-        (lapack_complex_float*) X,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) C,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) X,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Solves the linear equality-constrained least squares (LSE)
 /// problem:
@@ -290,52 +431,160 @@ int64_t gglse(
     std::complex<double>* D,
     std::complex<double>* X )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int p_ = (lapack_int) p;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgglse(
-        &m_, &n_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) C,
-        (lapack_complex_double*) D,
-        (lapack_complex_double*) X,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zgglse(
-        &m_, &n_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) C,
-        (lapack_complex_double*) D,
-        (lapack_complex_double*) X,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::gglse`. Arguments are the same as for
+/// `lapack::gglse`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup ggls
+void gglse_work_size_bytes(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gglse` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::gglse_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::gglse( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::gglse`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::gglse_work_size_bytes` for the same arguments.
+///
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return gglse_work( m, n, p, A, lda, B, ldb, C, D, X, work_buffer );
 }
 
 }  // namespace lapack
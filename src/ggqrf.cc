@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ggqrf_work(
     int64_t n, int64_t m, int64_t p,
     float* A, int64_t lda,
     float* taua,
     float* B, int64_t ldb,
-    float* taub )
+    float* taub,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -38,23 +44,31 @@ int64_t ggqrf(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggqrf(
-        &n_, &m_, &p_,
-        A, &lda_,
-        taua,
-        B, &ldb_,
-        taub,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sggqrf", { n_, m_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sggqrf(
+            &n_, &m_, &p_,
+            A, &lda_,
+            taua,
+            B, &ldb_,
+            taub,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sggqrf(
         &n_, &m_, &p_,
@@ -62,7 +76,7 @@ int64_t ggqrf(
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -70,12 +84,13 @@ int64_t ggqrf(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+int64_t ggqrf_work(
     int64_t n, int64_t m, int64_t p,
     double* A, int64_t lda,
     double* taua,
     double* B, int64_t ldb,
-    double* taub )
+    double* taub,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -92,23 +107,31 @@ int64_t ggqrf(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggqrf(
-        &n_, &m_, &p_,
-        A, &lda_,
-        taua,
-        B, &ldb_,
-        taub,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dggqrf", { n_, m_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dggqrf(
+            &n_, &m_, &p_,
+            A, &lda_,
+            taua,
+            B, &ldb_,
+            taub,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dggqrf(
         &n_, &m_, &p_,
@@ -116,7 +139,7 @@ int64_t ggqrf(
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -124,12 +147,13 @@ int64_t ggqrf(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+int64_t ggqrf_work(
     int64_t n, int64_t m, int64_t p,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub )
+    std::complex<float>* taub,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -146,23 +170,31 @@ int64_t ggqrf(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggqrf(
-        &n_, &m_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) taua,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) taub,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cggqrf", { n_, m_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cggqrf(
+            &n_, &m_, &p_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) taua,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) taub,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cggqrf(
         &n_, &m_, &p_,
@@ -170,7 +202,7 @@ int64_t ggqrf(
         (lapack_complex_float*) taua,
         (lapack_complex_float*) B, &ldb_,
         (lapack_complex_float*) taub,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -178,12 +210,13 @@ int64_t ggqrf(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+int64_t ggqrf_work(
     int64_t n, int64_t m, int64_t p,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* taua,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub )
+    std::complex<double>* taub,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -200,23 +233,31 @@ int64_t ggqrf(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggqrf(
-        &n_, &m_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) taua,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) taub,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zggqrf", { n_, m_, p_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zggqrf(
+            &n_, &m_, &p_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) taua,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) taub,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zggqrf(
         &n_, &m_, &p_,
@@ -224,11 +265,185 @@ int64_t ggqrf(
         (lapack_complex_double*) taua,
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) taub,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub )
+{
+    size_t host_work_size;
+    ggqrf_work_size_bytes( n, m, p, A, lda, taua, B, ldb, taub,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggqrf( n, m, p, A, lda, taua, B, ldb, taub,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub )
+{
+    size_t host_work_size;
+    ggqrf_work_size_bytes( n, m, p, A, lda, taua, B, ldb, taub,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggqrf( n, m, p, A, lda, taua, B, ldb, taub,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub )
+{
+    size_t host_work_size;
+    ggqrf_work_size_bytes( n, m, p, A, lda, taua, B, ldb, taub,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggqrf( n, m, p, A, lda, taua, B, ldb, taub,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub )
+{
+    size_t host_work_size;
+    ggqrf_work_size_bytes( n, m, p, A, lda, taua, B, ldb, taub,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggqrf( n, m, p, A, lda, taua, B, ldb, taub,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size_bytes(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub, work_buffer );
+}
+
 }  // namespace lapack
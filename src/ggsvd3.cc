@@ -17,8 +17,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ggsvd3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -28,7 +33,8 @@ int64_t ggsvd3(
     float* beta,
     float* U, int64_t ldu,
     float* V, int64_t ldv,
-    float* Q, int64_t ldq )
+    float* Q, int64_t ldq,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -56,30 +62,38 @@ int64_t ggsvd3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sggsvd3", { jobu_, jobv_, jobq_, m_, n_, p_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sggsvd3(
+            &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+            A, &lda_,
+            B, &ldb_,
+            alpha,
+            beta,
+            U, &ldu_,
+            V, &ldv_,
+            Q, &ldq_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -90,8 +104,8 @@ int64_t ggsvd3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -102,7 +116,7 @@ int64_t ggsvd3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+int64_t ggsvd3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -112,7 +126,8 @@ int64_t ggsvd3(
     double* beta,
     double* U, int64_t ldu,
     double* V, int64_t ldv,
-    double* Q, int64_t ldq )
+    double* Q, int64_t ldq,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -140,30 +155,38 @@ int64_t ggsvd3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dggsvd3", { jobu_, jobv_, jobq_, m_, n_, p_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dggsvd3(
+            &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+            A, &lda_,
+            B, &ldb_,
+            alpha,
+            beta,
+            U, &ldu_,
+            V, &ldv_,
+            Q, &ldq_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -174,8 +197,8 @@ int64_t ggsvd3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -186,7 +209,7 @@ int64_t ggsvd3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+int64_t ggsvd3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -196,7 +219,8 @@ int64_t ggsvd3(
     float* beta,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq )
+    std::complex<float>* Q, int64_t ldq,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -224,33 +248,41 @@ int64_t ggsvd3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        alpha,
-        beta,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cggsvd3", { jobu_, jobv_, jobq_, m_, n_, p_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cggsvd3(
+            &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            alpha,
+            beta,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) V, &ldv_,
+            (lapack_complex_float*) Q, &ldq_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (2*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -261,9 +293,9 @@ int64_t ggsvd3(
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) V, &ldv_,
         (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -274,7 +306,7 @@ int64_t ggsvd3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+int64_t ggsvd3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -284,7 +316,8 @@ int64_t ggsvd3(
     double* beta,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq )
+    std::complex<double>* Q, int64_t ldq,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -312,33 +345,41 @@ int64_t ggsvd3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        alpha,
-        beta,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) V, &ldv_,
-        (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zggsvd3", { jobu_, jobv_, jobq_, m_, n_, p_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zggsvd3(
+            &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            alpha,
+            beta,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) V, &ldv_,
+            (lapack_complex_double*) Q, &ldq_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (2*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -349,9 +390,9 @@ int64_t ggsvd3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -361,6 +402,252 @@ int64_t ggsvd3(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq )
+{
+    size_t host_work_size;
+    ggsvd3_work_size_bytes( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb,
+                            alpha, beta, U, ldu, V, ldv, Q, ldq,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvd3( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                   U, ldu, V, ldv, Q, ldq, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq )
+{
+    size_t host_work_size;
+    ggsvd3_work_size_bytes( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb,
+                            alpha, beta, U, ldu, V, ldv, Q, ldq,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvd3( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                   U, ldu, V, ldv, Q, ldq, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq )
+{
+    size_t host_work_size;
+    ggsvd3_work_size_bytes( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb,
+                            alpha, beta, U, ldu, V, ldv, Q, ldq,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvd3( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                   U, ldu, V, ldv, Q, ldq, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq )
+{
+    size_t host_work_size;
+    ggsvd3_work_size_bytes( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb,
+                            alpha, beta, U, ldu, V, ldv, Q, ldq,
+                            &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvd3( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                   U, ldu, V, ldv, Q, ldq, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                 U, ldu, V, ldv, Q, ldq, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                 U, ldu, V, ldv, Q, ldq, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                 U, ldu, V, ldv, Q, ldq, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta,
+                 U, ldu, V, ldv, Q, ldq, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.6
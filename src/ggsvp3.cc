@@ -17,8 +17,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ggsvp3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb, float tola, float tolb,
@@ -27,7 +32,8 @@ int64_t ggsvp3(
     float* U, int64_t ldu,
     float* V, int64_t ldv,
     float* Q, int64_t ldq,
-    float* tau )
+    float* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -55,29 +61,37 @@ int64_t ggsvp3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    lapack_int qry_iwork[1];
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        qry_iwork,
-        tau,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sggsvp3", { jobu_, jobv_, jobq_, m_, p_, n_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        lapack_int qry_iwork[1];
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sggsvp3(
+            &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+            A, &lda_,
+            B, &ldb_, &tola, &tolb, &k_, &l_,
+            U, &ldu_,
+            V, &ldv_,
+            Q, &ldq_,
+            qry_iwork,
+            tau,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
@@ -86,9 +100,9 @@ int64_t ggsvp3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &iwork[0],
+        iwork,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -99,7 +113,7 @@ int64_t ggsvp3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+int64_t ggsvp3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb, double tola, double tolb,
@@ -108,7 +122,8 @@ int64_t ggsvp3(
     double* U, int64_t ldu,
     double* V, int64_t ldv,
     double* Q, int64_t ldq,
-    double* tau )
+    double* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -136,29 +151,37 @@ int64_t ggsvp3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    lapack_int qry_iwork[1];
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        qry_iwork,
-        tau,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dggsvp3", { jobu_, jobv_, jobq_, m_, p_, n_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        lapack_int qry_iwork[1];
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dggsvp3(
+            &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+            A, &lda_,
+            B, &ldb_, &tola, &tolb, &k_, &l_,
+            U, &ldu_,
+            V, &ldv_,
+            Q, &ldq_,
+            qry_iwork,
+            tau,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
@@ -167,9 +190,9 @@ int64_t ggsvp3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &iwork[0],
+        iwork,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -180,7 +203,7 @@ int64_t ggsvp3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+int64_t ggsvp3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb, float tola, float tolb,
@@ -189,7 +212,8 @@ int64_t ggsvp3(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -217,32 +241,40 @@ int64_t ggsvp3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    lapack_int qry_iwork[1];
-    float qry_rwork[1];
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        qry_iwork,
-        qry_rwork,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cggsvp3", { jobu_, jobv_, jobq_, m_, p_, n_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        lapack_int qry_iwork[1];
+        float qry_rwork[1];
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cggsvp3(
+            &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
+            (lapack_complex_float*) U, &ldu_,
+            (lapack_complex_float*) V, &ldv_,
+            (lapack_complex_float*) Q, &ldq_,
+            qry_iwork,
+            qry_rwork,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    float* rwork = work_buffer.get< float >( (2*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
@@ -251,10 +283,10 @@ int64_t ggsvp3(
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) V, &ldv_,
         (lapack_complex_float*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
+        iwork,
+        rwork,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -265,7 +297,7 @@ int64_t ggsvp3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+int64_t ggsvp3_work(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb, double tola, double tolb,
@@ -274,7 +306,8 @@ int64_t ggsvp3(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -302,32 +335,40 @@ int64_t ggsvp3(
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    lapack_int qry_iwork[1];
-    double qry_rwork[1];
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_, &tola, &tolb, &k_, &l_,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) V, &ldv_,
-        (lapack_complex_double*) Q, &ldq_,
-        qry_iwork,
-        qry_rwork,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zggsvp3", { jobu_, jobv_, jobq_, m_, p_, n_, lda_, ldb_, ldu_, ldv_, ldq_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        lapack_int qry_iwork[1];
+        double qry_rwork[1];
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zggsvp3(
+            &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_, &tola, &tolb, &k_, &l_,
+            (lapack_complex_double*) U, &ldu_,
+            (lapack_complex_double*) V, &ldv_,
+            (lapack_complex_double*) Q, &ldq_,
+            qry_iwork,
+            qry_rwork,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    double* rwork = work_buffer.get< double >( (2*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
@@ -336,10 +377,10 @@ int64_t ggsvp3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
+        iwork,
+        rwork,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -349,6 +390,244 @@ int64_t ggsvp3(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau )
+{
+    size_t host_work_size;
+    ggsvp3_work_size_bytes( jobu, jobv, jobq, m, p, n, A, lda,
+                            B, ldb, tola, tolb, k, l, U, ldu, V, ldv, Q, ldq,
+                            tau, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvp3( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                   U, ldu, V, ldv, Q, ldq, tau,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau )
+{
+    size_t host_work_size;
+    ggsvp3_work_size_bytes( jobu, jobv, jobq, m, p, n, A, lda,
+                            B, ldb, tola, tolb, k, l, U, ldu, V, ldv, Q, ldq,
+                            tau, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvp3( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                   U, ldu, V, ldv, Q, ldq, tau,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau )
+{
+    size_t host_work_size;
+    ggsvp3_work_size_bytes( jobu, jobv, jobq, m, p, n, A, lda,
+                            B, ldb, tola, tolb, k, l, U, ldu, V, ldv, Q, ldq,
+                            tau, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvp3( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                   U, ldu, V, ldv, Q, ldq, tau,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau )
+{
+    size_t host_work_size;
+    ggsvp3_work_size_bytes( jobu, jobv, jobq, m, p, n, A, lda,
+                            B, ldb, tola, tolb, k, l, U, ldu, V, ldv, Q, ldq,
+                            tau, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ggsvp3( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                   U, ldu, V, ldv, Q, ldq, tau,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                 U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                 U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                 U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l,
+                 U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.6
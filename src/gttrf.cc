@@ -231,4 +231,133 @@ int64_t gttrf(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    float* DL,
+    float* D,
+    float* DU,
+    float* DU2,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int info_ = 0;
+
+    LAPACK_sgttrf(
+        &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    double* DL,
+    double* D,
+    double* DU,
+    double* DU2,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int info_ = 0;
+
+    LAPACK_dgttrf(
+        &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* DU2,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int info_ = 0;
+
+    LAPACK_cgttrf(
+        &n_,
+        (lapack_complex_float*) DL,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) DU,
+        (lapack_complex_float*) DU2,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::gttrf` that returns pivots ipiv in LAPACK's native
+/// integer type, `lapack_int`, passing them to LAPACK without conversion.
+/// Declared only when `lapack_int` is 32-bit (LP64); with ILP64, the
+/// `int64_t` version is already zero-copy. See `lapack::PivotView`.
+///
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    std::complex<double>* DL,
+    std::complex<double>* D,
+    std::complex<double>* DU,
+    std::complex<double>* DU2,
+    lapack_int* ipiv )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int info_ = 0;
+
+    LAPACK_zgttrf(
+        &n_,
+        (lapack_complex_double*) DL,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) DU,
+        (lapack_complex_double*) DU2,
+        ipiv, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -17,12 +17,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hbev_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hbev_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
     float* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,34 +45,42 @@ int64_t hbev_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chbev_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_float*) AB, &ldab_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chbev_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chbev_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            (lapack_complex_float*) AB, &ldab_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (max( 1, 3*n-2 )) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -75,11 +89,12 @@ int64_t hbev_2stage(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbev_2stage(
+int64_t hbev_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -96,34 +111,42 @@ int64_t hbev_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhbev_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_double*) AB, &ldab_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhbev_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhbev_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            (lapack_complex_double*) AB, &ldab_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (max( 1, 3*n-2 )) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -131,6 +154,90 @@ int64_t hbev_2stage(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                             work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                             work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
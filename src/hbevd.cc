@@ -15,12 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hbevd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hbevd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
     float* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -37,40 +43,50 @@ int64_t hbevd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chbevd(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_float*) AB, &ldab_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "chbevd", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chbevd(
+            &jobz_, &uplo_, &n_, &kd_,
+            (lapack_complex_float*) AB, &ldab_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chbevd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -79,11 +95,12 @@ int64_t hbevd(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbevd(
+int64_t hbevd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -100,40 +117,50 @@ int64_t hbevd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhbevd(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_double*) AB, &ldab_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zhbevd", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhbevd(
+            &jobz_, &uplo_, &n_, &kd_,
+            (lapack_complex_double*) AB, &ldab_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhbevd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -141,4 +168,86 @@ int64_t hbevd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbevd_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbevd_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbevd_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hbevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbevd_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbevd_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbevd_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+}
+
 }  // namespace lapack
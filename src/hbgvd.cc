@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hbgvd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hbgvd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     std::complex<float>* AB, int64_t ldab,
     std::complex<float>* BB, int64_t ldbb,
     float* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,35 +48,45 @@ int64_t hbgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        (lapack_complex_float*) AB, &ldab_,
-        (lapack_complex_float*) BB, &ldbb_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "chbgvd", { jobz_, uplo_, n_, ka_, kb_, ldab_, ldbb_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chbgvd(
+            &jobz_, &uplo_, &n_, &ka_, &kb_,
+            (lapack_complex_float*) AB, &ldab_,
+            (lapack_complex_float*) BB, &ldbb_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -78,9 +94,9 @@ int64_t hbgvd(
         (lapack_complex_float*) BB, &ldbb_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -89,12 +105,13 @@ int64_t hbgvd(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbgvd(
+int64_t hbgvd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* BB, int64_t ldbb,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -115,35 +132,45 @@ int64_t hbgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        (lapack_complex_double*) AB, &ldab_,
-        (lapack_complex_double*) BB, &ldbb_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zhbgvd", { jobz_, uplo_, n_, ka_, kb_, ldab_, ldbb_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhbgvd(
+            &jobz_, &uplo_, &n_, &ka_, &kb_,
+            (lapack_complex_double*) AB, &ldab_,
+            (lapack_complex_double*) BB, &ldbb_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -151,9 +178,9 @@ int64_t hbgvd(
         (lapack_complex_double*) BB, &ldbb_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -161,4 +188,96 @@ int64_t hbgvd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                       work_buffer );
+}
+
 }  // namespace lapack
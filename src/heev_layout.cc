@@ -0,0 +1,131 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/layout.hh"
+
+namespace lapack {
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// A row-major Hermitian A is the column-major conj(A) in the same storage,
+/// with the opposite triangle stored, which has the same eigenvalues and
+/// eigenvectors conj(Z). Row-major Z is stored as the column-major Z^T, so
+/// the eigenvectors are conjugate-transposed in place, the one data
+/// movement that can't be avoided.
+/// @ingroup heev_internal
+///
+template <typename scalar_t>
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::heev( jobz, uplo, n, A, lda, W );
+
+    // swap lower <=> upper
+    uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    int64_t info = lapack::heev( jobz, uplo, n, A, lda, W );
+    if (info == 0 && jobz == Job::Vec)
+        lapack::conj_transpose( n, A, lda );
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes all eigenvalues and, optionally, eigenvectors of a
+/// Hermitian matrix A stored in either layout, as in `lapack::heev`.
+///
+/// A row-major matrix is solved as the conjugate of the same storage in
+/// column-major, with the opposite triangle. Eigenvalues need no data
+/// movement; eigenvectors are conjugate-transposed in place at the end
+/// using a cache-blocked transpose, which avoids copying A.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syev`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n Hermitian matrix A.
+///     On exit, if jobz = Vec, the orthonormal eigenvectors of A are
+///     stored in the columns of A, in the given layout.
+///     If jobz = NoVec, the stored triangle of A is destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] W
+///     The vector W of length n.
+///     If successful, the eigenvalues in ascending order.
+///
+/// @return = 0: successful exit
+/// @return > 0: the algorithm failed to converge; see `lapack::heev`.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup heev
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return impl::heev( layout, jobz, uplo, n, A, lda, W );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup heev
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return impl::heev( layout, jobz, uplo, n, A, lda, W );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup heev
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
+{
+    return impl::heev( layout, jobz, uplo, n, A, lda, W );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup heev
+int64_t heev(
+    lapack::Layout layout, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W )
+{
+    return impl::heev( layout, jobz, uplo, n, A, lda, W );
+}
+
+}  // namespace lapack
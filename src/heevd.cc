@@ -5,7 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
+#include "backend_dispatch.hh"
 
 #include <vector>
 
@@ -15,12 +15,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev
-int64_t heevd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t heevd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    float* W )
+    float* W,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -33,38 +38,115 @@ int64_t heevd(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cheevd", { jobz_, uplo_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cheevd(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            W,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cheevd(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         W,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t heevd_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zheevd", { jobz_, uplo_, n_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zheevd(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            W,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_cheevd(
+    LAPACK_zheevd(
         &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         W,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -72,6 +154,20 @@ int64_t heevd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes all eigenvalues and, optionally, eigenvectors of a
 // Hermitian matrix A. If eigenvectors are desired, it uses a
@@ -138,54 +234,137 @@ int64_t heevd(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zheevd(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        W,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::heevd`. Arguments are the same as for
+/// `lapack::heevd`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zheevd(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        W,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::heevd` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::heevd_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::heevd( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::heevd`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::heevd_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    heevd_work( jobz, uplo, n, A, lda, W, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a
+/// Hermitian matrix A, using a reusable workspace.
+/// Same as the version without ws, except workspace sizes are cached
+/// in ws, and work arrays are taken from ws, so repeated calls with the
+/// same dimensions do no workspace queries or memory allocation.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syevd`.
+///
+/// @param[in,out] ws
+///     Workspace, reused across calls. See lapack::Workspace.
+///
+/// See heevd() for the remaining arguments.
+///
+/// @ingroup heev
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    lapack::Workspace& ws )
+{
+    // count bytes, keeping queried sizes in ws, then compute
+    internal::WorkBuffer counter(
+        internal::WorkBuffer::Mode::Count, &ws );
+    heevd_work( jobz, uplo, n, A, lda, W, counter );
+    size_t host_work_size = counter.bytes();
+    void* host_work = ws.reserve( host_work_size );
+    internal::WorkBuffer work_buffer( host_work, host_work_size, &ws );
+    return heevd_work( jobz, uplo, n, A, lda, W, work_buffer );
 }
 
 }  // namespace lapack
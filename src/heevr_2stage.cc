@@ -17,15 +17,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev
-int64_t heevr_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t heevr_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
     float* W,
     std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -44,62 +49,189 @@ int64_t heevr_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cheevr_2stage", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cheevr_2stage(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            isuppz_ptr,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cheevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         (lapack_complex_float*) Z, &ldz_,
         isuppz_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        std::copy( isuppz_, isuppz_ + (2*max( 1, n )), isuppz );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t heevr_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
 
-    LAPACK_cheevr_2stage(
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = isuppz_;
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zheevr_2stage", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zheevr_2stage(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            isuppz_ptr,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zheevr_2stage(
         &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
-        (lapack_complex_float*) Z, &ldz_,
+        (lapack_complex_double*) Z, &ldz_,
         isuppz_ptr,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + (2*max( 1, n )), isuppz );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    size_t host_work_size;
+    heevr_2stage_work_size_bytes( jobz, range, uplo, n,
+                                  A, lda, vl, vu, il, iu, abstol, nfound, W,
+                                  Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return heevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                         nfound, W, Z, ldz, isuppz,
+                         host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes selected eigenvalues and, optionally, eigenvectors
 /// of a Hermitian matrix A using the 2-stage technique for
@@ -333,77 +465,107 @@ int64_t heevr_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    char range_ = range2char( range );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int il_ = (lapack_int) il;
-    lapack_int iu_ = (lapack_int) iu;
-    lapack_int nfound_ = (lapack_int) *nfound;
-    lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    heevr_2stage_work_size_bytes( jobz, range, uplo, n,
+                                  A, lda, vl, vu, il, iu, abstol, nfound, W,
+                                  Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return heevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                         nfound, W, Z, ldz, isuppz,
+                         host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zheevr_2stage(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevr_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::heevr_2stage`. Arguments are the same as for
+/// `lapack::heevr_2stage`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev
+void heevr_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevr_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zheevr_2stage(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
-    #endif
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevr_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                              abstol, nfound, W, Z, ldz, isuppz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::heevr_2stage` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::heevr_2stage_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::heevr_2stage( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::heevr_2stage`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::heevr_2stage_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevr_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                              abstol, nfound, W, Z, ldz, isuppz, work_buffer );
 }
 
 }  // namespace lapack
@@ -15,15 +15,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev
-int64_t heevx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t heevx_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
     float* W,
     std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,48 +47,149 @@ int64_t heevx(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_ = (lapack_int) *nfound;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "cheevx", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cheevx(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (7*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_cheevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        if (jobz != Job::NoVec) {
+            std::copy( ifail_, &ifail_[ nfound_ ], ifail );
+        }
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+int64_t heevx_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int nfound_ = (lapack_int) *nfound;
+    lapack_int ldz_ = (lapack_int) ldz;
 
-    LAPACK_cheevx(
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zheevx", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zheevx(
+            &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (7*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zheevx(
         &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -92,12 +198,32 @@ int64_t heevx(
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
+            std::copy( ifail_, &ifail_[ nfound_ ], ifail );
         }
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    heevx_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                           nfound, W, Z, ldz, ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return heevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                  W, Z, ldz, ifail, host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes selected eigenvalues and, optionally, eigenvectors
 /// of a Hermitian matrix A. Eigenvalues and eigenvectors can
@@ -236,77 +362,105 @@ int64_t heevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    char range_ = range2char( range );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int il_ = (lapack_int) il;
-    lapack_int iu_ = (lapack_int) iu;
-    lapack_int nfound_ = (lapack_int) *nfound;
-    lapack_int ldz_ = (lapack_int) ldz;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    heevx_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                           nfound, W, Z, ldz, ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return heevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                  W, Z, ldz, ifail, host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zheevx(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevx_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::heevx`. Arguments are the same as for
+/// `lapack::heevx`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev
+void heevx_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    heevx_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevx_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, ifail, work_buffer );
+}
 
-    LAPACK_zheevx(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
-        }
-    #endif
-    return info_;
+// -----------------------------------------------------------------------------
+/// Version of `lapack::heevx` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::heevx_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::heevx( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::heevx`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::heevx_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return heevx_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, ifail, work_buffer );
 }
 
 }  // namespace lapack
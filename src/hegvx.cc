@@ -15,15 +15,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hegvx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hegvx_work(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -46,40 +52,49 @@ int64_t hegvx(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chegvx(
-        &itype_, &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chegvx", { itype_, jobz_, range_, uplo_, n_, lda_, ldb_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chegvx(
+            &itype_, &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (7*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chegvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
@@ -87,9 +102,9 @@ int64_t hegvx(
         (lapack_complex_float*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -98,21 +113,22 @@ int64_t hegvx(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t hegvx(
+int64_t hegvx_work(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -135,40 +151,49 @@ int64_t hegvx(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhegvx(
-        &itype_, &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhegvx", { itype_, jobz_, range_, uplo_, n_, lda_, ldb_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhegvx(
+            &itype_, &jobz_, &range_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (7*n) );
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhegvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
@@ -176,9 +201,9 @@ int64_t hegvx(
         (lapack_complex_double*) B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -187,10 +212,118 @@ int64_t hegvx(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    hegvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda,
+                           B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hegvx( itype, jobz, range, uplo, n, A, lda,
+                  B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    hegvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda,
+                           B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hegvx( itype, jobz, range, uplo, n, A, lda,
+                  B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hegvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hegvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu,
+                abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hegvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hegvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu,
+                abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hegvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hegvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+}
+
 }  // namespace lapack
@@ -17,14 +17,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup hesv
-int64_t hesv_rk(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hesv_rk_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* E,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -37,52 +42,155 @@ int64_t hesv_rk(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chesv_rk", { uplo_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chesv_rk(
+            &uplo_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) E,
+            ipiv_ptr,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_chesv_rk(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) E,
         ipiv_ptr,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t hesv_rk_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
 
-    LAPACK_chesv_rk(
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhesv_rk", { uplo_, n_, nrhs_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhesv_rk(
+            &uplo_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) E,
+            ipiv_ptr,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zhesv_rk(
         &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) E,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) E,
         ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup hesv
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    size_t host_work_size;
+    hesv_rk_work_size_bytes( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hesv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the solution to a system of linear equations
 /// \[
@@ -205,61 +313,97 @@ int64_t hesv_rk(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    hesv_rk_work_size_bytes( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hesv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhesv_rk(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) E,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup hesv
+void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hesv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::hesv_rk`. Arguments are the same as for
+/// `lapack::hesv_rk`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup hesv
+void hesv_rk_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hesv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zhesv_rk(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) E,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup hesv
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hesv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::hesv_rk` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::hesv_rk_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::hesv_rk( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::hesv_rk`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::hesv_rk_work_size_bytes` for the same arguments.
+///
+/// @ingroup hesv
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hesv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work_buffer );
 }
 
 }  // namespace lapack
@@ -17,15 +17,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev_computational
-int64_t hetrd_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hetrd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
     float* E,
     std::complex<float>* tau,
-    std::complex<float>* hous2, int64_t lhous2 )
+    std::complex<float>* hous2, int64_t lhous2,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,9 +45,34 @@ int64_t hetrd_2stage(
     lapack_int lhous2_ = (lapack_int) lhous2;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chetrd_2stage", { jobz_, uplo_, n_, lda_, lhous2_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chetrd_2stage(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            D,
+            E,
+            (lapack_complex_float*) tau,
+            (lapack_complex_float*) hous2, &lhous2_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_chetrd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -50,24 +80,73 @@ int64_t hetrd_2stage(
         E,
         (lapack_complex_float*) tau,
         (lapack_complex_float*) hous2, &lhous2_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hetrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhetrd_2stage", { jobz_, uplo_, n_, lda_, lhous2_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhetrd_2stage(
+            &jobz_, &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            D,
+            E,
+            (lapack_complex_double*) tau,
+            (lapack_complex_double*) hous2, &lhous2_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_chetrd_2stage(
+    LAPACK_zhetrd_2stage(
         &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         D,
         E,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) hous2, &lhous2_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) hous2, &lhous2_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -75,6 +154,26 @@ int64_t hetrd_2stage(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2 )
+{
+    size_t host_work_size;
+    hetrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau,
+                                  hous2, lhous2, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hetrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Reduces a Hermitian matrix A to real symmetric
 /// tridiagonal form T by a unitary similarity transformation:
@@ -196,52 +295,105 @@ int64_t hetrd_2stage(
     std::complex<double>* tau,
     std::complex<double>* hous2, int64_t lhous2 )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int lhous2_ = (lapack_int) lhous2;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    hetrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau,
+                                  hous2, lhous2, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hetrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhetrd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) hous2, &lhous2_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hetrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                       work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::hetrd_2stage`. Arguments are the same as for
+/// `lapack::hetrd_2stage`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev_computational
+void hetrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hetrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                       work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zhetrd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) hous2, &lhous2_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hetrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::hetrd_2stage` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::hetrd_2stage_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::hetrd_2stage( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::hetrd_2stage`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::hetrd_2stage_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hetrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work_buffer );
 }
 
 }  // namespace lapack
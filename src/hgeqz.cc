@@ -15,15 +15,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     float* H, int64_t ldh,
     float* T, int64_t ldt,
     std::complex<float>* alpha,
     float* beta,
     float* Q, int64_t ldq,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -48,41 +54,49 @@ int64_t hgeqz(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > alphar( max( 1, n ) );
-    lapack::vector< float > alphai( max( 1, n ) );
+    float* alphar = work_buffer.get< float >( max( 1, n ) );
+    float* alphai = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_shgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        H, &ldh_,
-        T, &ldt_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        Q, &ldq_,
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "shgeqz", { jobschur_, compq_, compz_, n_, ilo_, ihi_, ldh_, ldt_, ldq_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_shgeqz(
+            &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+            H, &ldh_,
+            T, &ldt_,
+            alphar,
+            alphai,
+            beta,
+            Q, &ldq_,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_shgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
         T, &ldt_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -95,14 +109,15 @@ int64_t hgeqz(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     double* H, int64_t ldh,
     double* T, int64_t ldt,
     std::complex<double>* alpha,
     double* beta,
     double* Q, int64_t ldq,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -127,41 +142,49 @@ int64_t hgeqz(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
+    double* alphar = work_buffer.get< double >( max( 1, n ) );
+    double* alphai = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dhgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        H, &ldh_,
-        T, &ldt_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        Q, &ldq_,
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dhgeqz", { jobschur_, compq_, compz_, n_, ilo_, ihi_, ldh_, ldt_, ldq_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dhgeqz(
+            &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+            H, &ldh_,
+            T, &ldt_,
+            alphar,
+            alphai,
+            beta,
+            Q, &ldq_,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
         T, &ldt_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -174,14 +197,15 @@ int64_t hgeqz(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* H, int64_t ldh,
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -205,29 +229,37 @@ int64_t hgeqz(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_float*) H, &ldh_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chgeqz", { jobschur_, compq_, compz_, n_, ilo_, ihi_, ldh_, ldt_, ldq_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chgeqz(
+            &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+            (lapack_complex_float*) H, &ldh_,
+            (lapack_complex_float*) T, &ldt_,
+            (lapack_complex_float*) alpha,
+            (lapack_complex_float*) beta,
+            (lapack_complex_float*) Q, &ldq_,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
+    // get workspace
+    float* rwork = work_buffer.get< float >( (n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -237,8 +269,8 @@ int64_t hgeqz(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -247,14 +279,15 @@ int64_t hgeqz(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double>* H, int64_t ldh,
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -278,29 +311,37 @@ int64_t hgeqz(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhgeqz", { jobschur_, compq_, compz_, n_, ilo_, ihi_, ldh_, ldt_, ldq_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhgeqz(
+            &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+            (lapack_complex_double*) H, &ldh_,
+            (lapack_complex_double*) T, &ldt_,
+            (lapack_complex_double*) alpha,
+            (lapack_complex_double*) beta,
+            (lapack_complex_double*) Q, &ldq_,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
+    // get workspace
+    double* rwork = work_buffer.get< double >( (n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -310,8 +351,8 @@ int64_t hgeqz(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -319,4 +360,210 @@ int64_t hgeqz(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hgeqz_work_size_bytes( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                           alpha, beta, Q, ldq, Z, ldz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hgeqz( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                  beta, Q, ldq, Z, ldz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hgeqz_work_size_bytes( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                           alpha, beta, Q, ldq, Z, ldz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hgeqz( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                  beta, Q, ldq, Z, ldz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hgeqz_work_size_bytes( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                           alpha, beta, Q, ldq, Z, ldz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hgeqz( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                  beta, Q, ldq, Z, ldz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hgeqz_work_size_bytes( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                           alpha, beta, Q, ldq, Z, ldz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hgeqz( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                  beta, Q, ldq, Z, ldz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                beta, Q, ldq, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                beta, Q, ldq, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                beta, Q, ldq, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                beta, Q, ldq, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz, work_buffer );
+}
+
 }  // namespace lapack
@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t hpgvd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hpgvd_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* AP,
     std::complex<float>* BP,
     float* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,32 +42,42 @@ int64_t hpgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chpgvd(
-        &itype_, &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) AP,
-        (lapack_complex_float*) BP,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "chpgvd", { itype_, jobz_, uplo_, n_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chpgvd(
+            &itype_, &jobz_, &uplo_, &n_,
+            (lapack_complex_float*) AP,
+            (lapack_complex_float*) BP,
+            W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_chpgvd(
         &itype_, &jobz_, &uplo_, &n_,
@@ -69,9 +85,9 @@ int64_t hpgvd(
         (lapack_complex_float*) BP,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -80,12 +96,13 @@ int64_t hpgvd(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hpgvd(
+int64_t hpgvd_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* AP,
     std::complex<double>* BP,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -100,32 +117,42 @@ int64_t hpgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhpgvd(
-        &itype_, &jobz_, &uplo_, &n_,
-        (lapack_complex_double*) AP,
-        (lapack_complex_double*) BP,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zhpgvd", { itype_, jobz_, uplo_, n_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhpgvd(
+            &itype_, &jobz_, &uplo_, &n_,
+            (lapack_complex_double*) AP,
+            (lapack_complex_double*) BP,
+            W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zhpgvd(
         &itype_, &jobz_, &uplo_, &n_,
@@ -133,9 +160,9 @@ int64_t hpgvd(
         (lapack_complex_double*) BP,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -143,4 +170,92 @@ int64_t hpgvd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hpgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hpgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hpgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hpgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hpgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void hpgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hpgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hpgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hpgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+}
+
 }  // namespace lapack
@@ -15,13 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t hseqr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t hseqr_work(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     float* H, int64_t ldh,
     std::complex<float>* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -41,35 +46,43 @@ int64_t hseqr(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    float* WR = work_buffer.get< float >( max( 1, n ) );
+    float* WI = work_buffer.get< float >( max( 1, n ) );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_shseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        H, &ldh_,
-        &WR[0],
-        &WI[0],
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "shseqr", { jobschur_, compz_, n_, ilo_, ihi_, ldh_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_shseqr(
+            &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+            H, &ldh_,
+            WR,
+            WI,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_shseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -82,12 +95,12 @@ int64_t hseqr(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t hseqr(
+int64_t hseqr_work(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     double* H, int64_t ldh,
     std::complex<double>* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -107,35 +120,43 @@ int64_t hseqr(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    double* WR = work_buffer.get< double >( max( 1, n ) );
+    double* WI = work_buffer.get< double >( max( 1, n ) );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dhseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        H, &ldh_,
-        &WR[0],
-        &WI[0],
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dhseqr", { jobschur_, compz_, n_, ilo_, ihi_, ldh_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dhseqr(
+            &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+            H, &ldh_,
+            WR,
+            WI,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -148,12 +169,12 @@ int64_t hseqr(
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t hseqr(
+int64_t hseqr_work(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* H, int64_t ldh,
     std::complex<float>* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -172,30 +193,102 @@ int64_t hseqr(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "chseqr", { jobschur_, compz_, n_, ilo_, ihi_, ldh_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_chseqr(
+            &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+            (lapack_complex_float*) H, &ldh_,
+            (lapack_complex_float*) W,
+            (lapack_complex_float*) Z, &ldz_,
+            (lapack_complex_float*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_chseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hseqr_work(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobschur_ = jobschur2char( jobschur );
+    char compz_ = job_comp2char( compz );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int ldh_ = (lapack_int) ldh;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zhseqr", { jobschur_, compz_, n_, ilo_, ihi_, ldh_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zhseqr(
+            &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+            (lapack_complex_double*) H, &ldh_,
+            (lapack_complex_double*) W,
+            (lapack_complex_double*) Z, &ldz_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
-    LAPACK_chseqr(
+    LAPACK_zhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_float*) H, &ldh_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) H, &ldh_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -203,6 +296,56 @@ int64_t hseqr(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hseqr_work_size_bytes( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hseqr( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hseqr_work_size_bytes( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hseqr( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    hseqr_work_size_bytes( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hseqr( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the eigenvalues of a Hessenberg matrix H
 /// and, optionally, the matrices T and Z from the Schur decomposition
@@ -338,52 +481,151 @@ int64_t hseqr(
     std::complex<double>* W,
     std::complex<double>* Z, int64_t ldz )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobschur_ = jobschur2char( jobschur );
-    char compz_ = job_comp2char( compz );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ilo_ = (lapack_int) ilo;
-    lapack_int ihi_ = (lapack_int) ihi;
-    lapack_int ldh_ = (lapack_int) ldh;
-    lapack_int ldz_ = (lapack_int) ldz;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    hseqr_work_size_bytes( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return hseqr( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zhseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::hseqr`. Arguments are the same as for
+/// `lapack::hseqr`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup geev_computational
+void hseqr_work_size_bytes(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::hseqr` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::hseqr_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::hseqr( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::hseqr`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::hseqr_work_size_bytes` for the same arguments.
+///
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return hseqr_work( jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+                       work_buffer );
 }
 
 }  // namespace lapack
@@ -0,0 +1,438 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/ilaenv.hh"
+#include "lapack/workspace.hh"
+#include "lapack/fortran.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+
+#if defined( LAPACK_ILAENV_OVERRIDE ) && ! defined( _WIN32 )
+    #include <dlfcn.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Tuning table: (name, ispec) => { size => value }.
+/// Set up from LAPACKPP_ILAENV_TABLE on first use.
+struct Table
+{
+    std::mutex mutex;
+    std::map< std::pair< std::string, int64_t >,
+              std::map< int64_t, int64_t > > entries;
+    std::map< std::string, int64_t > hits;
+    std::atomic< bool > empty { true };
+
+    /// Error loading LAPACKPP_ILAENV_TABLE, thrown by the next call to
+    /// the ilaenv_* routines; see check_env.
+    std::string env_error;
+};
+
+//------------------------------------------------------------------------------
+/// @return name lowercased, without Fortran's trailing blanks.
+std::string normalize( const char* name, size_t len )
+{
+    std::string str( name, len );
+    str.erase( str.find_last_not_of( ' ' ) + 1 );
+    std::transform( str.begin(), str.end(), str.begin(),
+                    [](unsigned char c) { return std::tolower( c ); } );
+    return str;
+}
+
+//------------------------------------------------------------------------------
+// Versions without locking, for use while the table is locked.
+
+void set_locked( Table& table, std::string const& name, int64_t ispec,
+                 int64_t size, int64_t value )
+{
+    auto key = std::make_pair( normalize( name.c_str(), name.size() ), ispec );
+    if (value > 0) {
+        table.entries[ key ][ size ] = value;
+    }
+    else {
+        auto iter = table.entries.find( key );
+        if (iter != table.entries.end()) {
+            iter->second.erase( size );
+            if (iter->second.empty())
+                table.entries.erase( iter );
+        }
+    }
+    table.empty = table.entries.empty();
+}
+
+int64_t get_locked( Table const& table, std::string const& name,
+                    int64_t ispec, int64_t size )
+{
+    auto iter = table.entries.find( std::make_pair( name, ispec ) );
+    if (iter == table.entries.end())
+        return -1;
+
+    // largest size <= problem size
+    auto const& sizes = iter->second;
+    auto entry = sizes.upper_bound( size );
+    if (entry == sizes.begin())
+        return -1;
+    --entry;
+    return entry->second;
+}
+
+void load_locked( Table& table, std::string const& filename )
+{
+    std::ifstream file( filename );
+    if (! file)
+        throw Error( "cannot read ILAENV table " + filename );
+
+    std::string line;
+    int64_t line_num = 0;
+    while (std::getline( file, line )) {
+        ++line_num;
+        line = line.substr( 0, line.find( '#' ) );
+        std::istringstream words( line );
+        std::string name, extra;
+        int64_t ispec, size, value;
+        if (! (words >> name))
+            continue;
+        if (! (words >> ispec >> size >> value) || (words >> extra)) {
+            throw Error( filename + ":" + std::to_string( line_num )
+                         + ": expected '<name> <ispec> <size> <value>'" );
+        }
+        set_locked( table, name, ispec, size, value );
+    }
+}
+
+//------------------------------------------------------------------------------
+Table& table()
+{
+    static Table table_;
+    static std::once_flag once;
+    std::call_once( once, [] {
+        std::lock_guard< std::mutex > lock( table_.mutex );
+        // This may be in a call from LAPACK, which can't take an exception,
+        // so save the error for check_env and use the LAPACK defaults.
+        const char* filename = std::getenv( "LAPACKPP_ILAENV_TABLE" );
+        if (filename != nullptr && filename[ 0 ] != '\0') {
+            try {
+                load_locked( table_, filename );
+            }
+            catch (std::exception const& ex) {
+                table_.entries.clear();
+                table_.empty = true;
+                table_.env_error = std::string( "LAPACKPP_ILAENV_TABLE: " )
+                                 + ex.what();
+            }
+        }
+    } );
+    return table_;
+}
+
+//------------------------------------------------------------------------------
+/// If loading LAPACKPP_ILAENV_TABLE failed, throws Error, once,
+/// then lets later calls proceed with the table empty.
+/// ilaenv_clear discards the error.
+/// Requires table.mutex.
+void check_env( Table& table )
+{
+    if (! table.env_error.empty()) {
+        std::string msg = std::move( table.env_error );
+        table.env_error.clear();
+        throw Error( msg );
+    }
+}
+
+#ifdef LAPACK_ILAENV_OVERRIDE
+
+#define LAPACK_ILAENV_STR_( x ) #x
+#define LAPACK_ILAENV_STR( x ) LAPACK_ILAENV_STR_( x )
+
+//------------------------------------------------------------------------------
+/// @return value from the table for a Fortran ILAENV query,
+/// or -1 if the LAPACK default applies.
+int64_t lookup( int64_t ispec, const char* name, size_t name_len,
+                int64_t size )
+{
+    Table& table_ = table();
+    if (table_.empty)
+        return -1;
+
+    std::string name_ = normalize( name, name_len );
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    int64_t value = get_locked( table_, name_, ispec, size );
+    if (value > 0)
+        table_.hits[ name_ ] += 1;
+    return value;
+}
+
+//------------------------------------------------------------------------------
+typedef lapack_int (*ilaenv_func)(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len );
+
+lapack_int default_ilaenv(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len );
+
+lapack_int default_ilaenv2stage(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len );
+
+/// LAPACK library's ILAENV and ILAENV2STAGE, which this library overrides.
+struct NextIlaenv
+{
+    ilaenv_func ilaenv;
+    ilaenv_func ilaenv2stage;
+};
+
+//------------------------------------------------------------------------------
+/// @return LAPACK library's ILAENV and ILAENV2STAGE. If there are none,
+/// e.g., if LAPACK is a static library, returns default_ilaenv and
+/// default_ilaenv2stage instead.
+NextIlaenv const& next_ilaenv()
+{
+    static NextIlaenv next = [] {
+        void* func1 = nullptr;
+        void* func2 = nullptr;
+        #ifndef _WIN32
+            func1 = dlsym( RTLD_NEXT,
+                LAPACK_ILAENV_STR( LAPACK_GLOBAL( ilaenv, ILAENV ) ) );
+            func2 = dlsym( RTLD_NEXT,
+                LAPACK_ILAENV_STR( LAPACK_GLOBAL( ilaenv2stage, ILAENV2STAGE ) ) );
+        #endif
+        NextIlaenv n;
+        n.ilaenv = func1 != nullptr
+                 ? reinterpret_cast< ilaenv_func >( func1 ) : &default_ilaenv;
+        n.ilaenv2stage = func2 != nullptr
+                 ? reinterpret_cast< ilaenv_func >( func2 ) : &default_ilaenv2stage;
+        return n;
+    }();
+    return next;
+}
+
+#endif // LAPACK_ILAENV_OVERRIDE
+
+}  // namespace
+
+//==============================================================================
+bool ilaenv_override()
+{
+    #ifdef LAPACK_ILAENV_OVERRIDE
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+void ilaenv_set( std::string const& name, int64_t ispec, int64_t size,
+                 int64_t value )
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    check_env( table_ );
+    set_locked( table_, name, ispec, size, value );
+
+    // Workspace sizes depend on block sizes, e.g., lwork = n*nb in geqrf,
+    // so cached sizes are stale whenever the table changes; clearing the
+    // cache also makes each Workspace drop its cached sizes.
+    work_query_cache_clear();
+}
+
+//------------------------------------------------------------------------------
+int64_t ilaenv_get( std::string const& name, int64_t ispec, int64_t size )
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    check_env( table_ );
+    return get_locked( table_, normalize( name.c_str(), name.size() ),
+                       ispec, size );
+}
+
+//------------------------------------------------------------------------------
+int64_t ilaenv_hits( std::string const& name )
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    check_env( table_ );
+    auto iter = table_.hits.find( normalize( name.c_str(), name.size() ) );
+    return iter == table_.hits.end() ? 0 : iter->second;
+}
+
+//------------------------------------------------------------------------------
+void ilaenv_clear()
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    table_.entries.clear();
+    table_.hits.clear();
+    table_.env_error.clear();
+    table_.empty = true;
+    work_query_cache_clear();
+}
+
+//------------------------------------------------------------------------------
+void ilaenv_load( std::string const& filename )
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    check_env( table_ );
+    work_query_cache_clear();  // also if load throws after some entries
+    load_locked( table_, filename );
+}
+
+//------------------------------------------------------------------------------
+void ilaenv_save( std::string const& filename )
+{
+    Table& table_ = table();
+    std::lock_guard< std::mutex > lock( table_.mutex );
+    check_env( table_ );
+    std::ofstream file( filename );
+    if (! file)
+        throw Error( "cannot write ILAENV table " + filename );
+
+    file << "# LAPACK++ ILAENV table: <name> <ispec> <size> <value>\n";
+    for (auto const& entry : table_.entries) {
+        for (auto const& size_value : entry.second) {
+            file << entry.first.first << ' ' << entry.first.second << ' '
+                 << size_value.first << ' ' << size_value.second << '\n';
+        }
+    }
+    if (! file)
+        throw Error( "cannot write ILAENV table " + filename );
+}
+
+}  // namespace lapack
+
+//==============================================================================
+#ifdef LAPACK_ILAENV_OVERRIDE
+
+extern "C" {
+
+// LAPACK routines that reference ILAENV and ILAENV2STAGE call;
+// these are in the LAPACK library even when it is static.
+lapack_int LAPACK_GLOBAL( iparmq, IPARMQ )(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n, lapack_int const* ilo, lapack_int const* ihi,
+    lapack_int const* lwork, size_t name_len, size_t opts_len );
+
+lapack_int LAPACK_GLOBAL( ieeeck, IEEECK )(
+    lapack_int const* ispec, float const* zero, float const* one );
+
+#if LAPACK_VERSION >= 30700
+lapack_int LAPACK_GLOBAL( iparam2stage, IPARAM2STAGE )(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* ni, lapack_int const* nbi, lapack_int const* ibi,
+    lapack_int const* nxi, size_t name_len, size_t opts_len );
+#endif
+
+}  // extern "C"
+
+namespace lapack {
+namespace {
+
+//------------------------------------------------------------------------------
+/// ILAENV used when the LAPACK library's can't be found. Returns what
+/// reference ILAENV returns for a routine name it does not know, so block
+/// sizes give unblocked code, which is valid for every routine.
+lapack_int default_ilaenv(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len )
+{
+    const float zero = 0, one = 1;
+    lapack_int ieee_spec;
+    switch (*ispec) {
+        case 1: return 1;   // nb
+        case 2: return 2;   // nbmin
+        case 3: return 0;   // nx
+        case 4: return 6;   // number of shifts, unused
+        case 5: return 2;   // minimum column dimension, unused
+        case 6: return lapack_int( float( std::min( *n1, *n2 ) ) * 1.6f );
+        case 7: return 1;   // number of processors
+        case 8: return 50;  // crossover point for multishift QR
+        case 9: return 25;  // maximum subproblem size for divide and conquer
+        case 10:            // NaN arithmetic can be trusted not to trap
+            ieee_spec = 1;
+            return LAPACK_GLOBAL( ieeeck, IEEECK )( &ieee_spec, &zero, &one );
+        case 11:            // infinity arithmetic can be trusted not to trap
+            ieee_spec = 0;
+            return LAPACK_GLOBAL( ieeeck, IEEECK )( &ieee_spec, &zero, &one );
+        case 12: case 13: case 14: case 15: case 16: case 17:  // xHSEQR
+            return LAPACK_GLOBAL( iparmq, IPARMQ )(
+                ispec, name, opts, n1, n2, n3, n4, name_len, opts_len );
+        default:
+            return -1;      // invalid ispec
+    }
+}
+
+//------------------------------------------------------------------------------
+/// ILAENV2STAGE used when the LAPACK library's can't be found.
+/// Same as reference ILAENV2STAGE.
+lapack_int default_ilaenv2stage(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len )
+{
+    #if LAPACK_VERSION >= 30700
+        if (1 <= *ispec && *ispec <= 5) {
+            lapack_int iispec = 16 + *ispec;
+            return LAPACK_GLOBAL( iparam2stage, IPARAM2STAGE )(
+                &iispec, name, opts, n1, n2, n3, n4, name_len, opts_len );
+        }
+    #endif
+    return -1;
+}
+
+}  // namespace
+}  // namespace lapack
+
+extern "C" {
+
+//------------------------------------------------------------------------------
+/// Overrides LAPACK's ILAENV with values from the tuning table.
+lapack_int LAPACK_GLOBAL( ilaenv, ILAENV )(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len )
+{
+    int64_t value = lapack::lookup( *ispec, name, name_len,
+                                    std::max( *n1, *n2 ) );
+    if (value > 0)
+        return lapack_int( value );
+
+    return lapack::next_ilaenv().ilaenv(
+        ispec, name, opts, n1, n2, n3, n4, name_len, opts_len );
+}
+
+//------------------------------------------------------------------------------
+/// Overrides LAPACK's ILAENV2STAGE with values from the tuning table.
+lapack_int LAPACK_GLOBAL( ilaenv2stage, ILAENV2STAGE )(
+    lapack_int const* ispec, char const* name, char const* opts,
+    lapack_int const* n1, lapack_int const* n2, lapack_int const* n3,
+    lapack_int const* n4, size_t name_len, size_t opts_len )
+{
+    int64_t value = lapack::lookup( *ispec, name, name_len, *n1 );
+    if (value > 0)
+        return lapack_int( value );
+
+    return lapack::next_ilaenv().ilaenv2stage(
+        ispec, name, opts, n1, n2, n3, n4, name_len, opts_len );
+}
+
+}  // extern "C"
+
+#endif // LAPACK_ILAENV_OVERRIDE
@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "copy_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native matrix copy, with SIMD kernels on the copied part of each
+/// column, parallel over chunks of columns with about the same number
+/// of entries. Uses streaming stores if B is larger than the last level cache.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void lacpy_native(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (min( m, n ) == 0)
+        return;
+
+    auto const& kernels = internal::copy_kernels< scalar_t >();
+
+    // As in LAPACK, any type but Upper or Lower copies all of A.
+    Uplo uplo = Uplo::General;
+    if (matrixtype == MatrixType::Upper)
+        uplo = Uplo::Upper;
+    else if (matrixtype == MatrixType::Lower)
+        uplo = Uplo::Lower;
+
+    // Rows [i0, i1) of column j.
+    auto col_rows = [&]( int64_t j, int64_t& i0, int64_t& i1 ) {
+        i0 = (uplo == Uplo::Lower ? min( m, j ) : 0);
+        i1 = (uplo == Uplo::Upper ? min( m, j + 1 ) : m);
+    };
+
+    // Chunks balance triangles; trapezoids are close enough.
+    int64_t entries = (uplo != Uplo::General && m == n ? n*(n + 1)/2 : m*n);
+    bool stream = int64_t( entries * sizeof( scalar_t ) ) > internal::llc_size();
+    std::vector< int64_t > cols = internal::column_chunks(
+        m == n ? uplo : Uplo::General, n, entries );
+    int64_t nchunks = cols.size() - 1;
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            int64_t i0, i1;
+            col_rows( j, i0, i1 );
+            kernels.copy( i1 - i0, &A[ i0 + j*lda ], &B[ i0 + j*ldb ], stream );
+        }
+        if (stream)
+            kernels.fence();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Matrix copy using the given method.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    lapack::Method method )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    if (method == Method::Lapack)
+        lapack::lacpy( matrixtype, m, n, A, lda, B, ldb );
+    else
+        lacpy_native( matrixtype, m, n, A, lda, B, ldb );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Copies all or part of a two-dimensional matrix A to another
+/// matrix B, as `lapack::lacpy` does, using the given method:
+///
+/// - Method::Lapack: calls LAPACK lacpy, which is single-threaded.
+///
+/// - Method::Native: uses SIMD kernels for the instruction set from
+///   `lapack::simd_get`, with OpenMP threads over chunks of columns
+///   with about the same number of copied entries once A has enough
+///   entries. If the copied part of B is larger than the last level
+///   cache, B is written with non-temporal (streaming) stores,
+///   which bypass the cache instead of evicting A and other data.
+///
+/// Both give identical results.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] matrixtype
+///     Specifies the part of the matrix A to be copied to B.
+///     - lapack::MatrixType::Upper: Upper triangular part
+///     - lapack::MatrixType::Lower: Lower triangular part
+///     - lapack::MatrixType::General: All of the matrix A
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     - If matrixtype = Upper, only the upper trapezium is accessed;
+///     - if matrixtype = Lower, only the lower trapezium is accessed.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] B
+///     The m-by-n matrix B, stored in an ldb-by-n array.
+///     On exit, $B = A$ in the locations specified by matrixtype.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup initialize
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb,
+    lapack::Method method )
+{
+    impl::lacpy( matrixtype, m, n, A, lda, B, ldb, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup initialize
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb,
+    lapack::Method method )
+{
+    impl::lacpy( matrixtype, m, n, A, lda, B, ldb, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup initialize
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    lapack::Method method )
+{
+    impl::lacpy( matrixtype, m, n, A, lda, B, ldb, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup initialize
+void lacpy(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    lapack::Method method )
+{
+    impl::lacpy( matrixtype, m, n, A, lda, B, ldb, method );
+}
+
+}  // namespace lapack
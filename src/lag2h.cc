@@ -0,0 +1,347 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+
+namespace {
+
+// Convert in parallel only when the matrix is big enough to amortize
+// starting threads; conversion is memory bound.
+const int64_t parallel_threshold = 64 * 1024;
+
+//------------------------------------------------------------------------------
+/// Rounds double to float, rounding to odd (setting the last bit) if
+/// inexact. A second rounding of the result to float16 or bfloat16, which
+/// have at least 2 fewer mantissa bits, is then correctly rounded, unlike
+/// rounding double to float to nearest, then to float16.
+inline float round_to_odd( double x )
+{
+    float y = float( x );
+    uint32_t bits = internal::float_to_bits( y );
+    bool inexact = double( y ) != x;
+    bool away = std::abs( double( y ) ) > std::abs( x );
+    // If y was rounded away from zero, truncate toward zero instead.
+    bits -= uint32_t( inexact && away );
+    bits |= uint32_t( inexact );
+    return internal::bits_to_float( bits );
+}
+
+inline float to_float( float x )  { return x; }
+inline float to_float( double x ) { return round_to_odd( x ); }
+
+// Conversions on the raw bits, by the 16-bit type.
+// Loops over uint16_t vectorize, unlike loops storing the class types.
+template <typename half_t>
+struct Bits;
+
+template <>
+struct Bits< lapack::float16 > {
+    static uint16_t from_float( float x )
+        { return internal::float_to_half_bits( x ); }
+    static float to_float( uint16_t h )
+        { return internal::half_bits_to_float( h ); }
+};
+
+template <>
+struct Bits< lapack::bfloat16 > {
+    static uint16_t from_float( float x )
+        { return internal::float_to_bfloat16_bits( x ); }
+    static float to_float( uint16_t h )
+        { return internal::bfloat16_bits_to_float( h ); }
+};
+
+//------------------------------------------------------------------------------
+/// Narrows m-by-n A to half_t (float16 or bfloat16) in H.
+/// @return 1 if an entry of A is outside the range of half_t, else 0.
+template <typename half_t, typename scalar_t>
+int64_t narrow_half(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    half_t* H, int64_t ldh )
+{
+    static_assert( sizeof( half_t ) == sizeof( uint16_t ),
+                   "half_t must be 16 bits" );
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldh < max( 1, m ) );
+
+    const scalar_t rmax = half_t::max();
+    uint16_t* Hbits = reinterpret_cast< uint16_t* >( H );
+    int overflow = 0;
+
+    #pragma omp parallel for schedule( static ) reduction( |: overflow ) \
+                if (m*n >= parallel_threshold)
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t const* Aj = &A[ j*lda ];
+        uint16_t* Hj = &Hbits[ j*ldh ];
+        int col_overflow = 0;
+        #pragma omp simd reduction( |: col_overflow )
+        for (int64_t i = 0; i < m; ++i) {
+            // As in LAPACK lag2s, NaN does not count as overflow.
+            col_overflow |= int( std::abs( Aj[ i ] ) > rmax );
+            Hj[ i ] = Bits< half_t >::from_float( to_float( Aj[ i ] ) );
+        }
+        overflow |= col_overflow;
+    }
+    return overflow;
+}
+
+//------------------------------------------------------------------------------
+/// Widens m-by-n half_t (float16 or bfloat16) H to A, which is exact.
+template <typename half_t, typename scalar_t>
+int64_t widen_half(
+    int64_t m, int64_t n,
+    half_t const* H, int64_t ldh,
+    scalar_t* A, int64_t lda )
+{
+    static_assert( sizeof( half_t ) == sizeof( uint16_t ),
+                   "half_t must be 16 bits" );
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldh < max( 1, m ) );
+    lapack_error_if( lda < max( 1, m ) );
+
+    uint16_t const* Hbits = reinterpret_cast< uint16_t const* >( H );
+
+    #pragma omp parallel for schedule( static ) \
+                if (m*n >= parallel_threshold)
+    for (int64_t j = 0; j < n; ++j) {
+        uint16_t const* Hj = &Hbits[ j*ldh ];
+        scalar_t* Aj = &A[ j*lda ];
+        #pragma omp simd
+        for (int64_t i = 0; i < m; ++i) {
+            Aj[ i ] = scalar_t( Bits< half_t >::to_float( Hj[ i ] ) );
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+int64_t lag2h(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::float16* H, int64_t ldh )
+{
+    return narrow_half( m, n, A, lda, H, ldh );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a float or double matrix A to a half precision matrix H,
+/// rounding to nearest. As in lag2s, values of A with magnitude greater than
+/// the largest half precision value, 65504, are reported as overflow.
+/// Double is rounded to float with round-to-odd, then to half. Since
+/// float has 13 more mantissa bits than half, the odd last bit keeps
+/// values that were inexact in double off the half rounding midpoints,
+/// so the result is the correctly rounded half value. Rounding to
+/// nearest in both steps could round twice, e.g., up to a midpoint,
+/// then up again.
+///
+/// Unlike LAPACK dlag2s, the whole matrix is converted even if
+/// some entries overflow. The conversion is vectorized, and
+/// multithreaded with OpenMP for large matrices.
+///
+/// Overloaded versions are available for
+/// `float` and `double`.
+///
+/// @param[in] m
+///     The number of lines of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] H
+///     The m-by-n matrix H, stored in an ldh-by-n array.
+///     On exit, H = A rounded to half precision.
+///
+/// @param[in] ldh
+///     The leading dimension of the array H. ldh >= max(1,m).
+///
+/// @return = 0: successful exit.
+/// @return = 1: an entry of A is out of half precision range;
+///              it is rounded to 65504 or infinity in H.
+///
+/// @see lag2s, lag2d to convert back.
+/// @ingroup initialize
+int64_t lag2h(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::float16* H, int64_t ldh )
+{
+    return narrow_half( m, n, A, lda, H, ldh );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+int64_t lag2b(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::bfloat16* H, int64_t ldh )
+{
+    return narrow_half( m, n, A, lda, H, ldh );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a float or double matrix A to a bfloat16 matrix H,
+/// rounding to nearest. Since bfloat16 has the range of float,
+/// only values of A with magnitude greater than the largest bfloat16 value,
+/// about 3.39e38, are reported as overflow. Rounding from double
+/// is correctly rounded.
+///
+/// The conversion is vectorized, and multithreaded with OpenMP for
+/// large matrices.
+///
+/// Overloaded versions are available for
+/// `float` and `double`.
+///
+/// @param[in] m
+///     The number of lines of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] H
+///     The m-by-n matrix H, stored in an ldh-by-n array.
+///     On exit, H = A rounded to bfloat16.
+///
+/// @param[in] ldh
+///     The leading dimension of the array H. ldh >= max(1,m).
+///
+/// @return = 0: successful exit.
+/// @return = 1: an entry of A is out of bfloat16 range;
+///              it is rounded to the largest value or infinity in H.
+///
+/// @see lag2s, lag2d to convert back.
+/// @ingroup initialize
+int64_t lag2b(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::bfloat16* H, int64_t ldh )
+{
+    return narrow_half( m, n, A, lda, H, ldh );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+int64_t lag2s(
+    int64_t m, int64_t n,
+    lapack::float16 const* H, int64_t ldh,
+    float* A, int64_t lda )
+{
+    return widen_half( m, n, H, ldh, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a half precision or bfloat16 matrix H to a float matrix A.
+/// The conversion is exact. It is vectorized, and multithreaded with OpenMP
+/// for large matrices.
+///
+/// Overloaded versions are available for
+/// `lapack::float16` and `lapack::bfloat16`.
+/// See also lag2s for double to float.
+///
+/// @param[in] m
+///     The number of lines of the matrix H. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix H. n >= 0.
+///
+/// @param[in] H
+///     The m-by-n matrix H, stored in an ldh-by-n array.
+///
+/// @param[in] ldh
+///     The leading dimension of the array H. ldh >= max(1,m).
+///
+/// @param[out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, A = H.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @return = 0: successful exit.
+///
+/// @ingroup initialize
+int64_t lag2s(
+    int64_t m, int64_t n,
+    lapack::bfloat16 const* H, int64_t ldh,
+    float* A, int64_t lda )
+{
+    return widen_half( m, n, H, ldh, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+int64_t lag2d(
+    int64_t m, int64_t n,
+    lapack::float16 const* H, int64_t ldh,
+    double* A, int64_t lda )
+{
+    return widen_half( m, n, H, ldh, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a half precision or bfloat16 matrix H to a double matrix A.
+/// The conversion is exact. It is vectorized, and multithreaded with OpenMP
+/// for large matrices.
+///
+/// Overloaded versions are available for
+/// `lapack::float16` and `lapack::bfloat16`.
+/// See also lag2d for float to double.
+///
+/// @param[in] m
+///     The number of lines of the matrix H. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix H. n >= 0.
+///
+/// @param[in] H
+///     The m-by-n matrix H, stored in an ldh-by-n array.
+///
+/// @param[in] ldh
+///     The leading dimension of the array H. ldh >= max(1,m).
+///
+/// @param[out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, A = H.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @return = 0: successful exit.
+///
+/// @ingroup initialize
+int64_t lag2d(
+    int64_t m, int64_t n,
+    lapack::bfloat16 const* H, int64_t ldh,
+    double* A, int64_t lda )
+{
+    return widen_half( m, n, H, ldh, A, lda );
+}
+
+}  // namespace lapack
@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "norm_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native general matrix norm, with SIMD kernels on each column.
+/// Max, one, and Frobenius norms are parallel over chunks of columns,
+/// the infinity norm over chunks of rows.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lange_native(
+    lapack::Norm norm, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (min( m, n ) == 0)
+        return 0;
+
+    auto const& kernels = internal::norm_kernels< scalar_t >();
+
+    if (norm == Norm::Inf) {
+        // Row sums, each chunk of rows summed across all columns.
+        std::vector< int64_t > rows = internal::column_chunks(
+            Uplo::General, m, m*n );
+        int64_t nchunks = rows.size() - 1;
+        std::vector< real_t > work( m, 0 );
+
+        #pragma omp parallel for schedule( static ) if (nchunks > 1)
+        for (int64_t t = 0; t < nchunks; ++t) {
+            int64_t i0 = rows[ t ];
+            int64_t mb = rows[ t+1 ] - i0;
+            for (int64_t j = 0; j < n; ++j)
+                kernels.add_abs( mb, &A[ i0 + j*lda ], &work[ i0 ] );
+        }
+
+        real_t value = 0;
+        for (int64_t i = 0; i < m; ++i)
+            internal::max_nan( value, work[ i ] );
+        return value;
+    }
+
+    // Max, one, and Frobenius norms; chunks are merged in order.
+    std::vector< int64_t > cols = internal::column_chunks(
+        Uplo::General, n, m*n );
+    int64_t nchunks = cols.size() - 1;
+    std::vector< real_t > values( nchunks, 0 );
+    std::vector< internal::SumSquares > sums( nchunks );
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        real_t value = 0;
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            scalar_t const* Aj = &A[ j*lda ];
+            if (norm == Norm::Max)
+                internal::max_nan( value, kernels.max_abs( m, Aj ) );
+            else if (norm == Norm::One)
+                internal::max_nan( value, kernels.sum_abs( m, Aj ) );
+            else
+                kernels.sum_squares( m, Aj, sums[ t ] );
+        }
+        values[ t ] = value;
+    }
+
+    if (norm == Norm::Fro) {
+        internal::SumSquares ss;
+        for (int64_t t = 0; t < nchunks; ++t)
+            ss += sums[ t ];
+        return real_t( ss.norm() );
+    }
+    real_t value = 0;
+    for (int64_t t = 0; t < nchunks; ++t)
+        internal::max_nan( value, values[ t ] );
+    return value;
+}
+
+//------------------------------------------------------------------------------
+/// General matrix norm using the given method.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    lapack::Method method )
+{
+    lapack_error_if( norm != Norm::Max &&
+                     norm != Norm::One &&
+                     norm != Norm::Inf &&
+                     norm != Norm::Fro );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    if (method == Method::Lapack)
+        return lapack::lange( norm, m, n, A, lda );
+    return lange_native( norm, m, n, A, lda );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Returns the value of the one norm, Frobenius norm,
+/// infinity norm, or the element of largest absolute value of a
+/// general m-by-n matrix A, as `lapack::lange` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK lange, which is single-threaded.
+///
+/// - Method::Native: uses SIMD kernels for the instruction set from
+///   `lapack::simd_get`, with OpenMP threads over chunks of columns
+///   (rows for the infinity norm) once A has enough entries.
+///   The Frobenius norm sums squares in Blue's scaled accumulators, as
+///   LAPACK's lassq does, merging the partial sums of each chunk,
+///   so it doesn't overflow or underflow unless the result does.
+///   Chunks depend only on the number of threads, so results are
+///   reproducible for a given number of threads.
+///
+/// Both return NaN if A has a NaN entry. Sums can differ in rounding.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] norm
+///     The value to be returned:
+///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
+///                          Note this is not a consistent matrix norm.
+///     - lapack::Norm::One: one norm: maximum column sum
+///     - lapack::Norm::Inf: infinity norm: maximum row sum
+///     - lapack::Norm::Fro: Frobenius norm: square root of sum of squares
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///     When m = 0, returns zero.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///     When n = 0, returns zero.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(m,1).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup norm
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lange( norm, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup norm
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lange( norm, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup norm
+float lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lange( norm, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup norm
+double lange(
+    lapack::Norm norm, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lange( norm, m, n, A, lda, method );
+}
+
+}  // namespace lapack
@@ -0,0 +1,303 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "norm_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native symmetric or Hermitian matrix norm, with SIMD kernels on the
+/// strictly upper or lower part of each column, parallel over chunks of
+/// columns with about the same number of entries.
+/// If hermitian, diagonal entries are taken as real.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lansy_native(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda, bool hermitian )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (n == 0)
+        return 0;
+
+    auto const& kernels = internal::norm_kernels< scalar_t >();
+    bool upper = (uplo == Uplo::Upper);
+
+    std::vector< int64_t > cols = internal::column_chunks(
+        uplo, n, n*(n + 1)/2 );
+    int64_t nchunks = cols.size() - 1;
+
+    // |A(j, j)|
+    auto diag_abs = [&]( int64_t j ) -> real_t {
+        scalar_t ajj = A[ j + j*lda ];
+        return hermitian ? std::abs( real( ajj ) ) : std::abs( ajj );
+    };
+
+    if (norm == Norm::One || norm == Norm::Inf) {
+        // Each off-diagonal entry adds to its row and column sum.
+        // Each chunk sums into its own work, to avoid races.
+        std::vector< real_t > work( nchunks*n, 0 );
+
+        #pragma omp parallel for schedule( static ) if (nchunks > 1)
+        for (int64_t t = 0; t < nchunks; ++t) {
+            real_t* w = &work[ t*n ];
+            for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+                int64_t i0 = (upper ? 0 : j + 1);
+                int64_t mb = (upper ? j : n - j - 1);
+                real_t sum = kernels.sum_add_abs(
+                    mb, &A[ i0 + j*lda ], &w[ i0 ] );
+                w[ j ] += sum + diag_abs( j );
+            }
+        }
+
+        real_t value = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            real_t sum = 0;
+            for (int64_t t = 0; t < nchunks; ++t)
+                sum += work[ i + t*n ];
+            internal::max_nan( value, sum );
+        }
+        return value;
+    }
+
+    // Max and Frobenius norms; chunks are merged in order.
+    std::vector< real_t > values( nchunks, 0 );
+    std::vector< internal::SumSquares > offdiag( nchunks );
+    std::vector< internal::SumSquares > diag( nchunks );
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        real_t value = 0;
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            int64_t i0 = (upper ? 0 : j + 1);
+            int64_t mb = (upper ? j : n - j - 1);
+            scalar_t const* Aj = &A[ i0 + j*lda ];
+            if (norm == Norm::Max) {
+                internal::max_nan( value, kernels.max_abs( mb, Aj ) );
+                internal::max_nan( value, diag_abs( j ) );
+            }
+            else {
+                kernels.sum_squares( mb, Aj, offdiag[ t ] );
+                scalar_t ajj = A[ j + j*lda ];
+                diag[ t ].add( real( ajj ) );
+                if constexpr (blas::is_complex< scalar_t >::value) {
+                    if (! hermitian)
+                        diag[ t ].add( imag( ajj ) );
+                }
+            }
+        }
+        values[ t ] = value;
+    }
+
+    if (norm == Norm::Fro) {
+        // off-diagonal entries are counted twice
+        internal::SumSquares ss;
+        for (int64_t t = 0; t < nchunks; ++t)
+            ss += offdiag[ t ];
+        ss += ss;
+        for (int64_t t = 0; t < nchunks; ++t)
+            ss += diag[ t ];
+        return real_t( ss.norm() );
+    }
+    real_t value = 0;
+    for (int64_t t = 0; t < nchunks; ++t)
+        internal::max_nan( value, values[ t ] );
+    return value;
+}
+
+//------------------------------------------------------------------------------
+/// Symmetric or Hermitian matrix norm using the given method.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda,
+    lapack::Method method, bool hermitian )
+{
+    lapack_error_if( norm != Norm::Max &&
+                     norm != Norm::One &&
+                     norm != Norm::Inf &&
+                     norm != Norm::Fro );
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    if (method == Method::Lapack) {
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            if (hermitian)
+                return lapack::lanhe( norm, uplo, n, A, lda );
+        }
+        return lapack::lansy( norm, uplo, n, A, lda );
+    }
+    return lansy_native( norm, uplo, n, A, lda, hermitian );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Returns the value of the one norm, Frobenius norm,
+/// infinity norm, or the element of largest absolute value of a
+/// symmetric n-by-n matrix A, as `lapack::lansy` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK lansy, which is single-threaded.
+///
+/// - Method::Native: uses SIMD kernels for the instruction set from
+///   `lapack::simd_get`, with OpenMP threads over chunks of columns
+///   with about the same number of entries of the stored triangle.
+///   The one and infinity norms, equal for symmetric matrices, add each
+///   off-diagonal entry to its row and column sums in one pass.
+///   The Frobenius norm sums squares in Blue's scaled accumulators, as
+///   LAPACK's lassq does, merging the partial sums of each chunk.
+///
+/// Both return NaN if A has a NaN entry. Sums can differ in rounding.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] norm
+///     The value to be returned:
+///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
+///                          Note this is not a consistent matrix norm.
+///     - lapack::Norm::One: one norm: maximum column sum
+///     - lapack::Norm::Inf: infinity norm: maximum row sum
+///     - lapack::Norm::Fro: Frobenius norm: square root of sum of squares
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangular part of the
+///     symmetric matrix A is to be referenced.
+///     - lapack::Uplo::Upper: Upper triangular part of A is referenced
+///     - lapack::Uplo::Lower: Lower triangular part of A is referenced
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0. When n = 0, returns zero.
+///
+/// @param[in] A
+///     The n-by-n symmetric matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(n,1).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup norm
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, false );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup norm
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, false );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup norm
+float lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, false );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup norm
+double lansy(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, false );
+}
+
+//==============================================================================
+/// Returns the value of the one norm, Frobenius norm,
+/// infinity norm, or the element of largest absolute value of a
+/// Hermitian n-by-n matrix A, as `lapack::lanhe` does,
+/// using the given method, as in `lapack::lansy` with a method.
+/// Imaginary parts of diagonal entries are assumed zero and not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::lansy`.
+///
+/// @param[in] norm
+///     The value to be returned:
+///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
+///                          Note this is not a consistent matrix norm.
+///     - lapack::Norm::One: one norm: maximum column sum
+///     - lapack::Norm::Inf: infinity norm: maximum row sum
+///     - lapack::Norm::Fro: Frobenius norm: square root of sum of squares
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangular part of the
+///     Hermitian matrix A is to be referenced.
+///     - lapack::Uplo::Upper: Upper triangular part of A is referenced
+///     - lapack::Uplo::Lower: Lower triangular part of A is referenced
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0. When n = 0, returns zero.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(n,1).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup norm
+float lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, true );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup norm
+double lanhe(
+    lapack::Norm norm, lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lansy( norm, uplo, n, A, lda, method, true );
+}
+
+}  // namespace lapack
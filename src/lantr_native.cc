@@ -0,0 +1,262 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "norm_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native trapezoidal matrix norm, with SIMD kernels on the stored part
+/// of each column, parallel over chunks of columns.
+/// Unit diagonal entries are not referenced and are added as ones,
+/// following LAPACK's lantr exactly, including rows and columns
+/// beyond the diagonal of a trapezoid.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lantr_native(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (min( m, n ) == 0)
+        return 0;
+
+    auto const& kernels = internal::norm_kernels< scalar_t >();
+    bool upper = (uplo == Uplo::Upper);
+    bool unit  = (diag == Diag::Unit);
+
+    // Stored rows [i0, i0 + mb) of column j, without a unit diagonal.
+    auto col_rows = [&]( int64_t j, int64_t& i0, int64_t& mb ) {
+        int64_t i1;
+        if (upper) {
+            i0 = 0;
+            i1 = min( m, unit ? j : j + 1 );
+        }
+        else {
+            i0 = min( m, unit ? j + 1 : j );
+            i1 = m;
+        }
+        mb = max( 0, i1 - i0 );
+    };
+
+    // Chunks balance triangles; trapezoids are close enough.
+    int64_t entries = (m == n ? n*(n + 1)/2 : m*n);
+    std::vector< int64_t > cols = internal::column_chunks(
+        m == n ? uplo : Uplo::General, n, entries );
+    int64_t nchunks = cols.size() - 1;
+
+    if (norm == Norm::Inf) {
+        // Each chunk sums its columns into its own work, to avoid races.
+        std::vector< real_t > work( nchunks*m, 0 );
+
+        #pragma omp parallel for schedule( static ) if (nchunks > 1)
+        for (int64_t t = 0; t < nchunks; ++t) {
+            real_t* w = &work[ t*m ];
+            for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+                int64_t i0, mb;
+                col_rows( j, i0, mb );
+                kernels.add_abs( mb, &A[ i0 + j*lda ], &w[ i0 ] );
+            }
+        }
+
+        // As in lantr, unit upper adds 1 to all m rows,
+        // unit lower only to the first min( m, n ) rows.
+        int64_t unit_rows = (! unit ? 0 : (upper ? m : min( m, n )));
+        real_t value = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            real_t sum = (i < unit_rows ? 1 : 0);
+            for (int64_t t = 0; t < nchunks; ++t)
+                sum += work[ i + t*m ];
+            internal::max_nan( value, sum );
+        }
+        return value;
+    }
+
+    // Max, one, and Frobenius norms; chunks are merged in order.
+    std::vector< real_t > values( nchunks, 0 );
+    std::vector< internal::SumSquares > sums( nchunks );
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        real_t value = 0;
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            int64_t i0, mb;
+            col_rows( j, i0, mb );
+            scalar_t const* Aj = &A[ i0 + j*lda ];
+            if (norm == Norm::Max) {
+                internal::max_nan( value, kernels.max_abs( mb, Aj ) );
+            }
+            else if (norm == Norm::One) {
+                // As in lantr, unit upper adds 1 only if j < m,
+                // unit lower to every column.
+                real_t sum = kernels.sum_abs( mb, Aj );
+                if (unit && (! upper || j < m))
+                    sum += 1;
+                internal::max_nan( value, sum );
+            }
+            else {
+                kernels.sum_squares( mb, Aj, sums[ t ] );
+            }
+        }
+        values[ t ] = value;
+    }
+
+    if (norm == Norm::Fro) {
+        internal::SumSquares ss;
+        if (unit)
+            ss.med = double( min( m, n ) );
+        for (int64_t t = 0; t < nchunks; ++t)
+            ss += sums[ t ];
+        return real_t( ss.norm() );
+    }
+    real_t value = (unit && norm == Norm::Max ? 1 : 0);
+    for (int64_t t = 0; t < nchunks; ++t)
+        internal::max_nan( value, values[ t ] );
+    return value;
+}
+
+//------------------------------------------------------------------------------
+/// Trapezoidal matrix norm using the given method.
+/// @ingroup norm
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    lapack::Method method )
+{
+    lapack_error_if( norm != Norm::Max &&
+                     norm != Norm::One &&
+                     norm != Norm::Inf &&
+                     norm != Norm::Fro );
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( diag != Diag::NonUnit &&
+                     diag != Diag::Unit );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    if (method == Method::Lapack)
+        return lapack::lantr( norm, uplo, diag, m, n, A, lda );
+    return lantr_native( norm, uplo, diag, m, n, A, lda );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Returns the value of the one norm, Frobenius norm,
+/// infinity norm, or the element of largest absolute value of a
+/// trapezoidal or triangular matrix A, as `lapack::lantr` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK lantr, which is single-threaded.
+///
+/// - Method::Native: uses SIMD kernels for the instruction set from
+///   `lapack::simd_get`, with OpenMP threads over chunks of columns
+///   with about the same number of stored entries.
+///   The Frobenius norm sums squares in Blue's scaled accumulators, as
+///   LAPACK's lassq does, merging the partial sums of each chunk.
+///
+/// Both return NaN if A has a NaN entry. Sums can differ in rounding.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] norm
+///     The value to be returned:
+///     - lapack::Norm::Max: max norm: max(abs(A(i,j))).
+///                          Note this is not a consistent matrix norm.
+///     - lapack::Norm::One: one norm: maximum column sum
+///     - lapack::Norm::Inf: infinity norm: maximum row sum
+///     - lapack::Norm::Fro: Frobenius norm: square root of sum of squares
+///
+/// @param[in] uplo
+///     Whether the matrix A is upper or lower trapezoidal.
+///     - lapack::Uplo::Upper: Upper trapezoidal
+///     - lapack::Uplo::Lower: Lower trapezoidal
+///     Note that A is triangular instead of trapezoidal if m = n.
+///
+/// @param[in] diag
+///     Whether or not the matrix A has unit diagonal.
+///     - lapack::Diag::NonUnit: Non-unit diagonal
+///     - lapack::Diag::Unit: Unit diagonal
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0, and if
+///     uplo = Upper, m <= n. When m = 0, returns zero.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0, and if
+///     uplo = Lower, n <= m. When n = 0, returns zero.
+///
+/// @param[in] A
+///     The trapezoidal matrix A, stored in an lda-by-n array.
+///     Only the uplo trapezoid is referenced. If diag = Unit,
+///     the diagonal elements of A are not referenced and are
+///     assumed to be one.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(m,1).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup norm
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lantr( norm, uplo, diag, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup norm
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lantr( norm, uplo, diag, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup norm
+float lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lantr( norm, uplo, diag, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup norm
+double lantr(
+    lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lantr( norm, uplo, diag, m, n, A, lda, method );
+}
+
+}  // namespace lapack
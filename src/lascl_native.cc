@@ -0,0 +1,290 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "copy_kernels.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native matrix scaling by cto/cfrom, with SIMD kernels on the stored part
+/// of each column, parallel over chunks of columns with about the same
+/// number of entries.
+/// The multipliers are computed exactly as in LAPACK's lascl, but all are
+/// applied to each column in one pass, instead of one pass over A per
+/// multiplier.
+/// @ingroup auxiliary
+///
+template <typename scalar_t>
+void lascl_native(
+    lapack::MatrixType matrixtype,
+    blas::real_type< scalar_t > cfrom, blas::real_type< scalar_t > cto,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (min( m, n ) == 0)
+        return;
+
+    // Multipliers, as in LAPACK's lascl.
+    const real_t smlnum = std::numeric_limits< real_t >::min();
+    const real_t bignum = 1 / smlnum;
+    std::vector< real_t > muls;
+    real_t cfromc = cfrom;
+    real_t ctoc = cto;
+    bool done = false;
+    while (! done) {
+        real_t mul;
+        real_t cfrom1 = cfromc * smlnum;
+        if (cfrom1 == cfromc) {
+            // cfromc is inf. Multiply by a correctly signed zero for
+            // finite ctoc, or NaN if ctoc is inf.
+            mul = ctoc / cfromc;
+            done = true;
+        }
+        else {
+            real_t cto1 = ctoc / bignum;
+            if (cto1 == ctoc) {
+                // ctoc is 0 or inf, and is itself the multiplier.
+                mul = ctoc;
+                done = true;
+            }
+            else if (std::abs( cfrom1 ) > std::abs( ctoc ) && ctoc != 0) {
+                mul = smlnum;
+                cfromc = cfrom1;
+            }
+            else if (std::abs( cto1 ) > std::abs( cfromc )) {
+                mul = bignum;
+                ctoc = cto1;
+            }
+            else {
+                mul = ctoc / cfromc;
+                done = true;
+                if (mul == 1)
+                    break;
+            }
+        }
+        muls.push_back( mul );
+    }
+    if (muls.empty())
+        return;
+
+    auto const& kernels = internal::copy_kernels< scalar_t >();
+
+    Uplo uplo = Uplo::General;
+    if (matrixtype == MatrixType::Upper || matrixtype == MatrixType::Hessenberg)
+        uplo = Uplo::Upper;
+    else if (matrixtype == MatrixType::Lower)
+        uplo = Uplo::Lower;
+
+    // Rows [i0, i1) of column j.
+    int64_t kd = (matrixtype == MatrixType::Hessenberg ? 2 : 1);
+    auto col_rows = [&]( int64_t j, int64_t& i0, int64_t& i1 ) {
+        i0 = (uplo == Uplo::Lower ? min( m, j ) : 0);
+        i1 = (uplo == Uplo::Upper ? min( m, j + kd ) : m);
+    };
+
+    // Chunks balance triangles; trapezoids are close enough.
+    int64_t entries = (uplo != Uplo::General && m == n ? n*(n + 1)/2 : m*n);
+    std::vector< int64_t > cols = internal::column_chunks(
+        m == n ? uplo : Uplo::General, n, entries );
+    int64_t nchunks = cols.size() - 1;
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            int64_t i0, i1;
+            col_rows( j, i0, i1 );
+            for (real_t mul : muls)
+                kernels.scale( i1 - i0, mul, &A[ i0 + j*lda ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Matrix scaling using the given method.
+/// @ingroup auxiliary
+///
+template <typename scalar_t>
+int64_t lascl(
+    lapack::MatrixType matrixtype, int64_t kl, int64_t ku,
+    blas::real_type< scalar_t > cfrom, blas::real_type< scalar_t > cto,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    lapack::Method method )
+{
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    // Band types aren't column-contiguous in the same way; use LAPACK.
+    if (method == Method::Lapack
+        || (matrixtype != MatrixType::General
+            && matrixtype != MatrixType::Lower
+            && matrixtype != MatrixType::Upper
+            && matrixtype != MatrixType::Hessenberg)) {
+        return lapack::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda );
+    }
+
+    lapack_error_if( cfrom == 0 || std::isnan( cfrom ) );
+    lapack_error_if( std::isnan( cto ) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    lascl_native( matrixtype, cfrom, cto, m, n, A, lda );
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Multiplies the m-by-n matrix A by the real scalar cto / cfrom,
+/// as `lapack::lascl` does, using the given method:
+///
+/// - Method::Lapack: calls LAPACK lascl, which is single-threaded.
+///
+/// - Method::Native: for General, Lower, Upper, and Hessenberg types,
+///   uses SIMD kernels for the instruction set from `lapack::simd_get`,
+///   with OpenMP threads over chunks of columns with about the same
+///   number of scaled entries once A has enough entries. When cto / cfrom
+///   needs several multipliers to avoid over/underflow, all are applied
+///   to each column while it is in cache, rather than in separate passes
+///   over A. Band types call LAPACK.
+///
+/// Both give identical results for real A. For complex A, the native
+/// method multiplies real and imaginary parts by each real multiplier,
+/// whereas LAPACK may do a complex multiply by (mul, 0), so results can
+/// differ in the sign of zeros, and LAPACK can give NaN from inf * 0 where
+/// an intermediate result overflows. A is scaled in place,
+/// so streaming stores aren't used.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] matrixtype
+///     type indices the storage type of the input matrix.
+///     - lapack::MatrixType::General:
+///         A is a full matrix.
+///
+///     - lapack::MatrixType::Lower:
+///         A is a lower triangular matrix.
+///
+///     - lapack::MatrixType::Upper:
+///         A is an upper triangular matrix.
+///
+///     - lapack::MatrixType::Hessenberg:
+///         A is an upper Hessenberg matrix.
+///
+///     - lapack::MatrixType::LowerBand:
+///         A is a symmetric band matrix with lower bandwidth kl
+///         and upper bandwidth ku and with the only the lower
+///         half stored.
+///
+///     - lapack::MatrixType::UpperBand:
+///         A is a symmetric band matrix with lower bandwidth kl
+///         and upper bandwidth ku and with the only the upper
+///         half stored.
+///
+///     - lapack::MatrixType::Band:
+///         A is a band matrix with lower bandwidth kl and upper
+///         bandwidth ku. See `lapack::gbtrf` for storage details.
+///
+/// @param[in] kl
+///     The lower bandwidth of A.
+///     Referenced only if type = LowerBand, UpperBand, or Band.
+///
+/// @param[in] ku
+///     The upper bandwidth of A.
+///     Referenced only if type = LowerBand, UpperBand, or Band.
+///
+/// @param[in] cfrom
+///
+/// @param[in] cto
+///     The matrix A is multiplied by cto/cfrom. A(i,j) is computed
+///     without over/underflow if the final result cto*A(i,j)/cfrom
+///     can be represented without over/underflow. cfrom must be
+///     nonzero.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     The matrix to be multiplied by cto/cfrom. See matrixtype for the
+///     storage type.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     - If matrixtype = General, Lower, Upper, or Hessenberg, lda >= max(1,m);
+///     - if matrixtype = LowerBand, lda >= kl+1;
+///     - if matrixtype = UpperBand, lda >= ku+1;
+///     - if matrixtype = Band, lda >= 2*kl+ku+1.
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup auxiliary
+int64_t lascl(
+    lapack::MatrixType matrixtype, int64_t kl, int64_t ku,
+    float cfrom, float cto, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup auxiliary
+int64_t lascl(
+    lapack::MatrixType matrixtype, int64_t kl, int64_t ku,
+    double cfrom, double cto, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup auxiliary
+int64_t lascl(
+    lapack::MatrixType matrixtype, int64_t kl, int64_t ku,
+    float cfrom, float cto, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup auxiliary
+int64_t lascl(
+    lapack::MatrixType matrixtype, int64_t kl, int64_t ku,
+    double cfrom, double cto, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::lascl( matrixtype, kl, ku, cfrom, cto, m, n, A, lda, method );
+}
+
+}  // namespace lapack
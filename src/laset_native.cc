@@ -0,0 +1,194 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "copy_kernels.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Native matrix initialization, with SIMD kernels on the set part of each
+/// column, parallel over chunks of columns with about the same number
+/// of entries. Uses streaming stores if A is larger than the last level cache.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void laset_native(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t offdiag, scalar_t diag,
+    scalar_t* A, int64_t lda )
+{
+    if (min( m, n ) == 0)
+        return;
+
+    auto const& kernels = internal::copy_kernels< scalar_t >();
+
+    // As in LAPACK, any type but Upper or Lower sets all of A.
+    Uplo uplo = Uplo::General;
+    if (matrixtype == MatrixType::Upper)
+        uplo = Uplo::Upper;
+    else if (matrixtype == MatrixType::Lower)
+        uplo = Uplo::Lower;
+
+    // Chunks balance triangles; trapezoids are close enough.
+    int64_t entries = (uplo != Uplo::General && m == n ? n*(n + 1)/2 : m*n);
+    bool stream = int64_t( entries * sizeof( scalar_t ) ) > internal::llc_size();
+    std::vector< int64_t > cols = internal::column_chunks(
+        m == n ? uplo : Uplo::General, n, entries );
+    int64_t nchunks = cols.size() - 1;
+
+    #pragma omp parallel for schedule( static ) if (nchunks > 1)
+    for (int64_t t = 0; t < nchunks; ++t) {
+        for (int64_t j = cols[ t ]; j < cols[ t+1 ]; ++j) {
+            scalar_t* Aj = &A[ j*lda ];
+            // strictly upper rows [0, min( j, m ))
+            if (uplo != Uplo::Lower)
+                kernels.set( min( j, m ), offdiag, Aj, stream );
+            if (j < m)
+                Aj[ j ] = diag;
+            // strictly lower rows [j + 1, m)
+            if (uplo != Uplo::Upper && j + 1 < m)
+                kernels.set( m - j - 1, offdiag, &Aj[ j + 1 ], stream );
+        }
+        if (stream)
+            kernels.fence();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Matrix initialization using the given method.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    scalar_t offdiag, scalar_t diag,
+    scalar_t* A, int64_t lda,
+    lapack::Method method )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Native );
+
+    if (method == Method::Lapack)
+        lapack::laset( matrixtype, m, n, offdiag, diag, A, lda );
+    else
+        laset_native( matrixtype, m, n, offdiag, diag, A, lda );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Initializes a 2-D array A to diag on the diagonal and
+/// offdiag on the offdiagonals, as `lapack::laset` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK laset, which is single-threaded.
+///
+/// - Method::Native: uses SIMD kernels for the instruction set from
+///   `lapack::simd_get`, with OpenMP threads over chunks of columns
+///   with about the same number of set entries once A has enough
+///   entries. If the set part of A is larger than the last level cache,
+///   A is written with non-temporal (streaming) stores, which don't
+///   read A into the cache before overwriting it.
+///
+/// Both give identical results.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] matrixtype
+///     Specifies the part of the matrix A to be set.
+///     - lapack::MatrixType::Upper:
+///         Upper triangular part is set. The lower triangle is unchanged.
+///
+///     - lapack::MatrixType::Lower:
+///         Lower triangular part is set. The upper triangle is unchanged.
+///
+///     - lapack::MatrixType::General:
+///         All of the matrix A is set.
+///
+/// @param[in] m
+///     On entry, m specifies the number of rows of A.
+///
+/// @param[in] n
+///     On entry, n specifies the number of columns of A.
+///
+/// @param[in] offdiag
+///     All the offdiagonal array elements are set to offdiag.
+///
+/// @param[in] diag
+///     All the diagonal array elements are set to diag.
+///
+/// @param[out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit,
+///     - A(i,j) = offdiag, 1 <= i <= m, 1 <= j <= n, i != j;
+///     - A(i,i) = diag, 1 <= i <= min(m,n)
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Native.
+///
+/// @ingroup initialize
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    float offdiag, float diag,
+    float* A, int64_t lda,
+    lapack::Method method )
+{
+    impl::laset( matrixtype, m, n, offdiag, diag, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup initialize
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    double offdiag, double diag,
+    double* A, int64_t lda,
+    lapack::Method method )
+{
+    impl::laset( matrixtype, m, n, offdiag, diag, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup initialize
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<float> offdiag, std::complex<float> diag,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method )
+{
+    impl::laset( matrixtype, m, n, offdiag, diag, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup initialize
+void laset(
+    lapack::MatrixType matrixtype, int64_t m, int64_t n,
+    std::complex<double> offdiag, std::complex<double> diag,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method )
+{
+    impl::laset( matrixtype, m, n, offdiag, diag, A, lda, method );
+}
+
+}  // namespace lapack
@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "norm_kernels.hh"
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Portable kernels. Real sums are simple loops the compiler can vectorize;
+// complex modulus uses std::abs, which avoids overflow like LAPACK's lapy2.
+
+template <typename scalar_t>
+blas::real_type< scalar_t > max_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t value = 0;
+    for (int64_t i = 0; i < m; ++i) {
+        real_t a = std::abs( x[ i ] );
+        if (std::isnan( a ))
+            return a;
+        value = std::max( value, a );
+    }
+    return value;
+}
+
+template <typename scalar_t>
+blas::real_type< scalar_t > sum_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t sum = 0;
+    for (int64_t i = 0; i < m; ++i)
+        sum += std::abs( x[ i ] );
+    return sum;
+}
+
+template <typename scalar_t>
+void add_abs( int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    for (int64_t i = 0; i < m; ++i)
+        work[ i ] += std::abs( x[ i ] );
+}
+
+template <typename scalar_t>
+blas::real_type< scalar_t > sum_add_abs(
+    int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t sum = 0;
+    for (int64_t i = 0; i < m; ++i) {
+        real_t a = std::abs( x[ i ] );
+        sum += a;
+        work[ i ] += a;
+    }
+    return sum;
+}
+
+template <typename scalar_t>
+void sum_squares( int64_t m, scalar_t const* x_, SumSquares& ss )
+{
+    // complex is summed as 2m real entries
+    using real_t = blas::real_type< scalar_t >;
+    real_t const* x = reinterpret_cast< real_t const* >( x_ );
+    int64_t mm = (blas::is_complex< scalar_t >::value ? 2*m : m);
+    for (int64_t i = 0; i < mm; ++i)
+        ss.add( x[ i ] );
+}
+
+template <typename scalar_t>
+NormKernels< scalar_t > const generic_kernels = {
+    max_abs< scalar_t >,
+    sum_abs< scalar_t >,
+    add_abs< scalar_t >,
+    sum_add_abs< scalar_t >,
+    sum_squares< scalar_t >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels_generic()
+{
+    return generic_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels()
+{
+    switch (simd_get()) {
+        #if defined( LAPACK_SIMD_X86 )
+            case Simd::AVX512:
+                return norm_kernels_avx512< scalar_t >();
+
+            case Simd::AVX2:
+                return norm_kernels_avx2< scalar_t >();
+        #endif
+
+        default:
+            return norm_kernels_generic< scalar_t >();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template NormKernels< float > const& norm_kernels();
+template NormKernels< double > const& norm_kernels();
+template NormKernels< std::complex<float> > const& norm_kernels();
+template NormKernels< std::complex<double> > const& norm_kernels();
+
+template NormKernels< float > const& norm_kernels_generic();
+template NormKernels< double > const& norm_kernels_generic();
+template NormKernels< std::complex<float> > const& norm_kernels_generic();
+template NormKernels< std::complex<double> > const& norm_kernels_generic();
+
+}  // namespace internal
+}  // namespace lapack
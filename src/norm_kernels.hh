@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_NORM_KERNELS_HH
+#define LAPACK_NORM_KERNELS_HH
+
+#include "lapack/util.hh"
+#include "simd_kernels.hh"
+
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Blue's scaling constants for double, from LAPACK's la_constants.f90.
+// Squares of entries |x| > tbig are summed as (x sbig)^2,
+// of entries |x| < tsml as (x ssml)^2, and others unscaled,
+// so no partial sum overflows or underflows harmfully.
+constexpr double blue_tsml = 0x1p-511;
+constexpr double blue_tbig = 0x1p486;
+constexpr double blue_ssml = 0x1p537;
+constexpr double blue_sbig = 0x1p-538;
+
+//------------------------------------------------------------------------------
+/// Sum of squares in Blue's three accumulators, as in LAPACK's lassq.
+/// Unlike lassq's (scale, sumsq) pair, partial sums of different columns or
+/// threads merge by adding the accumulators, in any order.
+/// Float entries are squared in double, which can't overflow or
+/// underflow harmfully, so they are summed in med.
+struct SumSquares
+{
+    double big = 0;
+    double med = 0;
+    double sml = 0;
+
+    SumSquares& operator += ( SumSquares const& other )
+    {
+        big += other.big;
+        med += other.med;
+        sml += other.sml;
+        return *this;
+    }
+
+    void add( double x )
+    {
+        double ax = std::abs( x );
+        if (ax > blue_tbig) {
+            ax *= blue_sbig;
+            big += ax*ax;
+        }
+        else if (ax < blue_tsml) {
+            ax *= blue_ssml;
+            sml += ax*ax;
+        }
+        else {
+            med += ax*ax;  // including NaN
+        }
+    }
+
+    void add( float x )
+    {
+        med += double( x ) * x;
+    }
+
+    /// Combines accumulators into (scale, sumsq), with sum of squares
+    /// scale^2 sumsq, as lassq does at its end.
+    void get( double* scale, double* sumsq ) const
+    {
+        if (big > 0) {
+            if (med > 0 || std::isnan( med ))
+                *sumsq = big + (med*blue_sbig)*blue_sbig;
+            else
+                *sumsq = big;
+            *scale = 1 / blue_sbig;
+        }
+        else if (sml > 0) {
+            if (med > 0 || std::isnan( med )) {
+                double ymed = std::sqrt( med );
+                double ysml = std::sqrt( sml ) / blue_ssml;
+                double ymax = std::max( ymed, ysml );
+                double ymin = std::min( ymed, ysml );
+                *scale = 1;
+                *sumsq = ymax*ymax*( 1 + (ymin/ymax)*(ymin/ymax) );
+            }
+            else {
+                *scale = 1 / blue_ssml;
+                *sumsq = sml;
+            }
+        }
+        else {
+            *scale = 1;
+            *sumsq = med;
+        }
+    }
+
+    /// @return sqrt( sum of squares ), the Frobenius norm.
+    double norm() const
+    {
+        double scale, sumsq;
+        get( &scale, &sumsq );
+        return scale * std::sqrt( sumsq );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Column kernels for native norms, one table per instruction set.
+/// |x| of complex x is the modulus, as in LAPACK's lange.
+template <typename scalar_t>
+struct NormKernels
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    /// @return max |x_i|, or NaN if some x_i is NaN.
+    real_t (*max_abs)( int64_t m, scalar_t const* x );
+
+    /// @return sum |x_i|.
+    real_t (*sum_abs)( int64_t m, scalar_t const* x );
+
+    /// Adds work_i += |x_i|.
+    void (*add_abs)( int64_t m, scalar_t const* x, real_t* work );
+
+    /// Adds work_i += |x_i|, and returns sum |x_i|, for symmetric norms,
+    /// where each entry is in both a row and a column.
+    real_t (*sum_add_abs)( int64_t m, scalar_t const* x, real_t* work );
+
+    /// Adds squares of x_i (real and imaginary parts) to ss.
+    void (*sum_squares)( int64_t m, scalar_t const* x, SumSquares& ss );
+};
+
+/// @return kernels for the instruction set from simd_get().
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels();
+
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels_generic();
+
+#if defined( LAPACK_SIMD_X86 )
+    template <typename scalar_t>
+    NormKernels< scalar_t > const& norm_kernels_avx2();
+
+    template <typename scalar_t>
+    NormKernels< scalar_t > const& norm_kernels_avx512();
+#endif
+
+//------------------------------------------------------------------------------
+/// Sets value = max( value, x ), keeping NaN once found,
+/// as LAPACK's norms do.
+template <typename real_t>
+inline void max_nan( real_t& value, real_t x )
+{
+    if (x > value || std::isnan( x ))
+        value = x;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_NORM_KERNELS_HH
@@ -0,0 +1,397 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "norm_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Vector operations, overloaded on __m256 (8 floats) and __m256d (4 doubles).
+// Comparisons return masks as vectors, with all bits set where true.
+
+template <typename real_t> struct Vec;
+
+template <>
+struct Vec< float > {
+    using type = __m256;
+    static constexpr int size = 8;
+};
+
+template <>
+struct Vec< double > {
+    using type = __m256d;
+    static constexpr int size = 4;
+};
+
+LAPACK_TARGET_AVX2 inline __m256  vload( float  const* x ) { return _mm256_loadu_ps( x ); }
+LAPACK_TARGET_AVX2 inline __m256d vload( double const* x ) { return _mm256_loadu_pd( x ); }
+
+LAPACK_TARGET_AVX2 inline void vstore( float*  x, __m256  v ) { _mm256_storeu_ps( x, v ); }
+LAPACK_TARGET_AVX2 inline void vstore( double* x, __m256d v ) { _mm256_storeu_pd( x, v ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vset1( float  a ) { return _mm256_set1_ps( a ); }
+LAPACK_TARGET_AVX2 inline __m256d vset1( double a ) { return _mm256_set1_pd( a ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vadd( __m256  a, __m256  b ) { return _mm256_add_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vadd( __m256d a, __m256d b ) { return _mm256_add_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vmul( __m256  a, __m256  b ) { return _mm256_mul_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vmul( __m256d a, __m256d b ) { return _mm256_mul_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vdiv( __m256  a, __m256  b ) { return _mm256_div_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vdiv( __m256d a, __m256d b ) { return _mm256_div_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vsqrt( __m256  a ) { return _mm256_sqrt_ps( a ); }
+LAPACK_TARGET_AVX2 inline __m256d vsqrt( __m256d a ) { return _mm256_sqrt_pd( a ); }
+
+/// @return a*b + c
+LAPACK_TARGET_AVX2 inline __m256  vfmadd( __m256  a, __m256  b, __m256  c ) { return _mm256_fmadd_ps( a, b, c ); }
+LAPACK_TARGET_AVX2 inline __m256d vfmadd( __m256d a, __m256d b, __m256d c ) { return _mm256_fmadd_pd( a, b, c ); }
+
+/// max and min return b if either is NaN.
+LAPACK_TARGET_AVX2 inline __m256  vmax( __m256  a, __m256  b ) { return _mm256_max_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vmax( __m256d a, __m256d b ) { return _mm256_max_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vmin( __m256  a, __m256  b ) { return _mm256_min_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vmin( __m256d a, __m256d b ) { return _mm256_min_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vabs( __m256  a ) { return _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), a ); }
+LAPACK_TARGET_AVX2 inline __m256d vabs( __m256d a ) { return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vgt( __m256  a, __m256  b ) { return _mm256_cmp_ps( a, b, _CMP_GT_OQ ); }
+LAPACK_TARGET_AVX2 inline __m256d vgt( __m256d a, __m256d b ) { return _mm256_cmp_pd( a, b, _CMP_GT_OQ ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vlt( __m256  a, __m256  b ) { return _mm256_cmp_ps( a, b, _CMP_LT_OQ ); }
+LAPACK_TARGET_AVX2 inline __m256d vlt( __m256d a, __m256d b ) { return _mm256_cmp_pd( a, b, _CMP_LT_OQ ); }
+
+/// true where a or b is NaN
+LAPACK_TARGET_AVX2 inline __m256  vunord( __m256  a, __m256  b ) { return _mm256_cmp_ps( a, b, _CMP_UNORD_Q ); }
+LAPACK_TARGET_AVX2 inline __m256d vunord( __m256d a, __m256d b ) { return _mm256_cmp_pd( a, b, _CMP_UNORD_Q ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vand( __m256  a, __m256  b ) { return _mm256_and_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vand( __m256d a, __m256d b ) { return _mm256_and_pd( a, b ); }
+
+LAPACK_TARGET_AVX2 inline __m256  vor( __m256  a, __m256  b ) { return _mm256_or_ps( a, b ); }
+LAPACK_TARGET_AVX2 inline __m256d vor( __m256d a, __m256d b ) { return _mm256_or_pd( a, b ); }
+
+/// @return mask ? a : b
+LAPACK_TARGET_AVX2 inline __m256  vselect( __m256  mask, __m256  a, __m256  b ) { return _mm256_blendv_ps( b, a, mask ); }
+LAPACK_TARGET_AVX2 inline __m256d vselect( __m256d mask, __m256d a, __m256d b ) { return _mm256_blendv_pd( b, a, mask ); }
+
+LAPACK_TARGET_AVX2 inline bool vany( __m256  mask ) { return _mm256_movemask_ps( mask ) != 0; }
+LAPACK_TARGET_AVX2 inline bool vany( __m256d mask ) { return _mm256_movemask_pd( mask ) != 0; }
+
+LAPACK_TARGET_AVX2 inline float hsum( __m256 a )
+{
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128( a ),
+                           _mm256_extractf128_ps( a, 1 ) );
+    s = _mm_add_ps( s, _mm_movehl_ps( s, s ) );
+    s = _mm_add_ss( s, _mm_movehdup_ps( s ) );
+    return _mm_cvtss_f32( s );
+}
+
+LAPACK_TARGET_AVX2 inline double hsum( __m256d a )
+{
+    __m128d s = _mm_add_pd( _mm256_castpd256_pd128( a ),
+                            _mm256_extractf128_pd( a, 1 ) );
+    s = _mm_add_sd( s, _mm_unpackhi_pd( s, s ) );
+    return _mm_cvtsd_f64( s );
+}
+
+/// Horizontal max, assuming no NaN.
+LAPACK_TARGET_AVX2 inline float hmax( __m256 a )
+{
+    __m128 s = _mm_max_ps( _mm256_castps256_ps128( a ),
+                           _mm256_extractf128_ps( a, 1 ) );
+    s = _mm_max_ps( s, _mm_movehl_ps( s, s ) );
+    s = _mm_max_ss( s, _mm_movehdup_ps( s ) );
+    return _mm_cvtss_f32( s );
+}
+
+LAPACK_TARGET_AVX2 inline double hmax( __m256d a )
+{
+    __m128d s = _mm_max_pd( _mm256_castpd256_pd128( a ),
+                            _mm256_extractf128_pd( a, 1 ) );
+    s = _mm_max_sd( s, _mm_unpackhi_pd( s, s ) );
+    return _mm_cvtsd_f64( s );
+}
+
+//------------------------------------------------------------------------------
+// Complex vectors. vload_complex loads 2 vectors of interleaved complex
+// entries and splits real and imaginary parts, in the permuted order
+// (0, 2, 1, 3) of 64-bit pairs; vorder restores the order.
+
+LAPACK_TARGET_AVX2
+inline void vload_complex( float const* x, __m256& re, __m256& im )
+{
+    __m256 v0 = _mm256_loadu_ps( x );
+    __m256 v1 = _mm256_loadu_ps( x + 8 );
+    re = _mm256_shuffle_ps( v0, v1, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    im = _mm256_shuffle_ps( v0, v1, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+}
+
+LAPACK_TARGET_AVX2
+inline void vload_complex( double const* x, __m256d& re, __m256d& im )
+{
+    __m256d v0 = _mm256_loadu_pd( x );
+    __m256d v1 = _mm256_loadu_pd( x + 4 );
+    re = _mm256_unpacklo_pd( v0, v1 );
+    im = _mm256_unpackhi_pd( v0, v1 );
+}
+
+LAPACK_TARGET_AVX2
+inline __m256 vorder( __m256 a )
+{
+    return _mm256_castpd_ps(
+        _mm256_permute4x64_pd( _mm256_castps_pd( a ), 0xD8 ) );
+}
+
+LAPACK_TARGET_AVX2
+inline __m256d vorder( __m256d a )
+{
+    return _mm256_permute4x64_pd( a, 0xD8 );
+}
+
+//------------------------------------------------------------------------------
+/// @return sqrt( re^2 + im^2 ) without overflow, as max * sqrt( 1 + r^2 ),
+/// r = min / max. Returns NaN if either is NaN, else inf if either is inf.
+template <typename vec_t, typename real_t>
+LAPACK_TARGET_AVX2
+inline vec_t vhypot( vec_t re, vec_t im, real_t )
+{
+    const real_t inf = std::numeric_limits< real_t >::infinity();
+    vec_t a = vabs( re );
+    vec_t b = vabs( im );
+    vec_t mx = vmax( a, b );
+    vec_t mn = vmin( a, b );
+    // r = 0 if max is 0 or inf, to avoid 0/0 and inf/inf
+    vec_t ok = vand( vgt( mx, vset1( real_t( 0 ) ) ),
+                     vlt( mx, vset1( inf ) ) );
+    vec_t r  = vselect( ok, vdiv( mn, mx ), vset1( real_t( 0 ) ) );
+    vec_t h  = vmul( mx, vsqrt( vfmadd( r, r, vset1( real_t( 1 ) ) ) ) );
+    // max and min drop NaN; a + b restores it
+    return vselect( vunord( a, b ), vadd( a, b ), h );
+}
+
+//------------------------------------------------------------------------------
+/// Loads nv entries of x starting at x_i, and returns |x_i| in order
+/// if ordered, else possibly permuted, for reductions.
+template <bool ordered, typename scalar_t>
+LAPACK_TARGET_AVX2
+inline typename Vec< blas::real_type< scalar_t > >::type
+vload_abs( scalar_t const* x_ )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    real_t const* x = reinterpret_cast< real_t const* >( x_ );
+    if constexpr (blas::is_complex< scalar_t >::value) {
+        vec_t re, im;
+        vload_complex( x, re, im );
+        vec_t h = vhypot( re, im, real_t( 0 ) );
+        return (ordered ? vorder( h ) : h);
+    }
+    else {
+        return vabs( vload( x ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+blas::real_type< scalar_t > max_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    constexpr int nv = Vec< real_t >::size;
+
+    // max drops NaN, so track it separately
+    vec_t vmx  = vset1( real_t( 0 ) );
+    vec_t vnan = vset1( real_t( 0 ) );
+    int64_t i = 0;
+    for (; i + nv <= m; i += nv) {
+        vec_t a = vload_abs< false >( &x[ i ] );
+        vnan = vor( vnan, vunord( a, a ) );
+        vmx  = vmax( vmx, a );
+    }
+    if (vany( vnan ))
+        return std::numeric_limits< real_t >::quiet_NaN();
+
+    real_t value = hmax( vmx );
+    for (; i < m; ++i) {
+        real_t a = std::abs( x[ i ] );
+        if (std::isnan( a ))
+            return a;
+        value = std::max( value, a );
+    }
+    return value;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+blas::real_type< scalar_t > sum_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    constexpr int nv = Vec< real_t >::size;
+
+    // 2 accumulators to hide latency of add
+    vec_t s0 = vset1( real_t( 0 ) );
+    vec_t s1 = vset1( real_t( 0 ) );
+    int64_t i = 0;
+    for (; i + 2*nv <= m; i += 2*nv) {
+        s0 = vadd( s0, vload_abs< false >( &x[ i      ] ) );
+        s1 = vadd( s1, vload_abs< false >( &x[ i + nv ] ) );
+    }
+    if (i + nv <= m) {
+        s0 = vadd( s0, vload_abs< false >( &x[ i ] ) );
+        i += nv;
+    }
+    real_t sum = hsum( vadd( s0, s1 ) );
+    for (; i < m; ++i)
+        sum += std::abs( x[ i ] );
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+void add_abs( int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    constexpr int nv = Vec< real_t >::size;
+
+    int64_t i = 0;
+    for (; i + nv <= m; i += nv) {
+        vstore( &work[ i ],
+                vadd( vload( &work[ i ] ), vload_abs< true >( &x[ i ] ) ) );
+    }
+    for (; i < m; ++i)
+        work[ i ] += std::abs( x[ i ] );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+blas::real_type< scalar_t > sum_add_abs(
+    int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    constexpr int nv = Vec< real_t >::size;
+
+    vec_t s = vset1( real_t( 0 ) );
+    int64_t i = 0;
+    for (; i + nv <= m; i += nv) {
+        vec_t a = vload_abs< true >( &x[ i ] );
+        s = vadd( s, a );
+        vstore( &work[ i ], vadd( vload( &work[ i ] ), a ) );
+    }
+    real_t sum = hsum( s );
+    for (; i < m; ++i) {
+        real_t a = std::abs( x[ i ] );
+        sum += a;
+        work[ i ] += a;
+    }
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+/// Sum of squares of n real entries, in Blue's accumulators.
+LAPACK_TARGET_AVX2
+void sum_squares_real( int64_t n, double const* x, SumSquares& ss )
+{
+    const __m256d tbig = vset1( blue_tbig );
+    const __m256d tsml = vset1( blue_tsml );
+    const __m256d sbig = vset1( blue_sbig );
+    const __m256d ssml = vset1( blue_ssml );
+    const __m256d zero = vset1( 0.0 );
+
+    __m256d big = zero, med = zero, sml = zero;
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a = vabs( vload( &x[ i ] ) );
+        __m256d is_big = vgt( a, tbig );
+        __m256d is_sml = vlt( a, tsml );
+        // NaN is neither big nor small, so it goes to med
+        __m256d b = vselect( is_big, vmul( a, sbig ), zero );
+        __m256d s = vselect( is_sml, vmul( a, ssml ), zero );
+        __m256d d = vselect( vor( is_big, is_sml ), zero, a );
+        big = vfmadd( b, b, big );
+        sml = vfmadd( s, s, sml );
+        med = vfmadd( d, d, med );
+    }
+    ss.big += hsum( big );
+    ss.med += hsum( med );
+    ss.sml += hsum( sml );
+    for (; i < n; ++i)
+        ss.add( x[ i ] );
+}
+
+/// Float squares are summed in double, without scaling.
+LAPACK_TARGET_AVX2
+void sum_squares_real( int64_t n, float const* x, SumSquares& ss )
+{
+    __m256d s0 = vset1( 0.0 );
+    __m256d s1 = vset1( 0.0 );
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = vload( &x[ i ] );
+        __m256d lo = _mm256_cvtps_pd( _mm256_castps256_ps128( v ) );
+        __m256d hi = _mm256_cvtps_pd( _mm256_extractf128_ps( v, 1 ) );
+        s0 = vfmadd( lo, lo, s0 );
+        s1 = vfmadd( hi, hi, s1 );
+    }
+    ss.med += hsum( vadd( s0, s1 ) );
+    for (; i < n; ++i)
+        ss.add( x[ i ] );
+}
+
+template <typename scalar_t>
+LAPACK_TARGET_AVX2
+void sum_squares( int64_t m, scalar_t const* x, SumSquares& ss )
+{
+    // complex is summed as 2m real entries
+    using real_t = blas::real_type< scalar_t >;
+    int64_t mm = (blas::is_complex< scalar_t >::value ? 2*m : m);
+    sum_squares_real( mm, reinterpret_cast< real_t const* >( x ), ss );
+}
+
+template <typename scalar_t>
+NormKernels< scalar_t > const avx2_kernels = {
+    max_abs< scalar_t >,
+    sum_abs< scalar_t >,
+    add_abs< scalar_t >,
+    sum_add_abs< scalar_t >,
+    sum_squares< scalar_t >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels_avx2()
+{
+    return avx2_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template NormKernels< float > const& norm_kernels_avx2();
+template NormKernels< double > const& norm_kernels_avx2();
+template NormKernels< std::complex<float> > const& norm_kernels_avx2();
+template NormKernels< std::complex<double> > const& norm_kernels_avx2();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
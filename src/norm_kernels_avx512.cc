@@ -0,0 +1,374 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "norm_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+// GCC 12's AVX-512 headers trigger false uninitialized warnings
+// from _mm512_undefined_pd when inlined.
+#if defined( __GNUC__ ) && ! defined( __clang__ )
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Vector operations, overloaded on __m512 (16 floats) and __m512d (8 doubles).
+// Comparisons return bit masks. Tails use masked loads and stores,
+// with masked-out entries loaded as zero.
+
+template <typename real_t> struct Vec;
+
+template <>
+struct Vec< float > {
+    using type = __m512;
+    using mask = __mmask16;
+    static constexpr int size = 16;
+};
+
+template <>
+struct Vec< double > {
+    using type = __m512d;
+    using mask = __mmask8;
+    static constexpr int size = 8;
+};
+
+/// @return mask of the first k < size entries.
+template <typename real_t>
+inline typename Vec< real_t >::mask tail_mask( int64_t k )
+{
+    return typename Vec< real_t >::mask( (1u << k) - 1 );
+}
+
+LAPACK_TARGET_AVX512 inline __m512  vload( float  const* x ) { return _mm512_loadu_ps( x ); }
+LAPACK_TARGET_AVX512 inline __m512d vload( double const* x ) { return _mm512_loadu_pd( x ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vload( __mmask16 k, float  const* x ) { return _mm512_maskz_loadu_ps( k, x ); }
+LAPACK_TARGET_AVX512 inline __m512d vload( __mmask8  k, double const* x ) { return _mm512_maskz_loadu_pd( k, x ); }
+
+LAPACK_TARGET_AVX512 inline void vstore( float*  x, __m512  v ) { _mm512_storeu_ps( x, v ); }
+LAPACK_TARGET_AVX512 inline void vstore( double* x, __m512d v ) { _mm512_storeu_pd( x, v ); }
+
+LAPACK_TARGET_AVX512 inline void vstore( __mmask16 k, float*  x, __m512  v ) { _mm512_mask_storeu_ps( x, k, v ); }
+LAPACK_TARGET_AVX512 inline void vstore( __mmask8  k, double* x, __m512d v ) { _mm512_mask_storeu_pd( x, k, v ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vset1( float  a ) { return _mm512_set1_ps( a ); }
+LAPACK_TARGET_AVX512 inline __m512d vset1( double a ) { return _mm512_set1_pd( a ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vadd( __m512  a, __m512  b ) { return _mm512_add_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vadd( __m512d a, __m512d b ) { return _mm512_add_pd( a, b ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vmul( __m512  a, __m512  b ) { return _mm512_mul_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vmul( __m512d a, __m512d b ) { return _mm512_mul_pd( a, b ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vdiv( __m512  a, __m512  b ) { return _mm512_div_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vdiv( __m512d a, __m512d b ) { return _mm512_div_pd( a, b ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vsqrt( __m512  a ) { return _mm512_sqrt_ps( a ); }
+LAPACK_TARGET_AVX512 inline __m512d vsqrt( __m512d a ) { return _mm512_sqrt_pd( a ); }
+
+/// @return a*b + c
+LAPACK_TARGET_AVX512 inline __m512  vfmadd( __m512  a, __m512  b, __m512  c ) { return _mm512_fmadd_ps( a, b, c ); }
+LAPACK_TARGET_AVX512 inline __m512d vfmadd( __m512d a, __m512d b, __m512d c ) { return _mm512_fmadd_pd( a, b, c ); }
+
+/// max and min return b if either is NaN.
+LAPACK_TARGET_AVX512 inline __m512  vmax( __m512  a, __m512  b ) { return _mm512_max_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vmax( __m512d a, __m512d b ) { return _mm512_max_pd( a, b ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vmin( __m512  a, __m512  b ) { return _mm512_min_ps( a, b ); }
+LAPACK_TARGET_AVX512 inline __m512d vmin( __m512d a, __m512d b ) { return _mm512_min_pd( a, b ); }
+
+LAPACK_TARGET_AVX512 inline __m512  vabs( __m512  a ) { return _mm512_abs_ps( a ); }
+LAPACK_TARGET_AVX512 inline __m512d vabs( __m512d a ) { return _mm512_abs_pd( a ); }
+
+LAPACK_TARGET_AVX512 inline __mmask16 vgt( __m512  a, __m512  b ) { return _mm512_cmp_ps_mask( a, b, _CMP_GT_OQ ); }
+LAPACK_TARGET_AVX512 inline __mmask8  vgt( __m512d a, __m512d b ) { return _mm512_cmp_pd_mask( a, b, _CMP_GT_OQ ); }
+
+LAPACK_TARGET_AVX512 inline __mmask16 vlt( __m512  a, __m512  b ) { return _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ ); }
+LAPACK_TARGET_AVX512 inline __mmask8  vlt( __m512d a, __m512d b ) { return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ ); }
+
+/// true where a or b is NaN
+LAPACK_TARGET_AVX512 inline __mmask16 vunord( __m512  a, __m512  b ) { return _mm512_cmp_ps_mask( a, b, _CMP_UNORD_Q ); }
+LAPACK_TARGET_AVX512 inline __mmask8  vunord( __m512d a, __m512d b ) { return _mm512_cmp_pd_mask( a, b, _CMP_UNORD_Q ); }
+
+/// @return mask ? a : b
+LAPACK_TARGET_AVX512 inline __m512  vselect( __mmask16 k, __m512  a, __m512  b ) { return _mm512_mask_blend_ps( k, b, a ); }
+LAPACK_TARGET_AVX512 inline __m512d vselect( __mmask8  k, __m512d a, __m512d b ) { return _mm512_mask_blend_pd( k, b, a ); }
+
+LAPACK_TARGET_AVX512 inline float  hsum( __m512  a ) { return _mm512_reduce_add_ps( a ); }
+LAPACK_TARGET_AVX512 inline double hsum( __m512d a ) { return _mm512_reduce_add_pd( a ); }
+
+/// Horizontal max, assuming no NaN.
+LAPACK_TARGET_AVX512 inline float  hmax( __m512  a ) { return _mm512_reduce_max_ps( a ); }
+LAPACK_TARGET_AVX512 inline double hmax( __m512d a ) { return _mm512_reduce_max_pd( a ); }
+
+//------------------------------------------------------------------------------
+// Complex vectors. vload_complex loads k0 and k1 masked entries of
+// 2 vectors of interleaved complex entries and splits real and
+// imaginary parts, in order.
+
+LAPACK_TARGET_AVX512
+inline void vload_complex(
+    __mmask16 k0, __mmask16 k1, float const* x, __m512& re, __m512& im )
+{
+    const __m512i even = _mm512_set_epi32(
+        30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0 );
+    const __m512i odd = _mm512_set_epi32(
+        31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1 );
+    __m512 v0 = _mm512_maskz_loadu_ps( k0, x );
+    __m512 v1 = _mm512_maskz_loadu_ps( k1, x + 16 );
+    re = _mm512_permutex2var_ps( v0, even, v1 );
+    im = _mm512_permutex2var_ps( v0, odd,  v1 );
+}
+
+LAPACK_TARGET_AVX512
+inline void vload_complex(
+    __mmask8 k0, __mmask8 k1, double const* x, __m512d& re, __m512d& im )
+{
+    const __m512i even = _mm512_set_epi64( 14, 12, 10, 8, 6, 4, 2, 0 );
+    const __m512i odd  = _mm512_set_epi64( 15, 13, 11, 9, 7, 5, 3, 1 );
+    __m512d v0 = _mm512_maskz_loadu_pd( k0, x );
+    __m512d v1 = _mm512_maskz_loadu_pd( k1, x + 8 );
+    re = _mm512_permutex2var_pd( v0, even, v1 );
+    im = _mm512_permutex2var_pd( v0, odd,  v1 );
+}
+
+//------------------------------------------------------------------------------
+/// @return sqrt( re^2 + im^2 ) without overflow, as max * sqrt( 1 + r^2 ),
+/// r = min / max. Returns NaN if either is NaN, else inf if either is inf.
+template <typename vec_t, typename real_t>
+LAPACK_TARGET_AVX512
+inline vec_t vhypot( vec_t re, vec_t im, real_t )
+{
+    const real_t inf = std::numeric_limits< real_t >::infinity();
+    vec_t a = vabs( re );
+    vec_t b = vabs( im );
+    vec_t mx = vmax( a, b );
+    vec_t mn = vmin( a, b );
+    // r = 0 if max is 0 or inf, to avoid 0/0 and inf/inf
+    auto ok = vgt( mx, vset1( real_t( 0 ) ) ) & vlt( mx, vset1( inf ) );
+    vec_t r = vselect( ok, vdiv( mn, mx ), vset1( real_t( 0 ) ) );
+    vec_t h = vmul( mx, vsqrt( vfmadd( r, r, vset1( real_t( 1 ) ) ) ) );
+    // max and min drop NaN; a + b restores it
+    return vselect( vunord( a, b ), vadd( a, b ), h );
+}
+
+//------------------------------------------------------------------------------
+/// Loads k < nv entries of x, or nv entries if k = nv, and returns |x_i|,
+/// with zeros after k.
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+inline typename Vec< blas::real_type< scalar_t > >::type
+vload_abs( int64_t k, scalar_t const* x_ )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    using mask_t = typename Vec< real_t >::mask;
+    constexpr int nv = Vec< real_t >::size;
+
+    real_t const* x = reinterpret_cast< real_t const* >( x_ );
+    if constexpr (blas::is_complex< scalar_t >::value) {
+        // 2k real entries in 2 vectors
+        mask_t k0 = mask_t( -1 ), k1 = mask_t( -1 );
+        if (k < nv) {
+            k0 = (2*k >= nv ? mask_t( -1 ) : tail_mask< real_t >( 2*k ));
+            k1 = (2*k >= nv ? tail_mask< real_t >( 2*k - nv ) : mask_t( 0 ));
+        }
+        vec_t re, im;
+        vload_complex( k0, k1, x, re, im );
+        return vhypot( re, im, real_t( 0 ) );
+    }
+    else {
+        if (k < nv)
+            return vabs( vload( tail_mask< real_t >( k ), x ) );
+        return vabs( vload( x ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+blas::real_type< scalar_t > max_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    using mask_t = typename Vec< real_t >::mask;
+    constexpr int nv = Vec< real_t >::size;
+
+    // max drops NaN, so track it separately
+    vec_t vmx = vset1( real_t( 0 ) );
+    mask_t nan = 0;
+    for (int64_t i = 0; i < m; i += nv) {
+        vec_t a = vload_abs( std::min( int64_t( nv ), m - i ), &x[ i ] );
+        nan |= vunord( a, a );
+        vmx = vmax( vmx, a );
+    }
+    if (nan)
+        return std::numeric_limits< real_t >::quiet_NaN();
+    return hmax( vmx );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+blas::real_type< scalar_t > sum_abs( int64_t m, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    constexpr int nv = Vec< real_t >::size;
+
+    // 2 accumulators to hide latency of add
+    vec_t s0 = vset1( real_t( 0 ) );
+    vec_t s1 = vset1( real_t( 0 ) );
+    int64_t i = 0;
+    for (; i + 2*nv <= m; i += 2*nv) {
+        s0 = vadd( s0, vload_abs( nv, &x[ i      ] ) );
+        s1 = vadd( s1, vload_abs( nv, &x[ i + nv ] ) );
+    }
+    for (; i < m; i += nv)
+        s0 = vadd( s0, vload_abs( std::min( int64_t( nv ), m - i ), &x[ i ] ) );
+    return hsum( vadd( s0, s1 ) );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+void add_abs( int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    constexpr int nv = Vec< real_t >::size;
+
+    int64_t i = 0;
+    for (; i + nv <= m; i += nv) {
+        vstore( &work[ i ], vadd( vload( &work[ i ] ), vload_abs( nv, &x[ i ] ) ) );
+    }
+    if (i < m) {
+        auto k = tail_mask< real_t >( m - i );
+        vstore( k, &work[ i ],
+                vadd( vload( k, &work[ i ] ), vload_abs( m - i, &x[ i ] ) ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+blas::real_type< scalar_t > sum_add_abs(
+    int64_t m, scalar_t const* x, blas::real_type< scalar_t >* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using vec_t = typename Vec< real_t >::type;
+    constexpr int nv = Vec< real_t >::size;
+
+    vec_t s = vset1( real_t( 0 ) );
+    int64_t i = 0;
+    for (; i + nv <= m; i += nv) {
+        vec_t a = vload_abs( nv, &x[ i ] );
+        s = vadd( s, a );
+        vstore( &work[ i ], vadd( vload( &work[ i ] ), a ) );
+    }
+    if (i < m) {
+        auto k = tail_mask< real_t >( m - i );
+        vec_t a = vload_abs( m - i, &x[ i ] );
+        s = vadd( s, a );
+        vstore( k, &work[ i ], vadd( vload( k, &work[ i ] ), a ) );
+    }
+    return hsum( s );
+}
+
+//------------------------------------------------------------------------------
+/// Sum of squares of n real entries, in Blue's accumulators.
+LAPACK_TARGET_AVX512
+void sum_squares_real( int64_t n, double const* x, SumSquares& ss )
+{
+    const __m512d tbig = vset1( blue_tbig );
+    const __m512d tsml = vset1( blue_tsml );
+    const __m512d sbig = vset1( blue_sbig );
+    const __m512d ssml = vset1( blue_ssml );
+    const __m512d zero = vset1( 0.0 );
+
+    __m512d big = zero, med = zero, sml = zero;
+    for (int64_t i = 0; i < n; i += 8) {
+        __m512d a = (i + 8 <= n ? vabs( vload( &x[ i ] ) )
+                                : vabs( vload( tail_mask< double >( n - i ),
+                                               &x[ i ] ) ));
+        __mmask8 is_big = vgt( a, tbig );
+        __mmask8 is_sml = vlt( a, tsml );
+        // NaN is neither big nor small, so it goes to med
+        __m512d b = _mm512_maskz_mul_pd( is_big, a, sbig );
+        __m512d s = _mm512_maskz_mul_pd( is_sml, a, ssml );
+        __m512d d = vselect( is_big | is_sml, zero, a );
+        big = vfmadd( b, b, big );
+        sml = vfmadd( s, s, sml );
+        med = vfmadd( d, d, med );
+    }
+    ss.big += hsum( big );
+    ss.med += hsum( med );
+    ss.sml += hsum( sml );
+}
+
+/// Float squares are summed in double, without scaling.
+LAPACK_TARGET_AVX512
+void sum_squares_real( int64_t n, float const* x, SumSquares& ss )
+{
+    __m512d s0 = vset1( 0.0 );
+    __m512d s1 = vset1( 0.0 );
+    for (int64_t i = 0; i < n; i += 16) {
+        __m512 v = (i + 16 <= n ? vload( &x[ i ] )
+                                : vload( tail_mask< float >( n - i ), &x[ i ] ));
+        __m512d lo = _mm512_cvtps_pd( _mm512_castps512_ps256( v ) );
+        __m512d hi = _mm512_cvtps_pd( _mm256_castpd_ps(
+                         _mm512_extractf64x4_pd( _mm512_castps_pd( v ), 1 ) ) );
+        s0 = vfmadd( lo, lo, s0 );
+        s1 = vfmadd( hi, hi, s1 );
+    }
+    ss.med += hsum( vadd( s0, s1 ) );
+}
+
+template <typename scalar_t>
+LAPACK_TARGET_AVX512
+void sum_squares( int64_t m, scalar_t const* x, SumSquares& ss )
+{
+    // complex is summed as 2m real entries
+    using real_t = blas::real_type< scalar_t >;
+    int64_t mm = (blas::is_complex< scalar_t >::value ? 2*m : m);
+    sum_squares_real( mm, reinterpret_cast< real_t const* >( x ), ss );
+}
+
+template <typename scalar_t>
+NormKernels< scalar_t > const avx512_kernels = {
+    max_abs< scalar_t >,
+    sum_abs< scalar_t >,
+    add_abs< scalar_t >,
+    sum_add_abs< scalar_t >,
+    sum_squares< scalar_t >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+NormKernels< scalar_t > const& norm_kernels_avx512()
+{
+    return avx512_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template NormKernels< float > const& norm_kernels_avx512();
+template NormKernels< double > const& norm_kernels_avx512();
+template NormKernels< std::complex<float> > const& norm_kernels_avx512();
+template NormKernels< std::complex<double> > const& norm_kernels_avx512();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
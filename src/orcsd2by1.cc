@@ -17,15 +17,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t orcsd2by1(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t orcsd2by1_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
     float* X11, int64_t ldx11,
     float* X21, int64_t ldx21,
     float* theta,
     float* U1, int64_t ldu1,
     float* U2, int64_t ldu2,
-    float* V1T, int64_t ldv1t )
+    float* V1T, int64_t ldv1t,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -51,29 +57,37 @@ int64_t orcsd2by1(
     lapack_int ldv1t_ = (lapack_int) ldv1t;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sorcsd2by1(
-        &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
-        X11, &ldx11_,
-        X21, &ldx21_,
-        theta,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sorcsd2by1", { jobu1_, jobu2_, jobv1t_, m_, p_, q_, ldx11_, ldx21_, ldu1_, ldu2_, ldv1t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sorcsd2by1(
+            &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
+            X11, &ldx11_,
+            X21, &ldx21_,
+            theta,
+            U1, &ldu1_,
+            U2, &ldu2_,
+            V1T, &ldv1t_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m - min( p, min( m-p, min( q, m-q )))) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
@@ -83,8 +97,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -93,14 +107,15 @@ int64_t orcsd2by1(
 }
 
 // -----------------------------------------------------------------------------
-int64_t orcsd2by1(
+int64_t orcsd2by1_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
     double* X11, int64_t ldx11,
     double* X21, int64_t ldx21,
     double* theta,
     double* U1, int64_t ldu1,
     double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t )
+    double* V1T, int64_t ldv1t,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -126,29 +141,37 @@ int64_t orcsd2by1(
     lapack_int ldv1t_ = (lapack_int) ldv1t;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorcsd2by1(
-        &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
-        X11, &ldx11_,
-        X21, &ldx21_,
-        theta,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dorcsd2by1", { jobu1_, jobu2_, jobv1t_, m_, p_, q_, ldx11_, ldx21_, ldu1_, ldu2_, ldv1t_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dorcsd2by1(
+            &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
+            X11, &ldx11_,
+            X21, &ldx21_,
+            theta,
+            U1, &ldu1_,
+            U2, &ldu2_,
+            V1T, &ldv1t_,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m - min( p, min( m-p, min( q, m-q )))) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
@@ -158,8 +181,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -167,6 +190,116 @@ int64_t orcsd2by1(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t )
+{
+    size_t host_work_size;
+    orcsd2by1_work_size_bytes( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11,
+                               X21, ldx21, theta, U1, ldu1, U2, ldu2,
+                               V1T, ldv1t, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                      theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                      host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t )
+{
+    size_t host_work_size;
+    orcsd2by1_work_size_bytes( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11,
+                               X21, ldx21, theta, U1, ldu1, U2, ldu2,
+                               V1T, ldv1t, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                      theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                      host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                    theta, U1, ldu1, U2, ldu2, V1T, ldv1t, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size_bytes(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                    theta, U1, ldu1, U2, ldu2, V1T, ldv1t, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21,
+                           ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                           work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21,
+                           ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                           work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.5.0
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,12 +14,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd_computational
-int64_t orgbr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t orgbr_work(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,28 +40,36 @@ int64_t orgbr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sorgbr(
-        &vect_, &m_, &n_, &k_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sorgbr", { vect_, m_, n_, k_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sorgbr(
+            &vect_, &m_, &n_, &k_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -66,12 +78,11 @@ int64_t orgbr(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::ungbr
-/// @ingroup gesvd_computational
-int64_t orgbr(
+int64_t orgbr_work(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -87,28 +98,36 @@ int64_t orgbr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorgbr(
-        &vect_, &m_, &n_, &k_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dorgbr", { vect_, m_, n_, k_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dorgbr(
+            &vect_, &m_, &n_, &k_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -116,4 +135,108 @@ int64_t orgbr(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::ungbr
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void orgbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::orgbr`. Arguments are the same as for
+/// `lapack::orgbr`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd_computational
+void orgbr_work_size_bytes(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::orgbr` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::orgbr_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::orgbr( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::orgbr`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::orgbr_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orgbr_work( vect, m, n, k, A, lda, tau, work_buffer );
+}
+
 }  // namespace lapack
@@ -5,7 +5,6 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
-#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -15,11 +14,17 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t orghr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t orghr_work(
     int64_t n, int64_t ilo, int64_t ihi,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -34,27 +39,35 @@ int64_t orghr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sorghr(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sorghr", { n_, ilo_, ihi_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sorghr(
+            &n_, &ilo_, &ihi_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -62,10 +75,11 @@ int64_t orghr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t orghr(
+int64_t orghr_work(
     int64_t n, int64_t ilo, int64_t ihi,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -80,31 +94,109 @@ int64_t orghr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorghr(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dorghr", { n_, ilo_, ihi_, lda_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dorghr(
+            &n_, &ilo_, &ihi_,
+            A, &lda_,
+            tau,
+            qry_work, &ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+void orghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void orghr_work_size_bytes(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return orghr_work( n, ilo, ihi, A, lda, tau, work_buffer );
+}
+
 }  // namespace lapack
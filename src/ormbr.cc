@@ -15,13 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup gesvd_computational
-int64_t ormbr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ormbr_work(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    float* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -45,30 +50,38 @@ int64_t ormbr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sormbr(
-        &vect_, &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        tau,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sormbr", { vect_, side_, trans_, m_, n_, k_, lda_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sormbr(
+            &vect_, &side_, &trans_, &m_, &n_, &k_,
+            A, &lda_,
+            tau,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -77,13 +90,12 @@ int64_t ormbr(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::unmbr
-/// @ingroup gesvd_computational
-int64_t ormbr(
+int64_t ormbr_work(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    double* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -107,30 +119,38 @@ int64_t ormbr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dormbr(
-        &vect_, &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        tau,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dormbr", { vect_, side_, trans_, m_, n_, k_, lda_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dormbr(
+            &vect_, &side_, &trans_, &m_, &n_, &k_,
+            A, &lda_,
+            tau,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -138,4 +158,122 @@ int64_t ormbr(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    size_t host_work_size;
+    ormbr_work_size_bytes( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmbr
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    size_t host_work_size;
+    ormbr_work_size_bytes( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void ormbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ormbr_work( vect, side, trans, m, n, k, A, lda, tau, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::ormbr`. Arguments are the same as for
+/// `lapack::ormbr`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup gesvd_computational
+void ormbr_work_size_bytes(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ormbr_work( vect, side, trans, m, n, k, A, lda, tau, C, ldc, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ormbr_work( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::ormbr` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::ormbr_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::ormbr( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::ormbr`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::ormbr_work_size_bytes` for the same arguments.
+///
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ormbr_work( vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+                       work_buffer );
+}
+
 }  // namespace lapack
@@ -15,12 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t ormhr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t ormhr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
     float const* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    float* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -45,30 +51,38 @@ int64_t ormhr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sormhr(
-        &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "sormhr", { side_, trans_, m_, n_, ilo_, ihi_, lda_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sormhr(
+            &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
+            A, &lda_,
+            tau,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -77,11 +91,12 @@ int64_t ormhr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormhr(
+int64_t ormhr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
     double const* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    double* C, int64_t ldc,
+    internal::WorkBuffer& work_buffer )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -106,30 +121,38 @@ int64_t ormhr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dormhr(
-        &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dormhr", { side_, trans_, m_, n_, ilo_, ihi_, lda_, ldc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dormhr(
+            &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
+            A, &lda_,
+            tau,
+            C, &ldc_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -137,4 +160,90 @@ int64_t ormhr(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    size_t host_work_size;
+    ormhr_work_size_bytes( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    size_t host_work_size;
+    ormhr_work_size_bytes( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void ormhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ormhr_work( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void ormhr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    ormhr_work( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ormhr_work( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return ormhr_work( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+                       work_buffer );
+}
+
 }  // namespace lapack
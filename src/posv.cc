@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "backend_dispatch.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -203,6 +204,7 @@ int64_t posv(
 }
 
 // -----------------------------------------------------------------------------
+/// @ingroup posv
 int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
@@ -224,12 +226,12 @@ int64_t posv(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int ldx_ = (lapack_int) ldx;
-    lapack_int iter_ = (lapack_int) *iter;
+    lapack_int iter_ = 0;
     lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< double > work( (n)*(nrhs) );
-    lapack::vector< float > swork( (n*(n+nrhs)) );
+    lapack::vector< double > work( max( 1, n*nrhs ) );
+    lapack::vector< float > swork( max( 1, n*(n + nrhs) ) );
 
     LAPACK_dsposv(
         &uplo_, &n_, &nrhs_,
@@ -247,6 +249,90 @@ int64_t posv(
 }
 
 // -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n Hermitian positive definite matrix and X and B
+/// are n-by-nrhs matrices, using mixed-precision iterative refinement
+/// (LAPACK dsposv, zcposv).
+///
+/// This overload, with separate B and X, first factors A in single
+/// precision with potrf, then uses this factorization within an iterative
+/// refinement procedure to produce a solution with double precision
+/// normwise backward error quality. If the approach fails, it falls back
+/// to a double precision factorization and solve, as in posv.
+///
+/// The iterative refinement is not going to be a winning strategy if
+/// the ratio of single precision performance over double precision
+/// performance is too small, or for small n.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`.
+/// See also lapack::solve_mixed.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A.
+///     If uplo = Upper, the leading n-by-n upper triangular part of A
+///     contains the upper triangular part of the matrix A, and the strictly
+///     lower triangular part of A is not referenced. If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper triangular
+///     part of A is not referenced.
+///     On exit, if iterative refinement has been successfully used
+///     (return value = 0 and iter >= 0), then A is unchanged;
+///     if double precision factorization has been used
+///     (return value = 0 and iter < 0), then the array A contains the
+///     factor U or L from the Cholesky factorization
+///     $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     The n-by-nrhs right hand side matrix B.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     If return value = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - < 0: iterative refinement has failed, double precision
+///         factorization has been performed
+///         - -1: the routine fell back to full precision for
+///             implementation- or machine-specific reasons
+///         - -2: narrowing the precision induced an overflow,
+///             the routine fell back to full precision
+///         - -3: failure of single precision potrf
+///         - -31: stop the iterative refinement after the 30th iteration
+///     - > 0: iterative refinement has been successfully used.
+///         Returns the number of iterations
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of
+///              A (double precision) is not positive definite, so the
+///              factorization could not be completed, and the solution
+///              has not been computed.
+///
+/// @ingroup posv
 int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
@@ -268,13 +354,13 @@ int64_t posv(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int ldx_ = (lapack_int) ldx;
-    lapack_int iter_ = (lapack_int) *iter;
+    lapack_int iter_ = 0;
     lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( (n)*(nrhs) );
-    lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
-    lapack::vector< double > rwork( (n) );
+    lapack::vector< std::complex<double> > work( max( 1, n*nrhs ) );
+    lapack::vector< std::complex<float> > swork( max( 1, n*(n + nrhs) ) );
+    lapack::vector< double > rwork( max( 1, n ) );
 
     LAPACK_zcposv(
         &uplo_, &n_, &nrhs_,
@@ -0,0 +1,458 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+#include "batch_interleaved.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems,
+/// then solves them in parallel.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( uplo, batch_size, "uplo" );
+    internal::check_batch_arg( n,    batch_size, "n" );
+    internal::check_batch_arg( nrhs, batch_size, "nrhs" );
+    internal::check_batch_arg( lda,  batch_size, "lda" );
+    internal::check_batch_arg( ldb,  batch_size, "ldb" );
+    lapack_error_if( Aarray.size() != batch_size );
+    lapack_error_if( Barray.size() != batch_size );
+    lapack_error_if( info.size()   != batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Uplo uplo_i = internal::extract( uplo, i );
+        int64_t n_i    = internal::extract( n,    i );
+        int64_t nrhs_i = internal::extract( nrhs, i );
+        int64_t lda_i  = internal::extract( lda,  i );
+        int64_t ldb_i  = internal::extract( ldb,  i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( ldb_i < max( 1, n_i ) );
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( n_i    > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( nrhs_i > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( lda_i  > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( ldb_i  > std::numeric_limits<lapack_int>::max() );
+        }
+    }
+
+    internal::batch_for( batch_size, 0,
+        [&]( int64_t i, lapack_int* ) {
+            info[ i ] = lapack::posv( internal::extract( uplo, i ),
+                                      internal::extract( n,    i ),
+                                      internal::extract( nrhs, i ),
+                                      Aarray[ i ], internal::extract( lda, i ),
+                                      Barray[ i ], internal::extract( ldb, i ) );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then solves strided problems in parallel.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideA < lda*n );
+    lapack_error_if( strideB < ldb*nrhs );
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( n    > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( nrhs > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda  > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( ldb  > std::numeric_limits<lapack_int>::max() );
+    }
+
+    internal::batch_for( batch_size, 0,
+        [&]( int64_t i, lapack_int* ) {
+            info[ i ] = lapack::posv( uplo, n, nrhs, A + i*strideA, lda,
+                                      B + i*strideB, ldb );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then solves interleaved problems in parallel,
+/// vectorizing across each chunk of problems.
+/// Each chunk is factored and solved while it is in cache.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    size_t batch_size, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    internal::interleaved_for( batch_size,
+        [&]( int64_t k0, int64_t k1 ) {
+            real_t ok[ internal::interleaved_chunk_size ];
+            internal::potrf_interleaved( uplo, n, A, lda, batch_size,
+                                         k0, k1, info, ok );
+            internal::potrs_interleaved( uplo, n, nrhs, A, lda, B, ldb,
+                                         batch_size, k0, k1, ok );
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$, with Hermitian positive definite matrices $A_i$,
+/// as in `lapack::posv`.
+///
+/// Problems are solved in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// For tiny matrices, see `lapack::posv_batch_interleaved`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_i$ is stored.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix $B_i$. nrhs[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the n[i]-by-n[i]
+///     Hermitian matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     On exit, if info[i] = 0, the factor $U_i$ or $L_i$
+///     from the Cholesky factorization of $A_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Barray[i] is the n[i]-by-nrhs[i]
+///     matrix $B_i$, stored in an ldb[i]-by-nrhs[i] array.
+///     On entry, the right hand side matrix $B_i$.
+///     On exit, if info[i] = 0, the solution matrix $X_i$.
+///
+/// @param[in] ldb
+///     The leading dimension of each array $B_i$. ldb[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::posv` for problem i:
+///     - = 0: successful exit.
+///     - > 0: if info[i] = j, the leading minor of order j of $A_i$
+///       is not positive definite, so the solution $X_i$
+///       could not be computed.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is solved.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_size, info );
+}
+
+//==============================================================================
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$, stored at a fixed stride.
+/// Same as `lapack::posv_batch`, but all problems have the same size,
+/// $A_i$ starts at A + i*strideA, and $B_i$ starts at B + i*strideB.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_i$ is stored.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of each matrix $B_i$. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, the factors $U_i$ or $L_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, n).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The batch of right hand sides, stored in an ldb-by-nrhs-by-batch_size
+///     array. On exit, the solutions $X_i$.
+///
+/// @param[in] ldb
+///     The leading dimension of each $B_i$. ldb >= max(1, n).
+///
+/// @param[in] strideB
+///     Distance between the first elements of $B_i$ and $B_{i+1}$.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::posv` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_strided( uplo, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_strided( uplo, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_strided( uplo, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void posv_batch_strided(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_strided( uplo, n, nrhs, A, lda, strideA,
+                              B, ldb, strideB, batch_size, info );
+}
+
+//==============================================================================
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_k X_k = B_k$, stored in interleaved layout.
+/// Same as `lapack::posv_batch_strided`, but the batch index is innermost:
+/// element (r, c) of $A_k$ is at A[ k + (r + c*lda)*batch_size ],
+/// and of $B_k$ is at B[ k + (r + c*ldb)*batch_size ].
+/// Chunks of problems are factored and solved at once, vectorizing
+/// across the batch; see `lapack::potrf_batch_interleaved`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_k$ is stored.
+///
+/// @param[in] n
+///     The order of each matrix $A_k$. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of each matrix $B_k$. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in a batch_size-by-lda-by-n array.
+///     On exit, the factors $U_k$ or $L_k$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_k$, in elements of one problem.
+///     lda >= max(1, n).
+///
+/// @param[in,out] B
+///     The batch of right hand sides, stored in a
+///     batch_size-by-ldb-by-nrhs array.
+///     On exit, if info[k] = 0, the solution $X_k$;
+///     otherwise $B_k$ is unchanged.
+///
+/// @param[in] ldb
+///     The leading dimension of each $B_k$, in elements of one problem.
+///     ldb >= max(1, n).
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[k] is set as in
+///     `lapack::posv` for problem k.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_interleaved( uplo, n, nrhs, A, lda, B, ldb,
+                                  batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_interleaved( uplo, n, nrhs, A, lda, B, ldb,
+                                  batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_interleaved( uplo, n, nrhs, A, lda, B, ldb,
+                                  batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    size_t batch_size, int64_t* info )
+{
+    impl::posv_batch_interleaved( uplo, n, nrhs, A, lda, B, ldb,
+                                  batch_size, info );
+}
+
+}  // namespace lapack
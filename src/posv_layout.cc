@@ -0,0 +1,361 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/layout.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// A row-major matrix is the transpose of a column-major matrix with the
+/// same storage. For Hermitian A, that transpose is conj(A), which has the
+/// opposite triangle stored, and if conj(A) = U^H U, then A = L L^H with
+/// L = U^T, which in row-major storage is U in column-major storage.
+/// So row-major potrf is column-major potrf with uplo swapped; no data moves.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::RowMajor) {
+        // swap lower <=> upper
+        uplo = (uplo == Uplo::Lower ? Uplo::Upper : Uplo::Lower);
+    }
+    return lapack::potrf( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// Solves with the Cholesky factor using BLAS triangular solves in the
+/// given layout, so B is not transposed either.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::Op;
+    using blas::Side;
+    using blas::Diag;
+
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    const scalar_t one = 1;
+    if (uplo == Uplo::Upper) {
+        // A = U^H U: solve U^H Y = B, then U X = Y.
+        blas::trsm( layout, Side::Left, uplo, Op::ConjTrans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( layout, Side::Left, uplo, Op::NoTrans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+    }
+    else {
+        // A = L L^H: solve L Y = B, then L^H X = Y.
+        blas::trsm( layout, Side::Left, uplo, Op::NoTrans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( layout, Side::Left, uplo, Op::ConjTrans, Diag::NonUnit,
+                    n, nrhs, one, A, lda, B, ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( layout != Layout::ColMajor && layout != Layout::RowMajor );
+
+    if (layout == Layout::ColMajor)
+        return lapack::posv( uplo, n, nrhs, A, lda, B, ldb );
+
+    // check all arguments before factoring
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = impl::potrf( layout, uplo, n, A, lda );
+    if (info == 0)
+        impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the Cholesky factorization of a Hermitian positive definite
+/// matrix A stored in either layout, as in `lapack::potrf`:
+///     $A = U^H U,$ if uplo = Upper, or
+///     $A = L L^H,$ if uplo = Lower.
+///
+/// A row-major matrix is factored in place, without transposing it,
+/// by factoring the opposite triangle of the same storage
+/// as a column-major matrix.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array (column-major)
+///     or an n-by-lda array (row-major).
+///     On exit, if return value = 0, the factor U or L.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+//==============================================================================
+/// Solves $A X = B$ using the Cholesky factorization computed by
+/// `lapack::potrf`, with A and B stored in either layout.
+/// Row-major matrices are solved in place, without transposing.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage of A and B, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns of B.
+///     nrhs >= 0.
+///
+/// @param[in] A
+///     The factor U or L from `lapack::potrf` with the same layout.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array (column-major)
+///     or an n-by-ldb array (row-major).
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     ldb >= max(1,n) (column-major) or max(1,nrhs) (row-major).
+///
+/// @return = 0: successful exit
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//==============================================================================
+/// Solves $A X = B$ for Hermitian positive definite A, as in `lapack::posv`,
+/// with A and B stored in either layout. Row-major matrices are factored
+/// and solved in place, without transposing.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] layout
+///     Matrix storage of A and B, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n Hermitian matrix A.
+///     On exit, if return value = 0, the factor U or L.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B.
+///     On exit, if return value = 0, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     ldb >= max(1,n) (column-major) or max(1,nrhs) (row-major).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of A is not
+///     positive definite, so the factorization could not be
+///     completed, and the solution has not been computed.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+}  // namespace lapack
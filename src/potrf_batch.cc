@@ -0,0 +1,375 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "batch.hh"
+#include "batch_interleaved.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments of all problems,
+/// then factors them in parallel.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    // check arguments
+    internal::check_batch_arg( uplo, batch_size, "uplo" );
+    internal::check_batch_arg( n,    batch_size, "n" );
+    internal::check_batch_arg( lda,  batch_size, "lda" );
+    lapack_error_if( Aarray.size() != batch_size );
+    lapack_error_if( info.size()   != batch_size );
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        lapack::Uplo uplo_i = internal::extract( uplo, i );
+        int64_t n_i   = internal::extract( n,   i );
+        int64_t lda_i = internal::extract( lda, i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( n_i   > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( lda_i > std::numeric_limits<lapack_int>::max() );
+        }
+    }
+
+    internal::batch_for( batch_size, 0,
+        [&]( int64_t i, lapack_int* ) {
+            info[ i ] = lapack::potrf( internal::extract( uplo, i ),
+                                       internal::extract( n,    i ),
+                                       Aarray[ i ],
+                                       internal::extract( lda,  i ) );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then factors strided problems in parallel.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( strideA < lda*n );
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( n   > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda > std::numeric_limits<lapack_int>::max() );
+    }
+
+    internal::batch_for( batch_size, 0,
+        [&]( int64_t i, lapack_int* ) {
+            info[ i ] = lapack::potrf( uplo, n, A + i*strideA, lda );
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments,
+/// then factors interleaved problems in parallel,
+/// vectorizing across each chunk of problems.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    size_t batch_size, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    internal::interleaved_for( batch_size,
+        [&]( int64_t k0, int64_t k1 ) {
+            real_t ok[ internal::interleaved_chunk_size ];
+            internal::potrf_interleaved( uplo, n, A, lda, batch_size,
+                                         k0, k1, info, ok );
+        } );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the Cholesky factorizations of a batch of Hermitian
+/// positive definite matrices $A_i$, as in `lapack::potrf`:
+/// \[
+///     A_i = U_i^H U_i,  \text{ if uplo[i] = Upper, or}
+/// \]
+/// \[
+///     A_i = L_i L_i^H,  \text{ if uplo[i] = Lower.}
+/// \]
+///
+/// Problems are factored in parallel using OpenMP, one problem per thread,
+/// with the vendor BLAS (MKL or OpenBLAS) set to one thread meanwhile.
+/// For tiny matrices, see `lapack::potrf_batch_interleaved`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_i$ is stored.
+///     Either 1 entry shared by all problems, or batch_size entries.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n[i] >= 0.
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Aarray[i] is the n[i]-by-n[i]
+///     Hermitian matrix $A_i$, stored in an lda[i]-by-n[i] array.
+///     Only the triangle given by uplo[i] is accessed.
+///     On exit, if info[i] = 0, the factor $U_i$ or $L_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each array $A_i$. lda[i] >= max(1, n[i]).
+///     Either 1 entry or batch_size entries.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Vector of length batch_size. On exit, info[i] is the return value
+///     of `lapack::potrf` for problem i:
+///     - = 0: successful exit.
+///     - > 0: if info[i] = j, the leading minor of order j of $A_i$
+///       is not positive definite, so its factorization
+///       could not be completed.
+///
+/// @throws Error if arguments of any problem are invalid,
+///     before any problem is factored.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch_size, std::vector< int64_t >& info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_size, info );
+}
+
+//==============================================================================
+/// Computes the Cholesky factorizations of a batch of Hermitian
+/// positive definite matrices $A_i$, stored at a fixed stride.
+/// Same as `lapack::potrf_batch`, but all problems have the same size
+/// and $A_i$ starts at A + i*strideA.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_i$ is stored.
+///
+/// @param[in] n
+///     The order of each matrix $A_i$. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in an lda-by-n-by-batch_size array.
+///     On exit, the factors $U_i$ or $L_i$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_i$. lda >= max(1, n).
+///
+/// @param[in] strideA
+///     Distance between the first elements of $A_i$ and $A_{i+1}$.
+///     strideA >= lda*n.
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[i] is the return value
+///     of `lapack::potrf` for problem i.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_strided( uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_strided( uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_strided( uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void potrf_batch_strided(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_strided( uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//==============================================================================
+/// Computes the Cholesky factorizations of a batch of Hermitian
+/// positive definite matrices $A_i$, stored in interleaved layout.
+/// Same as `lapack::potrf_batch_strided`, but the batch index is
+/// innermost: element (r, c) of $A_k$ is at A[ k + (r + c*lda)*batch_size ].
+///
+/// Rather than calling `lapack::potrf` on each problem, this uses
+/// an unblocked factorization that works on chunks of problems at once,
+/// vectorizing across the batch, with chunks processed in parallel
+/// using OpenMP. This is much faster than the strided version
+/// for tiny matrices, n <= 16 or so, where LAPACK's overheads dominate
+/// and there is too little work within one problem to vectorize.
+/// For larger matrices, the strided version is faster.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each $A_k$ is stored.
+///
+/// @param[in] n
+///     The order of each matrix $A_k$. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of matrices, stored in a batch_size-by-lda-by-n array.
+///     On exit, the factors $U_k$ or $L_k$.
+///
+/// @param[in] lda
+///     The leading dimension of each $A_k$, in elements of one problem.
+///     lda >= max(1, n).
+///
+/// @param[in] batch_size
+///     The number of problems.
+///
+/// @param[out] info
+///     Array of length batch_size. On exit, info[k] is set as in
+///     `lapack::potrf` for problem k.
+///     If info[k] = j > 0, columns j, ..., n of $A_k$ are left
+///     as they were when the failure was detected.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup posv_batch
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_interleaved( uplo, n, A, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_batch
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_interleaved( uplo, n, A, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_batch
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_interleaved( uplo, n, A, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_batch
+void potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    size_t batch_size, int64_t* info )
+{
+    impl::potrf_batch_interleaved( uplo, n, A, lda, batch_size, info );
+}
+
+}  // namespace lapack
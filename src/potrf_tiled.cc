@@ -0,0 +1,250 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "batch.hh"
+#include "task_graph.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Tiled Cholesky factorization, as a DAG of tile tasks
+/// (potrf, trsm, herk, gemm) run on a work-stealing thread pool.
+/// Vendor BLAS is set to one thread while tasks run.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t nb, int num_threads )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Op;
+    using blas::Side;
+    using blas::Diag;
+
+    const scalar_t one = 1;
+    const real_t r_one = 1;
+
+    int64_t nt = (n + nb - 1) / nb;
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return A + i*nb + j*nb*lda;
+    };
+    auto tile_size = [&]( int64_t i ) {
+        return blas::min( nb, n - i*nb );
+    };
+    auto key = [&]( int64_t i, int64_t j ) {
+        return i + j*nt;
+    };
+
+    // First diagonal tile that isn't positive definite sets info;
+    // all later tasks depend on it, so cancelling stops the factorization.
+    std::atomic< int64_t > info( 0 );
+    internal::TaskGraph graph;
+
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t kb = tile_size( k );
+        scalar_t* Akk = tile( k, k );
+
+        graph.add( [=, &info, &graph] {
+            int64_t iinfo = lapack::potrf( uplo, kb, Akk, lda );
+            if (iinfo != 0) {
+                info = k*nb + iinfo;
+                graph.cancel();
+            }
+        }, {}, key( k, k ), true );
+
+        if (uplo == lapack::Uplo::Lower) {
+            // A(i, k) = A(i, k) L(k, k)^{-H}
+            for (int64_t i = k+1; i < nt; ++i) {
+                int64_t ib = tile_size( i );
+                scalar_t* Aik = tile( i, k );
+                graph.add( [=] {
+                    blas::trsm( Layout::ColMajor, Side::Right, uplo,
+                                Op::ConjTrans, Diag::NonUnit,
+                                ib, kb, one, Akk, lda, Aik, lda );
+                }, { key( k, k ) }, key( i, k ), i == k+1 );
+            }
+            // A(i, j) -= A(i, k) A(j, k)^H, lower triangle of trailing matrix
+            for (int64_t i = k+1; i < nt; ++i) {
+                int64_t ib = tile_size( i );
+                scalar_t* Aik = tile( i, k );
+                graph.add( [=] {
+                    blas::herk( Layout::ColMajor, uplo, Op::NoTrans,
+                                ib, kb, -r_one, Aik, lda, r_one, tile( i, i ), lda );
+                }, { key( i, k ) }, key( i, i ), i == k+1 );
+
+                for (int64_t j = k+1; j < i; ++j) {
+                    int64_t jb = tile_size( j );
+                    graph.add( [=] {
+                        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                                    ib, jb, kb, -one, Aik, lda, tile( j, k ), lda,
+                                    one, tile( i, j ), lda );
+                    }, { key( i, k ), key( j, k ) }, key( i, j ), j == k+1 );
+                }
+            }
+        }
+        else {
+            // A(k, i) = U(k, k)^{-H} A(k, i)
+            for (int64_t i = k+1; i < nt; ++i) {
+                int64_t ib = tile_size( i );
+                scalar_t* Aki = tile( k, i );
+                graph.add( [=] {
+                    blas::trsm( Layout::ColMajor, Side::Left, uplo,
+                                Op::ConjTrans, Diag::NonUnit,
+                                kb, ib, one, Akk, lda, Aki, lda );
+                }, { key( k, k ) }, key( k, i ), i == k+1 );
+            }
+            // A(j, i) -= A(k, j)^H A(k, i), upper triangle of trailing matrix
+            for (int64_t i = k+1; i < nt; ++i) {
+                int64_t ib = tile_size( i );
+                scalar_t* Aki = tile( k, i );
+                graph.add( [=] {
+                    blas::herk( Layout::ColMajor, uplo, Op::ConjTrans,
+                                ib, kb, -r_one, Aki, lda, r_one, tile( i, i ), lda );
+                }, { key( k, i ) }, key( i, i ), i == k+1 );
+
+                for (int64_t j = k+1; j < i; ++j) {
+                    int64_t jb = tile_size( j );
+                    graph.add( [=] {
+                        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                    jb, ib, kb, -one, tile( k, j ), lda, Aki, lda,
+                                    one, tile( j, i ), lda );
+                    }, { key( k, j ), key( k, i ) }, key( j, i ), j == k+1 );
+                }
+            }
+        }
+    }
+
+    internal::SingleThreadBlas blas_threads;
+    graph.run( num_threads );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization using the given method.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    lapack::Method method )
+{
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( method != Method::Lapack &&
+                     method != Method::Tiled );
+
+    int num_threads = internal::batch_max_threads();
+    int64_t nb = internal::tiled_nb( n, num_threads );
+    if (method == Method::Lapack || n <= nb) {
+        return lapack::potrf( uplo, n, A, lda );
+    }
+    return potrf_tiled( uplo, n, A, lda, nb, num_threads );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A, as `lapack::potrf` does,
+/// using the given method:
+///
+/// - Method::Lapack: calls LAPACK potrf, using the threading of the
+///   vendor library.
+///
+/// - Method::Tiled: splits A into nb-by-nb tiles and runs tile
+///   operations as a DAG of tasks on a work-stealing pool of threads,
+///   with the vendor BLAS set to one thread. Tasks start as soon as
+///   their inputs are ready, without the fork-join barrier after each
+///   panel, which helps scaling on many cores for mid-size n.
+///   The number of threads is the OpenMP max threads
+///   (e.g., from `$OMP_NUM_THREADS`).
+///   If A is a single tile, this calls LAPACK potrf.
+///
+/// Results agree with Method::Lapack up to rounding. If the leading minor
+/// of order i is not positive definite, both return i; the contents of A
+/// then differ, as the factorization stops at different points.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, if return value = 0, the factor U or L from the Cholesky
+///     factorization $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] method
+///     Method::Lapack or Method::Tiled.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::potrf( uplo, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::potrf( uplo, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::potrf( uplo, n, A, lda, method );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack::Method method )
+{
+    return impl::potrf( uplo, n, A, lda, method );
+}
+
+}  // namespace lapack
@@ -0,0 +1,451 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/fortran.h"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Rank-1 update, $R^H R + x x^H$ or $L L^H + x x^H$, using Givens
+/// rotations (LINPACK xCHUD). Upper is done a column of R at a time,
+/// Lower a column of L at a time, so both access A with unit stride.
+/// Rotations keep the diagonal real and positive.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void potrf_update_rank1(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t const* x,
+    std::vector< blas::real_type< scalar_t > >& c,
+    std::vector< scalar_t >& s )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (uplo == Uplo::Upper) {
+        // The row appended to R is x^H.
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t* Aj = &A[ j*lda ];
+            scalar_t xj = conj( x[ j ] );
+            for (int64_t i = 0; i < j; ++i) {
+                scalar_t t = c[ i ]*Aj[ i ] + s[ i ]*xj;
+                xj = c[ i ]*xj - conj( s[ i ] )*Aj[ i ];
+                Aj[ i ] = t;
+            }
+            // Rotation annihilating xj against R(j, j).
+            real_t rjj = real( Aj[ j ] );
+            real_t norm = lapack::lapy2( rjj, std::abs( xj ) );
+            c[ j ] = rjj / norm;
+            s[ j ] = conj( xj ) / norm;
+            Aj[ j ] = norm;
+        }
+    }
+    else {
+        // The column appended to L is x; s holds its updated entries.
+        std::copy( x, x + n, s.begin() );
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t* Ai = &A[ i + i*lda ];
+            real_t lii = real( Ai[ 0 ] );
+            real_t norm = lapack::lapy2( lii, std::abs( s[ i ] ) );
+            real_t ci = lii / norm;
+            scalar_t si = s[ i ] / norm;
+            Ai[ 0 ] = norm;
+            for (int64_t j = i+1; j < n; ++j) {
+                scalar_t t = ci*Ai[ j-i ] + conj( si )*s[ j ];
+                s[ j ] = ci*s[ j ] - si*Ai[ j-i ];
+                Ai[ j-i ] = t;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Rank-1 downdate, $R^H R - x x^H$ or $L L^H - x x^H$, using Givens
+/// rotations (LINPACK xCHDD).
+/// @return 0, or 1 if the downdated matrix is not positive definite,
+/// in which case A is unchanged.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf_downdate_rank1(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t const* x,
+    std::vector< blas::real_type< scalar_t > >& c,
+    std::vector< scalar_t >& s,
+    std::vector< scalar_t >& w )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const real_t r_one = 1;
+
+    // Solve R^H p = x, or L p = x.
+    std::copy( x, x + n, w.begin() );
+    blas::trsv( blas::Layout::ColMajor, uplo,
+                (uplo == Uplo::Upper ? blas::Op::ConjTrans : blas::Op::NoTrans),
+                blas::Diag::NonUnit, n, A, lda, &w[ 0 ], 1 );
+    real_t pnorm = blas::nrm2( n, &w[ 0 ], 1 );
+    if (! (pnorm < r_one))
+        return 1;
+
+    // Rotations taking [ p; alpha ] to [ 0; 1 ], from the bottom up.
+    real_t alpha = std::sqrt( (r_one - pnorm) * (r_one + pnorm) );
+    for (int64_t i = n-1; i >= 0; --i) {
+        real_t alpha_new = lapack::lapy2( alpha, std::abs( w[ i ] ) );
+        c[ i ] = alpha / alpha_new;
+        s[ i ] = conj( w[ i ] ) / alpha_new;
+        alpha = alpha_new;
+    }
+
+    // Apply them to [ R; 0 ], removing x^H from the bottom row.
+    if (uplo == Uplo::Upper) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t* Aj = &A[ j*lda ];
+            scalar_t xx = 0;
+            for (int64_t i = j; i >= 0; --i) {
+                scalar_t t = c[ i ]*xx + s[ i ]*Aj[ i ];
+                Aj[ i ] = c[ i ]*Aj[ i ] - conj( s[ i ] )*xx;
+                xx = t;
+            }
+        }
+    }
+    else {
+        // Same, with R(i, j) = conj( L(j, i) ), a column of L at a time;
+        // w holds conj( xx ) for each row of L.
+        std::fill( w.begin(), w.end(), scalar_t( 0 ) );
+        for (int64_t i = n-1; i >= 0; --i) {
+            scalar_t* Ai = &A[ i*lda ];
+            for (int64_t j = i; j < n; ++j) {
+                scalar_t t = c[ i ]*w[ j ] + conj( s[ i ] )*Ai[ j ];
+                Ai[ j ] = c[ i ]*Ai[ j ] - s[ i ]*w[ j ];
+                w[ j ] = t;
+            }
+        }
+    }
+    return 0;
+}
+
+#if LAPACK_VERSION >= 30400  // >= 3.4
+
+//------------------------------------------------------------------------------
+/// Rank-k update using the blocked Householder QR of [ R; X^H ]
+/// (tpqrt), or LQ of [ L, X ] (tplqt), then flips signs so the
+/// diagonal is positive. Requires k > 1, and for Lower, LAPACK >= 3.7.
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+void potrf_update_blocked(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    int64_t nb = min( n, 32 );
+    std::vector< scalar_t > B( k*n );
+    std::vector< scalar_t > T( nb*n );
+
+    if (uplo == Uplo::Upper) {
+        // B = X^H, k-by-n.
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < k; ++i)
+                B[ i + j*k ] = conj( X[ j + i*ldx ] );
+        lapack::tpqrt( k, n, 0, nb, A, lda, &B[ 0 ], k, &T[ 0 ], nb );
+
+        for (int64_t i = 0; i < n; ++i) {
+            if (real( A[ i + i*lda ] ) < real_t( 0 )) {
+                for (int64_t j = i; j < n; ++j)
+                    A[ i + j*lda ] = -A[ i + j*lda ];
+            }
+        }
+    }
+    #if LAPACK_VERSION >= 30700  // >= 3.7
+    else {
+        // B = X, n-by-k.
+        lapack::lacpy( MatrixType::General, n, k, X, ldx, &B[ 0 ], n );
+        lapack::tplqt( n, k, 0, nb, A, lda, &B[ 0 ], n, &T[ 0 ], nb );
+
+        for (int64_t j = 0; j < n; ++j) {
+            if (real( A[ j + j*lda ] ) < real_t( 0 )) {
+                for (int64_t i = j; i < n; ++i)
+                    A[ i + j*lda ] = -A[ i + j*lda ];
+            }
+        }
+    }
+    #endif
+}
+
+#endif  // LAPACK >= 3.4
+
+//------------------------------------------------------------------------------
+/// @see lapack::potrf_update
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    if (n == 0 || k == 0)
+        return 0;
+
+    // tpqrt is LAPACK >= 3.4, tplqt >= 3.7; otherwise, or for
+    // rank 1, apply Givens rotations a column of X at a time.
+    #if LAPACK_VERSION >= 30700  // >= 3.7
+        bool blocked = k > 1;
+    #elif LAPACK_VERSION >= 30400  // >= 3.4
+        bool blocked = k > 1 && uplo == Uplo::Upper;
+    #endif
+
+    #if LAPACK_VERSION >= 30400  // >= 3.4
+        if (blocked) {
+            potrf_update_blocked( uplo, n, k, A, lda, X, ldx );
+            return 0;
+        }
+    #endif
+
+    std::vector< real_t > c( n );
+    std::vector< scalar_t > s( n );
+    for (int64_t l = 0; l < k; ++l) {
+        potrf_update_rank1( uplo, n, A, lda, &X[ l*ldx ], c, s );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::potrf_downdate
+/// @ingroup posv_internal
+///
+template <typename scalar_t>
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    if (n == 0 || k == 0)
+        return 0;
+
+    std::vector< real_t > c( n );
+    std::vector< scalar_t > s( n );
+    std::vector< scalar_t > w( n );
+    for (int64_t l = 0; l < k; ++l) {
+        if (potrf_downdate_rank1( uplo, n, A, lda, &X[ l*ldx ], c, s, w ) != 0)
+            return l + 1;
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Updates the Cholesky factorization of an n-by-n Hermitian positive
+/// definite matrix A, as computed by `lapack::potrf`, to that of
+/// $A + X X^H$, where X is n-by-k. This costs $O(k n^2)$, compared to
+/// $O(n^3)$ to refactor, e.g., to add observations to a least squares
+/// problem with normal matrix A.
+///
+/// For k = 1, or if the LAPACK library lacks tpqrt (Upper) or tplqt
+/// (Lower), this applies Givens rotations for each column of X.
+/// For k > 1, it computes the blocked Householder QR factorization
+/// of $[ U; X^H ]$ using tpqrt, or the LQ factorization of $[ L, X ]$
+/// using tplqt, which use larfg and level 3 BLAS block reflectors.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A holds the factor U, $A = U^H U$;
+///     - lapack::Uplo::Lower: A holds the factor L, $A = L L^H$.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the update. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from `lapack::potrf`, with positive
+///     diagonal. On exit, the factor of $A + X X^H$, with positive diagonal.
+///     The other triangle of A is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit.
+///
+/// @see potrf_downdate
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//==============================================================================
+/// Downdates the Cholesky factorization of an n-by-n Hermitian positive
+/// definite matrix A, as computed by `lapack::potrf`, to that of
+/// $A - X X^H$, where X is n-by-k. This costs $O(k n^2)$, compared to
+/// $O(n^3)$ to refactor, e.g., to remove observations from a least
+/// squares problem with normal matrix A.
+///
+/// Each column x of X is removed in turn by solving $U^H p = x$
+/// (or $L p = x$) and applying Givens rotations (LINPACK xCHDD),
+/// which is stable in the mixed sense. There is no blocked
+/// version, since the Householder reflectors in LAPACK are orthogonal,
+/// not the hyperbolic reflectors a blocked downdate needs.
+/// Downdating is ill conditioned when $A - X X^H$ is nearly singular,
+/// i.e., when $||p||_2$ is close to 1.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A holds the factor U, $A = U^H U$;
+///     - lapack::Uplo::Lower: A holds the factor L, $A = L L^H$.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the downdate. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from `lapack::potrf`, with positive
+///     diagonal. On successful exit, the factor of $A - X X^H$,
+///     with positive diagonal.
+///     The other triangle of A is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, removing column i of X would leave
+///     a matrix that is not positive definite. A holds the factor with
+///     columns 1, ..., i-1 of X removed.
+///
+/// @see potrf_update
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+}  // namespace lapack
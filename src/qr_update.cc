@@ -0,0 +1,727 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Applies the plane rotation G = [ c s; -conj(s) c ] to vectors x and y:
+/// [ x; y ] = G [ x; y ]. To apply G to rows i1, i2 of R, call with rows
+/// of R; to apply G^H to columns i1, i2 of Q (Q = Q G^H), call with
+/// columns of Q and conj( s ).
+template <typename scalar_t>
+void rot(
+    int64_t n,
+    scalar_t* x, int64_t incx,
+    scalar_t* y, int64_t incy,
+    blas::real_type< scalar_t > c, scalar_t s )
+{
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t t = c*x[ i*incx ] + s*y[ i*incy ];
+        y[ i*incy ] = c*y[ i*incy ] - conj( s )*x[ i*incx ];
+        x[ i*incx ] = t;
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @see lapack::qr_update
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void qr_update(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* u, scalar_t const* v )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( Q == nullptr );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+
+    if (m == 0 || n == 0)
+        return;
+
+    // w = Q^H u
+    std::vector< scalar_t > w( m );
+    blas::gemv( blas::Layout::ColMajor, blas::Op::ConjTrans, m, m,
+                1.0, Q, ldq, u, 1, 0.0, &w[ 0 ], 1 );
+
+    // Rotate w to r e_1 from the bottom up, making R upper Hessenberg,
+    // with subdiagonal h(i) = R(i+1, i) kept outside R.
+    std::vector< scalar_t > h( min( m - 1, n ) );
+    real_t c;
+    scalar_t s, r;
+    for (int64_t i = m-2; i >= 0; --i) {
+        lapack::lartg( w[ i ], w[ i+1 ], &c, &s, &r );
+        w[ i ] = r;
+        if (i < n) {
+            h[ i ] = -conj( s )*R[ i + i*ldr ];
+            R[ i + i*ldr ] *= c;
+            rot( n-i-1, &R[ i + (i+1)*ldr ], ldr,
+                        &R[ i+1 + (i+1)*ldr ], ldr, c, s );
+        }
+        rot( m, &Q[ i*ldq ], 1, &Q[ (i+1)*ldq ], 1, c, conj( s ) );
+    }
+
+    // R(0, :) += w(0) v^H
+    for (int64_t j = 0; j < n; ++j)
+        R[ j*ldr ] += w[ 0 ]*conj( v[ j ] );
+
+    // Restore R to upper triangular, from the top down.
+    for (int64_t i = 0; i < min( m - 1, n ); ++i) {
+        lapack::lartg( R[ i + i*ldr ], h[ i ], &c, &s, &r );
+        R[ i + i*ldr ] = r;
+        rot( n-i-1, &R[ i + (i+1)*ldr ], ldr,
+                    &R[ i+1 + (i+1)*ldr ], ldr, c, s );
+        rot( m, &Q[ i*ldq ], 1, &Q[ (i+1)*ldq ], 1, c, conj( s ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::qr_insert_row
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void qr_insert_row(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( j < 0 || j > m );
+    lapack_error_if( Q != nullptr && ldq < m + 1 );
+    lapack_error_if( ldr < max( 1, min( m + 1, n ) ) );
+
+    // Q = P [ Q 0; 0 1 ], where P moves row m to row j.
+    if (Q != nullptr) {
+        for (int64_t k = 0; k < m; ++k) {
+            scalar_t* Qk = &Q[ k*ldq ];
+            std::copy_backward( Qk + j, Qk + m, Qk + m + 1 );
+            Qk[ j ] = 0;
+        }
+        scalar_t* Qm = &Q[ m*ldq ];
+        std::fill( Qm, Qm + m + 1, scalar_t( 0 ) );
+        Qm[ j ] = 1;
+    }
+
+    // Rotate x, as row m of [ R; x^T ], into R from the top down.
+    std::vector< scalar_t > w( x, x + n );
+    real_t c;
+    scalar_t s, r;
+    for (int64_t i = 0; i < min( m, n ); ++i) {
+        lapack::lartg( R[ i + i*ldr ], w[ i ], &c, &s, &r );
+        R[ i + i*ldr ] = r;
+        rot( n-i-1, &R[ i + (i+1)*ldr ], ldr, &w[ i+1 ], 1, c, s );
+        if (Q != nullptr)
+            rot( m+1, &Q[ i*ldq ], 1, &Q[ m*ldq ], 1, c, conj( s ) );
+    }
+
+    // If m < n, what is left of x is row m of R; otherwise it is zero.
+    for (int64_t k = m; k < n; ++k)
+        R[ m + k*ldr ] = w[ k ];
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::qr_delete_row
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void qr_delete_row(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( m < 1 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( j < 0 || j >= m );
+    lapack_error_if( Q == nullptr );
+    lapack_error_if( ldq < m );
+    lapack_error_if( ldr < m );
+
+    // w = Q(j, :)^H. Rotate w to r e_1 from the bottom up, where |r| = 1,
+    // so column 1 of Q G^H is conj(r) e_j, and row 1 of G R is removed.
+    // G R is upper Hessenberg; row i+1 of G R, which no later rotation
+    // touches, is stored as row i of the new R, while the updated row i
+    // is carried in t for the next rotation.
+    std::vector< scalar_t > w( m );
+    for (int64_t k = 0; k < m; ++k)
+        w[ k ] = conj( Q[ j + k*ldq ] );
+
+    std::vector< scalar_t > t( n, scalar_t( 0 ) );
+    for (int64_t k = m-1; k < n; ++k)
+        t[ k ] = R[ m-1 + k*ldr ];
+
+    real_t c;
+    scalar_t s, r;
+    for (int64_t i = m-2; i >= 0; --i) {
+        lapack::lartg( w[ i ], w[ i+1 ], &c, &s, &r );
+        w[ i ] = r;
+        for (int64_t k = i; k < n; ++k) {
+            scalar_t rik = R[ i + k*ldr ];
+            R[ i + k*ldr ] = c*t[ k ] - conj( s )*rik;
+            t[ k ] = c*rik + s*t[ k ];
+        }
+        rot( m, &Q[ i*ldq ], 1, &Q[ (i+1)*ldq ], 1, c, conj( s ) );
+    }
+
+    // Remove row j and column 1 of Q.
+    for (int64_t k = 0; k < m-1; ++k) {
+        scalar_t const* src = &Q[ (k+1)*ldq ];
+        scalar_t* dst = &Q[ k*ldq ];
+        std::copy( src, src + j, dst );
+        std::copy( src + j + 1, src + m, dst + j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::qr_insert_col
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void qr_insert_col(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( j < 0 || j > n );
+    lapack_error_if( Q == nullptr );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+
+    if (m == 0)
+        return;
+
+    // w = Q^H x
+    std::vector< scalar_t > w( m );
+    blas::gemv( blas::Layout::ColMajor, blas::Op::ConjTrans, m, m,
+                1.0, Q, ldq, x, 1, 0.0, &w[ 0 ], 1 );
+
+    // Shift columns j, ..., n-1 of R right by one.
+    for (int64_t k = n-1; k >= j; --k) {
+        int64_t rows = min( k + 1, m );
+        std::copy_n( &R[ k*ldr ], rows, &R[ (k+1)*ldr ] );
+        if (k+1 < m)
+            R[ k+1 + (k+1)*ldr ] = 0;
+    }
+
+    // Rotate w to r e_j from the bottom up; each rotation also fills in
+    // the diagonal of the shifted column to its right.
+    real_t c;
+    scalar_t s, r;
+    for (int64_t i = m-2; i >= j; --i) {
+        lapack::lartg( w[ i ], w[ i+1 ], &c, &s, &r );
+        w[ i ] = r;
+        if (i+1 <= n) {
+            rot( n-i, &R[ i + (i+1)*ldr ], ldr,
+                      &R[ i+1 + (i+1)*ldr ], ldr, c, s );
+        }
+        rot( m, &Q[ i*ldq ], 1, &Q[ (i+1)*ldq ], 1, c, conj( s ) );
+    }
+
+    std::copy_n( &w[ 0 ], min( j + 1, m ), &R[ j*ldr ] );
+}
+
+//------------------------------------------------------------------------------
+/// @see lapack::qr_delete_col
+/// @ingroup geqrf_internal
+///
+template <typename scalar_t>
+void qr_delete_col(
+    int64_t m, int64_t n,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    int64_t j )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 1 );
+    lapack_error_if( j < 0 || j >= n );
+    lapack_error_if( Q != nullptr && ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, min( m, n ) ) );
+
+    // Shift each column k+1 left, then zero its subdiagonal R(k+1, k)
+    // with a rotation of rows k, k+1, applied to the columns not yet shifted.
+    real_t c;
+    scalar_t s, r;
+    for (int64_t k = j; k < n-1; ++k) {
+        std::copy_n( &R[ (k+1)*ldr ], min( k + 1, m ), &R[ k*ldr ] );
+        if (k+1 < m) {
+            lapack::lartg( R[ k + k*ldr ], R[ k+1 + (k+1)*ldr ], &c, &s, &r );
+            R[ k + k*ldr ] = r;
+            rot( n-k-2, &R[ k + (k+2)*ldr ], ldr,
+                        &R[ k+1 + (k+2)*ldr ], ldr, c, s );
+            if (Q != nullptr)
+                rot( m, &Q[ k*ldq ], 1, &Q[ (k+1)*ldq ], 1, c, conj( s ) );
+        }
+    }
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Updates the full QR factorization $A = QR$ of an m-by-n matrix A
+/// to that of $A + u v^H$, using $2 \min( m, n )$ Givens rotations.
+/// This costs $O(m^2 + mn)$, compared to $O(m^2 n)$ to refactor with
+/// geqrf and ungqr.
+///
+/// Q and R come from, e.g., `lapack::geqrf`, then `lapack::ungqr` with
+/// m columns. Only the upper trapezoid of R is referenced, so R can be
+/// the output of geqrf itself.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The m-by-n upper trapezoidal matrix R, stored in an ldr-by-n array.
+///     On exit, the updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] u
+///     The vector u of length m.
+///
+/// @param[in] v
+///     The vector v of length n.
+///
+/// @see qr_insert_row, qr_delete_row, qr_insert_col, qr_delete_col
+/// @ingroup geqrf_update
+void qr_update(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* u, float const* v )
+{
+    impl::qr_update( m, n, Q, ldq, R, ldr, u, v );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_update
+void qr_update(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* u, double const* v )
+{
+    impl::qr_update( m, n, Q, ldq, R, ldr, u, v );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_update
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* u, std::complex<float> const* v )
+{
+    impl::qr_update( m, n, Q, ldq, R, ldr, u, v );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_update
+void qr_update(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* u, std::complex<double> const* v )
+{
+    impl::qr_update( m, n, Q, ldq, R, ldr, u, v );
+}
+
+//==============================================================================
+/// Updates the full QR factorization $A = QR$ of an m-by-n matrix A
+/// to that of the (m+1)-by-n matrix with row $x^T$ inserted before row j
+/// of A, using $\min( m, n )$ Givens rotations.
+///
+/// If Q is null, only R is updated, at a cost of $O(n^2)$ instead of
+/// $O(m^2 + mn)$. This suffices to maintain least squares solutions
+/// as rows are added: factor $[ A, b ]$, insert rows $[ x^T, \beta ]$,
+/// and solve with the leading n-by-n triangle of R and the first n
+/// entries of its last column, as gels does.
+///
+/// Only the upper trapezoid of R is referenced, so R can be the output
+/// of geqrf itself. If m >= n, rows n, ..., m of R are zero and not
+/// referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in,out] Q
+///     On entry, the m-by-m unitary matrix Q, stored in an ldq-by-(m+1)
+///     array. On exit, the (m+1)-by-(m+1) updated Q.
+///     If null, Q is not updated.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. If Q is not null, ldq >= m+1.
+///
+/// @param[in,out] R
+///     On entry, the m-by-n upper trapezoidal matrix R, stored in an
+///     ldr-by-n array. On exit, the (m+1)-by-n updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1, min(m+1, n)).
+///
+/// @param[in] j
+///     The row of the updated A that holds x, 0-based. 0 <= j <= m.
+///     Only Q depends on j.
+///
+/// @param[in] x
+///     The vector x of length n.
+///
+/// @ingroup geqrf_update
+void qr_insert_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x )
+{
+    impl::qr_insert_row( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_update
+void qr_insert_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x )
+{
+    impl::qr_insert_row( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_update
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x )
+{
+    impl::qr_insert_row( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_update
+void qr_insert_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x )
+{
+    impl::qr_insert_row( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//==============================================================================
+/// Updates the full QR factorization $A = QR$ of an m-by-n matrix A
+/// to that of the (m-1)-by-n matrix with row j of A deleted, using
+/// $m - 1$ Givens rotations. This costs $O(m^2 + mn)$.
+///
+/// Only the upper trapezoid of R is referenced, so R can be the output
+/// of geqrf itself.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of A. m >= 1.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in,out] Q
+///     On entry, the m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the (m-1)-by-(m-1) updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= m.
+///
+/// @param[in,out] R
+///     On entry, the m-by-n upper trapezoidal matrix R, stored in an
+///     ldr-by-n array. On exit, the (m-1)-by-n updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= m.
+///
+/// @param[in] j
+///     The row of A to delete, 0-based. 0 <= j < m.
+///
+/// @ingroup geqrf_update
+void qr_delete_row(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_row( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_update
+void qr_delete_row(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_row( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_update
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_row( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_update
+void qr_delete_row(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_row( m, n, Q, ldq, R, ldr, j );
+}
+
+//==============================================================================
+/// Updates the full QR factorization $A = QR$ of an m-by-n matrix A
+/// to that of the m-by-(n+1) matrix with column x inserted before
+/// column j of A, using $m - j - 1$ Givens rotations.
+/// This costs $O(m^2 + mn)$.
+///
+/// Only the upper trapezoid of R is referenced, so R can be the output
+/// of geqrf itself.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     On entry, the m-by-n upper trapezoidal matrix R, stored in an
+///     ldr-by-(n+1) array. On exit, the m-by-(n+1) updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] j
+///     The column of the updated A that holds x, 0-based. 0 <= j <= n.
+///
+/// @param[in] x
+///     The vector x of length m.
+///
+/// @ingroup geqrf_update
+void qr_insert_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j, float const* x )
+{
+    impl::qr_insert_col( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_update
+void qr_insert_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j, double const* x )
+{
+    impl::qr_insert_col( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_update
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j, std::complex<float> const* x )
+{
+    impl::qr_insert_col( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_update
+void qr_insert_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j, std::complex<double> const* x )
+{
+    impl::qr_insert_col( m, n, Q, ldq, R, ldr, j, x );
+}
+
+//==============================================================================
+/// Updates the full QR factorization $A = QR$ of an m-by-n matrix A
+/// to that of the m-by-(n-1) matrix with column j of A deleted, using
+/// $\min( m, n ) - j - 1$ Givens rotations.
+///
+/// If Q is null, only R is updated, at a cost of $O(n^2)$ instead of
+/// $O(mn)$. As for qr_insert_row, least squares solutions can be
+/// maintained by factoring $[ A, b ]$; delete columns before the last.
+///
+/// Only the upper trapezoid of R is referenced, so R can be the output
+/// of geqrf itself.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 1.
+///
+/// @param[in,out] Q
+///     The m-by-m unitary matrix Q, stored in an ldq-by-m array.
+///     On exit, the updated Q. If null, Q is not updated.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. If Q is not null,
+///     ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     On entry, the m-by-n upper trapezoidal matrix R, stored in an
+///     ldr-by-n array. On exit, the m-by-(n-1) updated R.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1, min(m, n)).
+///
+/// @param[in] j
+///     The column of A to delete, 0-based. 0 <= j < n.
+///
+/// @ingroup geqrf_update
+void qr_delete_col(
+    int64_t m, int64_t n,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_col( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup geqrf_update
+void qr_delete_col(
+    int64_t m, int64_t n,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_col( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup geqrf_update
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_col( m, n, Q, ldq, R, ldr, j );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup geqrf_update
+void qr_delete_col(
+    int64_t m, int64_t n,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    int64_t j )
+{
+    impl::qr_delete_col( m, n, Q, ldq, R, ldr, j );
+}
+
+}  // namespace lapack
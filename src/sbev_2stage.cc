@@ -17,12 +17,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sbev_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sbev_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,30 +45,38 @@ int64_t sbev_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssbev_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssbev_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssbev_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -71,11 +85,12 @@ int64_t sbev_2stage(
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbev_2stage(
+int64_t sbev_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -92,30 +107,38 @@ int64_t sbev_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbev_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsbev_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsbev_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -123,6 +146,90 @@ int64_t sbev_2stage(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbev_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                 &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                        host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sbev_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                             work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbev_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                             work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
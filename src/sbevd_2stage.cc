@@ -17,12 +17,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sbevd_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sbevd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,35 +45,44 @@ int64_t sbevd_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssbevd_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "ssbevd_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssbevd_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -76,11 +91,12 @@ int64_t sbevd_2stage(
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbevd_2stage(
+int64_t sbevd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -97,35 +113,44 @@ int64_t sbevd_2stage(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbevd_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dsbevd_2stage", { jobz_, uplo_, n_, kd_, ldab_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsbevd_2stage(
+            &jobz_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsbevd_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -133,6 +158,90 @@ int64_t sbevd_2stage(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbevd_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                  &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbevd_2stage_work_size_bytes( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                                  &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbevd_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sbevd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbevd_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbevd_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                              work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbevd_2stage_work( jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+                              work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
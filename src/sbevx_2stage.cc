@@ -17,15 +17,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sbevx_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab,
     float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -48,37 +54,46 @@ int64_t sbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssbevx_2stage(
-        &jobz_, &range_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssbevx_2stage", { jobz_, range_, uplo_, n_, kd_, ldab_, ldq_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssbevx_2stage(
+            &jobz_, &range_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
@@ -86,8 +101,8 @@ int64_t sbevx_2stage(
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -96,21 +111,22 @@ int64_t sbevx_2stage(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
+int64_t sbevx_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab,
     double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -133,37 +149,46 @@ int64_t sbevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbevx_2stage(
-        &jobz_, &range_, &uplo_, &n_, &kd_,
-        AB, &ldab_,
-        Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsbevx_2stage", { jobz_, range_, uplo_, n_, kd_, ldab_, ldq_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsbevx_2stage(
+            &jobz_, &range_, &uplo_, &n_, &kd_,
+            AB, &ldab_,
+            Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
@@ -171,8 +196,8 @@ int64_t sbevx_2stage(
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -181,12 +206,122 @@ int64_t sbevx_2stage(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    sbevx_2stage_work_size_bytes( jobz, range, uplo, n, kd, AB, ldab,
+                                  Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                                  ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab,
+                         Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    sbevx_2stage_work_size_bytes( jobz, range, uplo, n, kd, AB, ldab,
+                                  Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                                  ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab,
+                         Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl,
+                              vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                              work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl,
+                              vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                              work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
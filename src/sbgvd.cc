@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sbgvd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     float* AB, int64_t ldab,
     float* BB, int64_t ldbb,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,31 +48,40 @@ int64_t sbgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        AB, &ldab_,
-        BB, &ldbb_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "ssbgvd", { jobz_, uplo_, n_, ka_, kb_, ldab_, ldbb_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssbgvd(
+            &jobz_, &uplo_, &n_, &ka_, &kb_,
+            AB, &ldab_,
+            BB, &ldbb_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -74,8 +89,8 @@ int64_t sbgvd(
         BB, &ldbb_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -84,12 +99,13 @@ int64_t sbgvd(
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
+int64_t sbgvd_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     double* AB, int64_t ldab,
     double* BB, int64_t ldbb,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -110,31 +126,40 @@ int64_t sbgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        AB, &ldab_,
-        BB, &ldbb_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dsbgvd", { jobz_, uplo_, n_, ka_, kb_, ldab_, ldbb_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsbgvd(
+            &jobz_, &uplo_, &n_, &ka_, &kb_,
+            AB, &ldab_,
+            BB, &ldbb_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -142,8 +167,8 @@ int64_t sbgvd(
         BB, &ldbb_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -151,4 +176,96 @@ int64_t sbgvd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    sbgvd_work_size_bytes( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sbgvd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sbgvd_work( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+                       work_buffer );
+}
+
 }  // namespace lapack
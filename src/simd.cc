@@ -0,0 +1,131 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/simd.hh"
+#include "simd_kernels.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#ifndef _WIN32
+    #include <unistd.h>
+#endif
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Instruction set in use, or 0 before it is set from the environment.
+std::atomic< char > g_simd { 0 };
+
+//------------------------------------------------------------------------------
+/// @return best instruction set the processor supports.
+Simd simd_best()
+{
+    if (simd_supported( Simd::AVX512 ))
+        return Simd::AVX512;
+    if (simd_supported( Simd::AVX2 ))
+        return Simd::AVX2;
+    return Simd::Generic;
+}
+
+//------------------------------------------------------------------------------
+/// @return instruction set from LAPACKPP_SIMD, or the best one if unset.
+/// Throws Error if the value is unknown or not supported.
+Simd simd_from_env()
+{
+    const char* value = std::getenv( "LAPACKPP_SIMD" );
+    if (value == nullptr || value[ 0 ] == '\0')
+        return simd_best();
+
+    std::string name( value );
+    for (auto& c : name)
+        c = char( tolower( c ));
+
+    Simd simd;
+    if (name == "generic")
+        simd = Simd::Generic;
+    else if (name == "avx2")
+        simd = Simd::AVX2;
+    else if (name == "avx512")
+        simd = Simd::AVX512;
+    else
+        throw Error( "LAPACKPP_SIMD: unknown instruction set '" + name + "'" );
+
+    if (! simd_supported( simd ))
+        throw Error( "LAPACKPP_SIMD: " + name + " is not supported" );
+    return simd;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+bool simd_supported( Simd simd )
+{
+    switch (simd) {
+        case Simd::Generic:
+            return true;
+
+        #if defined( LAPACK_SIMD_X86 )
+            case Simd::AVX2:
+                __builtin_cpu_init();
+                return __builtin_cpu_supports( "avx2" )
+                       && __builtin_cpu_supports( "fma" );
+
+            case Simd::AVX512:
+                return simd_supported( Simd::AVX2 )
+                       && __builtin_cpu_supports( "avx512f" );
+        #endif
+
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+void simd_set( Simd simd )
+{
+    if (! simd_supported( simd ))
+        throw Error( std::string( "SIMD " ) + simd2str( simd )
+                     + " is not supported" );
+    g_simd = simd2char( simd );
+}
+
+//------------------------------------------------------------------------------
+Simd simd_get()
+{
+    char simd = g_simd;
+    if (simd == 0) {
+        // Keep a value set by simd_set in another thread meanwhile.
+        char expected = 0;
+        simd = simd2char( simd_from_env() );
+        if (! g_simd.compare_exchange_strong( expected, simd ))
+            simd = expected;
+    }
+    return Simd( simd );
+}
+
+//------------------------------------------------------------------------------
+namespace internal {
+
+int64_t llc_size()
+{
+    static const int64_t size = [] {
+        long bytes = 0;
+        #if defined( _SC_LEVEL3_CACHE_SIZE )
+            bytes = sysconf( _SC_LEVEL3_CACHE_SIZE );
+            if (bytes <= 0)
+                bytes = sysconf( _SC_LEVEL2_CACHE_SIZE );
+        #endif
+        return bytes > 0 ? int64_t( bytes ) : int64_t( 32 ) * 1024 * 1024;
+    }();
+    return size;
+}
+
+}  // namespace internal
+
+}  // namespace lapack
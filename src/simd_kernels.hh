@@ -0,0 +1,76 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SIMD_KERNELS_HH
+#define LAPACK_SIMD_KERNELS_HH
+
+#include "lapack/simd.hh"
+#include "batch.hh"
+
+#include <cmath>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// AVX2 and AVX-512 kernels are compiled with function target attributes,
+// so they don't need -mavx2 or -mavx512f for the whole library and are
+// called only after checking the CPU at runtime.
+#if (defined( __GNUC__ ) || defined( __clang__ )) && defined( __x86_64__ )
+    #define LAPACK_SIMD_X86
+    #define LAPACK_TARGET_AVX2   __attribute__(( target( "avx2,fma" ) ))
+    #define LAPACK_TARGET_AVX512 __attribute__(( target( "avx512f,avx2,fma" ) ))
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Lower bound on entries per thread, so small matrices aren't
+/// slowed down by starting threads.
+constexpr int64_t column_chunk_threshold = 64*1024;
+
+//------------------------------------------------------------------------------
+/// Splits columns [0, n) into chunks, one per thread if the matrix has
+/// enough entries, with about the same number of entries in each chunk
+/// of the upper or lower triangle, or of a general matrix.
+/// Chunks are fixed by the number of threads, not the schedule,
+/// so results are reproducible.
+///
+/// @return boundaries of chunks, with chunk t = [ bound[t], bound[t+1] ).
+///
+inline std::vector< int64_t > column_chunks(
+    lapack::Uplo uplo, int64_t n, int64_t entries )
+{
+    int64_t nchunks = 1;
+    if (entries >= 2*column_chunk_threshold) {
+        nchunks = std::min( int64_t( batch_max_threads() ),
+                            entries / column_chunk_threshold );
+    }
+    nchunks = std::max( int64_t( 1 ), std::min( nchunks, n ) );
+
+    std::vector< int64_t > bound( nchunks + 1 );
+    for (int64_t t = 0; t <= nchunks; ++t) {
+        double f = double( t ) / nchunks;
+        if (uplo == Uplo::Upper)
+            bound[ t ] = int64_t( n * std::sqrt( f ) );
+        else if (uplo == Uplo::Lower)
+            bound[ t ] = n - int64_t( n * std::sqrt( 1 - f ) );
+        else
+            bound[ t ] = int64_t( n * f );
+    }
+    bound[ 0 ] = 0;
+    bound[ nchunks ] = n;
+    return bound;
+}
+
+//------------------------------------------------------------------------------
+/// @return size in bytes of the last level cache, from the OS, or 32 MiB
+/// if unknown. Writes larger than this use non-temporal stores, which skip
+/// reading destination lines into the cache and evicting useful data.
+int64_t llc_size();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_KERNELS_HH
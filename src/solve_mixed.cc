@@ -0,0 +1,619 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::is_complex;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Overloads of lag2s, lag2c, lag2d, lag2z by type, for templates.
+
+int64_t narrow( int64_t m, int64_t n, double const* A, int64_t lda,
+                float* SA, int64_t ldsa )
+{
+    return lapack::lag2s( m, n, A, lda, SA, ldsa );
+}
+
+int64_t narrow( int64_t m, int64_t n, std::complex<double> const* A, int64_t lda,
+                std::complex<float>* SA, int64_t ldsa )
+{
+    return lapack::lag2c( m, n, A, lda, SA, ldsa );
+}
+
+// Half to float is exact, so never overflows.
+int64_t narrow( int64_t m, int64_t n, lapack::float16 const* A, int64_t lda,
+                float* SA, int64_t ldsa )
+{
+    return lapack::lag2s( m, n, A, lda, SA, ldsa );
+}
+
+int64_t narrow( int64_t m, int64_t n, lapack::bfloat16 const* A, int64_t lda,
+                float* SA, int64_t ldsa )
+{
+    return lapack::lag2s( m, n, A, lda, SA, ldsa );
+}
+
+void widen( int64_t m, int64_t n, float const* SA, int64_t ldsa,
+            double* A, int64_t lda )
+{
+    lapack::lag2d( m, n, SA, ldsa, A, lda );
+}
+
+void widen( int64_t m, int64_t n, std::complex<float> const* SA, int64_t ldsa,
+            std::complex<double>* A, int64_t lda )
+{
+    lapack::lag2z( m, n, SA, ldsa, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Narrows the uplo triangle of n-by-n A a column at a time, so entries
+/// in the other triangle can't overflow.
+/// @return 1 if an entry overflows, else 0.
+template <typename scalar_t, typename low_t>
+int64_t narrow_triangle(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda, low_t* SA, int64_t ldsa )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = (uplo == Uplo::Upper ? 0 : j);
+        int64_t i1 = (uplo == Uplo::Upper ? j+1 : n);
+        if (narrow( i1 - i0, 1, &A[ i0 + j*lda ], lda,
+                    &SA[ i0 + j*ldsa ], ldsa ) != 0)
+            return 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// @return infinity norm of A, general for LU, else Hermitian in uplo.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_inf(
+    lapack::Factorization factorization, lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda )
+{
+    if (factorization == Factorization::LU)
+        return lapack::lange( Norm::Inf, n, n, A, lda );
+    else
+        return lapack::lanhe( Norm::Inf, uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// @return infinity norm of half precision A, summed in double.
+template <typename half_t>
+double norm_inf_half(
+    lapack::Factorization factorization, lapack::Uplo uplo, int64_t n,
+    half_t const* A, int64_t lda )
+{
+    // For LU, sums rows; for Hermitian, sums the columns of the full
+    // matrix from the uplo triangle, which is the same.
+    std::vector< double > sums( n, 0.0 );
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = 0, i1 = n;
+        if (factorization != Factorization::LU) {
+            i0 = (uplo == Uplo::Upper ? 0 : j);
+            i1 = (uplo == Uplo::Upper ? j+1 : n);
+        }
+        for (int64_t i = i0; i < i1; ++i) {
+            double a = std::abs( float( A[ i + j*lda ] ) );
+            sums[ i ] += a;
+            if (factorization != Factorization::LU && i != j)
+                sums[ j ] += a;
+        }
+    }
+    double result = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        // Propagate NaN.
+        if (! (sums[ i ] <= result))
+            result = sums[ i ];
+    }
+    return result;
+}
+
+double norm_inf(
+    lapack::Factorization factorization, lapack::Uplo uplo, int64_t n,
+    lapack::float16 const* A, int64_t lda )
+{
+    return norm_inf_half( factorization, uplo, n, A, lda );
+}
+
+double norm_inf(
+    lapack::Factorization factorization, lapack::Uplo uplo, int64_t n,
+    lapack::bfloat16 const* A, int64_t lda )
+{
+    return norm_inf_half( factorization, uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Computes residual R = B - A X, where R is n-by-nrhs with leading
+/// dimension n.
+template <typename scalar_t>
+void residual(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t const* X, int64_t ldx,
+    scalar_t* R )
+{
+    using blas::Layout;
+    using blas::Op;
+    using blas::Side;
+    const scalar_t one = 1;
+
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, R, n );
+    if (factorization == Factorization::LU)
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    n, nrhs, n, -one, A, lda, X, ldx, one, R, n );
+    else
+        blas::hemm( Layout::ColMajor, Side::Left, uplo,
+                    n, nrhs, -one, A, lda, X, ldx, one, R, n );
+}
+
+//------------------------------------------------------------------------------
+/// Computes residual R = B - A X in double, for half precision A.
+/// A is widened a block of columns at a time, so the workspace is
+/// n-by-nb doubles rather than a double copy of A.
+template <typename half_t>
+void residual_half(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    half_t const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double const* X, int64_t ldx,
+    double* R )
+{
+    using blas::Layout;
+    using blas::Op;
+
+    const int64_t nb = min( 256, n );
+    std::vector< double > W( n*nb );
+
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, R, n );
+    for (int64_t k = 0; k < n; k += nb) {
+        int64_t kb = min( nb, n - k );
+        if (factorization == Factorization::LU) {
+            lapack::lag2d( n, kb, &A[ k*lda ], lda, &W[ 0 ], n );
+        }
+        else {
+            // Expand columns k : k+kb-1 of the full matrix from the
+            // uplo triangle; entries in the other triangle come from
+            // row j of the stored triangle.
+            for (int64_t jj = 0; jj < kb; ++jj) {
+                int64_t j = k + jj;
+                for (int64_t i = 0; i < n; ++i) {
+                    bool stored = (uplo == Uplo::Upper ? i <= j : i >= j);
+                    half_t a = stored ? A[ i + j*lda ] : A[ j + i*lda ];
+                    W[ i + jj*n ] = float( a );
+                }
+            }
+        }
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    n, nrhs, kb, -1.0, &W[ 0 ], n, &X[ k ], ldx,
+                    1.0, R, n );
+    }
+}
+
+void residual(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::float16 const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double const* X, int64_t ldx,
+    double* R )
+{
+    residual_half( factorization, uplo, n, nrhs, A, lda, B, ldb, X, ldx, R );
+}
+
+void residual(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::bfloat16 const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double const* X, int64_t ldx,
+    double* R )
+{
+    residual_half( factorization, uplo, n, nrhs, A, lda, B, ldb, X, ldx, R );
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B in working precision with gesv, posv, or hesv,
+/// overwriting A with its factors.
+template <typename scalar_t>
+int64_t solve_full(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* X, int64_t ldx )
+{
+    if (factorization == Factorization::LU)
+        return lapack::gesv( n, nrhs, A, lda, ipiv, X, ldx );
+    else if (factorization == Factorization::Cholesky)
+        return lapack::posv( uplo, n, nrhs, A, lda, X, ldx );
+    else
+        return lapack::hesv( uplo, n, nrhs, A, lda, ipiv, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B in double for half precision A, which is left unchanged.
+template <typename half_t>
+int64_t solve_full_half(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    half_t const* A, int64_t lda,
+    int64_t* ipiv,
+    double* X, int64_t ldx )
+{
+    std::vector< double > DA( n*n );
+    lapack::lag2d( n, n, A, lda, &DA[ 0 ], n );
+    return solve_full( factorization, uplo, n, nrhs, &DA[ 0 ], n,
+                       ipiv, X, ldx );
+}
+
+int64_t solve_full(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::float16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double* X, int64_t ldx )
+{
+    return solve_full_half( factorization, uplo, n, nrhs, A, lda,
+                            ipiv, X, ldx );
+}
+
+int64_t solve_full(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::bfloat16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double* X, int64_t ldx )
+{
+    return solve_full_half( factorization, uplo, n, nrhs, A, lda,
+                            ipiv, X, ldx );
+}
+
+}  // namespace
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// @see lapack::solve_mixed
+/// A is stored as matrix_t: either scalar_t, or for real double,
+/// float16 const or bfloat16 const.
+/// @ingroup gesv_internal
+///
+template <typename matrix_t, typename scalar_t>
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    matrix_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter, int64_t itermax, bool fallback )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using low_t = typename std::conditional< is_complex< scalar_t >::value,
+                                             std::complex<float>, float >::type;
+    using blas::Op;
+
+    const scalar_t one = 1;
+    const bool is_lu = factorization == Factorization::LU;
+
+    // check arguments
+    lapack_error_if( factorization != Factorization::LU &&
+                     factorization != Factorization::Cholesky &&
+                     factorization != Factorization::LDLT );
+    lapack_error_if( ! is_lu &&
+                     uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( factorization != Factorization::Cholesky
+                     && n > 0 && ipiv == nullptr );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( itermax < 0 );
+
+    *iter = 0;
+    if (n == 0)
+        return 0;
+
+    // Refinement stops when, for each column, max |r_i| <= max |x_i| * cte.
+    real_t anorm = norm_inf( factorization, uplo, n, A, lda );
+    real_t eps = std::numeric_limits< real_t >::epsilon() / 2;
+    real_t cte = anorm * eps * std::sqrt( real_t( n ) );
+
+    auto converged = [&]( scalar_t const* R_ ) {
+        for (int64_t j = 0; j < nrhs; ++j) {
+            real_t xnorm = 0, rnorm = 0;
+            for (int64_t i = 0; i < n; ++i) {
+                xnorm = max( xnorm, std::abs( X[ i + j*ldx ] ) );
+                rnorm = max( rnorm, std::abs( R_[ i + j*n ] ) );
+            }
+            if (! (rnorm <= xnorm * cte))
+                return false;
+        }
+        return true;
+    };
+
+    std::vector< low_t > SA( n*n );
+    std::vector< low_t > SX( n*max( 1, nrhs ) );
+    std::vector< scalar_t > R( n*max( 1, nrhs ) );
+
+    // Solves with the low precision factors, in place in SX.
+    auto solve_low = [&] {
+        if (is_lu)
+            lapack::getrs( Op::NoTrans, n, nrhs, &SA[ 0 ], n, ipiv, &SX[ 0 ], n );
+        else if (factorization == Factorization::Cholesky)
+            lapack::potrs( uplo, n, nrhs, &SA[ 0 ], n, &SX[ 0 ], n );
+        else
+            lapack::hetrs( uplo, n, nrhs, &SA[ 0 ], n, ipiv, &SX[ 0 ], n );
+    };
+
+    // Iterate; on failure, set iter < 0 as LAPACK dsgesv does and break.
+    do {
+        if (narrow( n, nrhs, B, ldb, &SX[ 0 ], n ) != 0) {
+            *iter = -2;
+            break;
+        }
+        int64_t overflow = is_lu
+            ? narrow( n, n, A, lda, &SA[ 0 ], n )
+            : narrow_triangle( uplo, n, A, lda, &SA[ 0 ], n );
+        if (overflow != 0) {
+            *iter = -2;
+            break;
+        }
+
+        int64_t info;
+        if (is_lu)
+            info = lapack::getrf( n, n, &SA[ 0 ], n, ipiv );
+        else if (factorization == Factorization::Cholesky)
+            info = lapack::potrf( uplo, n, &SA[ 0 ], n );
+        else
+            info = lapack::hetrf( uplo, n, &SA[ 0 ], n, ipiv );
+        if (info != 0) {
+            *iter = -3;
+            break;
+        }
+
+        solve_low();
+        widen( n, nrhs, &SX[ 0 ], n, X, ldx );
+        residual( factorization, uplo, n, nrhs, A, lda, B, ldb, X, ldx, &R[ 0 ] );
+        if (converged( &R[ 0 ] ))
+            return 0;
+
+        for (int64_t it = 1; it <= itermax; ++it) {
+            // Correction: X += A^{-1} R, using the low precision factors.
+            if (narrow( n, nrhs, &R[ 0 ], n, &SX[ 0 ], n ) != 0) {
+                *iter = -2;
+                break;
+            }
+            solve_low();
+            widen( n, nrhs, &SX[ 0 ], n, &R[ 0 ], n );
+            for (int64_t j = 0; j < nrhs; ++j)
+                blas::axpy( n, one, &R[ j*n ], 1, &X[ j*ldx ], 1 );
+
+            residual( factorization, uplo, n, nrhs, A, lda, B, ldb, X, ldx, &R[ 0 ] );
+            if (converged( &R[ 0 ] )) {
+                *iter = it;
+                return 0;
+            }
+        }
+        if (*iter == 0)
+            *iter = -(itermax + 1);
+    } while (false);
+
+    if (! fallback)
+        return 0;
+
+    // Fall back to factoring and solving in working precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    return solve_full( factorization, uplo, n, nrhs, A, lda, ipiv, X, ldx );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using mixed-precision iterative refinement: A is factored in
+/// single precision, then each solve with the single precision factors
+/// is corrected using residuals computed in double precision, until
+/// the solution has double precision normwise backward error quality.
+///
+/// This generalizes the mixed-precision gesv and posv overloads
+/// (LAPACK dsgesv, dsposv) to any of the getrf, potrf, or hetrf
+/// (sytrf for real) factorizations,
+/// with a given iteration limit, and optionally without falling back to
+/// a double precision solve, e.g., to try another method instead.
+/// The iteration count and fallback status use the same iter codes as
+/// the mixed-precision gesv.
+///
+/// Refinement converges if A is not too ill conditioned relative to
+/// single precision, roughly cond(A) < 1e6. It pays off when single
+/// precision is significantly faster than double, for large n.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`.
+///
+/// @param[in] factorization
+///     - lapack::Factorization::LU: A is general; uses getrf.
+///     - lapack::Factorization::Cholesky: A is Hermitian positive
+///       definite; uses potrf.
+///     - lapack::Factorization::LDLT: A is Hermitian;
+///       uses hetrf (sytrf for real).
+///
+/// @param[in] uplo
+///     For Cholesky and LDLT:
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+///     Ignored for LU.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrices B and X. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, if iter >= 0, A is unchanged; if iter < 0 and fallback
+///     is true, A contains the double precision factors, as from
+///     gesv, posv, or hesv.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     For LU and LDLT, the vector ipiv of length n.
+///     The pivots of the single precision factorization if iter >= 0,
+///     or of the double precision one if iter < 0 and fallback is true.
+///     For Cholesky, not referenced and may be null.
+///
+/// @param[in] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     On exit, if iter >= 0, or iter < 0 and fallback is true, the
+///     solution X. If iter < 0 and fallback is false, X is not a solution.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - >= 0: iterative refinement succeeded after iter iterations.
+///     - < 0: iterative refinement failed:
+///         - -2: narrowing A, B, or a residual to single precision
+///             overflowed;
+///         - -3: the single precision factorization failed;
+///         - -(itermax+1): refinement did not converge in itermax
+///             iterations.
+///
+/// @param[in] itermax
+///     The maximum number of refinement iterations. itermax >= 0.
+///     LAPACK uses 30.
+///
+/// @param[in] fallback
+///     If true and refinement fails, factor and solve in double precision.
+///
+/// @return = 0: successful exit, or refinement failed and fallback is false.
+/// @return > 0: refinement failed, and the double precision factorization
+///     failed, with info from gesv, posv, or hesv.
+///
+/// @see gesv, posv
+/// @ingroup gesv
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax, bool fallback )
+{
+    return impl::solve_mixed( factorization, uplo, n, nrhs, A, lda, ipiv,
+                              B, ldb, X, ldx, iter, itermax, fallback );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gesv
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter, int64_t itermax, bool fallback )
+{
+    return impl::solve_mixed( factorization, uplo, n, nrhs, A, lda, ipiv,
+                              B, ldb, X, ldx, iter, itermax, fallback );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n matrix stored in half precision (IEEE float16)
+/// or bfloat16, and X and B are n-by-nrhs double precision matrices.
+/// A is converted to single precision, which is exact, and factored there,
+/// then the solution is refined with residuals computed in double
+/// precision, until it has double precision normwise backward error
+/// quality for the matrix A as stored. Storing A in 16 bits halves the
+/// memory and bandwidth of a float matrix.
+///
+/// The residual widens A a block of columns at a time, so besides the
+/// single precision factors, the workspace is O(n nb + n nrhs).
+/// A is not modified; if refinement fails and fallback is true,
+/// A is converted to a double precision workspace for gesv, posv, or hesv.
+///
+/// Overloaded versions are available for
+/// `lapack::float16` and `lapack::bfloat16`.
+/// Arguments are as for the double version of lapack::solve_mixed,
+/// except:
+///
+/// @param[in] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     For Cholesky and LDLT, only the uplo triangle is accessed,
+///     except on fallback.
+///
+/// @param[out] ipiv
+///     For LU and LDLT, the vector ipiv of length n.
+///     The pivots of the single precision factorization if iter >= 0,
+///     or of the double precision one if iter < 0 and fallback is true.
+///     For Cholesky, not referenced and may be null.
+///
+/// @see lag2h, lag2b to convert to half precision.
+/// @ingroup gesv
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::float16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax, bool fallback )
+{
+    return impl::solve_mixed( factorization, uplo, n, nrhs, A, lda, ipiv,
+                              B, ldb, X, ldx, iter, itermax, fallback );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, bfloat16 storage version.
+/// @ingroup gesv
+int64_t solve_mixed(
+    lapack::Factorization factorization, lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    lapack::bfloat16 const* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter, int64_t itermax, bool fallback )
+{
+    return impl::solve_mixed( factorization, uplo, n, nrhs, A, lda, ipiv,
+                              B, ldb, X, ldx, iter, itermax, fallback );
+}
+
+}  // namespace lapack
@@ -15,13 +15,19 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t spgvd(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t spgvd_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* AP,
     float* BP,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,28 +42,37 @@ int64_t spgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sspgvd(
-        &itype_, &jobz_, &uplo_, &n_,
-        AP,
-        BP,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sspgvd", { itype_, jobz_, uplo_, n_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sspgvd(
+            &itype_, &jobz_, &uplo_, &n_,
+            AP,
+            BP,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sspgvd(
         &itype_, &jobz_, &uplo_, &n_,
@@ -65,8 +80,8 @@ int64_t spgvd(
         BP,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -75,12 +90,13 @@ int64_t spgvd(
 }
 
 // -----------------------------------------------------------------------------
-int64_t spgvd(
+int64_t spgvd_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* AP,
     double* BP,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -95,28 +111,37 @@ int64_t spgvd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dspgvd(
-        &itype_, &jobz_, &uplo_, &n_,
-        AP,
-        BP,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dspgvd", { itype_, jobz_, uplo_, n_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dspgvd(
+            &itype_, &jobz_, &uplo_, &n_,
+            AP,
+            BP,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dspgvd(
         &itype_, &jobz_, &uplo_, &n_,
@@ -124,8 +149,8 @@ int64_t spgvd(
         BP,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -133,4 +158,92 @@ int64_t spgvd(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    spgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    size_t host_work_size;
+    spgvd_work_size_bytes( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void spgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    spgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void spgvd_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    spgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return spgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return spgvd_work( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work_buffer );
+}
+
 }  // namespace lapack
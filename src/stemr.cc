@@ -15,8 +15,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t stemr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t stemr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     float* D,
     float* E, float vl, float vu, int64_t il, int64_t iu,
@@ -24,7 +29,8 @@ int64_t stemr(
     float* W,
     float* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,39 +48,49 @@ int64_t stemr(
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int nzc_ = (lapack_int) nzc;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int tryrac_ = (lapack_int) *tryrac;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sstemr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &m_,
-        W,
-        Z, &ldz_, &nzc_,
-        isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sstemr", { jobz_, range_, n_, il_, iu_, ldz_, nzc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sstemr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &m_,
+            W,
+            Z, &ldz_, &nzc_,
+            isuppz_ptr, &tryrac_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sstemr(
         &jobz_, &range_, &n_,
@@ -83,22 +99,22 @@ int64_t stemr(
         W,
         Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     *tryrac = tryrac_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t stemr(
+int64_t stemr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     double* D,
     double* E, double vl, double vu, int64_t il, int64_t iu,
@@ -106,7 +122,8 @@ int64_t stemr(
     double* W,
     double* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -124,39 +141,49 @@ int64_t stemr(
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int nzc_ = (lapack_int) nzc;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int tryrac_ = (lapack_int) *tryrac;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dstemr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &m_,
-        W,
-        Z, &ldz_, &nzc_,
-        isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dstemr", { jobz_, range_, n_, il_, iu_, ldz_, nzc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dstemr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &m_,
+            W,
+            Z, &ldz_, &nzc_,
+            isuppz_ptr, &tryrac_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dstemr(
         &jobz_, &range_, &n_,
@@ -165,22 +192,22 @@ int64_t stemr(
         W,
         Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     *tryrac = tryrac_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t stemr(
+int64_t stemr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     float* D,
     float* E, float vl, float vu, int64_t il, int64_t iu,
@@ -188,7 +215,8 @@ int64_t stemr(
     float* W,
     std::complex<float>* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -206,39 +234,49 @@ int64_t stemr(
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int nzc_ = (lapack_int) nzc;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int tryrac_ = (lapack_int) *tryrac;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cstemr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &m_,
-        W,
-        (lapack_complex_float*) Z, &ldz_, &nzc_,
-        isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "cstemr", { jobz_, range_, n_, il_, iu_, ldz_, nzc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_cstemr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &m_,
+            W,
+            (lapack_complex_float*) Z, &ldz_, &nzc_,
+            isuppz_ptr, &tryrac_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_cstemr(
         &jobz_, &range_, &n_,
@@ -247,22 +285,22 @@ int64_t stemr(
         W,
         (lapack_complex_float*) Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     *tryrac = tryrac_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t stemr(
+int64_t stemr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     double* D,
     double* E, double vl, double vu, int64_t il, int64_t iu,
@@ -270,7 +308,8 @@ int64_t stemr(
     double* W,
     std::complex<double>* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -288,39 +327,49 @@ int64_t stemr(
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int nzc_ = (lapack_int) nzc;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int tryrac_ = (lapack_int) *tryrac;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zstemr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &m_,
-        W,
-        (lapack_complex_double*) Z, &ldz_, &nzc_,
-        isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "zstemr", { jobz_, range_, n_, il_, iu_, ldz_, nzc_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zstemr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &m_,
+            W,
+            (lapack_complex_double*) Z, &ldz_, &nzc_,
+            isuppz_ptr, &tryrac_,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_zstemr(
         &jobz_, &range_, &n_,
@@ -329,18 +378,236 @@ int64_t stemr(
         W,
         (lapack_complex_double*) Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     *tryrac = tryrac_;
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    size_t host_work_size;
+    stemr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, m, W,
+                           Z, ldz, nzc, isuppz, tryrac, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stemr( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                  isuppz, tryrac, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    size_t host_work_size;
+    stemr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, m, W,
+                           Z, ldz, nzc, isuppz, tryrac, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stemr( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                  isuppz, tryrac, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    size_t host_work_size;
+    stemr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, m, W,
+                           Z, ldz, nzc, isuppz, tryrac, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stemr( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                  isuppz, tryrac, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    size_t host_work_size;
+    stemr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, m, W,
+                           Z, ldz, nzc, isuppz, tryrac, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stemr( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                  isuppz, tryrac, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                isuppz, tryrac, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                isuppz, tryrac, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                isuppz, tryrac, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                isuppz, tryrac, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                       isuppz, tryrac, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                       isuppz, tryrac, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                       isuppz, tryrac, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stemr_work( jobz, range, n, D, E, vl, vu, il, iu, m, W, Z, ldz, nzc,
+                       isuppz, tryrac, work_buffer );
+}
+
 }  // namespace lapack
@@ -15,15 +15,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t stevr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t stevr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     float* D,
     float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,38 +45,48 @@ int64_t stevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sstevr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "sstevr", { jobz_, range_, n_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_sstevr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_sstevr(
         &jobz_, &range_, &n_,
@@ -79,28 +95,29 @@ int64_t stevr(
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t stevr(
+int64_t stevr_work(
     lapack::Job jobz, lapack::Range range, int64_t n,
     double* D,
     double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -116,38 +133,48 @@ int64_t stevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was m; n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was m; n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dstevr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dstevr", { jobz_, range_, n_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dstevr(
+            &jobz_, &range_, &n_,
+            D,
+            E, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dstevr(
         &jobz_, &range_, &n_,
@@ -156,17 +183,121 @@ int64_t stevr(
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *m = m_;
     #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[m_], isuppz );  // was begin to end
+        std::copy( isuppz_, &isuppz_[m_], isuppz );  // was begin to end
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    size_t host_work_size;
+    stevr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W,
+                           Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stevr( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                  isuppz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    size_t host_work_size;
+    stevr_work_size_bytes( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W,
+                           Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return stevr( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                  isuppz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void stevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stevr_work( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void stevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    stevr_work( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z, ldz,
+                isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stevr_work( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z,
+                       ldz, isuppz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return stevr_work( jobz, range, n, D, E, vl, vu, il, iu, abstol, m, W, Z,
+                       ldz, isuppz, work_buffer );
+}
+
 }  // namespace lapack
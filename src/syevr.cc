@@ -15,15 +15,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev
-int64_t syevr(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t syevr_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -42,37 +47,47 @@ int64_t syevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was max(1,m), n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssyevr(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "ssyevr", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssyevr(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssyevr(
         &jobz_, &range_, &uplo_, &n_,
@@ -80,29 +95,28 @@ int64_t syevr(
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + (2*max( 1, n )), isuppz );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heevr
-/// @ingroup heev
-int64_t syevr(
+int64_t syevr_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -121,37 +135,47 @@ int64_t syevr(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,m), n >= m
-        lapack_int* isuppz_ptr = &isuppz_[0];
+        lapack_int* isuppz_ = work_buffer.get< lapack_int >( (2*max( 1, n )) );  // was max(1,m), n >= m
+        lapack_int* isuppz_ptr = isuppz_;
     #else
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsyevr(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dsyevr", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsyevr(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            isuppz_ptr,
+            qry_work, &ineg_one,
+            qry_iwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.liwork = real(qry_iwork[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int liwork_ = sizes.liwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsyevr(
         &jobz_, &range_, &uplo_, &n_,
@@ -159,17 +183,149 @@ int64_t syevr(
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+        std::copy( isuppz_, isuppz_ + (2*max( 1, n )), isuppz );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    size_t host_work_size;
+    syevr_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                           nfound, W, Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                  W, Z, ldz, isuppz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevr
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    size_t host_work_size;
+    syevr_work_size_bytes( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                           nfound, W, Z, ldz, isuppz, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                  W, Z, ldz, isuppz, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void syevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    syevr_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                W, Z, ldz, isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::syevr`. Arguments are the same as for
+/// `lapack::syevr`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev
+void syevr_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    syevr_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound,
+                W, Z, ldz, isuppz, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return syevr_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, isuppz, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::syevr` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::syevr_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::syevr( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::syevr`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::syevr_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return syevr_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, isuppz, work_buffer );
+}
+
 }  // namespace lapack
@@ -17,15 +17,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev
-int64_t syevx_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t syevx_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -44,44 +49,53 @@ int64_t syevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssyevx_2stage(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssyevx_2stage", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssyevx_2stage(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssyevx_2stage(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -90,22 +104,21 @@ int64_t syevx_2stage(
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
+            std::copy( ifail_, &ifail_[ nfound_ ], ifail );
         }
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heevx_2stage
-/// @ingroup heev
-int64_t syevx_2stage(
+int64_t syevx_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -124,44 +137,53 @@ int64_t syevx_2stage(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int nfound_;  // output
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsyevx_2stage(
-        &jobz_, &range_, &uplo_, &n_,
-        A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsyevx_2stage", { jobz_, range_, uplo_, n_, lda_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsyevx_2stage(
+            &jobz_, &range_, &uplo_, &n_,
+            A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsyevx_2stage(
         &jobz_, &range_, &uplo_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -170,12 +192,148 @@ int64_t syevx_2stage(
     *nfound = nfound_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
+            std::copy( ifail_, &ifail_[ nfound_ ], ifail );
         }
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    syevx_2stage_work_size_bytes( jobz, range, uplo, n,
+                                  A, lda, vl, vu, il, iu, abstol, nfound, W,
+                                  Z, ldz, ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                         nfound, W, Z, ldz, ifail,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevx_2stage
+/// @ingroup heev
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    syevx_2stage_work_size_bytes( jobz, range, uplo, n,
+                                  A, lda, vl, vu, il, iu, abstol, nfound, W,
+                                  Z, ldz, ifail, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                         nfound, W, Z, ldz, ifail,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void syevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    syevx_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::syevx_2stage`. Arguments are the same as for
+/// `lapack::syevx_2stage`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev
+void syevx_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    syevx_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol,
+                       nfound, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return syevx_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                              abstol, nfound, W, Z, ldz, ifail, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::syevx_2stage` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::syevx_2stage_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::syevx_2stage( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::syevx_2stage`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::syevx_2stage_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return syevx_2stage_work( jobz, range, uplo, n, A, lda, vl, vu, il, iu,
+                              abstol, nfound, W, Z, ldz, ifail, work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -15,12 +15,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sygv(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sygv_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
-    float* W )
+    float* W,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -37,30 +43,38 @@ int64_t sygv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssygv(
-        &itype_, &jobz_, &uplo_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        W,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssygv", { itype_, jobz_, uplo_, n_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssygv(
+            &itype_, &jobz_, &uplo_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            W,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -69,11 +83,12 @@ int64_t sygv(
 }
 
 // -----------------------------------------------------------------------------
-int64_t sygv(
+int64_t sygv_work(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
-    double* W )
+    double* W,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -90,30 +105,38 @@ int64_t sygv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsygv(
-        &itype_, &jobz_, &uplo_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        W,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsygv", { itype_, jobz_, uplo_, n_, lda_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsygv(
+            &itype_, &jobz_, &uplo_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            W,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -121,4 +144,86 @@ int64_t sygv(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
+{
+    size_t host_work_size;
+    sygv_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    size_t host_work_size;
+    sygv_work_size_bytes( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                          &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W,
+                 host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sygv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sygv_work( itype, jobz, uplo, n, A, lda, B, ldb, W, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sygv_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sygv_work( itype, jobz, uplo, n, A, lda, B, ldb, W, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sygv_work( itype, jobz, uplo, n, A, lda, B, ldb, W, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sygv_work( itype, jobz, uplo, n, A, lda, B, ldb, W, work_buffer );
+}
+
 }  // namespace lapack
@@ -15,15 +15,21 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t sygvx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sygvx_work(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
     float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -46,37 +52,46 @@ int64_t sygvx(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssygvx(
-        &itype_, &jobz_, &range_, &uplo_, &n_,
-        A, &lda_,
-        B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssygvx", { itype_, jobz_, range_, uplo_, n_, lda_, ldb_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssygvx(
+            &itype_, &jobz_, &range_, &uplo_, &n_,
+            A, &lda_,
+            B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssygvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
@@ -84,8 +99,8 @@ int64_t sygvx(
         B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -94,21 +109,22 @@ int64_t sygvx(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t sygvx(
+int64_t sygvx_work(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* m,
     double* W,
     double* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -131,37 +147,46 @@ int64_t sygvx(
     lapack_int iu_ = (lapack_int) iu;
     lapack_int m_ = (lapack_int) *m;
     lapack_int ldz_ = (lapack_int) ldz;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
+        lapack_int* ifail_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ifail_ptr = ifail_;
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsygvx(
-        &itype_, &jobz_, &range_, &uplo_, &n_,
-        A, &lda_,
-        B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
-        W,
-        Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsygvx", { itype_, jobz_, range_, uplo_, n_, lda_, ldb_, il_, iu_, ldz_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsygvx(
+            &itype_, &jobz_, &range_, &uplo_, &n_,
+            A, &lda_,
+            B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
+            W,
+            Z, &ldz_,
+            qry_work, &ineg_one,
+            qry_iwork,
+            ifail_ptr, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (5*n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsygvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
@@ -169,8 +194,8 @@ int64_t sygvx(
         B, &ldb_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -179,10 +204,118 @@ int64_t sygvx(
     *m = m_;
     #ifndef LAPACK_ILP64
         if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+            std::copy( ifail_, &ifail_[ m_ ], ifail );
         }
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    sygvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda,
+                           B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sygvx( itype, jobz, range, uplo, n, A, lda,
+                  B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    size_t host_work_size;
+    sygvx_work_size_bytes( itype, jobz, range, uplo, n, A, lda,
+                           B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                           &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sygvx( itype, jobz, range, uplo, n, A, lda,
+                  B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void sygvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sygvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu,
+                abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void sygvx_work_size_bytes(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sygvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu,
+                abstol, m, W, Z, ldz, ifail, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sygvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sygvx_work( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il,
+                       iu, abstol, m, W, Z, ldz, ifail, work_buffer );
+}
+
 }  // namespace lapack
@@ -17,13 +17,18 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysv_aa(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sysv_aa_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb )
+    float* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -36,83 +41,92 @@ int64_t sysv_aa(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    // MKL (seen in 2019-2021) has bug in sysv_aa query;
-    // query sytrf_aa and sytrs_aa instead.
-    #ifdef BLAS_HAVE_MKL
-        LAPACK_ssytrf_aa(
-            &uplo_, &n_,
-            A, &lda_,
-            ipiv_ptr,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-        LAPACK_ssytrs_aa(
-            &uplo_, &n_, &nrhs_,
-            A, &lda_,
-            ipiv_ptr,
-            B, &ldb_,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lwork_ = max( lwork_, real(qry_work[0]) );
-    #else
-        LAPACK_ssysv_aa(
-            &uplo_, &n_, &nrhs_,
-            A, &lda_,
-            ipiv_ptr,
-            B, &ldb_,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-    #endif
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssysv_aa", { uplo_, n_, lda_, nrhs_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        // MKL (seen in 2019-2021) has bug in sysv_aa query;
+        // query sytrf_aa and sytrs_aa instead.
+        #ifdef BLAS_HAVE_MKL
+            LAPACK_ssytrf_aa(
+                &uplo_, &n_,
+                A, &lda_,
+                ipiv_ptr,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+            LAPACK_ssytrs_aa(
+                &uplo_, &n_, &nrhs_,
+                A, &lda_,
+                ipiv_ptr,
+                B, &ldb_,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        #else
+            LAPACK_ssysv_aa(
+                &uplo_, &n_, &nrhs_,
+                A, &lda_,
+                ipiv_ptr,
+                B, &ldb_,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+        #endif
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysv_aa(
+int64_t sysv_aa_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    double* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -125,84 +139,92 @@ int64_t sysv_aa(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    // MKL (seen in 2019-2021) has bug in sysv_aa query;
-    // query sytrf_aa and sytrs_aa instead.
-    #ifdef BLAS_HAVE_MKL
-        LAPACK_dsytrf_aa(
-            &uplo_, &n_,
-            A, &lda_,
-            ipiv_ptr,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-        LAPACK_dsytrs_aa(
-            &uplo_, &n_, &nrhs_,
-            A, &lda_,
-            ipiv_ptr,
-            B, &ldb_,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lwork_ = max( lwork_, real(qry_work[0]) );
-    #else
-        LAPACK_dsysv_aa(
-            &uplo_, &n_, &nrhs_,
-            A, &lda_,
-            ipiv_ptr,
-            B, &ldb_,
-            qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-    #endif
-
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsysv_aa", { uplo_, n_, lda_, nrhs_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        // MKL (seen in 2019-2021) has bug in sysv_aa query;
+        // query sytrf_aa and sytrs_aa instead.
+        #ifdef BLAS_HAVE_MKL
+            LAPACK_dsytrf_aa(
+                &uplo_, &n_,
+                A, &lda_,
+                ipiv_ptr,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+            LAPACK_dsytrs_aa(
+                &uplo_, &n_, &nrhs_,
+                A, &lda_,
+                ipiv_ptr,
+                B, &ldb_,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        #else
+            LAPACK_dsysv_aa(
+                &uplo_, &n_, &nrhs_,
+                A, &lda_,
+                ipiv_ptr,
+                B, &ldb_,
+                qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+        #endif
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysv_aa(
+int64_t sysv_aa_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -215,76 +237,233 @@ int64_t sysv_aa(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    // MKL (seen in 2019-2021) has bug in sysv_aa query;
-    // query sytrf_aa and sytrs_aa instead.
-    #ifdef BLAS_HAVE_MKL
-        LAPACK_csytrf_aa(
-            &uplo_, &n_,
-            (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_float*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-        LAPACK_csytrs_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_float*) B, &ldb_,
-            (lapack_complex_float*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lwork_ = max( lwork_, real(qry_work[0]) );
-    #else
-        LAPACK_csysv_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_float*) B, &ldb_,
-            (lapack_complex_float*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-    #endif
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "csysv_aa", { uplo_, n_, lda_, nrhs_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int ineg_one = -1;
+        // MKL (seen in 2019-2021) has bug in sysv_aa query;
+        // query sytrf_aa and sytrs_aa instead.
+        #ifdef BLAS_HAVE_MKL
+            LAPACK_csytrf_aa(
+                &uplo_, &n_,
+                (lapack_complex_float*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_float*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+            LAPACK_csytrs_aa(
+                &uplo_, &n_, &nrhs_,
+                (lapack_complex_float*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_float*) B, &ldb_,
+                (lapack_complex_float*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        #else
+            LAPACK_csysv_aa(
+                &uplo_, &n_, &nrhs_,
+                (lapack_complex_float*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_float*) B, &ldb_,
+                (lapack_complex_float*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+        #endif
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_csysv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
+    #endif
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t sysv_aa_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        lapack_int* ipiv_ptr = ipiv_;
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zsysv_aa", { uplo_, n_, lda_, nrhs_, ldb_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int ineg_one = -1;
+        // MKL (seen in 2019-2021) has bug in sysv_aa query;
+        // query sytrf_aa and sytrs_aa instead.
+        #ifdef BLAS_HAVE_MKL
+            LAPACK_zsytrf_aa(
+                &uplo_, &n_,
+                (lapack_complex_double*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_double*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+            LAPACK_zsytrs_aa(
+                &uplo_, &n_, &nrhs_,
+                (lapack_complex_double*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_double*) B, &ldb_,
+                (lapack_complex_double*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = max( sizes.lwork, real(qry_work[0]) );
+        #else
+            LAPACK_zsysv_aa(
+                &uplo_, &n_, &nrhs_,
+                (lapack_complex_double*) A, &lda_,
+                ipiv_ptr,
+                (lapack_complex_double*) B, &ldb_,
+                (lapack_complex_double*) qry_work, &ineg_one, &info_
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real(qry_work[0]);
+        #endif
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zsysv_aa(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    size_t host_work_size;
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    size_t host_work_size;
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    size_t host_work_size;
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes the solution to a system of linear equations
 ///     $A X = B$,
@@ -362,85 +541,147 @@ int64_t sysv_aa(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    sysv_aa_work_size_bytes( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                             &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    // MKL (seen in 2019-2021) has bug in sysv_aa query;
-    // query sytrf_aa and sytrs_aa instead.
-    #ifdef BLAS_HAVE_MKL
-        LAPACK_zsytrf_aa(
-            &uplo_, &n_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-        LAPACK_zsytrs_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) B, &ldb_,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lwork_ = max( lwork_, real(qry_work[0]) );
-    #else
-        LAPACK_zsysv_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) B, &ldb_,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-    #endif
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zsysv_aa(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::sysv_aa`. Arguments are the same as for
+/// `lapack::sysv_aa`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup sysv
+void sysv_aa_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::sysv_aa` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::sysv_aa_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::sysv_aa( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::sysv_aa`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::sysv_aa_work_size_bytes` for the same arguments.
+///
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysv_aa_work( uplo, n, nrhs, A, lda, ipiv, B, ldb, work_buffer );
 }
 
 }  // namespace lapack
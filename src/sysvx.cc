@@ -15,9 +15,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysvx(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sysvx_work(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* A, int64_t lda,
     float* AF, int64_t ldaf,
@@ -26,7 +30,8 @@ int64_t sysvx(
     float* X, int64_t ldx,
     float* rcond,
     float* ferr,
-    float* berr )
+    float* berr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -43,10 +48,12 @@ int64_t sysvx(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldaf_ = (lapack_int) ldaf;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &ipiv[0], &ipiv[(n)], ipiv_ );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -54,30 +61,38 @@ int64_t sysvx(
     lapack_int ldx_ = (lapack_int) ldx;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssysvx", { fact_, uplo_, n_, nrhs_, lda_, ldaf_, ldb_, ldx_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssysvx(
+            &fact_, &uplo_, &n_, &nrhs_,
+            A, &lda_,
+            AF, &ldaf_,
+            ipiv_ptr,
+            B, &ldb_,
+            X, &ldx_, rcond,
+            ferr,
+            berr,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssysvx(
         &fact_, &uplo_, &n_, &nrhs_,
@@ -88,21 +103,20 @@ int64_t sysvx(
         X, &ldx_, rcond,
         ferr,
         berr,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysvx(
+int64_t sysvx_work(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* A, int64_t lda,
     double* AF, int64_t ldaf,
@@ -111,7 +125,8 @@ int64_t sysvx(
     double* X, int64_t ldx,
     double* rcond,
     double* ferr,
-    double* berr )
+    double* berr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -128,10 +143,12 @@ int64_t sysvx(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldaf_ = (lapack_int) ldaf;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &ipiv[0], &ipiv[(n)], ipiv_ );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -139,30 +156,38 @@ int64_t sysvx(
     lapack_int ldx_ = (lapack_int) ldx;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsysvx", { fact_, uplo_, n_, nrhs_, lda_, ldaf_, ldb_, ldx_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsysvx(
+            &fact_, &uplo_, &n_, &nrhs_,
+            A, &lda_,
+            AF, &ldaf_,
+            ipiv_ptr,
+            B, &ldb_,
+            X, &ldx_, rcond,
+            ferr,
+            berr,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (n) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsysvx(
         &fact_, &uplo_, &n_, &nrhs_,
@@ -173,21 +198,20 @@ int64_t sysvx(
         X, &ldx_, rcond,
         ferr,
         berr,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup sysv
-int64_t sysvx(
+int64_t sysvx_work(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* AF, int64_t ldaf,
@@ -196,7 +220,8 @@ int64_t sysvx(
     std::complex<float>* X, int64_t ldx,
     float* rcond,
     float* ferr,
-    float* berr )
+    float* berr,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -213,10 +238,12 @@ int64_t sysvx(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldaf_ = (lapack_int) ldaf;
+
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &ipiv[0], &ipiv[(n)], ipiv_ );
+        lapack_int* ipiv_ptr = ipiv_;
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -224,10 +251,39 @@ int64_t sysvx(
     lapack_int ldx_ = (lapack_int) ldx;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "csysvx", { fact_, uplo_, n_, nrhs_, lda_, ldaf_, ldb_, ldx_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_csysvx(
+            &fact_, &uplo_, &n_, &nrhs_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) AF, &ldaf_,
+            ipiv_ptr,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) X, &ldx_, rcond,
+            ferr,
+            berr,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    float* rwork = work_buffer.get< float >( (n) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_csysvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -237,39 +293,178 @@ int64_t sysvx(
         (lapack_complex_float*) X, &ldx_, rcond,
         ferr,
         berr,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t sysvx_work(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldaf) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldx) > std::numeric_limits<lapack_int>::max() );
+    }
+    char fact_ = factored2char( fact );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldaf_ = (lapack_int) ldaf;
 
-    LAPACK_csysvx(
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack_int* ipiv_ = work_buffer.get< lapack_int >( (n) );
+        work_buffer.copy( &ipiv[0], &ipiv[(n)], ipiv_ );
+        lapack_int* ipiv_ptr = ipiv_;
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldx_ = (lapack_int) ldx;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "zsysvx", { fact_, uplo_, n_, nrhs_, lda_, ldaf_, ldb_, ldx_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_zsysvx(
+            &fact_, &uplo_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) AF, &ldaf_,
+            ipiv_ptr,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) X, &ldx_, rcond,
+            ferr,
+            berr,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+
+    // get workspace
+    double* rwork = work_buffer.get< double >( (n) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_zsysvx(
         &fact_, &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) AF, &ldaf_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) AF, &ldaf_,
         ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) X, &ldx_, rcond,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) X, &ldx_, rcond,
         ferr,
         berr,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        std::copy( ipiv_, ipiv_ + (n), ipiv );
     #endif
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    size_t host_work_size;
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb,
+                           X, ldx, rcond, ferr, berr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                  rcond, ferr, berr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
+{
+    size_t host_work_size;
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb,
+                           X, ldx, rcond, ferr, berr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                  rcond, ferr, berr, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    size_t host_work_size;
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb,
+                           X, ldx, rcond, ferr, berr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                  rcond, ferr, berr, host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Uses the diagonal pivoting factorization to compute the
 /// solution to a system of linear equations
@@ -418,76 +613,195 @@ int64_t sysvx(
     double* ferr,
     double* berr )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldaf) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldx) > std::numeric_limits<lapack_int>::max() );
-    }
-    char fact_ = factored2char( fact );
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldaf_ = (lapack_int) ldaf;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int ldx_ = (lapack_int) ldx;
-    lapack_int info_ = 0;
+    size_t host_work_size;
+    sysvx_work_size_bytes( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb,
+                           X, ldx, rcond, ferr, berr, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                  rcond, ferr, berr, host_work.data(), host_work_size );
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) AF, &ldaf_,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) X, &ldx_, rcond,
-        ferr,
-        berr,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                rcond, ferr, berr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                rcond, ferr, berr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    LAPACK_zsysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) AF, &ldaf_,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) X, &ldx_, rcond,
-        ferr,
-        berr,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                rcond, ferr, berr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::sysvx`. Arguments are the same as for
+/// `lapack::sysvx`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup sysv
+void sysvx_work_size_bytes(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                rcond, ferr, berr, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X,
+                       ldx, rcond, ferr, berr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X,
+                       ldx, rcond, ferr, berr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X,
+                       ldx, rcond, ferr, berr, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::sysvx` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::sysvx_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::sysvx( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::sysvx`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::sysvx_work_size_bytes` for the same arguments.
+///
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sysvx_work( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X,
+                       ldx, rcond, ferr, berr, work_buffer );
 }
 
 }  // namespace lapack
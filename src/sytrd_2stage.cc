@@ -17,15 +17,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup heev_computational
-int64_t sytrd_2stage(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t sytrd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* D,
     float* E,
     float* tau,
-    float* hous2, int64_t lhous2 )
+    float* hous2, int64_t lhous2,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -40,25 +45,33 @@ int64_t sytrd_2stage(
     lapack_int lhous2_ = (lapack_int) lhous2;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssytrd_2stage(
-        &jobz_, &uplo_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tau,
-        hous2, &lhous2_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ssytrd_2stage", { jobz_, uplo_, n_, lda_, lhous2_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ssytrd_2stage(
+            &jobz_, &uplo_, &n_,
+            A, &lda_,
+            D,
+            E,
+            tau,
+            hous2, &lhous2_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -67,7 +80,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -76,15 +89,14 @@ int64_t sytrd_2stage(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd_2stage
-/// @ingroup heev_computational
-int64_t sytrd_2stage(
+int64_t sytrd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* D,
     double* E,
     double* tau,
-    double* hous2, int64_t lhous2 )
+    double* hous2, int64_t lhous2,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -99,25 +111,33 @@ int64_t sytrd_2stage(
     lapack_int lhous2_ = (lapack_int) lhous2;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsytrd_2stage(
-        &jobz_, &uplo_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tau,
-        hous2, &lhous2_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dsytrd_2stage", { jobz_, uplo_, n_, lda_, lhous2_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dsytrd_2stage(
+            &jobz_, &uplo_, &n_,
+            A, &lda_,
+            D,
+            E,
+            tau,
+            hous2, &lhous2_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -126,7 +146,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -134,6 +154,138 @@ int64_t sytrd_2stage(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 )
+{
+    size_t host_work_size;
+    sytrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau,
+                                  hous2, lhous2, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
+{
+    size_t host_work_size;
+    sytrd_2stage_work_size_bytes( jobz, uplo, n, A, lda, D, E, tau,
+                                  hous2, lhous2, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                         host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void sytrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                       work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::sytrd_2stage`. Arguments are the same as for
+/// `lapack::sytrd_2stage`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup heev_computational
+void sytrd_2stage_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                       work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::sytrd_2stage` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::sytrd_2stage_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::sytrd_2stage( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::sytrd_2stage`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::sytrd_2stage_work_size_bytes` for the same arguments.
+///
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work_buffer );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.7
@@ -0,0 +1,263 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "task_graph.hh"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+struct TaskGraph::Task
+{
+    std::function< void () > func;
+    std::vector< int64_t > successors;
+    std::atomic< int64_t > ndeps;  ///< number of unfinished predecessors
+    bool priority;
+};
+
+//------------------------------------------------------------------------------
+/// Deque of ready task ids. The owner pushes and pops at the back;
+/// thieves steal from the front. Tasks are coarse (tile BLAS calls),
+/// so a mutex is cheap compared to the work it protects.
+class TaskGraph::Deque
+{
+public:
+    void push( int64_t id )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        ids_.push_back( id );
+    }
+
+    bool pop( int64_t* id )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if (ids_.empty())
+            return false;
+        *id = ids_.back();
+        ids_.pop_back();
+        return true;
+    }
+
+    bool steal( int64_t* id )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if (ids_.empty())
+            return false;
+        *id = ids_.front();
+        ids_.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque< int64_t > ids_;
+};
+
+//------------------------------------------------------------------------------
+TaskGraph::TaskGraph():
+    remaining_( 0 ),
+    ready_( 0 ),
+    idle_( 0 ),
+    cancelled_( false )
+{}
+
+TaskGraph::~TaskGraph()
+{}
+
+//------------------------------------------------------------------------------
+void TaskGraph::add_edge( int64_t from, int64_t to )
+{
+    // Edges into a task are added together while adding it,
+    // so a duplicate edge is always the last one.
+    auto& succ = tasks_[ from ]->successors;
+    if (succ.empty() || succ.back() != to) {
+        succ.push_back( to );
+        tasks_[ to ]->ndeps += 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+int64_t TaskGraph::add(
+    std::function< void () > func,
+    std::vector< int64_t > const& reads,
+    std::vector< int64_t > const& writes,
+    bool priority )
+{
+    int64_t id = int64_t( tasks_.size() );
+    tasks_.emplace_back( new Task );
+    Task& task = *tasks_.back();
+    task.func = std::move( func );
+    task.ndeps = 0;
+    task.priority = priority;
+
+    // read-after-write
+    for (int64_t tile : reads) {
+        if (std::find( writes.begin(), writes.end(), tile ) != writes.end())
+            continue;
+        auto w = last_writer_.find( tile );
+        if (w != last_writer_.end())
+            add_edge( w->second, id );
+        readers_[ tile ].push_back( id );
+    }
+
+    // write-after-write and write-after-read
+    for (int64_t tile : writes) {
+        auto w = last_writer_.find( tile );
+        if (w != last_writer_.end())
+            add_edge( w->second, id );
+        auto r = readers_.find( tile );
+        if (r != readers_.end()) {
+            for (int64_t reader : r->second)
+                add_edge( reader, id );
+            r->second.clear();
+        }
+        last_writer_[ tile ] = id;
+    }
+
+    return id;
+}
+
+//------------------------------------------------------------------------------
+/// Pushes ready task id on deque tid, and wakes an idle thread, if any.
+void TaskGraph::push( int64_t id, int tid )
+{
+    deques_[ tid ]->push( id );
+    ready_.fetch_add( 1 );
+    // Pairs with wait_for_task: either it sees ready_ > 0,
+    // or this sees idle_ > 0 and notifies it.
+    if (idle_.load() > 0) {
+        std::lock_guard< std::mutex > lock( idle_mutex_ );
+        idle_cv_.notify_one();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Pops a task from deque tid, else steals one from another deque.
+/// @return true if a task was found, in which case id is set.
+bool TaskGraph::pop( int64_t* id, int tid, int num_threads )
+{
+    bool found = deques_[ tid ]->pop( id );
+    for (int i = 1; i < num_threads && ! found; ++i) {
+        found = deques_[ (tid + i) % num_threads ]->steal( id );
+    }
+    if (found)
+        ready_.fetch_sub( 1 );
+    return found;
+}
+
+//------------------------------------------------------------------------------
+/// Blocks until a task may be ready or all tasks are finished.
+void TaskGraph::wait_for_task()
+{
+    std::unique_lock< std::mutex > lock( idle_mutex_ );
+    idle_.fetch_add( 1 );
+    idle_cv_.wait( lock, [this] {
+        return ready_.load() > 0
+               || remaining_.load( std::memory_order_acquire ) == 0;
+    } );
+    idle_.fetch_sub( 1 );
+}
+
+//------------------------------------------------------------------------------
+void TaskGraph::execute( int64_t id, int tid )
+{
+    Task& task = *tasks_[ id ];
+    if (! cancelled()) {
+        try {
+            task.func();
+        }
+        catch (...) {
+            std::lock_guard< std::mutex > lock( exception_mutex_ );
+            if (! exception_)
+                exception_ = std::current_exception();
+            cancel();
+        }
+    }
+
+    // Release successors; push priority tasks last so they are popped first.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int64_t s : task.successors) {
+            Task& succ = *tasks_[ s ];
+            if (succ.priority == (pass == 1)
+                && succ.ndeps.fetch_sub( 1, std::memory_order_acq_rel ) == 1) {
+                push( s, tid );
+            }
+        }
+    }
+    if (remaining_.fetch_sub( 1, std::memory_order_acq_rel ) == 1) {
+        // last task: wake all idle threads to exit
+        std::lock_guard< std::mutex > lock( idle_mutex_ );
+        idle_cv_.notify_all();
+    }
+}
+
+//------------------------------------------------------------------------------
+void TaskGraph::worker( int tid, int num_threads )
+{
+    int64_t id;
+    while (remaining_.load( std::memory_order_acquire ) > 0) {
+        if (pop( &id, tid, num_threads ))
+            execute( id, tid );
+        else
+            wait_for_task();
+    }
+}
+
+//------------------------------------------------------------------------------
+void TaskGraph::run( int num_threads )
+{
+    int64_t ntasks = size();
+    num_threads = int( blas::max( int64_t( 1 ),
+                                  blas::min( int64_t( num_threads ), ntasks ) ) );
+
+    deques_.clear();
+    for (int t = 0; t < num_threads; ++t)
+        deques_.emplace_back( new Deque );
+
+    remaining_ = ntasks;
+    ready_ = 0;
+    idle_ = 0;
+    cancelled_ = false;
+    exception_ = nullptr;
+
+    // Distribute initially ready tasks round-robin.
+    int t = 0;
+    for (int64_t id = 0; id < ntasks; ++id) {
+        if (tasks_[ id ]->ndeps == 0) {
+            push( id, t );
+            t = (t + 1) % num_threads;
+        }
+    }
+
+    // Run on an OpenMP team, whose threads the runtime keeps between
+    // parallel regions, so repeated runs don't create threads. The calling
+    // thread is worker 0. If the team is smaller than num_threads, e.g.,
+    // when nested, workers steal the tasks of missing threads.
+    #ifdef _OPENMP
+        #pragma omp parallel num_threads( num_threads )
+        worker( omp_get_thread_num(), num_threads );
+    #else
+        worker( 0, num_threads );
+    #endif
+
+    tasks_.clear();
+    last_writer_.clear();
+    readers_.clear();
+    deques_.clear();
+
+    if (exception_)
+        std::rethrow_exception( exception_ );
+}
+
+}  // namespace internal
+}  // namespace lapack
@@ -0,0 +1,135 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TASK_GRAPH_HH
+#define LAPACK_TASK_GRAPH_HH
+
+#include "lapack.hh"
+
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// DAG of tasks on tiles, executed by a work-stealing thread pool.
+///
+/// Tasks are added in sequential program order, each declaring the tiles it
+/// reads and the tiles it writes; tiles are identified by any int64_t key,
+/// typically i + j*mt. Dependencies are inferred from that order as in a
+/// superscalar processor: a task waits for the last writer of each tile it
+/// reads or writes (read-after-write, write-after-write), and for readers of
+/// the tile it writes since that tile's last write (write-after-read).
+///
+/// run() executes the graph on an OpenMP team of num_threads threads,
+/// including the caller; without OpenMP, only the caller runs tasks.
+/// Each thread owns a deque of ready tasks: it pushes tasks that it makes
+/// ready and pops the most recent one, which keeps data hot in its cache;
+/// an idle thread steals the oldest task from another thread's deque,
+/// or, if none is ready, blocks until a task becomes ready.
+/// Ready tasks marked priority are pushed last, so they run first; use it
+/// for tasks on the critical path, such as panel factorizations.
+///
+/// If a task throws, tasks that have not started are skipped, and run()
+/// rethrows the first exception once all threads finish. Tasks may also
+/// call cancel() to skip remaining tasks, e.g., when a factorization fails.
+///
+class TaskGraph
+{
+public:
+    TaskGraph();
+    ~TaskGraph();
+
+    TaskGraph( TaskGraph const& ) = delete;
+    TaskGraph& operator = ( TaskGraph const& ) = delete;
+
+    /// Adds a task that reads tiles in reads and writes tiles in writes.
+    /// @return task id.
+    int64_t add( std::function< void () > func,
+                 std::vector< int64_t > const& reads,
+                 std::vector< int64_t > const& writes,
+                 bool priority = false );
+
+    /// Adds a task that reads tiles in reads and writes tile write.
+    /// @return task id.
+    int64_t add( std::function< void () > func,
+                 std::vector< int64_t > const& reads, int64_t write,
+                 bool priority = false )
+    {
+        return add( std::move( func ), reads, std::vector< int64_t >{ write },
+                    priority );
+    }
+
+    /// Executes all tasks, then clears the graph.
+    void run( int num_threads );
+
+    /// Skips all tasks that have not yet started. Safe to call from a task.
+    void cancel()
+    {
+        cancelled_.store( true, std::memory_order_relaxed );
+    }
+
+    /// @return true if cancel() was called or a task threw.
+    bool cancelled() const
+    {
+        return cancelled_.load( std::memory_order_relaxed );
+    }
+
+    /// @return number of tasks in the graph.
+    int64_t size() const
+    {
+        return int64_t( tasks_.size() );
+    }
+
+private:
+    struct Task;
+    class Deque;
+
+    void add_edge( int64_t from, int64_t to );
+    void push( int64_t id, int tid );
+    bool pop( int64_t* id, int tid, int num_threads );
+    void wait_for_task();
+    void worker( int tid, int num_threads );
+    void execute( int64_t id, int tid );
+
+    std::vector< std::unique_ptr< Task > > tasks_;
+    std::unordered_map< int64_t, int64_t > last_writer_;
+    std::unordered_map< int64_t, std::vector< int64_t > > readers_;
+
+    std::vector< std::unique_ptr< Deque > > deques_;
+    std::atomic< int64_t > remaining_;
+    std::atomic< int64_t > ready_;  ///< number of tasks in deques
+    std::atomic< int >     idle_;   ///< number of threads in wait_for_task
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    std::atomic< bool > cancelled_;
+    std::exception_ptr exception_;
+    std::mutex exception_mutex_;
+};
+
+//------------------------------------------------------------------------------
+/// @return tile size for tiled factorizations of an n-by-n matrix on
+/// num_threads threads: 256, reduced for small n to give at least
+/// 2 sqrt( num_threads ) block columns, so the first trailing update
+/// has a few tasks per thread. Multiple of 32, at least 64.
+inline int64_t tiled_nb( int64_t n, int num_threads )
+{
+    int64_t nb = int64_t( std::ceil( n / (2 * std::sqrt( double( num_threads ) )) ) );
+    nb = (nb + 31) / 32 * 32;
+    return blas::max( int64_t( 64 ), blas::min( int64_t( 256 ), nb ) );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TASK_GRAPH_HH
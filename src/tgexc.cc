@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -105,17 +106,19 @@ namespace impl {
 
 //------------------------------------------------------------------------------
 /// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// then calls low-level wrapper, taking workspace from work_buffer.
+/// When work_buffer only counts bytes, returns 0 once the workspace is counted.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
-int64_t tgexc(
+int64_t tgexc_work(
     bool wantq, bool wantz, int64_t n,
     scalar_t* A, int64_t lda,
     scalar_t* B, int64_t ldb,
     scalar_t* Q, int64_t ldq,
     scalar_t* Z, int64_t ldz,
-    int64_t* ifst, int64_t* ilst )
+    int64_t* ifst, int64_t* ilst,
+    internal::WorkBuffer& work_buffer )
 {
     // convert arguments
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -138,28 +141,42 @@ int64_t tgexc(
 
     if constexpr (! is_complex<scalar_t>::value) {
         // Real needs workspace.
-        // query for workspace size
-        scalar_t qry_work[1];
-        lapack_int ineg_one = -1;
-        internal::tgexc(
-            wantq_, wantz_, n_,
-            A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            qry_work, ineg_one, &info_ );
-        if (info_ < 0) {
-            throw Error();
+        // query for workspace size, unless cached or set by host_work
+        const char* name = std::is_same< scalar_t, float >::value
+                         ? "stgexc" : "dtgexc";
+        internal::WorkKey key( name, { wantq_, wantz_, n_, lda_, ldb_, ldq_, ldz_ } );
+        internal::WorkSizes sizes;
+        if (! work_buffer.find_lwork( key, &sizes )) {
+            scalar_t qry_work[1];
+            lapack_int ineg_one = -1;
+            internal::tgexc(
+                wantq_, wantz_, n_,
+                A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
+                qry_work, ineg_one, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            sizes.lwork = real( qry_work[ 0 ] );
+            work_buffer.insert( key, sizes );
         }
-        lapack_int lwork_ = real( qry_work[ 0 ] );
+        lapack_int lwork_ = sizes.lwork;
 
-        // allocate workspace
-        std::vector< scalar_t > work( lwork_ );
+        // get workspace
+        scalar_t* work = work_buffer.get_rest< scalar_t >( &lwork_ );
+        if (work_buffer.counts_only())
+            return 0;
 
         // call low-level wrapper
         internal::tgexc(
             wantq_, wantz_, n_,
             A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            &work[0], lwork_, &info_ );
+            work, lwork_, &info_ );
     }
     else {
+        // complex needs no workspace
+        if (work_buffer.counts_only())
+            return 0;
+
         // call low-level wrapper
         internal::tgexc(
             wantq_, wantz_, n_,
@@ -173,6 +190,64 @@ int64_t tgexc(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper computes size of host workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgexc_work( wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz,
+                ifst, ilst, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper takes workspace from host_work.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgexc_work( wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz,
+                       ifst, ilst, work_buffer );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper allocates workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return tgexc_work( wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz,
+                       ifst, ilst, work_buffer );
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -327,4 +402,148 @@ int64_t tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
 
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// Computes size of host_work needed by the host_work version of tgexc.
+/// @ingroup gges
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size )
+{
+    impl::tgexc_work_size_bytes(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// Computes size of host_work needed by the host_work version of tgexc.
+/// @ingroup gges
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size )
+{
+    impl::tgexc_work_size_bytes(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// Computes size of host_work needed by the host_work version of tgexc.
+/// @ingroup gges
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size )
+{
+    impl::tgexc_work_size_bytes(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// Computes size of host_work needed by the host_work version of tgexc.
+/// @ingroup gges
+void tgexc_work_size_bytes(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    size_t* host_work_size )
+{
+    impl::tgexc_work_size_bytes(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// Takes workspace from host_work, of size given by tgexc_work_size_bytes.
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// Takes workspace from host_work, of size given by tgexc_work_size_bytes.
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// Takes workspace from host_work, of size given by tgexc_work_size_bytes.
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// Takes workspace from host_work, of size given by tgexc_work_size_bytes.
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        host_work, host_work_size );
+}
+
 }  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -134,11 +135,12 @@ namespace impl {
 
 //------------------------------------------------------------------------------
 /// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// then calls low-level wrapper, taking workspace from work_buffer.
+/// When work_buffer only counts bytes, returns 0 once the workspace is counted.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
-int64_t tgsen(
+int64_t tgsen_work(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
     scalar_t* A, int64_t lda,
@@ -149,7 +151,8 @@ int64_t tgsen(
     scalar_t* Z, int64_t ldz,
     int64_t* sdim,
     real_type<scalar_t>* pl, real_type<scalar_t>* pr,
-    real_type<scalar_t>* dif )
+    real_type<scalar_t>* dif,
+    internal::WorkBuffer& work_buffer )
 {
     // convert arguments
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -171,24 +174,26 @@ int64_t tgsen(
     lapack_int sdim_ = (lapack_int) *sdim;
     lapack_int info_ = 0;
 
-    // For real, create vectors for split-complex representation.
-    // For complex, creates as dummy `int` type to be optimized away.
-    std::conditional_t< is_complex<scalar_t>::value, int, std::vector<scalar_t> >
-        alphar, alphai;
+    // For real, get vectors for split-complex representation.
+    scalar_t* alphar = nullptr;
+    scalar_t* alphai = nullptr;
+    if constexpr (! is_complex<scalar_t>::value) {
+        alphar = work_buffer.get< scalar_t >( n );
+        alphai = work_buffer.get< scalar_t >( n );
+    }
     blas_unused( alphar );  // unused in complex
     blas_unused( alphai );
 
     // query for workspace size
+    // Not cached: it depends on the number of eigenvalues in select.
     scalar_t qry_work[ 1 ];
     lapack_int qry_iwork[ 1 ];
     lapack_int ineg_one = -1;
     if constexpr (! is_complex<scalar_t>::value) {
         // For real, use split-complex alpha.
-        alphar.resize( n );
-        alphai.resize( n );
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
-            A, lda_, B, ldb_, &alphar[ 0 ], &alphai[ 0 ], beta,
+            A, lda_, B, ldb_, alphar, alphai, beta,
             Q, ldq_, Z, ldz_, &sdim_, pl, pr, dif,
             qry_work, ineg_one, qry_iwork, ineg_one, &info_ );
     }
@@ -206,18 +211,20 @@ int64_t tgsen(
     lapack_int lwork_  = real( qry_work[ 0 ] ) + 1;
     lapack_int liwork_ = real( qry_iwork[ 0 ] );
 
-    // allocate workspace
-    std::vector< scalar_t > work( lwork_ );
-    std::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    scalar_t* work = work_buffer.get< scalar_t >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     // call low-level wrapper
     if constexpr (! is_complex<scalar_t>::value) {
         // For real, use split-complex alpha.
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
-            A, lda_, B, ldb_, &alphar[0], &alphai[0], beta,
+            A, lda_, B, ldb_, alphar, alphai, beta,
             Q, ldq_, Z, ldz_, &sdim_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
         // Merge split-complex representation.
         for (int64_t i = 0; i < n; ++i) {
             alpha[ i ] = std::complex<scalar_t>( alphar[ i ], alphai[ i ] );
@@ -228,7 +235,7 @@ int64_t tgsen(
             ijob_, wantq_, wantz_, select, n_,
             A, lda_, B, ldb_, alpha, beta,
             Q, ldq_, Z, ldz_, &sdim_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
     }
     if (info_ < 0) {
         throw Error();
@@ -237,6 +244,85 @@ int64_t tgsen(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper computes size of host workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* sdim,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper takes workspace from host_work.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* sdim,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, work_buffer );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper allocates workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* sdim,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif )
+{
+    internal::WorkBuffer work_buffer(
+        internal::WorkBuffer::Mode::Allocate );
+    return tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, work_buffer );
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -580,4 +666,200 @@ int64_t tgsen(
         Q, ldq, Z, ldz, sdim, pl, pr, dif );
 }
 
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// Computes size of host_work needed by the host_work version of tgsen.
+/// @ingroup gges
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    size_t* host_work_size )
+{
+    impl::tgsen_work_size_bytes(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// Computes size of host_work needed by the host_work version of tgsen.
+/// @ingroup gges
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    size_t* host_work_size )
+{
+    impl::tgsen_work_size_bytes(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// Computes size of host_work needed by the host_work version of tgsen.
+/// @ingroup gges
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    size_t* host_work_size )
+{
+    impl::tgsen_work_size_bytes(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// Computes size of host_work needed by the host_work version of tgsen.
+/// @ingroup gges
+void tgsen_work_size_bytes(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    size_t* host_work_size )
+{
+    impl::tgsen_work_size_bytes(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// Takes workspace from host_work, of size given by tgsen_work_size_bytes.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// Takes workspace from host_work, of size given by tgsen_work_size_bytes.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// Takes workspace from host_work, of size given by tgsen_work_size_bytes.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        host_work, host_work_size );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// Takes workspace from host_work, of size given by tgsen_work_size_bytes.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    void* host_work, size_t host_work_size )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        host_work, host_work_size );
+}
+
 }  // namespace lapack
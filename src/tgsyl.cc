@@ -15,8 +15,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t tgsyl_work(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     float const* A, int64_t lda,
     float const* B, int64_t ldb,
@@ -25,7 +30,8 @@ int64_t tgsyl(
     float const* E, int64_t lde,
     float* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -51,29 +57,37 @@ int64_t tgsyl(
     lapack_int ldf_ = (lapack_int) ldf;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_stgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "stgsyl", { trans_, ijob_, m_, n_, lda_, ldb_, ldc_, ldd_, lde_, ldf_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        float qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_stgsyl(
+            &trans_, &ijob_, &m_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            C, &ldc_,
+            D, &ldd_,
+            E, &lde_,
+            F, &ldf_, dif, scale,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m+n+6) );
+    float* work = work_buffer.get_rest< float >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_stgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -83,8 +97,8 @@ int64_t tgsyl(
         D, &ldd_,
         E, &lde_,
         F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -93,7 +107,7 @@ int64_t tgsyl(
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+int64_t tgsyl_work(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     double const* A, int64_t lda,
     double const* B, int64_t ldb,
@@ -102,7 +116,8 @@ int64_t tgsyl(
     double const* E, int64_t lde,
     double* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -128,29 +143,37 @@ int64_t tgsyl(
     lapack_int ldf_ = (lapack_int) ldf;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dtgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "dtgsyl", { trans_, ijob_, m_, n_, lda_, ldb_, ldc_, ldd_, lde_, ldf_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        double qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dtgsyl(
+            &trans_, &ijob_, &m_, &n_,
+            A, &lda_,
+            B, &ldb_,
+            C, &ldc_,
+            D, &ldd_,
+            E, &lde_,
+            F, &ldf_, dif, scale,
+            qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m+n+6) );
+    double* work = work_buffer.get_rest< double >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dtgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -160,8 +183,8 @@ int64_t tgsyl(
         D, &ldd_,
         E, &lde_,
         F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -170,7 +193,7 @@ int64_t tgsyl(
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+int64_t tgsyl_work(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* B, int64_t ldb,
@@ -179,7 +202,8 @@ int64_t tgsyl(
     std::complex<float> const* E, int64_t lde,
     std::complex<float>* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -205,29 +229,37 @@ int64_t tgsyl(
     lapack_int ldf_ = (lapack_int) ldf;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ctgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) D, &ldd_,
-        (lapack_complex_float*) E, &lde_,
-        (lapack_complex_float*) F, &ldf_, dif, scale,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ctgsyl", { trans_, ijob_, m_, n_, lda_, ldb_, ldc_, ldd_, lde_, ldf_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ctgsyl(
+            &trans_, &ijob_, &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            (lapack_complex_float*) B, &ldb_,
+            (lapack_complex_float*) C, &ldc_,
+            (lapack_complex_float*) D, &ldd_,
+            (lapack_complex_float*) E, &lde_,
+            (lapack_complex_float*) F, &ldf_, dif, scale,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m+n+2) );
+    std::complex<float>* work = work_buffer.get_rest< std::complex<float> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ctgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -237,8 +269,8 @@ int64_t tgsyl(
         (lapack_complex_float*) D, &ldd_,
         (lapack_complex_float*) E, &lde_,
         (lapack_complex_float*) F, &ldf_, dif, scale,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -247,7 +279,7 @@ int64_t tgsyl(
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+int64_t tgsyl_work(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* B, int64_t ldb,
@@ -256,7 +288,8 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -282,29 +315,37 @@ int64_t tgsyl(
     lapack_int ldf_ = (lapack_int) ldf;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ztgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) D, &ldd_,
-        (lapack_complex_double*) E, &lde_,
-        (lapack_complex_double*) F, &ldf_, dif, scale,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached or set by host_work
+    internal::WorkKey key( "ztgsyl", { trans_, ijob_, m_, n_, lda_, ldb_, ldc_, ldd_, lde_, ldf_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find_lwork( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        lapack_int qry_iwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ztgsyl(
+            &trans_, &ijob_, &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) C, &ldc_,
+            (lapack_complex_double*) D, &ldd_,
+            (lapack_complex_double*) E, &lde_,
+            (lapack_complex_double*) F, &ldf_, dif, scale,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_iwork, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+    // get workspace
+    lapack_int* iwork = work_buffer.get< lapack_int >( (m+n+2) );
+    std::complex<double>* work = work_buffer.get_rest< std::complex<double> >( &lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -314,8 +355,8 @@ int64_t tgsyl(
         (lapack_complex_double*) D, &ldd_,
         (lapack_complex_double*) E, &lde_,
         (lapack_complex_double*) F, &ldf_, dif, scale,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -323,4 +364,234 @@ int64_t tgsyl(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    size_t host_work_size;
+    tgsyl_work_size_bytes( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd,
+                           E, lde, F, ldf, dif, scale, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return tgsyl( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                  F, ldf, dif, scale, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    size_t host_work_size;
+    tgsyl_work_size_bytes( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd,
+                           E, lde, F, ldf, dif, scale, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return tgsyl( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                  F, ldf, dif, scale, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    size_t host_work_size;
+    tgsyl_work_size_bytes( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd,
+                           E, lde, F, ldf, dif, scale, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return tgsyl( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                  F, ldf, dif, scale, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    size_t host_work_size;
+    tgsyl_work_size_bytes( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd,
+                           E, lde, F, ldf, dif, scale, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return tgsyl( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                  F, ldf, dif, scale, host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F,
+                ldf, dif, scale, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F,
+                ldf, dif, scale, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F,
+                ldf, dif, scale, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size_bytes(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F,
+                ldf, dif, scale, work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale, work_buffer );
+}
+
 }  // namespace lapack
@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/thread_scope.hh"
+#include "batch.hh"
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Vendor detected by LAPACK++'s configure, or else by BLAS++'s.
+#if defined( LAPACK_HAVE_MKL ) || defined( BLAS_HAVE_MKL )
+    #define LAPACK_THREADS_MKL
+#elif defined( LAPACK_HAVE_OPENBLAS ) || defined( BLAS_HAVE_OPENBLAS )
+    #define LAPACK_THREADS_OPENBLAS
+#endif
+
+// Vendor routines to get and set the number of BLAS threads.
+// Declared here to avoid depending on vendor headers.
+extern "C" {
+#if defined( LAPACK_THREADS_MKL )
+    int  MKL_Get_Max_Threads();
+    void MKL_Set_Num_Threads( int nt );
+    int  MKL_Set_Num_Threads_Local( int nt );
+#elif defined( LAPACK_THREADS_OPENBLAS )
+    int  openblas_get_num_threads();
+    void openblas_set_num_threads( int nt );
+#endif
+}
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Process-wide BLAS thread setting, shared by all active scopes.
+// Scopes may end out of order when used from several threads,
+// so keep every active request rather than a stack of saved values.
+static std::mutex s_blas_threads_mutex;
+static std::vector< std::pair< int64_t, int > > s_blas_threads_active;
+static int64_t s_blas_threads_next = 0;
+static int s_blas_threads_saved = 0;
+
+static int get_blas_threads()
+{
+    #if defined( LAPACK_THREADS_MKL )
+        return MKL_Get_Max_Threads();
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        return openblas_get_num_threads();
+    #else
+        return 0;
+    #endif
+}
+
+static void set_blas_threads( int num_threads )
+{
+    #if defined( LAPACK_THREADS_MKL )
+        MKL_Set_Num_Threads( num_threads );
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        openblas_set_num_threads( num_threads );
+    #else
+        (void) num_threads;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+/// Sets the process-wide vendor BLAS thread count to num_threads.
+/// The count from before the first active request is saved.
+/// @return token to pass to blas_threads_pop.
+int64_t blas_threads_push( int num_threads )
+{
+    std::lock_guard< std::mutex > lock( s_blas_threads_mutex );
+    if (s_blas_threads_active.empty())
+        s_blas_threads_saved = get_blas_threads();
+    int64_t token = s_blas_threads_next++;
+    s_blas_threads_active.emplace_back( token, num_threads );
+    set_blas_threads( num_threads );
+    return token;
+}
+
+//------------------------------------------------------------------------------
+/// Ends the request with the given token. Sets the vendor BLAS thread count
+/// to the most recent remaining request, or restores the saved count if
+/// none remain.
+void blas_threads_pop( int64_t token )
+{
+    std::lock_guard< std::mutex > lock( s_blas_threads_mutex );
+    auto& active = s_blas_threads_active;
+    for (auto iter = active.begin(); iter != active.end(); ++iter) {
+        if (iter->first == token) {
+            active.erase( iter );
+            break;
+        }
+    }
+    if (active.empty()) {
+        if (s_blas_threads_saved > 0)
+            set_blas_threads( s_blas_threads_saved );
+    }
+    else {
+        set_blas_threads( active.back().second );
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+ThreadScope::ThreadScope( int num_threads ):
+    num_threads_( num_threads ),
+    saved_omp_( 0 ),
+    saved_blas_( 0 ),
+    token_( -1 )
+{
+    if (num_threads_ <= 0)
+        return;
+
+    #ifdef _OPENMP
+        saved_omp_ = omp_get_max_threads();
+        omp_set_num_threads( num_threads_ );
+    #endif
+
+    #if defined( LAPACK_THREADS_MKL )
+        // Thread-local; returns the previous local setting, 0 if none.
+        saved_blas_ = MKL_Set_Num_Threads_Local( num_threads_ );
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        token_ = internal::blas_threads_push( num_threads_ );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+ThreadScope::~ThreadScope()
+{
+    if (num_threads_ <= 0)
+        return;
+
+    #if defined( LAPACK_THREADS_MKL )
+        MKL_Set_Num_Threads_Local( saved_blas_ );
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        internal::blas_threads_pop( token_ );
+    #endif
+
+    #ifdef _OPENMP
+        omp_set_num_threads( saved_omp_ );
+    #endif
+}
+
+}  // namespace lapack
@@ -0,0 +1,683 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "transpose_kernels.hh"
+
+#include <vector>
+
+#if defined( __SSE2__ )
+    #include <emmintrin.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+
+namespace {
+
+// Transpose in parallel only when the matrix is big enough to amortize
+// starting threads; transposing is memory bound.
+const int64_t parallel_threshold = 64 * 1024;
+
+// Below this many entries, a recursive split is done in the current task
+// instead of creating new tasks.
+const int64_t task_threshold = 16 * 1024;
+
+//==============================================================================
+// Leaf tiles fit with their transpose in L1 cache:
+// 64x64 float, 32x32 double and complex;
+// multiples of every kernel's block size.
+template <typename scalar_t>
+constexpr int64_t leaf_size()
+{
+    return sizeof( scalar_t ) <= 4 ? 64 : 32;
+}
+
+//------------------------------------------------------------------------------
+/// Splits dimension n in half, rounded up to a multiple of the kernel size nb,
+/// so tiles other than the last are made of whole kernel blocks.
+inline int64_t split( int64_t n, int64_t nb )
+{
+    return ((n/2 + nb - 1) / nb) * nb;
+}
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for an m-by-n tile A, using the tile kernel for the
+/// instruction set in kernels.
+template <typename scalar_t, bool conj_>
+inline void transpose_tile(
+    internal::TransposeKernels< scalar_t > const& kernels,
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if constexpr (conj_)
+        kernels.conj_transpose( m, n, A, lda, B, ldb );
+    else
+        kernels.transpose( m, n, A, lda, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// B = A for an m-by-n tile.
+template <typename scalar_t>
+inline void copy_tile(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            B[ i + j*ldb ] = A[ i + j*lda ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Out-of-place B = A^T or A^H, recursively halving the longer dimension
+/// until tiles fit in L1 cache. Being cache oblivious, every level of the
+/// cache hierarchy sees blocks that fit in it. Halves are transposed in
+/// separate OpenMP tasks.
+template <typename scalar_t, bool conj_>
+void transpose_rec(
+    internal::TransposeKernels< scalar_t > const& kernels,
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    constexpr int64_t leaf = leaf_size< scalar_t >();
+
+    if (m <= leaf && n <= leaf) {
+        // Each column of B is written a few entries at a time, and stores
+        // that miss cache wait one after another in the store buffer, so
+        // prefetching the B tile (as the in-place swap loads its tiles
+        // anyway) roughly doubles the bandwidth. The prefetch is inline;
+        // a function doing only prefetches is removed as having no effect.
+        #if defined( __SSE2__ )
+            const int64_t line = 64 / sizeof( scalar_t );
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < n; j += line) {
+                    _mm_prefetch( (char const*) &B[ j + i*ldb ], _MM_HINT_T0 );
+                }
+                _mm_prefetch( (char const*) &B[ n - 1 + i*ldb ], _MM_HINT_T0 );
+            }
+        #endif
+        transpose_tile< scalar_t, conj_ >( kernels, m, n, A, lda, B, ldb );
+    }
+    else if (m >= n) {
+        int64_t m1 = split( m, kernels.nb );
+        #pragma omp task if (m*n >= 2*task_threshold)
+        transpose_rec< scalar_t, conj_ >( kernels, m1, n, A, lda, B, ldb );
+
+        transpose_rec< scalar_t, conj_ >( kernels, m - m1, n, &A[ m1 ], lda,
+                                          &B[ m1*ldb ], ldb );
+        #pragma omp taskwait
+    }
+    else {
+        int64_t n1 = split( n, kernels.nb );
+        #pragma omp task if (m*n >= 2*task_threshold)
+        transpose_rec< scalar_t, conj_ >( kernels, m, n1, A, lda, B, ldb );
+
+        transpose_rec< scalar_t, conj_ >( kernels, m, n - n1,
+                                          &A[ n1*lda ], lda, &B[ n1 ], ldb );
+        #pragma omp taskwait
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Exchanges X <=> Y^T (or Y^H), where X is m-by-n and Y is n-by-m,
+/// recursively as in transpose_rec. Each pair of leaf tiles is swapped
+/// through a buffer that stays in L1 cache.
+template <typename scalar_t, bool conj_>
+void swap_transpose_rec(
+    internal::TransposeKernels< scalar_t > const& kernels,
+    int64_t m, int64_t n,
+    scalar_t* X, int64_t ldx,
+    scalar_t* Y, int64_t ldy )
+{
+    constexpr int64_t leaf = leaf_size< scalar_t >();
+
+    if (m <= leaf && n <= leaf) {
+        scalar_t buf[ leaf*leaf ];
+        transpose_tile< scalar_t, conj_ >( kernels, m, n, X, ldx, buf, leaf );
+        transpose_tile< scalar_t, conj_ >( kernels, n, m, Y, ldy, X, ldx );
+        copy_tile( n, m, buf, leaf, Y, ldy );
+    }
+    else if (m >= n) {
+        int64_t m1 = split( m, kernels.nb );
+        #pragma omp task if (m*n >= 2*task_threshold)
+        swap_transpose_rec< scalar_t, conj_ >( kernels, m1, n,
+                                               X, ldx, Y, ldy );
+
+        swap_transpose_rec< scalar_t, conj_ >( kernels, m - m1, n,
+                                               &X[ m1 ], ldx,
+                                               &Y[ m1*ldy ], ldy );
+        #pragma omp taskwait
+    }
+    else {
+        int64_t n1 = split( n, kernels.nb );
+        #pragma omp task if (m*n >= 2*task_threshold)
+        swap_transpose_rec< scalar_t, conj_ >( kernels, m, n1,
+                                               X, ldx, Y, ldy );
+
+        swap_transpose_rec< scalar_t, conj_ >( kernels, m, n - n1,
+                                               &X[ n1*ldx ], ldx,
+                                               &Y[ n1 ], ldy );
+        #pragma omp taskwait
+    }
+}
+
+//------------------------------------------------------------------------------
+/// In-place A = A^T or A^H for n-by-n A: transposes the diagonal blocks
+/// recursively and swaps the off-diagonal blocks.
+template <typename scalar_t, bool conj_>
+void transpose_square_rec(
+    internal::TransposeKernels< scalar_t > const& kernels,
+    int64_t n, scalar_t* A, int64_t lda )
+{
+    constexpr int64_t leaf = leaf_size< scalar_t >();
+
+    if (n <= leaf) {
+        scalar_t buf[ leaf*leaf ];
+        copy_tile( n, n, A, lda, buf, leaf );
+        transpose_tile< scalar_t, conj_ >( kernels, n, n, buf, leaf, A, lda );
+    }
+    else {
+        int64_t n1 = split( n, kernels.nb );
+        int64_t n2 = n - n1;
+        bool big = n*n >= 2*task_threshold;
+        #pragma omp task if (big)
+        transpose_square_rec< scalar_t, conj_ >( kernels, n1, A, lda );
+
+        #pragma omp task if (big)
+        transpose_square_rec< scalar_t, conj_ >( kernels, n2,
+                                                 &A[ n1 + n1*lda ], lda );
+
+        // A21 <=> A12^T
+        swap_transpose_rec< scalar_t, conj_ >( kernels, n2, n1,
+                                               &A[ n1 ], lda,
+                                               &A[ n1*lda ], lda );
+        #pragma omp taskwait
+    }
+}
+
+//------------------------------------------------------------------------------
+/// In-place A = A^T or A^H for m-by-n A stored contiguously, by following
+/// the cycles of the permutation. Entry p of the n-by-m result, at row
+/// p % n and column p / n, comes from entry (p % n)*m + p / n of A.
+/// Uses one bit of workspace per entry to mark entries already moved.
+template <typename scalar_t, bool conj_>
+void transpose_cycles(
+    int64_t m, int64_t n, scalar_t* A )
+{
+    using blas::conj;
+
+    int64_t mn = m*n;
+    std::vector<bool> done( mn, false );
+    // Entries 0 and mn - 1 never move.
+    for (int64_t start = 1; start < mn - 1; ++start) {
+        if (done[ start ])
+            continue;
+
+        scalar_t tmp = A[ start ];
+        int64_t p = start;
+        while (true) {
+            done[ p ] = true;
+            int64_t q = (p % n)*m + p / n;
+            if (q == start)
+                break;
+            if constexpr (conj_)
+                A[ p ] = conj( A[ q ] );
+            else
+                A[ p ] = A[ q ];
+            p = q;
+        }
+        if constexpr (conj_)
+            A[ p ] = conj( tmp );
+        else
+            A[ p ] = tmp;
+    }
+    if constexpr (conj_) {
+        A[ 0 ] = conj( A[ 0 ] );
+        if (mn > 1)
+            A[ mn - 1 ] = conj( A[ mn - 1 ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Out-of-place transpose, checking arguments and starting threads.
+template <typename scalar_t, bool conj_>
+void transpose_outofplace(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    if (m == 0 || n == 0)
+        return;
+
+    // Kernels are chosen here, in the calling thread.
+    auto const& kernels = internal::transpose_kernels< scalar_t >();
+
+    if (m*n >= parallel_threshold) {
+        #pragma omp parallel
+        #pragma omp single nowait
+        transpose_rec< scalar_t, conj_ >( kernels, m, n, A, lda, B, ldb );
+    }
+    else {
+        transpose_rec< scalar_t, conj_ >( kernels, m, n, A, lda, B, ldb );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Square in-place transpose, checking arguments and starting threads.
+template <typename scalar_t, bool conj_>
+void transpose_inplace(
+    int64_t n, scalar_t* A, int64_t lda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    if (n == 0)
+        return;
+
+    // Kernels are chosen here, in the calling thread.
+    auto const& kernels = internal::transpose_kernels< scalar_t >();
+
+    if (n*n >= parallel_threshold) {
+        #pragma omp parallel
+        #pragma omp single nowait
+        transpose_square_rec< scalar_t, conj_ >( kernels, n, A, lda );
+    }
+    else {
+        transpose_square_rec< scalar_t, conj_ >( kernels, n, A, lda );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Rectangular in-place transpose of contiguous A.
+template <typename scalar_t, bool conj_>
+void transpose_inplace(
+    int64_t m, int64_t n, scalar_t* A )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+
+    if (m == n) {
+        transpose_inplace< scalar_t, conj_ >( n, A, max( 1, n ) );
+    }
+    else if (m == 1 || n == 1) {
+        // A vector is its own transpose in memory.
+        if constexpr (conj_) {
+            using blas::conj;
+            for (int64_t i = 0; i < m*n; ++i)
+                A[ i ] = conj( A[ i ] );
+        }
+    }
+    else if (m > 0 && n > 0) {
+        transpose_cycles< scalar_t, conj_ >( m, n, A );
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+// Out-of-place transpose.
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    transpose_outofplace< float, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    transpose_outofplace< double, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    transpose_outofplace< std::complex<float>, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Transposes an m-by-n matrix A out-of-place, $B = A^T$.
+///
+/// The matrix is split recursively, halving its longer dimension, until
+/// tiles fit in L1 cache (cache-oblivious blocking); tiles are transposed
+/// in registers by SIMD micro-kernels for the instruction set from
+/// `lapack::simd_get` (up to 16x16 for float with AVX-512).
+/// Large matrices are transposed in parallel using OpenMP tasks.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] B
+///     The n-by-m matrix B, stored in an ldb-by-m array.
+///     On exit, $B = A^T$. B must not overlap A.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @see conj_transpose, lacpy
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    transpose_outofplace< std::complex<double>, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    transpose_outofplace< float, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    transpose_outofplace< double, false >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    transpose_outofplace< std::complex<float>, true >( m, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Conjugate-transposes an m-by-n matrix A out-of-place, $B = A^H$,
+/// as in `lapack::transpose`. For real matrices, this is the same as
+/// `lapack::transpose`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] B
+///     The n-by-m matrix B, stored in an ldb-by-m array.
+///     On exit, $B = A^H$. B must not overlap A.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @see transpose, lacpy
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    transpose_outofplace< std::complex<double>, true >( m, n, A, lda, B, ldb );
+}
+
+//==============================================================================
+// Square in-place transpose.
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t n, float* A, int64_t lda )
+{
+    transpose_inplace< float, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t n, double* A, int64_t lda )
+{
+    transpose_inplace< double, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t n, std::complex<float>* A, int64_t lda )
+{
+    transpose_inplace< std::complex<float>, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Transposes an n-by-n matrix A in place, $A = A^T$.
+///
+/// Diagonal blocks are transposed recursively and pairs of off-diagonal
+/// blocks are exchanged, through L1-sized tiles and SIMD micro-kernels
+/// as in the out-of-place `lapack::transpose`. Large matrices are
+/// transposed in parallel using OpenMP tasks.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, $A^T$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @ingroup initialize
+void transpose(
+    int64_t n, std::complex<double>* A, int64_t lda )
+{
+    transpose_inplace< std::complex<double>, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t n, float* A, int64_t lda )
+{
+    transpose_inplace< float, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t n, double* A, int64_t lda )
+{
+    transpose_inplace< double, false >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t n, std::complex<float>* A, int64_t lda )
+{
+    transpose_inplace< std::complex<float>, true >( n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Conjugate-transposes an n-by-n matrix A in place, $A = A^H$,
+/// as in `lapack::transpose`. For real matrices, this is the same as
+/// `lapack::transpose`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, $A^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @ingroup initialize
+void conj_transpose(
+    int64_t n, std::complex<double>* A, int64_t lda )
+{
+    transpose_inplace< std::complex<double>, true >( n, A, lda );
+}
+
+//==============================================================================
+// Rectangular in-place transpose.
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n, float* A )
+{
+    transpose_inplace< float, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n, double* A )
+{
+    transpose_inplace< double, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n, std::complex<float>* A )
+{
+    transpose_inplace< std::complex<float>, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// Transposes an m-by-n matrix A in place, $A = A^T$, where A is stored
+/// contiguously, without padding: on entry with leading dimension m, on
+/// exit with leading dimension n.
+///
+/// If m = n, this is the square in-place transpose. Otherwise, entries are
+/// moved by following the cycles of the transpose permutation, which needs
+/// only m*n bits of workspace, but accesses memory irregularly and is
+/// sequential, so it is several times slower than the out-of-place
+/// `lapack::transpose`. Use it when memory for a second copy of A is not
+/// available.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A on entry. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A on entry. n >= 0.
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, stored in an m-by-n array.
+///     On exit, the n-by-m matrix $A^T$, stored in an n-by-m array.
+///
+/// @ingroup initialize
+void transpose(
+    int64_t m, int64_t n, std::complex<double>* A )
+{
+    transpose_inplace< std::complex<double>, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n, float* A )
+{
+    transpose_inplace< float, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n, double* A )
+{
+    transpose_inplace< double, false >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n, std::complex<float>* A )
+{
+    transpose_inplace< std::complex<float>, true >( m, n, A );
+}
+
+// -----------------------------------------------------------------------------
+/// Conjugate-transposes an m-by-n matrix A in place, $A = A^H$, where A is
+/// stored contiguously, as in `lapack::transpose`. For real matrices, this
+/// is the same as `lapack::transpose`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A on entry. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A on entry. n >= 0.
+///
+/// @param[in,out] A
+///     On entry, the m-by-n matrix A, stored in an m-by-n array.
+///     On exit, the n-by-m matrix $A^H$, stored in an n-by-m array.
+///
+/// @ingroup initialize
+void conj_transpose(
+    int64_t m, int64_t n, std::complex<double>* A )
+{
+    transpose_inplace< std::complex<double>, true >( m, n, A );
+}
+
+}  // namespace lapack
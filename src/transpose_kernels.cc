@@ -0,0 +1,186 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "transpose_kernels.hh"
+
+#if defined( __SSE2__ )
+    #include <emmintrin.h>
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Kernels for the instruction set the library is compiled for. On x86-64
+// that includes SSE2; otherwise all types use the portable kernel.
+
+/// Portable kernel, used for complex<double> (one entry per SSE register),
+/// and for all types without SSE2.
+template <typename scalar_t, bool conj_>
+struct Kernel {
+    static constexpr int nb = 4;
+
+    static void transpose(
+        scalar_t const* A, int64_t lda,
+        scalar_t* B, int64_t ldb )
+    {
+        transpose_block< scalar_t, conj_, nb >( A, lda, B, ldb );
+    }
+};
+
+#if defined( __SSE2__ )
+
+//------------------------------------------------------------------------------
+/// Transposes a 4-by-4 block of 64-bit entries as four 2-by-2 blocks.
+/// For complex<float>, each entry is a (re, im) pair, with the sign of im
+/// in the sign bit of the 64-bit word, so negating the word as a double
+/// conjugates the entry.
+template <bool negate>
+inline void transpose_4x4_b64(
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    for (int jj = 0; jj < 4; jj += 2) {
+        for (int ii = 0; ii < 4; ii += 2) {
+            __m128d c0 = _mm_loadu_pd( &A[ ii + (jj    )*lda ] );
+            __m128d c1 = _mm_loadu_pd( &A[ ii + (jj + 1)*lda ] );
+            __m128d r0 = _mm_unpacklo_pd( c0, c1 );
+            __m128d r1 = _mm_unpackhi_pd( c0, c1 );
+            if constexpr (negate) {
+                const __m128d sign = _mm_set1_pd( -0.0 );
+                r0 = _mm_xor_pd( r0, sign );
+                r1 = _mm_xor_pd( r1, sign );
+            }
+            _mm_storeu_pd( &B[ jj + (ii    )*ldb ], r0 );
+            _mm_storeu_pd( &B[ jj + (ii + 1)*ldb ], r1 );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// float kernel, 4x4.
+template <bool conj_>
+struct Kernel< float, conj_ > {
+    static constexpr int nb = 4;
+
+    static void transpose(
+        float const* A, int64_t lda,
+        float* B, int64_t ldb )
+    {
+        __m128 r0 = _mm_loadu_ps( &A[ 0*lda ] );
+        __m128 r1 = _mm_loadu_ps( &A[ 1*lda ] );
+        __m128 r2 = _mm_loadu_ps( &A[ 2*lda ] );
+        __m128 r3 = _mm_loadu_ps( &A[ 3*lda ] );
+        _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+        _mm_storeu_ps( &B[ 0*ldb ], r0 );
+        _mm_storeu_ps( &B[ 1*ldb ], r1 );
+        _mm_storeu_ps( &B[ 2*ldb ], r2 );
+        _mm_storeu_ps( &B[ 3*ldb ], r3 );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// double kernel, 4x4.
+template <bool conj_>
+struct Kernel< double, conj_ > {
+    static constexpr int nb = 4;
+
+    static void transpose(
+        double const* A, int64_t lda,
+        double* B, int64_t ldb )
+    {
+        transpose_4x4_b64< false >( A, lda, B, ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// complex<float> kernel, 4x4, moving each entry as one 64-bit word.
+template <bool conj_>
+struct Kernel< std::complex<float>, conj_ > {
+    static constexpr int nb = 4;
+
+    static void transpose(
+        std::complex<float> const* A, int64_t lda,
+        std::complex<float>* B, int64_t ldb )
+    {
+        transpose_4x4_b64< conj_ >(
+            reinterpret_cast< double const* >( A ), lda,
+            reinterpret_cast< double* >( B ), ldb );
+    }
+};
+
+#endif  // __SSE2__
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for an m-by-n tile A.
+template <typename scalar_t, bool conj_>
+void transpose_tile(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using kernel = Kernel< scalar_t, conj_ >;
+    const int64_t nb = kernel::nb;
+
+    int64_t m_full = m - m % nb;
+    int64_t n_full = n - n % nb;
+    for (int64_t j = 0; j < n_full; j += nb) {
+        for (int64_t i = 0; i < m_full; i += nb) {
+            kernel::transpose( &A[ i + j*lda ], lda, &B[ j + i*ldb ], ldb );
+        }
+    }
+    transpose_edges< scalar_t, conj_ >( m, n, m_full, n_full, A, lda, B, ldb );
+}
+
+template <typename scalar_t>
+TransposeKernels< scalar_t > const generic_kernels = {
+    Kernel< scalar_t, false >::nb,
+    transpose_tile< scalar_t, false >,
+    transpose_tile< scalar_t, true >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels_generic()
+{
+    return generic_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels()
+{
+    switch (simd_get()) {
+        #if defined( LAPACK_SIMD_X86 )
+            case Simd::AVX512:
+                return transpose_kernels_avx512< scalar_t >();
+
+            case Simd::AVX2:
+                return transpose_kernels_avx2< scalar_t >();
+        #endif
+
+        default:
+            return transpose_kernels_generic< scalar_t >();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template TransposeKernels< float > const& transpose_kernels();
+template TransposeKernels< double > const& transpose_kernels();
+template TransposeKernels< std::complex<float> > const& transpose_kernels();
+template TransposeKernels< std::complex<double> > const& transpose_kernels();
+
+template TransposeKernels< float > const& transpose_kernels_generic();
+template TransposeKernels< double > const& transpose_kernels_generic();
+template TransposeKernels< std::complex<float> > const& transpose_kernels_generic();
+template TransposeKernels< std::complex<double> > const& transpose_kernels_generic();
+
+}  // namespace internal
+}  // namespace lapack
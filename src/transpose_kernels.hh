@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TRANSPOSE_KERNELS_HH
+#define LAPACK_TRANSPOSE_KERNELS_HH
+
+#include "lapack/util.hh"
+#include "simd_kernels.hh"
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Tile kernels for native transpose and conj_transpose, one table per
+/// instruction set. A tile kernel transposes whole nb-by-nb blocks of
+/// a tile in registers, and its edges with scalar loops.
+template <typename scalar_t>
+struct TransposeKernels
+{
+    /// Block size of the register kernel. Tiles are split at multiples
+    /// of nb, so only the last tile in each dimension has edges.
+    int64_t nb;
+
+    /// B = A^T for an m-by-n tile A, with A and B column-major.
+    void (*transpose)(
+        int64_t m, int64_t n,
+        scalar_t const* A, int64_t lda,
+        scalar_t* B, int64_t ldb );
+
+    /// B = A^H for an m-by-n tile A, with A and B column-major.
+    void (*conj_transpose)(
+        int64_t m, int64_t n,
+        scalar_t const* A, int64_t lda,
+        scalar_t* B, int64_t ldb );
+};
+
+/// @return kernels for the instruction set from simd_get().
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels();
+
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels_generic();
+
+#if defined( LAPACK_SIMD_X86 )
+    template <typename scalar_t>
+    TransposeKernels< scalar_t > const& transpose_kernels_avx2();
+
+    template <typename scalar_t>
+    TransposeKernels< scalar_t > const& transpose_kernels_avx512();
+#endif
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for an nb-by-nb block, with scalar loops. Used for
+/// types that an instruction set has no register kernel for.
+template <typename scalar_t, bool conj_, int nb>
+inline void transpose_block(
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+
+    for (int j = 0; j < nb; ++j) {
+        for (int i = 0; i < nb; ++i) {
+            if constexpr (conj_)
+                B[ j + i*ldb ] = conj( A[ i + j*lda ] );
+            else
+                B[ j + i*ldb ] = A[ i + j*lda ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for the edges of an m-by-n tile A: rows m_full:m,
+/// and columns n_full:n of rows 0:m_full. The m_full-by-n_full part
+/// is made of whole blocks, done by the register kernel.
+template <typename scalar_t, bool conj_>
+inline void transpose_edges(
+    int64_t m, int64_t n, int64_t m_full, int64_t n_full,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+
+    // bottom edge, m_full:m rows
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = m_full; i < m; ++i) {
+            if constexpr (conj_)
+                B[ j + i*ldb ] = conj( A[ i + j*lda ] );
+            else
+                B[ j + i*ldb ] = A[ i + j*lda ];
+        }
+    }
+    // right edge, n_full:n columns
+    for (int64_t j = n_full; j < n; ++j) {
+        for (int64_t i = 0; i < m_full; ++i) {
+            if constexpr (conj_)
+                B[ j + i*ldb ] = conj( A[ i + j*lda ] );
+            else
+                B[ j + i*ldb ] = A[ i + j*lda ];
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TRANSPOSE_KERNELS_HH
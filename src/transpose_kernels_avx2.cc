@@ -0,0 +1,201 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "transpose_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+/// Generic kernel, used for complex<double>, which is one entry per
+/// SSE register, so shuffles gain nothing over moving whole entries.
+template <typename scalar_t, bool conj_>
+struct Kernel {
+    static constexpr int nb = 4;
+
+    LAPACK_TARGET_AVX2
+    static void transpose(
+        scalar_t const* A, int64_t lda,
+        scalar_t* B, int64_t ldb )
+    {
+        transpose_block< scalar_t, conj_, nb >( A, lda, B, ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// Transposes a 4-by-4 block of 64-bit entries. For complex<float>, each
+/// entry is a (re, im) pair, with the sign of im in the sign bit of the
+/// 64-bit word, so negating the word as a double conjugates the entry.
+template <bool negate>
+LAPACK_TARGET_AVX2
+inline void transpose_4x4_b64(
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    __m256d r0 = _mm256_loadu_pd( &A[ 0*lda ] );
+    __m256d r1 = _mm256_loadu_pd( &A[ 1*lda ] );
+    __m256d r2 = _mm256_loadu_pd( &A[ 2*lda ] );
+    __m256d r3 = _mm256_loadu_pd( &A[ 3*lda ] );
+
+    __m256d t0 = _mm256_unpacklo_pd( r0, r1 );  // a00 a01 a20 a21
+    __m256d t1 = _mm256_unpackhi_pd( r0, r1 );  // a10 a11 a30 a31
+    __m256d t2 = _mm256_unpacklo_pd( r2, r3 );  // a02 a03 a22 a23
+    __m256d t3 = _mm256_unpackhi_pd( r2, r3 );  // a12 a13 a32 a33
+
+    r0 = _mm256_permute2f128_pd( t0, t2, 0x20 );
+    r1 = _mm256_permute2f128_pd( t1, t3, 0x20 );
+    r2 = _mm256_permute2f128_pd( t0, t2, 0x31 );
+    r3 = _mm256_permute2f128_pd( t1, t3, 0x31 );
+
+    if constexpr (negate) {
+        const __m256d sign = _mm256_set1_pd( -0.0 );
+        r0 = _mm256_xor_pd( r0, sign );
+        r1 = _mm256_xor_pd( r1, sign );
+        r2 = _mm256_xor_pd( r2, sign );
+        r3 = _mm256_xor_pd( r3, sign );
+    }
+
+    _mm256_storeu_pd( &B[ 0*ldb ], r0 );
+    _mm256_storeu_pd( &B[ 1*ldb ], r1 );
+    _mm256_storeu_pd( &B[ 2*ldb ], r2 );
+    _mm256_storeu_pd( &B[ 3*ldb ], r3 );
+}
+
+//------------------------------------------------------------------------------
+/// float kernel, 8x8.
+template <bool conj_>
+struct Kernel< float, conj_ > {
+    static constexpr int nb = 8;
+
+    LAPACK_TARGET_AVX2
+    static void transpose(
+        float const* A, int64_t lda,
+        float* B, int64_t ldb )
+    {
+        __m256 r0 = _mm256_loadu_ps( &A[ 0*lda ] );
+        __m256 r1 = _mm256_loadu_ps( &A[ 1*lda ] );
+        __m256 r2 = _mm256_loadu_ps( &A[ 2*lda ] );
+        __m256 r3 = _mm256_loadu_ps( &A[ 3*lda ] );
+        __m256 r4 = _mm256_loadu_ps( &A[ 4*lda ] );
+        __m256 r5 = _mm256_loadu_ps( &A[ 5*lda ] );
+        __m256 r6 = _mm256_loadu_ps( &A[ 6*lda ] );
+        __m256 r7 = _mm256_loadu_ps( &A[ 7*lda ] );
+
+        __m256 t0 = _mm256_unpacklo_ps( r0, r1 );
+        __m256 t1 = _mm256_unpackhi_ps( r0, r1 );
+        __m256 t2 = _mm256_unpacklo_ps( r2, r3 );
+        __m256 t3 = _mm256_unpackhi_ps( r2, r3 );
+        __m256 t4 = _mm256_unpacklo_ps( r4, r5 );
+        __m256 t5 = _mm256_unpackhi_ps( r4, r5 );
+        __m256 t6 = _mm256_unpacklo_ps( r6, r7 );
+        __m256 t7 = _mm256_unpackhi_ps( r6, r7 );
+
+        __m256 s0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 s6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 s7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+        _mm256_storeu_ps( &B[ 0*ldb ], _mm256_permute2f128_ps( s0, s4, 0x20 ) );
+        _mm256_storeu_ps( &B[ 1*ldb ], _mm256_permute2f128_ps( s1, s5, 0x20 ) );
+        _mm256_storeu_ps( &B[ 2*ldb ], _mm256_permute2f128_ps( s2, s6, 0x20 ) );
+        _mm256_storeu_ps( &B[ 3*ldb ], _mm256_permute2f128_ps( s3, s7, 0x20 ) );
+        _mm256_storeu_ps( &B[ 4*ldb ], _mm256_permute2f128_ps( s0, s4, 0x31 ) );
+        _mm256_storeu_ps( &B[ 5*ldb ], _mm256_permute2f128_ps( s1, s5, 0x31 ) );
+        _mm256_storeu_ps( &B[ 6*ldb ], _mm256_permute2f128_ps( s2, s6, 0x31 ) );
+        _mm256_storeu_ps( &B[ 7*ldb ], _mm256_permute2f128_ps( s3, s7, 0x31 ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// double kernel, 4x4.
+template <bool conj_>
+struct Kernel< double, conj_ > {
+    static constexpr int nb = 4;
+
+    LAPACK_TARGET_AVX2
+    static void transpose(
+        double const* A, int64_t lda,
+        double* B, int64_t ldb )
+    {
+        transpose_4x4_b64< false >( A, lda, B, ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// complex<float> kernel, 4x4, moving each entry as one 64-bit word.
+template <bool conj_>
+struct Kernel< std::complex<float>, conj_ > {
+    static constexpr int nb = 4;
+
+    LAPACK_TARGET_AVX2
+    static void transpose(
+        std::complex<float> const* A, int64_t lda,
+        std::complex<float>* B, int64_t ldb )
+    {
+        transpose_4x4_b64< conj_ >(
+            reinterpret_cast< double const* >( A ), lda,
+            reinterpret_cast< double* >( B ), ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for an m-by-n tile A.
+template <typename scalar_t, bool conj_>
+LAPACK_TARGET_AVX2
+void transpose_tile(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using kernel = Kernel< scalar_t, conj_ >;
+    const int64_t nb = kernel::nb;
+
+    int64_t m_full = m - m % nb;
+    int64_t n_full = n - n % nb;
+    for (int64_t j = 0; j < n_full; j += nb) {
+        for (int64_t i = 0; i < m_full; i += nb) {
+            kernel::transpose( &A[ i + j*lda ], lda, &B[ j + i*ldb ], ldb );
+        }
+    }
+    transpose_edges< scalar_t, conj_ >( m, n, m_full, n_full, A, lda, B, ldb );
+}
+
+template <typename scalar_t>
+TransposeKernels< scalar_t > const avx2_kernels = {
+    Kernel< scalar_t, false >::nb,
+    transpose_tile< scalar_t, false >,
+    transpose_tile< scalar_t, true >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels_avx2()
+{
+    return avx2_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template TransposeKernels< float > const& transpose_kernels_avx2();
+template TransposeKernels< double > const& transpose_kernels_avx2();
+template TransposeKernels< std::complex<float> > const& transpose_kernels_avx2();
+template TransposeKernels< std::complex<double> > const& transpose_kernels_avx2();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
@@ -0,0 +1,307 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "transpose_kernels.hh"
+
+#if defined( LAPACK_SIMD_X86 )
+
+#include <immintrin.h>
+
+#include <cstdint>
+
+// GCC 12's AVX-512 headers trigger false uninitialized warnings
+// from _mm512_undefined_pd when inlined.
+#if defined( __GNUC__ ) && ! defined( __clang__ )
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Each kernel ends by transposing a 4-by-4 block of 128-bit lanes:
+// for float, after transposing 4x4 floats within each lane;
+// for double and complex<float>, after transposing 2x2 within each lane;
+// for complex<double>, each lane is one entry.
+
+/// Transposes 4-by-4 lanes: lane i of vector j goes to lane j of vector i.
+LAPACK_TARGET_AVX512
+inline void transpose_lanes(
+    __m512d& v0, __m512d& v1, __m512d& v2, __m512d& v3 )
+{
+    // _mm512_shuffle_f64x2( a, b, imm ) takes lanes 0, 1 from a
+    // and lanes 2, 3 from b, as selected by each 2 bits of imm.
+    __m512d u0 = _mm512_shuffle_f64x2( v0, v1, 0x44 );  // v0.0 v0.1 v1.0 v1.1
+    __m512d u1 = _mm512_shuffle_f64x2( v2, v3, 0x44 );  // v2.0 v2.1 v3.0 v3.1
+    __m512d u2 = _mm512_shuffle_f64x2( v0, v1, 0xEE );  // v0.2 v0.3 v1.2 v1.3
+    __m512d u3 = _mm512_shuffle_f64x2( v2, v3, 0xEE );  // v2.2 v2.3 v3.2 v3.3
+    v0 = _mm512_shuffle_f64x2( u0, u1, 0x88 );  // v0.0 v1.0 v2.0 v3.0
+    v1 = _mm512_shuffle_f64x2( u0, u1, 0xDD );  // v0.1 v1.1 v2.1 v3.1
+    v2 = _mm512_shuffle_f64x2( u2, u3, 0x88 );  // v0.2 v1.2 v2.2 v3.2
+    v3 = _mm512_shuffle_f64x2( u2, u3, 0xDD );  // v0.3 v1.3 v2.3 v3.3
+}
+
+/// Flips the sign bits selected by sign, an integer vector since
+/// _mm512_xor_pd needs AVX-512DQ.
+LAPACK_TARGET_AVX512
+inline __m512d negate( __m512d v, __m512i sign )
+{
+    return _mm512_castsi512_pd(
+        _mm512_xor_si512( _mm512_castpd_si512( v ), sign ) );
+}
+
+//------------------------------------------------------------------------------
+/// Transposes an 8-by-8 block of 64-bit entries. For complex<float>, each
+/// entry is a (re, im) pair, with the sign of im in the sign bit of the
+/// 64-bit word, so negating the word as a double conjugates the entry.
+template <bool negate_>
+LAPACK_TARGET_AVX512
+inline void transpose_8x8_b64(
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    __m512d r0 = _mm512_loadu_pd( &A[ 0*lda ] );
+    __m512d r1 = _mm512_loadu_pd( &A[ 1*lda ] );
+    __m512d r2 = _mm512_loadu_pd( &A[ 2*lda ] );
+    __m512d r3 = _mm512_loadu_pd( &A[ 3*lda ] );
+    __m512d r4 = _mm512_loadu_pd( &A[ 4*lda ] );
+    __m512d r5 = _mm512_loadu_pd( &A[ 5*lda ] );
+    __m512d r6 = _mm512_loadu_pd( &A[ 6*lda ] );
+    __m512d r7 = _mm512_loadu_pd( &A[ 7*lda ] );
+
+    // 2x2 within lanes: lane l of t0 is row 2l, of t1 row 2l + 1,
+    // columns 0, 1; t2, t3 columns 2, 3; etc.
+    __m512d t0 = _mm512_unpacklo_pd( r0, r1 );
+    __m512d t1 = _mm512_unpackhi_pd( r0, r1 );
+    __m512d t2 = _mm512_unpacklo_pd( r2, r3 );
+    __m512d t3 = _mm512_unpackhi_pd( r2, r3 );
+    __m512d t4 = _mm512_unpacklo_pd( r4, r5 );
+    __m512d t5 = _mm512_unpackhi_pd( r4, r5 );
+    __m512d t6 = _mm512_unpacklo_pd( r6, r7 );
+    __m512d t7 = _mm512_unpackhi_pd( r6, r7 );
+
+    transpose_lanes( t0, t2, t4, t6 );  // rows 0, 2, 4, 6
+    transpose_lanes( t1, t3, t5, t7 );  // rows 1, 3, 5, 7
+
+    if constexpr (negate_) {
+        const __m512i sign = _mm512_set1_epi64( INT64_MIN );
+        t0 = negate( t0, sign );
+        t1 = negate( t1, sign );
+        t2 = negate( t2, sign );
+        t3 = negate( t3, sign );
+        t4 = negate( t4, sign );
+        t5 = negate( t5, sign );
+        t6 = negate( t6, sign );
+        t7 = negate( t7, sign );
+    }
+
+    _mm512_storeu_pd( &B[ 0*ldb ], t0 );
+    _mm512_storeu_pd( &B[ 1*ldb ], t1 );
+    _mm512_storeu_pd( &B[ 2*ldb ], t2 );
+    _mm512_storeu_pd( &B[ 3*ldb ], t3 );
+    _mm512_storeu_pd( &B[ 4*ldb ], t4 );
+    _mm512_storeu_pd( &B[ 5*ldb ], t5 );
+    _mm512_storeu_pd( &B[ 6*ldb ], t6 );
+    _mm512_storeu_pd( &B[ 7*ldb ], t7 );
+}
+
+//------------------------------------------------------------------------------
+/// Transposes 4x4 floats within each lane of 4 columns, as in the 8x8 AVX
+/// kernel: on output, lane l of s0, s1, s2, s3 is row 4l, 4l + 1, 4l + 2,
+/// 4l + 3, respectively, of the 4 columns r0, ..., r3.
+LAPACK_TARGET_AVX512
+inline void transpose_4x4_ps(
+    __m512 r0, __m512 r1, __m512 r2, __m512 r3,
+    __m512d& s0, __m512d& s1, __m512d& s2, __m512d& s3 )
+{
+    __m512 t0 = _mm512_unpacklo_ps( r0, r1 );
+    __m512 t1 = _mm512_unpackhi_ps( r0, r1 );
+    __m512 t2 = _mm512_unpacklo_ps( r2, r3 );
+    __m512 t3 = _mm512_unpackhi_ps( r2, r3 );
+    s0 = _mm512_castps_pd( _mm512_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+    s1 = _mm512_castps_pd( _mm512_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+    s2 = _mm512_castps_pd( _mm512_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+    s3 = _mm512_castps_pd( _mm512_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+}
+
+//------------------------------------------------------------------------------
+/// Kernels, specialized for each type.
+template <typename scalar_t, bool conj_>
+struct Kernel;
+
+//------------------------------------------------------------------------------
+/// float kernel, 16x16.
+template <bool conj_>
+struct Kernel< float, conj_ > {
+    static constexpr int nb = 16;
+
+    LAPACK_TARGET_AVX512
+    static void transpose(
+        float const* A, int64_t lda,
+        float* B, int64_t ldb )
+    {
+        // Columns 4q : 4q + 3 in s<q><p>, with row 4l + p in lane l.
+        __m512d s00, s01, s02, s03, s10, s11, s12, s13;
+        __m512d s20, s21, s22, s23, s30, s31, s32, s33;
+        transpose_4x4_ps(
+            _mm512_loadu_ps( &A[  0*lda ] ), _mm512_loadu_ps( &A[  1*lda ] ),
+            _mm512_loadu_ps( &A[  2*lda ] ), _mm512_loadu_ps( &A[  3*lda ] ),
+            s00, s01, s02, s03 );
+        transpose_4x4_ps(
+            _mm512_loadu_ps( &A[  4*lda ] ), _mm512_loadu_ps( &A[  5*lda ] ),
+            _mm512_loadu_ps( &A[  6*lda ] ), _mm512_loadu_ps( &A[  7*lda ] ),
+            s10, s11, s12, s13 );
+        transpose_4x4_ps(
+            _mm512_loadu_ps( &A[  8*lda ] ), _mm512_loadu_ps( &A[  9*lda ] ),
+            _mm512_loadu_ps( &A[ 10*lda ] ), _mm512_loadu_ps( &A[ 11*lda ] ),
+            s20, s21, s22, s23 );
+        transpose_4x4_ps(
+            _mm512_loadu_ps( &A[ 12*lda ] ), _mm512_loadu_ps( &A[ 13*lda ] ),
+            _mm512_loadu_ps( &A[ 14*lda ] ), _mm512_loadu_ps( &A[ 15*lda ] ),
+            s30, s31, s32, s33 );
+
+        // Gather lanes: rows p, 4 + p, 8 + p, 12 + p.
+        transpose_lanes( s00, s10, s20, s30 );
+        transpose_lanes( s01, s11, s21, s31 );
+        transpose_lanes( s02, s12, s22, s32 );
+        transpose_lanes( s03, s13, s23, s33 );
+
+        _mm512_storeu_ps( &B[  0*ldb ], _mm512_castpd_ps( s00 ) );
+        _mm512_storeu_ps( &B[  1*ldb ], _mm512_castpd_ps( s01 ) );
+        _mm512_storeu_ps( &B[  2*ldb ], _mm512_castpd_ps( s02 ) );
+        _mm512_storeu_ps( &B[  3*ldb ], _mm512_castpd_ps( s03 ) );
+        _mm512_storeu_ps( &B[  4*ldb ], _mm512_castpd_ps( s10 ) );
+        _mm512_storeu_ps( &B[  5*ldb ], _mm512_castpd_ps( s11 ) );
+        _mm512_storeu_ps( &B[  6*ldb ], _mm512_castpd_ps( s12 ) );
+        _mm512_storeu_ps( &B[  7*ldb ], _mm512_castpd_ps( s13 ) );
+        _mm512_storeu_ps( &B[  8*ldb ], _mm512_castpd_ps( s20 ) );
+        _mm512_storeu_ps( &B[  9*ldb ], _mm512_castpd_ps( s21 ) );
+        _mm512_storeu_ps( &B[ 10*ldb ], _mm512_castpd_ps( s22 ) );
+        _mm512_storeu_ps( &B[ 11*ldb ], _mm512_castpd_ps( s23 ) );
+        _mm512_storeu_ps( &B[ 12*ldb ], _mm512_castpd_ps( s30 ) );
+        _mm512_storeu_ps( &B[ 13*ldb ], _mm512_castpd_ps( s31 ) );
+        _mm512_storeu_ps( &B[ 14*ldb ], _mm512_castpd_ps( s32 ) );
+        _mm512_storeu_ps( &B[ 15*ldb ], _mm512_castpd_ps( s33 ) );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// double kernel, 8x8.
+template <bool conj_>
+struct Kernel< double, conj_ > {
+    static constexpr int nb = 8;
+
+    LAPACK_TARGET_AVX512
+    static void transpose(
+        double const* A, int64_t lda,
+        double* B, int64_t ldb )
+    {
+        transpose_8x8_b64< false >( A, lda, B, ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// complex<float> kernel, 8x8, moving each entry as one 64-bit word.
+template <bool conj_>
+struct Kernel< std::complex<float>, conj_ > {
+    static constexpr int nb = 8;
+
+    LAPACK_TARGET_AVX512
+    static void transpose(
+        std::complex<float> const* A, int64_t lda,
+        std::complex<float>* B, int64_t ldb )
+    {
+        transpose_8x8_b64< conj_ >(
+            reinterpret_cast< double const* >( A ), lda,
+            reinterpret_cast< double* >( B ), ldb );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// complex<double> kernel, 4x4, each entry one lane.
+template <bool conj_>
+struct Kernel< std::complex<double>, conj_ > {
+    static constexpr int nb = 4;
+
+    LAPACK_TARGET_AVX512
+    static void transpose(
+        std::complex<double> const* A_, int64_t lda,
+        std::complex<double>* B_, int64_t ldb )
+    {
+        double const* A = reinterpret_cast< double const* >( A_ );
+        double* B = reinterpret_cast< double* >( B_ );
+        __m512d r0 = _mm512_loadu_pd( &A[ 0*2*lda ] );
+        __m512d r1 = _mm512_loadu_pd( &A[ 1*2*lda ] );
+        __m512d r2 = _mm512_loadu_pd( &A[ 2*2*lda ] );
+        __m512d r3 = _mm512_loadu_pd( &A[ 3*2*lda ] );
+        transpose_lanes( r0, r1, r2, r3 );
+        if constexpr (conj_) {
+            // sign bits of imaginary parts
+            const __m512i sign = _mm512_set_epi64(
+                INT64_MIN, 0, INT64_MIN, 0, INT64_MIN, 0, INT64_MIN, 0 );
+            r0 = negate( r0, sign );
+            r1 = negate( r1, sign );
+            r2 = negate( r2, sign );
+            r3 = negate( r3, sign );
+        }
+        _mm512_storeu_pd( &B[ 0*2*ldb ], r0 );
+        _mm512_storeu_pd( &B[ 1*2*ldb ], r1 );
+        _mm512_storeu_pd( &B[ 2*2*ldb ], r2 );
+        _mm512_storeu_pd( &B[ 3*2*ldb ], r3 );
+    }
+};
+
+//------------------------------------------------------------------------------
+/// B = A^T or A^H for an m-by-n tile A.
+template <typename scalar_t, bool conj_>
+LAPACK_TARGET_AVX512
+void transpose_tile(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using kernel = Kernel< scalar_t, conj_ >;
+    const int64_t nb = kernel::nb;
+
+    int64_t m_full = m - m % nb;
+    int64_t n_full = n - n % nb;
+    for (int64_t j = 0; j < n_full; j += nb) {
+        for (int64_t i = 0; i < m_full; i += nb) {
+            kernel::transpose( &A[ i + j*lda ], lda, &B[ j + i*ldb ], ldb );
+        }
+    }
+    transpose_edges< scalar_t, conj_ >( m, n, m_full, n_full, A, lda, B, ldb );
+}
+
+template <typename scalar_t>
+TransposeKernels< scalar_t > const avx512_kernels = {
+    Kernel< scalar_t, false >::nb,
+    transpose_tile< scalar_t, false >,
+    transpose_tile< scalar_t, true >,
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+TransposeKernels< scalar_t > const& transpose_kernels_avx512()
+{
+    return avx512_kernels< scalar_t >;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template TransposeKernels< float > const& transpose_kernels_avx512();
+template TransposeKernels< double > const& transpose_kernels_avx512();
+template TransposeKernels< std::complex<float> > const& transpose_kernels_avx512();
+template TransposeKernels< std::complex<double> > const& transpose_kernels_avx512();
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SIMD_X86
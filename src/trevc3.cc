@@ -18,15 +18,20 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t trevc3(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t trevc3_work(
     lapack::Sides sides, lapack::HowMany howmany,
     bool* select, int64_t n,
     float const* T, int64_t ldt,
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr, int64_t mm,
-    int64_t* m )
+    int64_t* m,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -39,9 +44,18 @@ int64_t trevc3(
     char sides_ = sides2char( sides );
     char howmany_ = howmany2char( howmany );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -51,24 +65,32 @@ int64_t trevc3(
     lapack_int m_ = (lapack_int) *m;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_strevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "strevc3", { sides_, howmany_, n_, ldt_, ldvl_, ldvr_, mm_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        float qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_strevc3(
+            &sides_, &howmany_,
+            select_ptr, &n_,
+            T, &ldt_,
+            VL, &ldvl_,
+            VR, &ldvr_, &mm_, &m_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_strevc3(
         &sides_, &howmany_,
@@ -76,26 +98,26 @@ int64_t trevc3(
         T, &ldt_,
         VL, &ldvl_,
         VR, &ldvr_, &mm_, &m_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
+    std::copy( select_, select_ + (n), select );
     *m = m_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t trevc3(
+int64_t trevc3_work(
     lapack::Sides sides, lapack::HowMany howmany,
     bool* select, int64_t n,
     double const* T, int64_t ldt,
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr, int64_t mm,
-    int64_t* m )
+    int64_t* m,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -108,9 +130,18 @@ int64_t trevc3(
     char sides_ = sides2char( sides );
     char howmany_ = howmany2char( howmany );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -120,24 +151,32 @@ int64_t trevc3(
     lapack_int m_ = (lapack_int) *m;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dtrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
+    // query for workspace size, unless cached
+    internal::WorkKey key( "dtrevc3", { sides_, howmany_, n_, ldt_, ldvl_, ldvr_, mm_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        double qry_work[1];
+        lapack_int ineg_one = -1;
+        LAPACK_dtrevc3(
+            &sides_, &howmany_,
+            select_ptr, &n_,
+            T, &ldt_,
+            VL, &ldvl_,
+            VR, &ldvr_, &mm_, &m_,
+            qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        work_buffer.insert( key, sizes );
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    lapack_int lwork_ = sizes.lwork;
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dtrevc3(
         &sides_, &howmany_,
@@ -145,26 +184,26 @@ int64_t trevc3(
         T, &ldt_,
         VL, &ldvl_,
         VR, &ldvr_, &mm_, &m_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
+    std::copy( select_, select_ + (n), select );
     *m = m_;
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// @ingroup geev_computational
-int64_t trevc3(
+int64_t trevc3_work(
     lapack::Sides sides, lapack::HowMany howmany,
     bool const* select, int64_t n,
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
-    int64_t* m )
+    int64_t* m,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -177,9 +216,18 @@ int64_t trevc3(
     char sides_ = sides2char( sides );
     char howmany_ = howmany2char( howmany );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -189,37 +237,136 @@ int64_t trevc3(
     lapack_int m_ = (lapack_int) *m;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
+    // query for workspace size, unless cached
+    internal::WorkKey key( "ctrevc3", { sides_, howmany_, n_, ldt_, ldvl_, ldvr_, mm_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<float> qry_work[1];
+        float qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ctrevc3(
+            &sides_, &howmany_,
+            select_ptr, &n_,
+            (lapack_complex_float*) T, &ldt_,
+            (lapack_complex_float*) VL, &ldvl_,
+            (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
+            (lapack_complex_float*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    float* rwork = work_buffer.get< float >( lrwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
     LAPACK_ctrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
         (lapack_complex_float*) T, &ldt_,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *m = m_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t trevc3_work(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    internal::WorkBuffer& work_buffer )
+{
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
-    LAPACK_ctrevc3(
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // query for workspace size, unless cached
+    internal::WorkKey key( "ztrevc3", { sides_, howmany_, n_, ldt_, ldvl_, ldvr_, mm_ } );
+    internal::WorkSizes sizes;
+    if (! work_buffer.find( key, &sizes )) {
+        std::complex<double> qry_work[1];
+        double qry_rwork[1];
+        lapack_int ineg_one = -1;
+        LAPACK_ztrevc3(
+            &sides_, &howmany_,
+            select_ptr, &n_,
+            (lapack_complex_double*) T, &ldt_,
+            (lapack_complex_double*) VL, &ldvl_,
+            (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
+            (lapack_complex_double*) qry_work, &ineg_one,
+            qry_rwork, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        sizes.lwork = real(qry_work[0]);
+        sizes.lrwork = real(qry_rwork[0]);
+        work_buffer.insert( key, sizes );
+    }
+    lapack_int lwork_ = sizes.lwork;
+    lapack_int lrwork_ = sizes.lrwork;
+
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    double* rwork = work_buffer.get< double >( lrwork_ );
+    if (work_buffer.counts_only())
+        return 0;
+
+    LAPACK_ztrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -228,6 +375,62 @@ int64_t trevc3(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* m )
+{
+    size_t host_work_size;
+    trevc3_work_size_bytes( sides, howmany, select, n, T, ldt, VL, ldvl,
+                            VR, ldvr, mm, m, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trevc3( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* m )
+{
+    size_t host_work_size;
+    trevc3_work_size_bytes( sides, howmany, select, n, T, ldt, VL, ldvl,
+                            VR, ldvr, mm, m, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trevc3( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                   host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m )
+{
+    size_t host_work_size;
+    trevc3_work_size_bytes( sides, howmany, select, n, T, ldt, VL, ldvl,
+                            VR, ldvr, mm, m, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trevc3( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                   host_work.data(), host_work_size );
+}
+
 // -----------------------------------------------------------------------------
 /// Computes some or all of the right and/or left eigenvectors of
 /// a complex upper triangular matrix T.
@@ -362,66 +565,171 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
-    }
-    char sides_ = sides2char( sides );
-    char howmany_ = howmany2char( howmany );
+    size_t host_work_size;
+    trevc3_work_size_bytes( sides, howmany, select, n, T, ldt, VL, ldvl,
+                            VR, ldvr, mm, m, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trevc3( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                   host_work.data(), host_work_size );
+}
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size_bytes(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                 work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ldt_ = (lapack_int) ldt;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int mm_ = (lapack_int) mm;
-    lapack_int m_ = (lapack_int) *m;
-    lapack_int info_ = 0;
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size_bytes(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                 work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ztrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size_bytes(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                 work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the size of host workspace needed by the `host_work`
+/// version of `lapack::trevc3`. Arguments are the same as for
+/// `lapack::trevc3`; only the workspace query is done.
+///
+/// @param[out] host_work_size
+///     On exit, size in bytes of host_work.
+///
+/// @ingroup geev_computational
+void trevc3_work_size_bytes(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, m,
+                 work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m, work_buffer );
+}
 
-    LAPACK_ztrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *m = m_;
-    return info_;
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m, work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+/// Version of `lapack::trevc3` that takes its workspace, including
+/// any 32-bit integer copies, from host_work instead of allocating it.
+/// After the first call for a given problem shape fills the workspace
+/// query cache, it does no heap allocation, e.g.:
+///
+///     lapack::trevc3_work_size_bytes( ..., &host_work_size );
+///     std::vector< char > host_work( host_work_size );
+///     for (...) {
+///         lapack::trevc3( ..., host_work.data(), host_work_size );
+///     }
+///
+/// Other arguments are the same as for `lapack::trevc3`.
+///
+/// @param[in,out] host_work
+///     Host workspace of host_work_size bytes. Need not be aligned.
+///
+/// @param[in] host_work_size
+///     Size in bytes of host_work; at least the value returned by
+///     `lapack::trevc3_work_size_bytes` for the same arguments.
+///
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m, work_buffer );
 }
 
 }  // namespace lapack
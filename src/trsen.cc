@@ -15,8 +15,13 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+namespace {
+
 // -----------------------------------------------------------------------------
-int64_t trsen(
+// Shared by the wrappers below: checks and converts arguments, takes any
+// workspace from work_buffer, and calls LAPACK. When work_buffer only
+// counts bytes, returns 0 once the workspace is counted.
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     float* T, int64_t ldt,
@@ -24,7 +29,8 @@ int64_t trsen(
     std::complex<float>* W,
     int64_t* m,
     float* s,
-    float* sep )
+    float* sep,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -35,9 +41,18 @@ int64_t trsen(
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -46,10 +61,11 @@ int64_t trsen(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    float* WR = work_buffer.get< float >( max( 1, n ) );
+    float* WI = work_buffer.get< float >( max( 1, n ) );
 
     // query for workspace size
+    // Not cached: it depends on the number of eigenvalues in select.
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -58,8 +74,8 @@ int64_t trsen(
         select_ptr, &n_,
         T, &ldt_,
         Q, &ldq_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         &m_, s, sep,
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
@@ -70,20 +86,22 @@ int64_t trsen(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    float* work = work_buffer.get< float >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_strsen(
         &sense_, &compq_,
         select_ptr, &n_,
         T, &ldt_,
         Q, &ldq_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         &m_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -97,7 +115,7 @@ int64_t trsen(
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     double* T, int64_t ldt,
@@ -105,7 +123,8 @@ int64_t trsen(
     std::complex<double>* W,
     int64_t* m,
     double* s,
-    double* sep )
+    double* sep,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -116,9 +135,18 @@ int64_t trsen(
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -127,10 +155,11 @@ int64_t trsen(
     lapack_int info_ = 0;
 
     // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    double* WR = work_buffer.get< double >( max( 1, n ) );
+    double* WI = work_buffer.get< double >( max( 1, n ) );
 
     // query for workspace size
+    // Not cached: it depends on the number of eigenvalues in select.
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -139,8 +168,8 @@ int64_t trsen(
         select_ptr, &n_,
         T, &ldt_,
         Q, &ldq_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         &m_, s, sep,
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
@@ -151,20 +180,22 @@ int64_t trsen(
     lapack_int lwork_ = real(qry_work[0]);
     lapack_int liwork_ = real(qry_iwork[0]);
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    // get workspace
+    double* work = work_buffer.get< double >( lwork_ );
+    lapack_int* iwork = work_buffer.get< lapack_int >( liwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_dtrsen(
         &sense_, &compq_,
         select_ptr, &n_,
         T, &ldt_,
         Q, &ldq_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         &m_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -178,7 +209,7 @@ int64_t trsen(
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     std::complex<float>* T, int64_t ldt,
@@ -186,7 +217,8 @@ int64_t trsen(
     std::complex<float>* W,
     int64_t* m,
     float* s,
-    float* sep )
+    float* sep,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -197,9 +229,18 @@ int64_t trsen(
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -208,6 +249,7 @@ int64_t trsen(
     lapack_int info_ = 0;
 
     // query for workspace size
+    // Not cached: it depends on the number of eigenvalues in select.
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ctrsen(
@@ -223,8 +265,10 @@ int64_t trsen(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    // get workspace
+    std::complex<float>* work = work_buffer.get< std::complex<float> >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ctrsen(
         &sense_, &compq_,
@@ -232,7 +276,7 @@ int64_t trsen(
         (lapack_complex_float*) T, &ldt_,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) W, &m_, s, sep,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -242,7 +286,7 @@ int64_t trsen(
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     std::complex<double>* T, int64_t ldt,
@@ -250,7 +294,8 @@ int64_t trsen(
     std::complex<double>* W,
     int64_t* m,
     double* s,
-    double* sep )
+    double* sep,
+    internal::WorkBuffer& work_buffer )
 {
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -261,9 +306,18 @@ int64_t trsen(
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    // lapack_logical (32 or 64-bit) copy. The query reads select,
+    // so it is copied even when only counting bytes.
+    std::vector< lapack_logical > select_count;
+    lapack_logical* select_ = work_buffer.get< lapack_logical >( (n) );
+    if (work_buffer.counts_only()) {
+        select_count.assign( &select[0], &select[(n)] );
+        select_ = select_count.data();
+    }
+    else {
+        std::copy( &select[0], &select[(n)], select_ );
+    }
+    lapack_logical const* select_ptr = select_;
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -272,6 +326,7 @@ int64_t trsen(
     lapack_int info_ = 0;
 
     // query for workspace size
+    // Not cached: it depends on the number of eigenvalues in select.
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ztrsen(
@@ -287,8 +342,10 @@ int64_t trsen(
     }
     lapack_int lwork_ = real(qry_work[0]);
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    // get workspace
+    std::complex<double>* work = work_buffer.get< std::complex<double> >( lwork_ );
+    if (work_buffer.counts_only())
+        return 0;
 
     LAPACK_ztrsen(
         &sense_, &compq_,
@@ -296,7 +353,7 @@ int64_t trsen(
         (lapack_complex_double*) T, &ldt_,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) W, &m_, s, sep,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -305,4 +362,222 @@ int64_t trsen(
     return info_;
 }
 
+}  // namespace
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep )
+{
+    size_t host_work_size;
+    trsen_work_size_bytes( sense, compq, select, n, T, ldt, Q, ldq, W, m, s,
+                           sep, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trsen( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep )
+{
+    size_t host_work_size;
+    trsen_work_size_bytes( sense, compq, select, n, T, ldt, Q, ldq, W, m, s,
+                           sep, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trsen( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep )
+{
+    size_t host_work_size;
+    trsen_work_size_bytes( sense, compq, select, n, T, ldt, Q, ldq, W, m, s,
+                           sep, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trsen( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep )
+{
+    size_t host_work_size;
+    trsen_work_size_bytes( sense, compq, select, n, T, ldt, Q, ldq, W, m, s,
+                           sep, &host_work_size );
+    lapack::vector< char > host_work( host_work_size );
+    return trsen( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                  host_work.data(), host_work_size );
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size_bytes(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    size_t* host_work_size )
+{
+    internal::WorkBuffer work_buffer;  // counts bytes only
+    trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                work_buffer );
+    *host_work_size = work_buffer.bytes();
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work_buffer );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    void* host_work, size_t host_work_size )
+{
+    internal::WorkBuffer work_buffer( host_work, host_work_size );
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work_buffer );
+}
+
 }  // namespace lapack
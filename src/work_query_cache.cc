@@ -0,0 +1,358 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace lapack {
+namespace internal {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Immutable cache entry. Once published in a bucket, a node is never
+// modified. clear() unlinks nodes, but frees them only once no reader
+// can still be traversing them; see WorkQueryCache.
+struct Node
+{
+    Node( WorkKey const& key_, WorkSizes const& sizes_, Node* next_ ):
+        key( key_ ),
+        sizes( sizes_ ),
+        next( next_ )
+    {}
+
+    WorkKey   key;
+    WorkSizes sizes;
+    Node*     next;
+};
+
+//------------------------------------------------------------------------------
+// Per-thread state of readers: the epoch announced while traversing
+// buckets, and hit and miss counters. Each is written only by its
+// thread, on its own cache line, so lookups share no written memory.
+// When a thread exits, its record is reused by a later thread.
+struct alignas( 64 ) Reader
+{
+    static constexpr uint64_t idle = UINT64_MAX;
+
+    std::atomic< uint64_t > epoch { idle };
+    std::atomic< int64_t > hits { 0 };
+    std::atomic< int64_t > misses { 0 };
+    std::atomic< bool > in_use { true };
+
+    // Counts at last clear. Require mutex.
+    int64_t hits_base = 0;
+    int64_t misses_base = 0;
+
+    Reader* next = nullptr;
+};
+
+//------------------------------------------------------------------------------
+// Nodes unlinked by one clear, freed once all readers have left
+// epochs <= epoch.
+struct Retired
+{
+    uint64_t epoch;
+    std::vector< Node* > nodes;
+};
+
+//------------------------------------------------------------------------------
+// Hash table of singly-linked lists. Readers load a bucket head with
+// acquire semantics; writers, serialized by mutex, push new nodes onto
+// the head with release semantics.
+//
+// Unlinked nodes are reclaimed by epochs: a reader announces the current
+// epoch while it traverses buckets. clear() unlinks all nodes, retires
+// them tagged with the current epoch, and advances the epoch. Retired
+// nodes are freed once no reader still announces an epoch at or before
+// their tag, so memory stays bounded however often the cache is cleared.
+class WorkQueryCache
+{
+public:
+    static constexpr size_t num_buckets = 1024;  // power of 2
+
+    WorkQueryCache():
+        enabled( true ),
+        epoch( 0 ),
+        readers( nullptr ),
+        entries( 0 ),
+        generation( 0 )
+    {
+        for (auto& bucket : buckets)
+            bucket.store( nullptr, std::memory_order_relaxed );
+
+        const char* env = std::getenv( "LAPACKPP_WORK_QUERY_CACHE" );
+        if (env != nullptr) {
+            std::string val( env );
+            for (auto& c : val)
+                c = tolower( c );
+            if (val == "0" || val == "off" || val == "no" || val == "false")
+                enabled.store( false, std::memory_order_relaxed );
+        }
+    }
+
+    // Reader records are not freed, since threads may still release
+    // them after the cache is destroyed at exit.
+    ~WorkQueryCache()
+    {
+        retire_all();
+        for (auto& batch : retired) {
+            for (Node* node : batch.nodes)
+                delete node;
+        }
+    }
+
+    static size_t hash( WorkKey const& key )
+    {
+        // FNV-1a
+        size_t h = 14695981039346656037ull;
+        for (const char* p = key.routine; *p != '\0'; ++p) {
+            h = (h ^ size_t( *p )) * 1099511628211ull;
+        }
+        for (int i = 0; i < key.nargs; ++i) {
+            h = (h ^ size_t( key.args[ i ] )) * 1099511628211ull;
+        }
+        return h & (num_buckets - 1);
+    }
+
+    static bool equal( WorkKey const& a, WorkKey const& b )
+    {
+        if (a.nargs != b.nargs)
+            return false;
+        for (int i = 0; i < a.nargs; ++i) {
+            if (a.args[ i ] != b.args[ i ])
+                return false;
+        }
+        return a.routine == b.routine || strcmp( a.routine, b.routine ) == 0;
+    }
+
+    static Node* find_node( Node* node, WorkKey const& key )
+    {
+        for (; node != nullptr; node = node->next) {
+            if (equal( node->key, key ))
+                return node;
+        }
+        return nullptr;
+    }
+
+    // Returns an unused reader record, reusing one from an exited thread
+    // if possible.
+    Reader* acquire_reader()
+    {
+        for (Reader* r = readers.load( std::memory_order_acquire );
+             r != nullptr; r = r->next) {
+            bool unused = false;
+            if (r->in_use.compare_exchange_strong( unused, true,
+                                                   std::memory_order_acquire ))
+                return r;
+        }
+        Reader* r = new Reader;
+        r->next = readers.load( std::memory_order_relaxed );
+        while (! readers.compare_exchange_weak( r->next, r,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed ))
+        {}
+        return r;
+    }
+
+    // Unlinks all nodes and retires them with the current epoch, then
+    // advances the epoch. Requires mutex.
+    void retire_all()
+    {
+        Retired batch;
+        batch.epoch = epoch.load( std::memory_order_relaxed );
+        for (auto& bucket : buckets) {
+            Node* node = bucket.exchange( nullptr, std::memory_order_acq_rel );
+            for (; node != nullptr; node = node->next)
+                batch.nodes.push_back( node );
+        }
+        epoch.store( batch.epoch + 1, std::memory_order_release );
+        if (! batch.nodes.empty())
+            retired.push_back( std::move( batch ) );
+        entries.store( 0, std::memory_order_relaxed );
+    }
+
+    // Frees retired nodes that no reader can still hold. Requires mutex.
+    void reclaim()
+    {
+        if (retired.empty())
+            return;
+
+        // Pairs with the fence in work_query_find: either this scan sees
+        // a reader's announced epoch, or that reader sees the unlinked
+        // buckets.
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        uint64_t oldest = Reader::idle;
+        for (Reader* r = readers.load( std::memory_order_acquire );
+             r != nullptr; r = r->next) {
+            // Acquire pairs with the release when a reader goes idle, so its
+            // reads of retired nodes happen before they are freed.
+            oldest = std::min( oldest, r->epoch.load( std::memory_order_acquire ) );
+        }
+
+        auto freed = std::remove_if(
+            retired.begin(), retired.end(),
+            [oldest]( Retired const& batch ) {
+                if (batch.epoch >= oldest)
+                    return false;
+                for (Node* node : batch.nodes)
+                    delete node;
+                return true;
+            });
+        retired.erase( freed, retired.end() );
+    }
+
+    std::atomic< Node* > buckets[ num_buckets ];
+    std::mutex mutex;
+    std::vector< Retired > retired;
+    std::atomic< bool > enabled;
+    std::atomic< uint64_t > epoch;
+    std::atomic< Reader* > readers;
+    std::atomic< int64_t > entries;
+    std::atomic< uint64_t > generation;  ///< number of clears
+};
+
+//------------------------------------------------------------------------------
+WorkQueryCache& cache()
+{
+    static WorkQueryCache s_cache;
+    return s_cache;
+}
+
+//------------------------------------------------------------------------------
+// Holds this thread's reader record; releases it for reuse on thread exit.
+class ReaderHandle
+{
+public:
+    ReaderHandle():
+        reader( cache().acquire_reader() )
+    {}
+
+    ~ReaderHandle()
+    {
+        reader->in_use.store( false, std::memory_order_release );
+    }
+
+    Reader* const reader;
+};
+
+Reader& this_reader()
+{
+    thread_local ReaderHandle handle;
+    return *handle.reader;
+}
+
+}  // anonymous namespace
+
+//------------------------------------------------------------------------------
+/// Looks up workspace sizes for key in the process-wide cache.
+/// Lock free.
+/// @return true if found, in which case sizes is set;
+///         false if not found or the cache is disabled.
+bool work_query_find( WorkKey const& key, WorkSizes* sizes )
+{
+    WorkQueryCache& c = cache();
+    if (! c.enabled.load( std::memory_order_relaxed ))
+        return false;
+
+    // Announce epoch, so nodes seen below are not freed until done.
+    Reader& r = this_reader();
+    r.epoch.store( c.epoch.load( std::memory_order_acquire ),
+                   std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    size_t h = WorkQueryCache::hash( key );
+    Node* head = c.buckets[ h ].load( std::memory_order_acquire );
+    Node* node = WorkQueryCache::find_node( head, key );
+    if (node != nullptr)
+        *sizes = node->sizes;
+    r.epoch.store( Reader::idle, std::memory_order_release );
+
+    // Only this thread writes its counters, so no atomic add is needed.
+    auto& count = (node != nullptr ? r.hits : r.misses);
+    count.store( count.load( std::memory_order_relaxed ) + 1,
+                 std::memory_order_relaxed );
+    return node != nullptr;
+}
+
+//------------------------------------------------------------------------------
+/// Inserts workspace sizes for key into the process-wide cache.
+/// If another thread already inserted key, keeps the existing entry.
+void work_query_insert( WorkKey const& key, WorkSizes const& sizes )
+{
+    WorkQueryCache& c = cache();
+    if (! c.enabled.load( std::memory_order_relaxed ))
+        return;
+
+    size_t h = WorkQueryCache::hash( key );
+    std::lock_guard< std::mutex > lock( c.mutex );
+    Node* head = c.buckets[ h ].load( std::memory_order_relaxed );
+    if (WorkQueryCache::find_node( head, key ) == nullptr) {
+        Node* node = new Node( key, sizes, head );
+        c.buckets[ h ].store( node, std::memory_order_release );
+        c.entries.fetch_add( 1, std::memory_order_relaxed );
+    }
+    c.reclaim();
+}
+
+//------------------------------------------------------------------------------
+uint64_t work_query_generation()
+{
+    return cache().generation.load( std::memory_order_acquire );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void work_query_cache_enable( bool enable )
+{
+    internal::cache().enabled.store( enable, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+bool work_query_cache_enabled()
+{
+    return internal::cache().enabled.load( std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+void work_query_cache_clear()
+{
+    internal::WorkQueryCache& c = internal::cache();
+    std::lock_guard< std::mutex > lock( c.mutex );
+    c.retire_all();
+    c.reclaim();
+    c.generation.fetch_add( 1, std::memory_order_release );
+    for (internal::Reader* r = c.readers.load( std::memory_order_acquire );
+         r != nullptr; r = r->next) {
+        r->hits_base   = r->hits  .load( std::memory_order_relaxed );
+        r->misses_base = r->misses.load( std::memory_order_relaxed );
+    }
+}
+
+//------------------------------------------------------------------------------
+WorkQueryCacheStats work_query_cache_stats()
+{
+    internal::WorkQueryCache& c = internal::cache();
+    WorkQueryCacheStats stats;
+    std::lock_guard< std::mutex > lock( c.mutex );
+    for (internal::Reader* r = c.readers.load( std::memory_order_acquire );
+         r != nullptr; r = r->next) {
+        stats.hits   += r->hits  .load( std::memory_order_relaxed ) - r->hits_base;
+        stats.misses += r->misses.load( std::memory_order_relaxed ) - r->misses_base;
+    }
+    stats.entries = c.entries.load( std::memory_order_relaxed );
+    return stats;
+}
+
+}  // namespace lapack
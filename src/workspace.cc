@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Creates an empty workspace. Nothing is allocated until first use.
+Workspace::Workspace():
+    data_( nullptr ),
+    capacity_( 0 ),
+    num_allocations_( 0 ),
+    num_queries_( 0 ),
+    generation_( internal::work_query_generation() )
+{}
+
+//------------------------------------------------------------------------------
+/// Creates a workspace with bytes preallocated.
+Workspace::Workspace( size_t bytes ):
+    Workspace()
+{
+    reserve( bytes );
+}
+
+//------------------------------------------------------------------------------
+Workspace::~Workspace()
+{
+    clear();
+}
+
+//------------------------------------------------------------------------------
+void* Workspace::reserve( size_t bytes )
+{
+    if (bytes > capacity_) {
+        NoConstructAllocator<char> alloc;
+        // Allocate new buffer before freeing old one, so on bad_alloc
+        // the workspace is still valid.
+        char* new_data = alloc.allocate( bytes );
+        if (data_ != nullptr)
+            alloc.deallocate( (char*) data_, capacity_ );
+        data_ = new_data;
+        capacity_ = bytes;
+        ++num_allocations_;
+    }
+    return data_;
+}
+
+//------------------------------------------------------------------------------
+void Workspace::clear()
+{
+    if (data_ != nullptr) {
+        NoConstructAllocator<char> alloc;
+        alloc.deallocate( (char*) data_, capacity_ );
+    }
+    data_ = nullptr;
+    capacity_ = 0;
+    sizes_.clear();
+}
+
+//------------------------------------------------------------------------------
+bool Workspace::find(
+    internal::WorkKey const& key, internal::WorkSizes* sizes ) const
+{
+    if (generation_ != internal::work_query_generation())
+        return false;
+    auto iter = sizes_.find( key );
+    if (iter == sizes_.end())
+        return false;
+    *sizes = iter->second;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void Workspace::insert(
+    internal::WorkKey const& key, internal::WorkSizes const& sizes )
+{
+    uint64_t generation = internal::work_query_generation();
+    if (generation_ != generation) {
+        sizes_.clear();
+        generation_ = generation;
+    }
+    sizes_[ key ] = sizes;
+    ++num_queries_;
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+bool WorkBuffer::find( WorkKey const& key, WorkSizes* sizes ) const
+{
+    if (ws_ != nullptr && ws_->find( key, sizes ))
+        return true;
+    return work_query_find( key, sizes );
+}
+
+//------------------------------------------------------------------------------
+void WorkBuffer::insert( WorkKey const& key, WorkSizes const& sizes )
+{
+    if (ws_ != nullptr)
+        ws_->insert( key, sizes );
+    work_query_insert( key, sizes );
+}
+
+}  // namespace internal
+
+}  // namespace lapack
@@ -19,6 +19,11 @@
 #
 # run getrf, potrf with small, medium sizes
 #     ./run_tests.py -s -m getrf potrf
+#
+# compare runtime LAPACK backends (see include/lapack/backend.hh),
+# reporting the fastest backend for each routine and size
+#     export LAPACKPP_BACKEND_LIBRARIES="mkl=libmkl_rt.so;openblas=libopenblas.so.0"
+#     ./run_tests.py --backend linked,mkl,openblas --type d getrf gesdd
 
 from __future__ import print_function
 
@@ -43,6 +48,7 @@ group_test.add_argument( '--xml', help='generate report.xml for jenkins' )
 group_test.add_argument( '--dry-run', action='store_true', help='print commands, but do not execute them' )
 group_test.add_argument( '--start',   action='store', help='routine to start with, helpful for restarting', default='' )
 group_test.add_argument( '-x', '--exclude', action='append', help='routines to exclude; repeatable', default=[] )
+group_test.add_argument( '--backend', action='store', help='runtime LAPACK backends to compare, e.g., linked,mkl,openblas; runs each test with each backend and reports the fastest', default='' )
 
 group_size = parser.add_argument_group( 'matrix dimensions (default is medium)' )
 group_size.add_argument( '--quick',  action='store_true', help='run quick "sanity check" of few, small tests' )
@@ -138,6 +144,10 @@ group_opt.add_argument( '--vu',     action='store', help='default=%(default)s',
 group_opt.add_argument( '--il',     action='store', help='default=%(default)s', default='10' )
 group_opt.add_argument( '--iu',     action='store', help='default=%(default)s', default='-1,100' )
 group_opt.add_argument( '--nb',     action='store', help='default=%(default)s', default='64' )
+group_opt.add_argument( '--batch',  action='store', help='default=%(default)s', default='100' )
+group_opt.add_argument( '--method', action='store', help='default=%(default)s', default='l,t,q' )
+group_opt.add_argument( '--simd',   action='store', help='SIMD instruction sets for native methods; unsupported ones are skipped; default=%(default)s', default='g,a,z' )
+group_opt.add_argument( '--threads', action='store', help='e.g., 1,2,4,8 for scaling; default is OpenMP default', default='' )
 group_opt.add_argument( '--matrixtype', action='store', help='default=%(default)s', default='g,l,u' )
 
 parser.add_argument( 'tests', nargs=argparse.REMAINDER )
@@ -309,6 +319,10 @@ sense  = ' --sense '  + opts.sense  if (opts.sense)  else ''
 vect   = ' --vect '   + opts.vect   if (opts.vect)   else ''
 l      = ' --l '      + opts.l      if (opts.l)      else ''
 nb     = ' --nb '     + opts.nb     if (opts.nb)     else ''
+batch  = ' --batch '  + opts.batch  if (opts.batch)  else ''
+method = ' --method ' + opts.method if (opts.method) else ''
+threads = ' --threads ' + opts.threads if (opts.threads) else ''
+simd   = ' --simd '   + opts.simd   if (opts.simd)   else ''
 ka     = ' --ka '     + opts.ka     if (opts.ka)     else ''
 kb     = ' --kb '     + opts.kb     if (opts.kb)     else ''
 kd     = ' --kd '     + opts.kd     if (opts.kd)     else ''
@@ -320,6 +334,9 @@ il     = ' --il '     + opts.il     if (opts.il)     else ''
 iu     = ' --iu '     + opts.iu     if (opts.iu)     else ''
 mtype  = ' --matrixtype ' + opts.matrixtype if (opts.matrixtype) else ''
 
+# fixed-size kernels require n, nrhs <= 8
+fixed  = ' --dim 1:8 --nrhs 1,4,8'
+
 # general options for all routines
 gen = check + ref + verbose
 
@@ -361,6 +378,14 @@ if (opts.lu and opts.host):
     [ 'gecon', gen + dtype + align + n ],
     [ 'gerfs', gen + dtype + align + n + trans ],
     [ 'geequ', gen + dtype + align + n ],
+    [ 'factor_lu', gen + dtype + align + n + trans ],
+    [ 'gesv_mixed',     gen + dtype_double + align + n ],
+    [ 'solve_mixed_lu', gen + dtype_double + align + n ],
+    [ 'gesv_layout',    gen + dtype + layout + align + n + trans ],
+    [ 'gesv_batch',  gen + dtype + align + n + batch ],
+    [ 'getrf_batch', gen + dtype + align + n + batch ],
+    [ 'getrs_batch', gen + dtype + align + n + batch + trans ],
+    [ 'gesv_fixed',  gen + dtype + align + fixed + batch + trans ],
     ]
 
 if (opts.lu and opts.device):
@@ -400,6 +425,18 @@ if (opts.chol and opts.host):
     [ 'pocon', gen + dtype + align + n + uplo ],
     [ 'porfs', gen + dtype + align + n + uplo ],
     [ 'poequ', gen + dtype + align + n ],  # only diagonal elements (no uplo)
+    [ 'factor_chol', gen + dtype + align + n + uplo ],
+    [ 'posv_batch',  gen + dtype + align + n + batch + uplo ],
+    [ 'potrf_batch', gen + dtype + align + n + batch + uplo ],
+    [ 'potrs_batch', gen + dtype + align + n + batch + uplo ],
+    [ 'posv_fixed',  gen + dtype + align + fixed + batch + uplo ],
+    [ 'potrf_update',   gen + dtype + align + mnk + uplo ],
+    [ 'potrf_downdate', gen + dtype + align + mnk + uplo ],
+    [ 'posv_mixed',       gen + dtype_double + align + n + uplo ],
+    [ 'solve_mixed_chol', gen + dtype_double + align + n + uplo ],
+    [ 'solve_mixed_fp16', gen + ' --type d' + align + n + uplo ],
+    [ 'solve_mixed_bf16', gen + ' --type d' + align + n + uplo ],
+    [ 'posv_layout',      gen + dtype + layout + align + n + uplo ],
 
     # Packed
     [ 'ppsv',  gen + dtype + align + n + uplo ],
@@ -490,6 +527,8 @@ if (opts.hesv and opts.host):
     [ 'hetri', gen + dtype + align + n + uplo ],
     [ 'hecon', gen + dtype + align + n + uplo ],
     [ 'herfs', gen + dtype + align + n + uplo ],
+    [ 'factor_ldlt', gen + dtype + align + n + uplo ],
+    [ 'solve_mixed_ldlt', gen + dtype_double + align + n + uplo ],
 
     # Packed
     [ 'hpsv',  gen + dtype + align + n + uplo ],
@@ -504,11 +543,13 @@ if (opts.hesv and opts.host):
 if (opts.least_squares and opts.host):
     cmds += [
     [ 'gels',   gen + dtype + align + mn + trans_nc ],
+    [ 'gels_batch', gen + dtype + align + mn + batch + trans_nc ],
     [ 'gelsy',  gen + dtype + align + mn ],
     # todo: gelsd is failing
     #[ 'gelsd',  gen + dtype + align + mn ],
     [ 'gelss',  gen + dtype + align + mn ],
     [ 'getsls', gen + dtype + align + mn + trans_nc ],
+    [ 'factor_qr', gen + dtype + align + mn ],  # m >= n
 
     # Generalized
     [ 'gglse', gen + dtype + align + mnk ],
@@ -519,14 +560,24 @@ if (opts.least_squares and opts.host):
 # QR
 if (opts.qr and opts.host):
     cmds += [
-    [ 'geqr',  gen + dtype + align + n + wide + tall ],
+    [ 'geqr',  gen + dtype + align + n + wide + tall + method + threads ],
     [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf_batch', gen + dtype + align + n + wide + tall + batch ],
+    [ 'geqrf_layout', gen + dtype + layout + align + n + wide + tall ],
+    [ 'gelqf_layout', gen + dtype + layout + align + n + wide + tall ],
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
     #[ 'unmqr', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
     #[ 'unmqr', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
 
+    # Updating
+    [ 'qr_update',     gen + dtype + align + mnk ],
+    [ 'qr_insert_row', gen + dtype + align + mnk ],
+    [ 'qr_delete_row', gen + dtype + align + mnk ],
+    [ 'qr_insert_col', gen + dtype + align + mnk ],
+    [ 'qr_delete_col', gen + dtype + align + mnk ],
+
     [ 'orhr_col', gen + dtype_real + align + n + tall ],
     [ 'unhr_col', gen + dtype      + align + n + tall ],
 
@@ -588,6 +639,7 @@ if (opts.rq and opts.host):
 if (opts.syev and opts.host):
     cmds += [
     [ 'heev',  gen + dtype + align + n + jobz + uplo ],
+    [ 'heev_layout', gen + dtype + layout + align + n + jobz + uplo ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'heevd', gen + dtype + align + n + jobz + uplo ],
@@ -681,6 +733,7 @@ if (opts.svd and opts.host):
     [ 'gesvd',         gen + dtype + align + mn + " --jobu n,a" + jobvt ],
     [ 'gesvd',         gen + dtype + align + mn + " --jobu o,s --jobvt n" ],
     [ 'gesdd',         gen + dtype + align + mn + jobu ],
+    [ 'gesvd_layout',  gen + dtype + layout + align + mn + " --jobu n,s,a,o --jobvt n,s,a" ],
     # todo: gesvdx is failing
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + vl + vu ],
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + il + iu ],
@@ -694,10 +747,16 @@ if (opts.svd and opts.host):
 # auxilary
 if (opts.aux and opts.host):
     cmds += [
-    [ 'lacpy', gen + dtype + align + mn + mtype ],
+    [ 'lacpy', gen + dtype + align + mn + mtype + ' --method l,n' + simd ],
     [ 'laed4', gen + dtype_real + n ],
-    [ 'laset', gen + dtype + align + mn + mtype ],
+    [ 'lag2h', gen + dtype_real + align + mn ],
+    [ 'lag2b', gen + dtype_real + align + mn ],
+    [ 'lascl', gen + dtype + align + mn + mtype + ' --method l,n' + simd ],
+    [ 'laset', gen + dtype + align + mn + mtype + ' --method l,n' + simd ],
     [ 'laswp', gen + dtype + align + mn ],
+    [ 'transpose', gen + dtype + align + mn + ' --trans t,c' + simd ],
+    [ 'ilaenv', gen + dtype + align + mn + ' --nb 8,32' ],
+    [ 'thread_scope', ' --threads 0,1,3' ],
     ]
 
 # auxilary - householder
@@ -715,11 +774,10 @@ if (opts.aux_house and opts.host):
 # auxilary - norms
 if (opts.aux_norm and opts.host):
     cmds += [
-    [ 'lange', gen + dtype + align + mn + norm ],
-    # todo: lanhe is failing
-    #[ 'lanhe', gen + dtype + align + n  + norm + uplo ],
-    [ 'lansy', gen + dtype + align + n  + norm + uplo ],
-    [ 'lantr', gen + dtype + align + mn + norm + uplo + diag ],
+    [ 'lange', gen + dtype + align + mn + norm + ' --method l,n' + simd ],
+    [ 'lanhe', gen + dtype + align + n  + norm + uplo + ' --method l,n' + simd ],
+    [ 'lansy', gen + dtype + align + n  + norm + uplo + ' --method l,n' + simd ],
+    [ 'lantr', gen + dtype + align + mn + norm + uplo + diag + ' --method l,n' + simd ],
     [ 'lanhs', gen + dtype + align + n  + norm ],
 
     # Packed
@@ -765,15 +823,20 @@ def print_tee( *args ):
 # ------------------------------------------------------------------------------
 # cmd is a pair of strings: (function, args)
 
-def run_test( cmd ):
+def run_test( cmd, backend=None ):
     cmd = opts.test +' '+ cmd[1] +' '+ cmd[0]
-    print_tee( cmd )
+    env = None
+    if (backend):
+        env = dict( os.environ, LAPACKPP_BACKEND_ROUTINES='default=' + backend )
+        print_tee( 'backend', backend + ':', cmd )
+    else:
+        print_tee( cmd )
     if (opts.dry_run):
         return (None, None)
 
     output = ''
     p = subprocess.Popen( cmd.split(), stdout=subprocess.PIPE,
-                                       stderr=subprocess.STDOUT )
+                                       stderr=subprocess.STDOUT, env=env )
     p_out = p.stdout
     if (sys.version_info.major >= 3):
         p_out = io.TextIOWrapper(p.stdout, encoding='utf-8')
@@ -789,6 +852,34 @@ def run_test( cmd ):
     return (err, output)
 # end
 
+# ------------------------------------------------------------------------------
+# Parses tester output. Returns list of (params, time) for each row,
+# where params are the values of the input columns, which precede the
+# error and time columns.
+
+def parse_times( output ):
+    rows = []
+    columns = None
+    for line in output.splitlines():
+        if (re.search( r'\btime \(s\)', line )):
+            # column names are separated by at least 2 spaces
+            columns = re.split( r'\s{2,}', line.strip() )
+            ninput = 0
+            while (ninput < len( columns )
+                   and not re.search( r'^(error|orth|time)', columns[ ninput ] )):
+                ninput += 1
+            itime = columns.index( 'time (s)' )
+            continue
+        values = line.split()
+        if (columns is None or len( values ) < len( columns ) - 1):
+            continue
+        try:
+            rows.append( (' '.join( values[ 0:ninput ] ), float( values[ itime ] )) )
+        except ValueError:
+            pass  # not a row, or time is NA
+    return rows
+# end
+
 # ------------------------------------------------------------------------------
 # Utility to pretty print XML.
 # See https://stackoverflow.com/a/33956544/1655607
@@ -821,6 +912,8 @@ ntests = len(opts.tests)
 run_all = (ntests == 0)
 
 seen = set()
+backend_times = {}
+backend_keys = []
 for cmd in cmds:
     if ((run_all or cmd[0] in opts.tests) and cmd[0] not in opts.exclude):
         if (start_routine and cmd[0] != start_routine):
@@ -829,16 +922,46 @@ for cmd in cmds:
         start_routine = None
 
         seen.add( cmd[0] )
-        (err, output) = run_test( cmd )
-        if (err):
-            failed_tests.append( (cmd[0], err, output) )
+        if (opts.backend):
+            # time of each backend for each routine and params
+            for backend in opts.backend.split( ',' ):
+                (err, output) = run_test( cmd, backend )
+                if (err):
+                    failed_tests.append( (cmd[0] + ' ' + backend, err, output) )
+                else:
+                    passed_tests.append( cmd[0] + ' ' + backend )
+                for (params, t) in parse_times( output or '' ):
+                    key = (cmd[0], params)
+                    if (key not in backend_times):
+                        backend_times[ key ] = []
+                        backend_keys.append( key )
+                    backend_times[ key ].append( (t, backend) )
         else:
-            passed_tests.append( cmd[0] )
+            (err, output) = run_test( cmd )
+            if (err):
+                failed_tests.append( (cmd[0], err, output) )
+            else:
+                passed_tests.append( cmd[0] )
 
 not_seen = list( filter( lambda x: x not in seen, opts.tests ) )
 if (not_seen):
     print_tee( 'Warning: unknown routines:', ' '.join( not_seen ))
 
+# print fastest backend for each routine and params
+if (backend_keys):
+    backends = opts.backend.split( ',' )
+    print_tee( '\nFastest backend for each routine and size:' )
+    print_tee( '%-10s  %-40s  %-10s  %s' % ('routine', 'params', 'fastest',
+               '  '.join( map( lambda b: '%10s' % (b + ' (s)'), backends ))) )
+    for key in backend_keys:
+        times = dict( map( lambda x: (x[1], x[0]), backend_times[ key ] ) )
+        fastest = min( backend_times[ key ] )[1]
+        print_tee( '%-10s  %-40s  %-10s  %s' % (key[0], key[1], fastest,
+                   '  '.join( map( lambda b: '%10.4g' % times[ b ]
+                                   if b in times else '%10s' % 'NA',
+                                   backends ))) )
+# end
+
 # print summary of failures
 nfailed = len( failed_tests )
 if (nfailed > 0):
@@ -4,12 +4,15 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include <complex>
+#include <fstream>
+#include <map>
 
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 
 #include "test.hh"
+#include "lapack/ilaenv.hh"
 
 // -----------------------------------------------------------------------------
 using testsweeper::ParamType;
@@ -101,6 +104,16 @@ std::vector< testsweeper::routines_t > routines = {
     { "getri",              test_getri,     Section::gesv },    // lawn 41 test
     { "",                   nullptr,        Section::newline },
 
+    { "gesv_batch",         test_gesv_batch,  Section::gesv },
+    { "getrf_batch",        test_getrf_batch, Section::gesv },
+    { "getrs_batch",        test_getrs_batch, Section::gesv },
+    { "gesv_fixed",         test_gesv_fixed,  Section::gesv },
+    { "factor_lu",          test_factor_lu,   Section::gesv },
+    { "gesv_mixed",         test_gesv_mixed,     Section::gesv },
+    { "solve_mixed_lu",     test_solve_mixed_lu, Section::gesv },
+    { "gesv_layout",        test_gesv_layout,    Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
     { "gecon",              test_gecon,     Section::gesv },
     { "gbcon",              test_gbcon,     Section::gesv },
     { "gtcon",              test_gtcon,     Section::gesv },
@@ -139,6 +152,20 @@ std::vector< testsweeper::routines_t > routines = {
     { "pptri",              test_pptri,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "posv_batch",         test_posv_batch,  Section::posv },
+    { "potrf_batch",        test_potrf_batch, Section::posv },
+    { "potrs_batch",        test_potrs_batch, Section::posv },
+    { "posv_fixed",         test_posv_fixed,  Section::posv },
+    { "factor_chol",        test_factor_chol, Section::posv },
+    { "potrf_update",       test_potrf_update,   Section::posv },
+    { "potrf_downdate",     test_potrf_downdate, Section::posv },
+    { "posv_mixed",         test_posv_mixed,       Section::posv },
+    { "solve_mixed_chol",   test_solve_mixed_chol, Section::posv },
+    { "solve_mixed_fp16",   test_solve_mixed_fp16, Section::posv },
+    { "solve_mixed_bf16",   test_solve_mixed_bf16, Section::posv },
+    { "posv_layout",        test_posv_layout,      Section::posv },
+    { "",                   nullptr,        Section::newline },
+
     { "pocon",              test_pocon,     Section::posv },
     { "ppcon",              test_ppcon,     Section::posv },
     { "pbcon",              test_pbcon,     Section::posv },
@@ -231,6 +258,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "hprfs",              test_hprfs,     Section::hesv }, // tested via LAPACKE, error < 3*eps
     { "",                   nullptr,        Section::newline },
 
+    { "factor_ldlt",        test_factor_ldlt, Section::hesv },
+    { "solve_mixed_ldlt",   test_solve_mixed_ldlt, Section::hesv },
+    { "",                   nullptr,        Section::newline },
+
     // -----
     // least squares
     { "gels",               test_gels,      Section::gels }, // tested via LAPACKE using gcc/MKL
@@ -240,6 +271,10 @@ std::vector< testsweeper::routines_t > routines = {
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
 
+    { "gels_batch",         test_gels_batch,  Section::gels },
+    { "factor_qr",          test_factor_qr,   Section::gels },
+    { "",                   nullptr,        Section::newline },
+
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "ggglm",              test_ggglm,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
@@ -254,6 +289,18 @@ std::vector< testsweeper::routines_t > routines = {
     { "gemqrt",             test_gemqrt,    Section::qr }, // tested via LAPACKE
     { "",                   nullptr,        Section::newline },
 
+    { "geqrf_batch",        test_geqrf_batch, Section::qr },
+    { "geqrf_layout",       test_geqrf_layout, Section::qr },
+    { "gelqf_layout",       test_gelqf_layout, Section::qr },
+    { "",                   nullptr,        Section::newline },
+
+    { "qr_update",          test_qr_update,     Section::qr },
+    { "qr_insert_row",      test_qr_insert_row, Section::qr },
+    { "qr_delete_row",      test_qr_delete_row, Section::qr },
+    { "qr_insert_col",      test_qr_insert_col, Section::qr },
+    { "qr_delete_col",      test_qr_delete_col, Section::qr },
+    { "",                   nullptr,        Section::newline },
+
     { "ggqrf",              test_ggqrf,     Section::qr }, // tested via LAPACKE using gcc/MKL, TODO for now use p=param.k
     //{ "gglqf",              test_gglqf,     Section::qr }, // TODO No automagic generation.  No src
     { "",                   nullptr,        Section::qr }, // space for gglqf
@@ -296,6 +343,7 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // symmetric/Hermitian eigenvalues
     { "heev",               test_heev,      Section::heev }, // tested via LAPACKE
+    { "heev_layout",        test_heev_layout, Section::heev },
     { "hpev",               test_hpev,      Section::heev }, // tested via LAPACKE
     { "hbev",               test_hbev,      Section::heev }, // tested via LAPACKE
     { "sturm",              test_sturm,     Section::heev },
@@ -383,6 +431,7 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // driver: singular value decomposition
     { "gesvd",              test_gesvd,         Section::svd },
+    { "gesvd_layout",       test_gesvd_layout,  Section::svd },
     //{ "gesvd_2stage",       test_gesvd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
@@ -402,8 +451,14 @@ std::vector< testsweeper::routines_t > routines = {
     // auxiliary
     { "lacpy",              test_lacpy,     Section::aux },
     { "laed4",              test_laed4,     Section::aux },
+    { "lag2h",              test_lag2h,     Section::aux },
+    { "lag2b",              test_lag2b,     Section::aux },
+    { "lascl",              test_lascl,     Section::aux },
     { "laset",              test_laset,     Section::aux },
     { "laswp",              test_laswp,     Section::aux },
+    { "transpose",          test_transpose, Section::aux },
+    { "ilaenv",             test_ilaenv,    Section::aux },
+    { "thread_scope",       test_thread_scope, Section::aux },
     { "",                   nullptr,        Section::newline },
 
     // auxiliary: Householder
@@ -482,6 +537,7 @@ Params::Params():
     check     ( "check",   0,    ParamType::Value, 'y', "ny",  "check the results" ),
     error_exit( "error-exit", 0, ParamType::Value, 'n', "ny",  "check error exits" ),
     ref       ( "ref",     0,    ParamType::Value, 'n', "ny",  "run reference; sometimes check implies ref" ),
+    tune      ( "tune",    0,    ParamType::Value, 'n', "ny",  "tune ILAENV block sizes for geqrf, getrf, hetrd over nb, nx; saves fastest to $LAPACKPP_ILAENV_TABLE or lapackpp_ilaenv.txt" ),
 
     //          name,      w, p, type,             def, min,  max, help
     tol       ( "tol",     0, 0, ParamType::Value,  50,   1, 1000, "tolerance (e.g., error < tol*epsilon to pass)" ),
@@ -518,6 +574,8 @@ Params::Params():
                 "matrix type: g=general, l=lower, u=upper, h=Hessenberg, z=band-general, b=band-lower, q=band-upper" ),
     factored  ( "factored",    11,    ParamType::List, lapack::Factored::NotFactored, lapack::char2factored, lapack::factored2char, lapack::factored2str, "f=Factored, n=NotFactored, e=Equilibrate" ),
     equed     ( "equed",   9,    ParamType::List, lapack::Equed::None, lapack::char2equed, lapack::equed2char, lapack::equed2str, "n=None, r=Row, c=Col, b=Both, y=Yes" ),
+    method    ( "method",  6,    ParamType::List, lapack::Method::Lapack, lapack::char2method, lapack::method2char, lapack::method2str, "algorithm: l=lapack, t=tiled, q=tsqr, c=calu, n=native" ),
+    simd      ( "simd",    7,    ParamType::List, lapack::simd_get(), lapack::char2simd, lapack::simd2char, lapack::simd2str, "SIMD instruction set for native methods: g=generic, a=avx2, z=avx512; default is best supported or $LAPACKPP_SIMD" ),
 
     //          name,      w, p, type,            def,   min,     max, help
     dim       ( "dim",     6,    ParamType::List,          0, 1000000, "m by n by k dimensions" ),
@@ -530,6 +588,7 @@ Params::Params():
     ku        ( "ku",      6,    ParamType::List, 100,     0, 1000000, "upper bandwidth" ),
     nrhs      ( "nrhs",    6,    ParamType::List,  10,     0, 1000000, "number of right hand sides" ),
     nb        ( "nb",      4,    ParamType::List,  64,     0, 1000000, "block size" ),
+    nx        ( "nx",      4,    ParamType::List,   0,     0, 1000000, "crossover size from blocked to unblocked code, for --tune; 0 is LAPACK default" ),
     vl        ( "vl",      7, 2, ParamType::List, -inf, -inf,     inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",      7, 2, ParamType::List,  inf, -inf,     inf, "upper bound of eigen/singular values to find" ),
 
@@ -547,7 +606,9 @@ Params::Params():
     incx      ( "incx",    4,    ParamType::List,   1, -1000,    1000, "stride of x vector" ),
     incy      ( "incy",    4,    ParamType::List,   1, -1000,    1000, "stride of y vector" ),
     align     ( "align",   0,    ParamType::List,   1,     1,    1024, "column alignment (sets lda, ldb, etc. to multiple of align)" ),
+    batch     ( "batch",   6,    ParamType::List, 100,     0, 1000000, "batch size" ),
     device    ( "device",  6,    ParamType::List,   0,     0,     100, "device id" ),
+    threads   ( "threads", 7,    ParamType::List,   0,     0,    1024, "number of OpenMP threads, e.g., for scaling of tiled methods; 0 is default" ),
 
     // ----- output parameters
     // min, max are ignored
@@ -605,6 +666,7 @@ Params::Params():
     check();
     error_exit();
     ref();
+    tune();
     repeat();
     verbose();
     cache();
@@ -705,6 +767,82 @@ void print_matrix_header(
     }
 }
 
+// -----------------------------------------------------------------------------
+// ILAENV tuning (--tune y): runs each test with ILAENV's nb and nx set from
+// the --nb and --nx params, then adds the fastest for each routine and size
+// to the table in $LAPACKPP_ILAENV_TABLE, or lapackpp_ilaenv.txt.
+
+struct TuneResult
+{
+    double time;
+    int64_t nb, nx;
+};
+
+typedef std::map< std::pair< std::string, int64_t >, TuneResult > TuneResults;
+
+// @return true if the command line has --tune y or --tune=y.
+bool tune_requested( int argc, char** argv );
+
+bool tune_requested( int argc, char** argv )
+{
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp( argv[ i ], "--tune=y" ) == 0
+            || (strcmp( argv[ i ], "--tune" ) == 0 && i+1 < argc
+                && strcmp( argv[ i+1 ], "y" ) == 0))
+            return true;
+    }
+    return false;
+}
+
+// @return LAPACK name of routine in the given precision, e.g., "dgeqrf",
+// or "" if the tester can't tune routine's block sizes.
+std::string ilaenv_name( const char* routine, DataType datatype );
+
+std::string ilaenv_name( const char* routine, DataType datatype )
+{
+    std::string name( routine );
+    if (name != "geqrf" && name != "getrf" && name != "hetrd")
+        return "";
+
+    char prefix = datatype2char( datatype );
+    if ((prefix == 's' || prefix == 'd') && name.compare( 0, 2, "he" ) == 0)
+        name.replace( 0, 2, "sy" );
+    return prefix + name;
+}
+
+// Adds tuned nb and nx to the ILAENV table file and prints them.
+void save_tuning( TuneResults const& tuned );
+
+void save_tuning( TuneResults const& tuned )
+{
+    const char* filename = getenv( "LAPACKPP_ILAENV_TABLE" );
+    if (filename == nullptr || filename[ 0 ] == '\0')
+        filename = "lapackpp_ilaenv.txt";
+
+    // Keep existing entries for other routines and sizes.
+    lapack::ilaenv_clear();
+    if (std::ifstream( filename ).good())
+        lapack::ilaenv_load( filename );
+
+    printf( "\nILAENV tuning, saved to %s:\n", filename );
+    printf( "%-14s %9s %6s %6s %12s\n", "routine", "size", "nb", "nx", "time (s)" );
+    for (auto const& result : tuned) {
+        std::string const& name = result.first.first;
+        int64_t size = result.first.second;
+        TuneResult const& best = result.second;
+        lapack::ilaenv_set( name, 1, size, best.nb );
+        lapack::ilaenv_set( name, 3, size, best.nx );  // nx = 0 removes
+        printf( "%-14s %9lld %6lld %6lld %12.4g\n", name.c_str(),
+                llong( size ), llong( best.nb ), llong( best.nx ), best.time );
+        if (lapack::ilaenv_hits( name ) == 0) {
+            printf( "%s%sWarning: the LAPACK library did not query ILAENV"
+                    " for %s, so nb and nx had no effect.%s\n",
+                    ansi_bold, ansi_red, name.c_str(), ansi_normal );
+        }
+    }
+    lapack::ilaenv_save( filename );
+}
+
 // -----------------------------------------------------------------------------
 int main( int argc, char** argv )
 {
@@ -759,6 +897,10 @@ int main( int argc, char** argv )
         // mark fields that are used (run=false)
         Params params;
         test_routine( params, false );
+        if (tune_requested( argc, argv )) {
+            params.nb();
+            params.nx();
+        }
 
         // Parse parameters up to routine name.
         try {
@@ -779,6 +921,20 @@ int main( int argc, char** argv )
         testsweeper::DataType last = params.datatype();
         std::string matrix, matrixB;
         double cond = 0, condD = 0, condB = 0, condD_B = 0;
+        bool tune = params.tune() == 'y';
+        TuneResults tuned;
+        if (tune) {
+            if (ilaenv_name( routine, params.datatype() ).empty()) {
+                throw std::runtime_error(
+                    std::string( "--tune not supported for " ) + routine );
+            }
+            if (! lapack::ilaenv_override()) {
+                printf( "%s%sWarning: LAPACK++ was configured without"
+                        " ilaenv_override, so nb and nx have no effect.%s\n",
+                        ansi_bold, ansi_red, ansi_normal );
+            }
+            lapack::ilaenv_clear();
+        }
         params.header();
         do {
             if (params.datatype() != last) {
@@ -786,6 +942,13 @@ int main( int argc, char** argv )
                 printf( "\n" );
             }
             for (int iter = 0; iter < repeat; ++iter) {
+                std::string name;
+                if (tune) {
+                    // size 0 applies to all sizes
+                    name = ilaenv_name( routine, params.datatype() );
+                    lapack::ilaenv_set( name, 1, 0, params.nb() );
+                    lapack::ilaenv_set( name, 3, 0, params.nx() );
+                }
                 try {
                     test_routine( params, true );
                 }
@@ -794,6 +957,16 @@ int main( int argc, char** argv )
                              ansi_bold, ansi_red, ex.what(), ansi_normal );
                     params.okay() = false;
                 }
+                if (tune && params.okay() != false && params.time() > 0) {
+                    auto key = std::make_pair(
+                        name, std::max( params.dim.m(), params.dim.n() ) );
+                    auto iter_best = tuned.find( key );
+                    if (iter_best == tuned.end()
+                        || params.time() < iter_best->second.time) {
+                        tuned[ key ] = TuneResult { params.time(), params.nb(),
+                                                    params.nx() };
+                    }
+                }
                 if (iter == 0) {
                     print_matrix_header( params.matrix,  "test matrix A", &matrix,  &cond,  &condD   );
                     print_matrix_header( params.matrixB, "test matrix B", &matrixB, &condB, &condD_B );
@@ -808,6 +981,10 @@ int main( int argc, char** argv )
             }
         } while(params.next());
 
+        if (tune) {
+            save_tuning( tuned );
+        }
+
         if (status) {
             printf( "%d tests FAILED for %s.\n", status, routine );
         }
@@ -8,9 +8,12 @@
 
 #include "testsweeper.hh"
 #include "lapack/util.hh"
+#include "lapack/simd.hh"
 #include "matrix_params.hh"
 #include "matrix_generator.hh"
 
+#include <type_traits>
+
 // -----------------------------------------------------------------------------
 using llong = long long;
 
@@ -46,6 +49,7 @@ public:
     testsweeper::ParamChar   check;
     testsweeper::ParamChar   error_exit;
     testsweeper::ParamChar   ref;
+    testsweeper::ParamChar   tune;
     testsweeper::ParamDouble tol;
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
@@ -74,6 +78,8 @@ public:
     testsweeper::ParamEnum< lapack::MatrixType > matrixtype;
     testsweeper::ParamEnum< lapack::Factored >  factored;
     testsweeper::ParamEnum< lapack::Equed >     equed;
+    testsweeper::ParamEnum< lapack::Method >    method;
+    testsweeper::ParamEnum< lapack::Simd >      simd;
 
     testsweeper::ParamInt3   dim;
     testsweeper::ParamInt    i;
@@ -85,6 +91,7 @@ public:
     testsweeper::ParamInt    ku;
     testsweeper::ParamInt    nrhs;
     testsweeper::ParamInt    nb;
+    testsweeper::ParamInt    nx;
     testsweeper::ParamDouble vl;
     testsweeper::ParamDouble vu;
     testsweeper::ParamInt    il;
@@ -98,7 +105,9 @@ public:
     testsweeper::ParamInt    incx;
     testsweeper::ParamInt    incy;
     testsweeper::ParamInt    align;
+    testsweeper::ParamInt    batch;
     testsweeper::ParamInt    device;
+    testsweeper::ParamInt    threads;
 
     // ----- output parameters
     testsweeper::ParamScientific error;
@@ -143,6 +152,68 @@ inline T roundup( T x, T y )
     return T( (x + y - 1) / y ) * y;
 }
 
+// -----------------------------------------------------------------------------
+// Copies a batch of ld-by-n arrays between strided layout, problem k at
+// A[ k*ld*n ], and interleaved layout, element i of problem k at
+// Ai[ k + i*batch ].
+template< typename T >
+void to_interleaved( int64_t ld, int64_t n, int64_t batch,
+                     T const* A, T* Ai )
+{
+    for (int64_t k = 0; k < batch; ++k)
+        for (int64_t i = 0; i < ld*n; ++i)
+            Ai[ k + i*batch ] = A[ k*ld*n + i ];
+}
+
+template< typename T >
+void from_interleaved( int64_t ld, int64_t n, int64_t batch,
+                       T const* Ai, T* A )
+{
+    for (int64_t k = 0; k < batch; ++k)
+        for (int64_t i = 0; i < ld*n; ++i)
+            A[ k*ld*n + i ] = Ai[ k + i*batch ];
+}
+
+// -----------------------------------------------------------------------------
+// While in scope, sets the SIMD instruction set for native methods, then
+// restores the previous one when destroyed, even if the test throws.
+class SimdScope
+{
+public:
+    explicit SimdScope( lapack::Simd simd ):
+        saved_( lapack::simd_get() )
+    {
+        lapack::simd_set( simd );
+    }
+
+    ~SimdScope()
+    {
+        lapack::simd_set( saved_ );
+    }
+
+    SimdScope( SimdScope const& ) = delete;
+    SimdScope& operator = ( SimdScope const& ) = delete;
+
+private:
+    lapack::Simd saved_;
+};
+
+// -----------------------------------------------------------------------------
+// Calls func( N, NRHS ) with std::integral_constant arguments matching
+// runtime n and nrhs, for testing lapack::fixed routines.
+// Does nothing unless 1 <= n, nrhs <= 8.
+template< int64_t N = 1, int64_t NRHS = 1, typename Func >
+void dispatch_fixed( int64_t n, int64_t nrhs, Func&& func )
+{
+    if (n == N && nrhs == NRHS)
+        func( std::integral_constant< int64_t, N >(),
+              std::integral_constant< int64_t, NRHS >() );
+    else if constexpr (NRHS < 8)
+        dispatch_fixed< N, NRHS+1 >( n, nrhs, func );
+    else if constexpr (N < 8)
+        dispatch_fixed< N+1, 1 >( n, nrhs, func );
+}
+
 // -----------------------------------------------------------------------------
 #ifndef assert_throw
     #define assert_throw( expr, exception_type ) \
@@ -180,6 +251,14 @@ void test_gesvx ( Params& params, bool run );
 void test_getrf ( Params& params, bool run );
 void test_getri ( Params& params, bool run );
 void test_getrs ( Params& params, bool run );
+void test_gesv_batch  ( Params& params, bool run );
+void test_getrf_batch ( Params& params, bool run );
+void test_getrs_batch ( Params& params, bool run );
+void test_gesv_fixed  ( Params& params, bool run );
+void test_factor_lu   ( Params& params, bool run );
+void test_gesv_mixed     ( Params& params, bool run );
+void test_solve_mixed_lu ( Params& params, bool run );
+void test_gesv_layout    ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
 void test_gerfs ( Params& params, bool run );
 void test_geequ ( Params& params, bool run );
@@ -208,6 +287,18 @@ void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
+void test_posv_batch  ( Params& params, bool run );
+void test_potrf_batch ( Params& params, bool run );
+void test_potrs_batch ( Params& params, bool run );
+void test_posv_fixed  ( Params& params, bool run );
+void test_factor_chol ( Params& params, bool run );
+void test_potrf_update   ( Params& params, bool run );
+void test_potrf_downdate ( Params& params, bool run );
+void test_posv_mixed       ( Params& params, bool run );
+void test_solve_mixed_chol ( Params& params, bool run );
+void test_solve_mixed_fp16 ( Params& params, bool run );
+void test_solve_mixed_bf16 ( Params& params, bool run );
+void test_posv_layout      ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
 void test_porfs ( Params& params, bool run );
 void test_poequ ( Params& params, bool run );
@@ -283,6 +374,8 @@ void test_hetrs ( Params& params, bool run );
 void test_hetri ( Params& params, bool run );
 void test_hecon ( Params& params, bool run );
 void test_herfs ( Params& params, bool run );
+void test_factor_ldlt ( Params& params, bool run );
+void test_solve_mixed_ldlt ( Params& params, bool run );
 
 // hermetian, packed
 void test_hpsv  ( Params& params, bool run );
@@ -298,6 +391,8 @@ void test_gelsy ( Params& params, bool run );
 void test_gelsd ( Params& params, bool run );
 void test_gelss ( Params& params, bool run );
 void test_getsls( Params& params, bool run );
+void test_gels_batch ( Params& params, bool run );
+void test_factor_qr   ( Params& params, bool run );
 void test_gglse ( Params& params, bool run );
 void test_ggglm ( Params& params, bool run );
 
@@ -308,6 +403,14 @@ void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
 void test_gemqrt( Params& params, bool run );
+void test_geqrf_batch ( Params& params, bool run );
+void test_geqrf_layout ( Params& params, bool run );
+void test_gelqf_layout ( Params& params, bool run );
+void test_qr_update     ( Params& params, bool run );
+void test_qr_insert_row ( Params& params, bool run );
+void test_qr_delete_row ( Params& params, bool run );
+void test_qr_insert_col ( Params& params, bool run );
+void test_qr_delete_col ( Params& params, bool run );
 
 void test_ggqrf ( Params& params, bool run );
 void test_gglqf ( Params& params, bool run );
@@ -341,6 +444,7 @@ void test_tprfb ( Params& params, bool run );
 
 // symmetric eigenvalues
 void test_heev  ( Params& params, bool run );
+void test_heev_layout ( Params& params, bool run );
 void test_heevx ( Params& params, bool run );
 void test_heevd ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
@@ -408,6 +512,7 @@ void test_ggesx ( Params& params, bool run );
 
 // SVD
 void test_gesvd ( Params& params, bool run );
+void test_gesvd_layout ( Params& params, bool run );
 void test_gesdd ( Params& params, bool run );
 void test_gesvdx( Params& params, bool run );
 void test_gesvd_2stage ( Params& params, bool run );
@@ -419,8 +524,14 @@ void test_gesvj ( Params& params, bool run );
 // auxiliary
 void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
+void test_lag2h ( Params& params, bool run );
+void test_lag2b ( Params& params, bool run );
+void test_lascl ( Params& params, bool run );
 void test_laset ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
+void test_transpose( Params& params, bool run );
+void test_ilaenv( Params& params, bool run );
+void test_thread_scope( Params& params, bool run );
 
 // auxiliary - Householder
 void test_larfg ( Params& params, bool run );
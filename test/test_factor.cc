@@ -0,0 +1,611 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the factorization objects, lapack::LU, Cholesky, LDLT, and QR.
+// Each factors A once, then solves two batches of right-hand sides, and
+// compares rcond, det, and inverse with the LAPACK routines.
+
+// -----------------------------------------------------------------------------
+// Relative backwards error = ||B - op(A) X|| / (n ||A|| ||X||), for square A.
+template< typename scalar_t >
+blas::real_type< scalar_t > solve_error(
+    lapack::Op op, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* X, scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    std::vector< scalar_t > R( B, B + ldb*nrhs );
+    blas::gemm( blas::Layout::ColMajor, op, blas::Op::NoTrans, n, nrhs, n,
+                -1.0, A, lda,
+                      X, ldb,
+                 1.0, &R[0], ldb );
+    real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldb );
+    real_t Anorm = lapack::lange( lapack::Norm::One, n, n, A, lda );
+    return error / (n * Anorm * Xnorm);
+}
+
+// -----------------------------------------------------------------------------
+// Least squares error = ||A^H (B - A X)|| / (m ||A|| (||A|| ||X|| + ||B||)),
+// for m-by-n A; X is the first n rows of the m-by-nrhs solve result.
+template< typename scalar_t >
+blas::real_type< scalar_t > least_squares_error(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* X, scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    std::vector< scalar_t > R( B, B + ldb*nrhs );
+    std::vector< scalar_t > AHR( n*nrhs );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                m, nrhs, n,
+                -1.0, A, lda,
+                      X, ldb,
+                 1.0, &R[0], ldb );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::ConjTrans, blas::Op::NoTrans,
+                n, nrhs, m,
+                1.0, A, lda,
+                     &R[0], ldb,
+                0.0, &AHR[0], n );
+    real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &AHR[0], n );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldb );
+    real_t Bnorm = lapack::lange( lapack::Norm::One, m, nrhs, B, ldb );
+    real_t Anorm = lapack::lange( lapack::Norm::One, m, n, A, lda );
+    return error / (m * Anorm * (Anorm * Xnorm + Bnorm));
+}
+
+// -----------------------------------------------------------------------------
+// Inverse error = ||I - Ainv A|| / (m ||A|| ||Ainv||),
+// for m-by-n A and n-by-m Ainv.
+template< typename scalar_t >
+blas::real_type< scalar_t > inverse_error(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* Ainv, int64_t ldainv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    std::vector< scalar_t > R( n*n );
+    lapack::laset( lapack::MatrixType::General, n, n, 0.0, 1.0, &R[0], n );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, n, m,
+                -1.0, Ainv, ldainv,
+                      A, lda,
+                 1.0, &R[0], n );
+    real_t error = lapack::lange( lapack::Norm::One, n, n, &R[0], n );
+    real_t Anorm    = lapack::lange( lapack::Norm::One, m, n, A, lda );
+    real_t Ainvnorm = lapack::lange( lapack::Norm::One, n, m, Ainv, ldainv );
+    return error / (m * Anorm * Ainvnorm);
+}
+
+// -----------------------------------------------------------------------------
+// Determinant from getrf, as reference.
+template< typename scalar_t >
+scalar_t det_ref( int64_t n, scalar_t const* A, int64_t lda )
+{
+    std::vector< scalar_t > LU( A, A + lda*n );
+    std::vector< int64_t > ipiv( blas::max( 1, n ) );
+    lapack::getrf( n, n, &LU[0], lda, &ipiv[0] );
+    scalar_t det = 1;
+    for (int64_t i = 0; i < n; ++i) {
+        det *= LU[ i + i*lda ];
+        if (ipiv[ i ] != i + 1)
+            det = -det;
+    }
+    return det;
+}
+
+// -----------------------------------------------------------------------------
+// Determinant error = |det - det_ref| / |det_ref| * rcond / n, since
+// perturbations of A of size eps change det by about n cond( A ) eps.
+// Skipped (0) if det_ref over- or underflowed.
+template< typename scalar_t >
+blas::real_type< scalar_t > det_error(
+    scalar_t det, scalar_t det_ref, blas::real_type< scalar_t > rcond,
+    int64_t n )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t ref = std::abs( det_ref );
+    if (! std::isnormal( ref ))
+        return 0;
+    return std::abs( det - det_ref ) / ref * rcond / n;
+}
+
+// -----------------------------------------------------------------------------
+// Relative difference of rcond estimates.
+template< typename real_t >
+real_t rcond_error( real_t rcond, real_t rcond_ref )
+{
+    return std::abs( rcond - rcond_ref ) / rcond_ref;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_lu_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B1( size_B );
+    std::vector< scalar_t > B2( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B1.size(), &B1[0] );
+    lapack::larnv( idist, iseed, B2.size(), &B2[0] );
+    std::vector< scalar_t > X1 = B1;
+    std::vector< scalar_t > X2 = B2;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::LU< scalar_t > lu( n, &A[0], lda );
+    if (lu.info() == 0)
+        lu.solve( nrhs, &X1[0], ldb, trans );
+    time = testsweeper::get_wtime() - time;
+    if (lu.info() != 0) {
+        fprintf( stderr, "lapack::LU returned error %lld\n", llong( lu.info() ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y' && lu.info() == 0) {
+        // ---------- check error
+        // second batch reuses the factors
+        lu.solve( nrhs, &X2[0], ldb, trans );
+        real_t error = solve_error( trans, n, nrhs, &A[0], lda, &X1[0], &B1[0], ldb );
+        error = blas::max(
+            error, solve_error( trans, n, nrhs, &A[0], lda, &X2[0], &B2[0], ldb ) );
+
+        // rcond, compared with getrf, gecon
+        std::vector< scalar_t > LU_ref = A;
+        std::vector< int64_t > ipiv_ref( blas::max( 1, n ) );
+        lapack::getrf( n, n, &LU_ref[0], lda, &ipiv_ref[0] );
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n, &A[0], lda );
+        real_t rcond_ref;
+        lapack::gecon( lapack::Norm::One, n, &LU_ref[0], lda, Anorm, &rcond_ref );
+        real_t rcond = lu.rcond();
+        error = blas::max( error, rcond_error( rcond, rcond_ref ) );
+
+        error = blas::max(
+            error, det_error( lu.det(), det_ref( n, &A[0], lda ), rcond_ref, n ) );
+
+        std::vector< scalar_t > Ainv( size_A );
+        lu.inverse( &Ainv[0], lda );
+        error = blas::max(
+            error, inverse_error( n, n, &A[0], lda, &Ainv[0], lda ) );
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > A_ref = A;
+        std::vector< scalar_t > B_ref = B1;
+        std::vector< int64_t > ipiv_ref( blas::max( 1, n ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gesv( n, nrhs, &A_ref[0], lda, &ipiv_ref[0],
+                                         &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Cholesky and LDLT: A is Hermitian, stored in full so errors can use gemm.
+template< typename Factor, typename scalar_t >
+void test_factor_hermitian_work( Params& params, bool run, const char* name )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    constexpr bool is_chol
+        = std::is_same< Factor, lapack::Cholesky< scalar_t > >::value;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B1( size_B );
+    std::vector< scalar_t > B2( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    // make Hermitian from the lower triangle
+    for (int64_t j = 0; j < n; ++j) {
+        A[ j + j*lda ] = blas::real( A[ j + j*lda ] );
+        for (int64_t i = j + 1; i < n; ++i) {
+            A[ j + i*lda ] = conj( A[ i + j*lda ] );
+        }
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B1.size(), &B1[0] );
+    lapack::larnv( idist, iseed, B2.size(), &B2[0] );
+    std::vector< scalar_t > X1 = B1;
+    std::vector< scalar_t > X2 = B2;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    Factor F( uplo, n, &A[0], lda );
+    if (F.info() == 0)
+        F.solve( nrhs, &X1[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    if (F.info() != 0) {
+        fprintf( stderr, "lapack::%s returned error %lld\n",
+                 name, llong( F.info() ) );
+    }
+
+    params.time() = time;
+    double gflop = is_chol ? lapack::Gflop< scalar_t >::posv( n, nrhs )
+                           : lapack::Gflop< scalar_t >::hesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y' && F.info() == 0) {
+        // ---------- check error
+        // second batch reuses the factors
+        F.solve( nrhs, &X2[0], ldb );
+        lapack::Op op = lapack::Op::NoTrans;
+        real_t error = solve_error( op, n, nrhs, &A[0], lda, &X1[0], &B1[0], ldb );
+        error = blas::max(
+            error, solve_error( op, n, nrhs, &A[0], lda, &X2[0], &B2[0], ldb ) );
+
+        // rcond, compared with potrf, pocon or hetrf, hecon
+        std::vector< scalar_t > F_ref = A;
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A[0], lda );
+        real_t rcond_ref;
+        if constexpr (is_chol) {
+            lapack::potrf( uplo, n, &F_ref[0], lda );
+            lapack::pocon( uplo, n, &F_ref[0], lda, Anorm, &rcond_ref );
+        }
+        else {
+            std::vector< int64_t > ipiv_ref( blas::max( 1, n ) );
+            lapack::hetrf( uplo, n, &F_ref[0], lda, &ipiv_ref[0] );
+            lapack::hecon( uplo, n, &F_ref[0], lda, &ipiv_ref[0], Anorm,
+                           &rcond_ref );
+        }
+        real_t rcond = F.rcond();
+        error = blas::max( error, rcond_error( rcond, rcond_ref ) );
+
+        error = blas::max(
+            error, det_error( scalar_t( F.det() ), det_ref( n, &A[0], lda ),
+                              rcond_ref, n ) );
+
+        std::vector< scalar_t > Ainv( size_A );
+        F.inverse( &Ainv[0], lda );
+        error = blas::max(
+            error, inverse_error( n, n, &A[0], lda, &Ainv[0], lda ) );
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > A_ref = A;
+        std::vector< scalar_t > B_ref = B1;
+        std::vector< int64_t > ipiv_ref( blas::max( 1, n ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref;
+        if constexpr (is_chol) {
+            info_ref = lapack::posv( uplo, n, nrhs, &A_ref[0], lda,
+                                     &B_ref[0], ldb );
+        }
+        else {
+            info_ref = lapack::hesv( uplo, n, nrhs, &A_ref[0], lda,
+                                     &ipiv_ref[0], &B_ref[0], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::%s returned error %lld\n",
+                     (is_chol ? "posv" : "hesv"), llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_qr_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldainv = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_Ainv = (size_t) ldainv * m;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B1( size_B );
+    std::vector< scalar_t > B2( size_B );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B1.size(), &B1[0] );
+    lapack::larnv( idist, iseed, B2.size(), &B2[0] );
+    std::vector< scalar_t > X1 = B1;
+    std::vector< scalar_t > X2 = B2;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "B m=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( m ), llong( nrhs ), llong( ldb ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::QR< scalar_t > qr( m, n, &A[0], lda );
+    qr.solve( nrhs, &X1[0], ldb );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gels( m, n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // second batch reuses the factors
+        qr.solve( nrhs, &X2[0], ldb );
+        real_t error = least_squares_error( m, n, nrhs, &A[0], lda,
+                                            &X1[0], &B1[0], ldb );
+        error = blas::max(
+            error, least_squares_error( m, n, nrhs, &A[0], lda,
+                                        &X2[0], &B2[0], ldb ) );
+
+        // rcond, compared with geqrf, trcon
+        std::vector< scalar_t > QR_ref = A;
+        std::vector< scalar_t > tau_ref( n );
+        lapack::geqrf( m, n, &QR_ref[0], lda, &tau_ref[0] );
+        real_t rcond_ref;
+        lapack::trcon( lapack::Norm::One, lapack::Uplo::Upper,
+                       lapack::Diag::NonUnit, n, &QR_ref[0], lda, &rcond_ref );
+        real_t rcond = qr.rcond();
+        error = blas::max( error, rcond_error( rcond, rcond_ref ) );
+
+        if (m == n) {
+            error = blas::max(
+                error, det_error( qr.det(), det_ref( n, &A[0], lda ),
+                                  rcond_ref, n ) );
+        }
+
+        std::vector< scalar_t > Ainv( size_Ainv );
+        qr.inverse( &Ainv[0], ldainv );
+        error = blas::max(
+            error, inverse_error( m, n, &A[0], lda, &Ainv[0], ldainv ) );
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > A_ref = A;
+        std::vector< scalar_t > B_ref = B1;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                                         &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_lu( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_lu_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_lu_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_lu_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_lu_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< template< typename > class Factor >
+void test_factor_hermitian( Params& params, bool run, const char* name )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_hermitian_work< Factor< float >, float >(
+                params, run, name );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_hermitian_work< Factor< double >, double >(
+                params, run, name );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_hermitian_work< Factor< std::complex<float> >,
+                                        std::complex<float> >(
+                params, run, name );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_hermitian_work< Factor< std::complex<double> >,
+                                        std::complex<double> >(
+                params, run, name );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_chol( Params& params, bool run )
+{
+    test_factor_hermitian< lapack::Cholesky >( params, run, "Cholesky" );
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_ldlt( Params& params, bool run )
+{
+    test_factor_hermitian< lapack::LDLT >( params, run, "LDLT" );
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_qr( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_qr_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_qr_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_qr_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_qr_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gels_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A * batch );
+    std::vector< scalar_t > A_ref( size_A * batch );
+    std::vector< scalar_t > B_tst( size_B * batch );
+    std::vector< scalar_t > B_ref( size_B * batch );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_ref( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*size_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+    std::vector< scalar_t > B_orig = B_tst;
+
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< scalar_t* > Barray( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = &A_tst[ i*size_A ];
+        Barray[ i ] = &B_tst[ i*size_B ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "B nrhs=%5lld, ldb=%5lld\n"
+                "batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( nrhs ), llong( ldb ),
+                llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gels_batch( { trans }, { -1 }, {  n }, { nrhs }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( { trans }, {  m }, { -1 }, { nrhs }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( { trans }, {  m }, {  n }, {   -1 }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( { trans }, {  m }, {  n }, { nrhs }, Aarray, { m-1 }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( { trans }, {  m }, {  n }, { nrhs }, Aarray, { lda }, Barray, { blas::max( m, n ) - 1 }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( { trans }, {  m }, {  n }, { nrhs }, Aarray, { lda }, Barray, { ldb }, batch + 1, info_tst ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gels_batch( { trans }, { m }, { n }, { nrhs }, Aarray, { lda },
+                        Barray, { ldb }, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::gels_batch returned error %lld for problem %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+            break;
+        }
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: gels on one problem at a time
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::gels( trans, m, n, nrhs,
+                                          &A_ref[ i*size_A ], lda,
+                                          &B_ref[ i*size_B ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Batch should match one-at-a-time solves.
+        // gels is tested numerically by test_gels.
+        real_t error = rel_error( B_tst, B_ref );
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+
+        // strided version should match too
+        A_ref = A_orig;
+        B_ref = B_orig;
+        lapack::gels_batch_strided( trans, m, n, nrhs,
+                                    &A_ref[0], lda, size_A,
+                                    &B_ref[0], ldb, size_B,
+                                    batch, &info_ref[0] );
+        error += rel_error( B_ref, B_tst );
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gels_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
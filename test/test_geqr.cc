@@ -23,8 +23,13 @@ void test_geqr_work( Params& params, bool run )
     // get & mark input values
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
+    lapack::Method method = params.method();
+    int64_t threads = params.threads();
     int64_t align = params.align();
 
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
     // mark non-standard output values
     params.ref_time();
     params.ref_gflops();
@@ -41,8 +46,13 @@ void test_geqr_work( Params& params, bool run )
     std::vector< scalar_t > A_ref( size_A );
     std::vector< scalar_t > T_tst( 5 );  // 5 is minimum
 
+    // With threads > 0, run on that many threads, e.g., for scaling.
+    // T size for tiled methods depends on threads, so set it before query.
+    lapack::ThreadScope thread_scope( threads );
+
     // query for T size (pass tsize = -1 for optimal, tsize = -2 for minimum)
-    int64_t info_tst = lapack::geqr( m, n, &A_tst[0], lda, &T_tst[0], -1 );
+    int64_t info_tst = lapack::geqr( m, n, &A_tst[0], lda, &T_tst[0], -1,
+                                     method );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqr query returned error %lld\n", llong( info_tst ) );
     }
@@ -59,7 +69,7 @@ void test_geqr_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    info_tst = lapack::geqr( m, n, &A_tst[0], lda, &T_tst[0], tsize );
+    info_tst = lapack::geqr( m, n, &A_tst[0], lda, &T_tst[0], tsize, method );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqr returned error %lld\n", llong( info_tst ) );
@@ -69,7 +79,42 @@ void test_geqr_work( Params& params, bool run )
     double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
     params.gflops() = gflop / time;
 
-    if (params.ref() == 'y' || params.check() == 'y') {
+    if (method != lapack::Method::Lapack && params.check() == 'y') {
+        // ---------- check numerical error
+        // T is in a different format than LAPACK's, so check
+        // error1 = || A - QR ||_1 / (m ||A||_1)  and
+        // error2 = || I - Q^H Q ||_1 / m,  applying Q with gemqr.
+        int64_t k = blas::min( m, n );
+        std::vector< scalar_t > R( size_A );
+        lapack::lacpy( lapack::MatrixType::Upper, k, n, &A_tst[0], lda, &R[0], lda );
+        lapack::gemqr( lapack::Side::Left, lapack::Op::NoTrans, m, n, k,
+                       &A_tst[0], lda, &T_tst[0], tsize, &R[0], lda, method );
+        for (size_t i = 0; i < size_A; ++i) {
+            R[ i ] -= A_ref[ i ];
+        }
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+        real_t error1 = lapack::lange( lapack::Norm::One, m, n, &R[0], lda );
+        if (Anorm != 0)
+            error1 /= m * Anorm;
+
+        int64_t ldq = lda;
+        std::vector< scalar_t > Q( ldq * k );
+        std::vector< scalar_t > QHQ( k * k );
+        lapack::laset( lapack::MatrixType::General, m, k, 0.0, 1.0, &Q[0], ldq );
+        lapack::gemqr( lapack::Side::Left, lapack::Op::NoTrans, m, k, k,
+                       &A_tst[0], lda, &T_tst[0], tsize, &Q[0], ldq, method );
+        lapack::laset( lapack::MatrixType::Upper, k, k, 0.0, 1.0, &QHQ[0], k );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    k, m, -1.0, &Q[0], ldq, 1.0, &QHQ[0], k );
+        real_t error2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                       k, &QHQ[0], k );
+        if (m > 0)
+            error2 /= m;
+
+        params.error() = blas::max( error1, error2 );
+        params.okay() = (params.error() < tol);
+    }
+    else if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
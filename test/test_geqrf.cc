@@ -32,6 +32,10 @@ void test_geqrf_work( Params& params, bool run )
     //params.ref_gflops();
     params.gflops();
     params.ortho();
+    params.error2();
+    params.error2.name( "ws error" );
+    params.time2();
+    params.time2.name( "ws time (s)" );
 
     if (! run)
         return;
@@ -63,6 +67,33 @@ void test_geqrf_work( Params& params, bool run )
     double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
     params.gflops() = gflop / time;
 
+    // ---------- run version with reusable workspace
+    // First call queries and allocates workspace; time second call,
+    // which does neither.
+    lapack::Workspace ws;
+    std::vector< scalar_t > A_ws = A_ref;
+    std::vector< scalar_t > tau_ws( size_tau );
+    lapack::geqrf( m, n, &A_ws[0], lda, &tau_ws[0], ws );
+    A_ws = A_ref;
+    int64_t num_allocations = ws.num_allocations();
+    int64_t num_queries = ws.num_queries();
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    int64_t info_ws = lapack::geqrf( m, n, &A_ws[0], lda, &tau_ws[0], ws );
+    time = testsweeper::get_wtime() - time;
+    if (info_ws != 0) {
+        fprintf( stderr, "lapack::geqrf with workspace returned error %lld\n", llong( info_ws ) );
+    }
+    params.time2() = time;
+
+    // Second call should neither allocate nor query.
+    bool ws_reused = ws.num_allocations() == num_allocations
+                     && ws.num_queries() == num_queries;
+    if (! ws_reused) {
+        fprintf( stderr, "lapack::geqrf with workspace allocated or queried again\n" );
+    }
+
     if (params.check() == 'y') {
         // ---------- check error
         // comparing to ref. solution doesn't work
@@ -108,9 +139,17 @@ void test_geqrf_work( Params& params, bool run )
         real_t resid2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, minmn, &R[0], ldr );
         real_t error2 = ( resid2 / n );
 
+        // Workspace version should match non-workspace version.
+        blas::axpy( size_A, -1.0, &A_tst[0], 1, &A_ws[0], 1 );
+        real_t error3 = lapack::lange( lapack::Norm::One, m, n, &A_ws[0], lda );
+        if (Anorm > 0)
+            error3 /= Anorm;
+
         params.error() = error1;
         params.ortho() = error2;
-        params.okay() = (error1 < tol) && (error2 < tol);
+        params.error2() = error3;
+        params.okay() = (error1 < tol) && (error2 < tol) && (error3 < tol)
+                        && ws_reused;
     }
 
     if (params.ref() == 'y') {
@@ -76,6 +76,19 @@ void test_gesdd_work( Params& params, bool run )
     //double gflop = lapack::Gflop< scalar_t >::gesdd( jobu, m, n );
     //params.gflops() = gflop / time;
 
+    // ---------- run version with user-supplied host workspace
+    std::vector< scalar_t > A_hw = A_ref;
+    std::vector< real_t > S_hw( size_S );
+    std::vector< scalar_t > U_hw( size_U );
+    std::vector< scalar_t > VT_hw( size_VT );
+    size_t host_work_size;
+    lapack::gesdd_work_size_bytes( jobu, m, n, &A_hw[0], lda, &S_hw[0], &U_hw[0], ldu, &VT_hw[0], ldvt, &host_work_size );
+    std::vector< char > host_work( host_work_size );
+    int64_t info_hw = lapack::gesdd( jobu, m, n, &A_hw[0], lda, &S_hw[0], &U_hw[0], ldu, &VT_hw[0], ldvt, host_work.data(), host_work_size );
+    if (info_hw != info_tst) {
+        fprintf( stderr, "lapack::gesdd with host_work returned error %lld\n", llong( info_hw ) );
+    }
+
     // ---------- check numerical error
     // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
     //                                    if jobu  != NoVec
@@ -104,6 +117,12 @@ void test_gesdd_work( Params& params, bool run )
         }
         check_svd( jobu, jobu, m, n, &A_ref[0], lda,
                    &S_tst[0], U2, ldu2, VT2, ldvt2, errors );
+
+        // host_work version should match
+        if (info_hw != info_tst) {
+            errors[0] = 1;
+        }
+        errors[3] += rel_error( S_hw, S_tst );
     }
 
     if (params.ref() == 'y') {
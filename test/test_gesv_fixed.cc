@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesv_fixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (! (1 <= n && n <= 8 && 1 <= nrhs && nrhs <= 8)) {
+        params.msg() = "skipping: requires 1 <= n, nrhs <= 8";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( n, align );
+    int64_t ldb = roundup( n, align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A * batch );
+    std::vector< scalar_t > A_ref( size_A * batch );
+    std::vector< int64_t > ipiv_tst( size_ipiv * batch );
+    std::vector< int64_t > ipiv_ref( size_ipiv * batch );
+    std::vector< scalar_t > B_tst( size_B * batch );
+    std::vector< scalar_t > B_ref( size_B * batch );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_ref( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*size_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+    std::vector< scalar_t > B_orig = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n"
+                "batch=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ),
+                llong( batch ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    dispatch_fixed( n, nrhs, [&]( auto N_, auto NRHS_ ) {
+        constexpr int64_t N = decltype( N_ )::value;
+        constexpr int64_t NRHS = decltype( NRHS_ )::value;
+        for (int64_t i = 0; i < batch; ++i) {
+            info_tst[ i ] = lapack::fixed::gesv< N, NRHS >(
+                &A_tst[ i*size_A ], lda, &ipiv_tst[ i*size_ipiv ],
+                &B_tst[ i*size_B ], ldb );
+        }
+    } );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: gesv on one problem at a time
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::gesv( n, nrhs, &A_ref[ i*size_A ], lda,
+                                          &ipiv_ref[ i*size_ipiv ],
+                                          &B_ref[ i*size_B ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over batch of relative backwards error
+        // = ||b - op(A)x|| / (n * ||A|| * ||x||).
+        auto backward_error = [&]( lapack::Op op, std::vector< scalar_t > const& X ) {
+            std::vector< scalar_t > R( B_orig );
+            real_t error = 0;
+            for (int64_t i = 0; i < batch; ++i) {
+                scalar_t const* A_i = &A_orig[ i*size_A ];
+                scalar_t const* X_i = &X[ i*size_B ];
+                scalar_t* R_i = &R[ i*size_B ];
+                blas::gemm( blas::Layout::ColMajor, op, blas::Op::NoTrans,
+                            n, nrhs, n,
+                            -1.0, A_i, lda,
+                                  X_i, ldb,
+                             1.0, R_i, ldb );
+                real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, R_i, ldb );
+                real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X_i, ldb );
+                real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    A_i, lda );
+                error_i /= (n * Anorm * Xnorm);
+                error = blas::max( error, error_i );
+            }
+            return error;
+        };
+        real_t error = backward_error( lapack::Op::NoTrans, B_tst );
+
+        // Pivoting should match gesv exactly.
+        if (info_tst != info_ref || ipiv_tst != ipiv_ref) {
+            error = 1;
+        }
+
+        // getrs with trans, using the factors
+        B_tst = B_orig;
+        dispatch_fixed( n, nrhs, [&]( auto N_, auto NRHS_ ) {
+            constexpr int64_t N = decltype( N_ )::value;
+            constexpr int64_t NRHS = decltype( NRHS_ )::value;
+            for (int64_t i = 0; i < batch; ++i) {
+                lapack::fixed::getrs< N, NRHS >(
+                    trans, &A_tst[ i*size_A ], lda, &ipiv_tst[ i*size_ipiv ],
+                    &B_tst[ i*size_B ], ldb );
+            }
+        } );
+        error = blas::max( error, backward_error( trans, B_tst ) );
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesv_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_fixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
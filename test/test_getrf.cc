@@ -19,6 +19,7 @@ void test_getrf_work( Params& params, bool run )
     using real_t = blas::real_type< scalar_t >;
 
     // get & mark input values
+    lapack::Method method = params.method();
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
     int64_t align = params.align();
@@ -32,6 +33,10 @@ void test_getrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.error2();
+    params.error3();
+    params.error2.name( "PA-LU" );
+    params.error3.name( "growth" );
 
     if (! run)
         return;
@@ -63,12 +68,13 @@ void test_getrf_work( Params& params, bool run )
         assert_throw( lapack::getrf( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf(  m,  n, &A_tst[0], lda, &ipiv_tst[0], lapack::Method(0) ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0] );
+    int64_t info_tst = lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0], method );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_tst ) );
@@ -82,10 +88,10 @@ void test_getrf_work( Params& params, bool run )
         printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
     }
 
+    bool okay = true;
     if (params.check() == 'y' && m == n) {
         // ---------- check error
         // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
-        // For m != n, could check PA - LU.
         int64_t nrhs = 1;
         int64_t ldb = roundup( blas::max( 1, n ), align );
         size_t size_B = (size_t) ldb * nrhs;
@@ -95,6 +101,8 @@ void test_getrf_work( Params& params, bool run )
         int64_t iseed[4] = { 0, 1, 2, 3 };
         lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
         B_ref = B_tst;
+        std::vector< scalar_t > A_piv = A_ref;
+        std::vector< scalar_t > B_piv = B_tst;
 
         info_tst = lapack::getrs(
             lapack::Op::NoTrans, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb );
@@ -115,8 +123,61 @@ void test_getrf_work( Params& params, bool run )
         real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
         real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
         error /= (n * Anorm * Xnorm);
+
+        // pivots in native lapack_int should give same solution
+        // (other methods match only up to rounding or pivoting, so skip them)
+        if (method == lapack::Method::Lapack) {
+            std::vector< lapack_int > ipiv_native( size_ipiv );
+            lapack::PivotView piv( &ipiv_native[0], size_ipiv );
+            lapack::getrf( m, n, &A_piv[0], lda, piv );
+            lapack::getrs(
+                lapack::Op::NoTrans, n, nrhs, &A_piv[0], lda, piv, &B_piv[0], ldb );
+            error += rel_error( B_piv, B_tst );
+        }
+
         params.error() = error;
-        params.okay() = (error < tol);
+        okay = (error < tol);
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check stability, for any m, n
+        // error2 = || P^T A - L U ||_1 / (n ||A||_1), backward error of the
+        // factors, which must be small for any pivoting strategy.
+        // error3 = pivot growth max |U| / max |A|, relative to partial
+        // pivoting (LAPACK getrf); 1 for Method::Lapack, and close to 1
+        // for stable strategies such as tournament pivoting (CALU).
+        int64_t k = blas::min( m, n );
+        int64_t ldu = blas::max( 1, k );
+        std::vector< scalar_t > L( lda * k );
+        std::vector< scalar_t > U( ldu * n );
+        lapack::lacpy( lapack::MatrixType::Lower, m, k, &A_tst[0], lda, &L[0], lda );
+        lapack::laset( lapack::MatrixType::Upper, m, k, 0.0, 1.0, &L[0], lda );
+        lapack::lacpy( lapack::MatrixType::Upper, k, n, &A_tst[0], lda, &U[0], ldu );
+
+        std::vector< scalar_t > PA = A_ref;
+        lapack::laswp( n, &PA[0], lda, 1, k, &ipiv_tst[0], 1 );
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, n, k,
+                    -1.0, &L[0], lda,
+                          &U[0], ldu,
+                     1.0, &PA[0], lda );
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+        real_t error2 = lapack::lange( lapack::Norm::One, m, n, &PA[0], lda );
+        if (Anorm != 0)
+            error2 /= n * Anorm;
+
+        std::vector< scalar_t > A_gepp = A_ref;
+        std::vector< int64_t > ipiv_gepp( size_ipiv );
+        lapack::getrf( m, n, &A_gepp[0], lda, &ipiv_gepp[0] );
+        real_t Umax  = lapack::lantr( lapack::Norm::Max, lapack::Uplo::Upper,
+                                      lapack::Diag::NonUnit, k, n, &A_tst[0], lda );
+        real_t Ugepp = lapack::lantr( lapack::Norm::Max, lapack::Uplo::Upper,
+                                      lapack::Diag::NonUnit, k, n, &A_gepp[0], lda );
+        real_t growth = (Ugepp != 0 ? Umax / Ugepp : 1);
+
+        params.error2() = error2;
+        params.error3() = growth;
+        params.okay() = (okay && error2 < tol);
     }
 
     if (params.ref() == 'y') {
@@ -0,0 +1,157 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_getrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_ipiv = (size_t) (blas::min( m, n ));
+
+    std::vector< scalar_t > A_tst( size_A * batch );
+    std::vector< scalar_t > A_ref( size_A * batch );
+    std::vector< int64_t > ipiv_tst( size_ipiv * batch );
+    std::vector< int64_t > ipiv_ref( size_ipiv * batch );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_ref( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*size_A ], lda );
+    }
+    A_ref = A_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        Aarray[ i ]     = &A_tst[ i*size_A ];
+        ipiv_array[ i ] = &ipiv_tst[ i*size_ipiv ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::getrf_batch( { -1 }, {  n }, Aarray, { lda }, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( {  m }, { -1 }, Aarray, { lda }, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( {  m }, {  n }, Aarray, { m-1 }, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( {  m }, {  n }, Aarray, { lda }, ipiv_array, batch + 1, info_tst ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::getrf_batch( { m }, { n }, Aarray, { lda }, ipiv_array,
+                         batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::getrf_batch returned error %lld for problem %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+            break;
+        }
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: getrf on one problem at a time
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::getrf( m, n, &A_ref[ i*size_A ], lda,
+                                           &ipiv_ref[ i*size_ipiv ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Batch should match one-at-a-time factorizations.
+        real_t error = rel_error( A_tst, A_ref );
+        if (ipiv_tst != ipiv_ref || info_tst != info_ref) {
+            error = 1;
+        }
+
+        // strided version should match too
+        A_ref = A_orig;
+        lapack::getrf_batch_strided( m, n, &A_ref[0], lda, size_A,
+                                     &ipiv_ref[0], size_ipiv,
+                                     batch, &info_ref[0] );
+        error += rel_error( A_ref, A_tst );
+        if (ipiv_tst != ipiv_ref || info_tst != info_ref) {
+            error = 1;
+        }
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_getrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/ilaenv.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Restores routine name's nb entry and the workspace query cache setting on
+// scope exit, and enables the cache meanwhile.
+class IlaenvRestore
+{
+public:
+    IlaenvRestore( std::string const& name ):
+        name_( name ),
+        nb_( lapack::ilaenv_get( name, 1, 0 ) ),
+        cache_( lapack::work_query_cache_enabled() )
+    {
+        lapack::work_query_cache_enable( true );
+    }
+
+    ~IlaenvRestore()
+    {
+        lapack::ilaenv_set( name_, 1, 0, nb_ );  // nb_ = -1 removes
+        lapack::work_query_cache_enable( cache_ );
+    }
+
+private:
+    std::string name_;
+    int64_t nb_;
+    bool cache_;
+};
+
+// -----------------------------------------------------------------------------
+// Checks the ILAENV table that --tune sets: each geqrf workspace query and
+// factorization gets nb from the table, and changing nb from nb to 2*nb
+// changes the workspace geqrf requests (lwork = n*nb), even with the
+// workspace query cache enabled, and even when reusing a Workspace,
+// which must grow to the new size instead of using its cached size.
+// Requires LAPACK++ configured with ilaenv_override and a LAPACK that calls
+// ILAENV, like reference LAPACK; otherwise the test is skipped.
+template< typename scalar_t >
+void test_ilaenv_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nb = params.nb();
+    int64_t align = params.align();
+    params.matrix.mark();
+
+    if (! run)
+        return;
+
+    if (! lapack::ilaenv_override()) {
+        params.msg() = "skipping: configured without ilaenv_override";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t k = blas::min( m, n );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A1( size_A );
+    std::vector< scalar_t > A2( size_A );
+    std::vector< scalar_t > tau1( k );
+    std::vector< scalar_t > tau2( k );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    A1 = A;
+    A2 = A;
+
+    std::string name = testsweeper::datatype2char( params.datatype() )
+                     + std::string( "geqrf" );
+    int64_t hits = lapack::ilaenv_hits( name );
+
+    // ---------- run test with nb, then 2*nb
+    size_t size1 = 0, size2 = 0;
+    int64_t info1, info2;
+    size_t ws_capacity;
+    double time = testsweeper::get_wtime();
+    {
+        IlaenvRestore restore( name );
+        lapack::Workspace ws;
+        std::vector< scalar_t > A3( A );
+        lapack::ilaenv_set( name, 1, 0, nb );
+        // ws queries first, so it caches the size for nb itself
+        lapack::geqrf( m, n, &A3[0], lda, &tau1[0], ws );
+        lapack::geqrf_work_size_bytes( m, n, &A1[0], lda, &tau1[0], &size1 );
+        info1 = lapack::geqrf( m, n, &A1[0], lda, &tau1[0] );
+
+        lapack::ilaenv_set( name, 1, 0, 2*nb );
+        lapack::geqrf_work_size_bytes( m, n, &A2[0], lda, &tau2[0], &size2 );
+        info2 = lapack::geqrf( m, n, &A2[0], lda, &tau2[0] );
+        A3 = A;
+        lapack::geqrf( m, n, &A3[0], lda, &tau1[0], ws );
+        ws_capacity = ws.capacity();
+    }
+    time = testsweeper::get_wtime() - time;
+    hits = lapack::ilaenv_hits( name ) - hits;
+
+    params.time() = time;
+    if (info1 != 0 || info2 != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld, %lld\n",
+                 llong( info1 ), llong( info2 ) );
+    }
+
+    if (hits == 0) {
+        params.msg() = "skipping: LAPACK did not query ILAENV for " + name;
+        return;
+    }
+
+    // ---------- check
+    // Both runs compute the same QR factorization, up to rounding.
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+    real_t error = rel_error( A2, A1 );
+    params.error() = error;
+
+    // The 2 queries and 2 factorizations each get nb from the table,
+    // so the workspace sizes differ.
+    bool differ = (k == 0 || size1 != size2);
+    // The Workspace grows to the size for 2*nb.
+    bool regrown = (k == 0 || ws_capacity >= size2);
+    params.okay() = (error < tol) && differ && regrown && hits >= 4;
+    if (! differ) {
+        params.msg() = "workspace size did not change with nb: "
+                     + std::to_string( size1 ) + " bytes";
+    }
+    else if (! regrown) {
+        params.msg() = "Workspace kept " + std::to_string( ws_capacity )
+                     + " bytes, expected " + std::to_string( size2 );
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ilaenv( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_ilaenv_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ilaenv_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ilaenv_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ilaenv_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Traits for the 16-bit types: mantissa bits and smallest normal exponent,
+// for the reference rounding.
+template <typename half_t>
+struct HalfTraits;
+
+template <>
+struct HalfTraits< lapack::float16 > {
+    static constexpr int digits = 11;     // incl. implicit bit
+    static constexpr int min_exp = -14;
+};
+
+template <>
+struct HalfTraits< lapack::bfloat16 > {
+    static constexpr int digits = 8;
+    static constexpr int min_exp = -126;
+};
+
+// -----------------------------------------------------------------------------
+// Reference rounding of x to half_t, computed in double: scales x so the
+// last half_t mantissa bit is the units place, rounds to nearest even
+// (the default rounding mode), and scales back. Ignores overflow.
+template <typename half_t>
+double round_ref( double x )
+{
+    using traits = HalfTraits< half_t >;
+    if (x == 0 || std::isnan( x ))
+        return x;
+    int e = std::max( int( std::floor( std::log2( std::abs( x ) ) ) ),
+                      traits::min_exp );
+    int shift = traits::digits - 1 - e;
+    return std::ldexp( std::nearbyint( std::ldexp( x, shift ) ), -shift );
+}
+
+// Overloads to call lag2h or lag2b by type.
+template <typename scalar_t>
+int64_t lag2half( int64_t m, int64_t n, scalar_t const* A, int64_t lda,
+                  lapack::float16* H, int64_t ldh )
+{
+    return lapack::lag2h( m, n, A, lda, H, ldh );
+}
+
+template <typename scalar_t>
+int64_t lag2half( int64_t m, int64_t n, scalar_t const* A, int64_t lda,
+                  lapack::bfloat16* H, int64_t ldh )
+{
+    return lapack::lag2b( m, n, A, lda, H, ldh );
+}
+
+// Overloads to call lag2s or lag2d by type.
+template <typename half_t>
+int64_t half2lag( int64_t m, int64_t n, half_t const* H, int64_t ldh,
+                  float* A, int64_t lda )
+{
+    return lapack::lag2s( m, n, H, ldh, A, lda );
+}
+
+template <typename half_t>
+int64_t half2lag( int64_t m, int64_t n, half_t const* H, int64_t ldh,
+                  double* A, int64_t lda )
+{
+    return lapack::lag2d( m, n, H, ldh, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+// Tests conversion from scalar_t (float or double) to half_t and back.
+template< typename half_t, typename scalar_t >
+void test_lag2h_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.gbytes();
+    params.time2();
+    params.gbytes2();
+    params.error.name( "rel. error" );
+    params.error2.name( "mismatch" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldh = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_H = (size_t) ldh * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A2( size_A );
+    std::vector< half_t > H( size_H );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lag2half( -1,  n, &A[0], lda, &H[0], ldh ), lapack::Error );
+        assert_throw( lag2half(  m, -1, &A[0], lda, &H[0], ldh ), lapack::Error );
+        assert_throw( lag2half(  m,  n, &A[0], m-1, &H[0], ldh ), lapack::Error );
+        assert_throw( lag2half(  m,  n, &A[0], lda, &H[0], m-1 ), lapack::Error );
+        assert_throw( half2lag( -1,  n, &H[0], ldh, &A2[0], lda ), lapack::Error );
+        assert_throw( half2lag(  m, -1, &H[0], ldh, &A2[0], lda ), lapack::Error );
+        assert_throw( half2lag(  m,  n, &H[0], m-1, &A2[0], lda ), lapack::Error );
+        assert_throw( half2lag(  m,  n, &H[0], ldh, &A2[0], m-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Bytes read and written: m n (sizeof(scalar_t) + 2).
+    double gbyte = 1e-9 * m * n * (sizeof( scalar_t ) + sizeof( half_t ));
+
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info = lag2half( m, n, &A[0], lda, &H[0], ldh );
+    time = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lag2h returned error %lld\n", llong( info ) );
+    }
+    params.time() = time;
+    params.gbytes() = gbyte / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    half2lag( m, n, &H[0], ldh, &A2[0], lda );
+    time = testsweeper::get_wtime() - time;
+    params.time2() = time;
+    params.gbytes2() = gbyte / time;
+
+    if (verbose >= 2) {
+        printf( "A2 = " ); print_matrix( m, n, &A2[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative error |a - h| / |a| is at most the unit roundoff
+        // 2^-digits; below the normal range, relative to the smallest
+        // normal value. Each entry must also match the reference rounding.
+        using traits = HalfTraits< half_t >;
+        const double unit = std::ldexp( 1.0, -traits::digits );
+        const double tiny = std::ldexp( 1.0, traits::min_exp );
+        double error = 0;
+        int64_t mismatch = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                double a = A[ i + j*lda ];
+                double h = A2[ i + j*lda ];
+                error = std::max( error, std::abs( a - h )
+                                         / std::max( std::abs( a ), tiny ) );
+                if (h != round_ref< half_t >( a ))
+                    mismatch += 1;
+            }
+        }
+
+        // Overflow is detected; use an entry the reference can't round.
+        if (m > 0 && n > 0) {
+            scalar_t save = A[ 0 ];
+            A[ 0 ] = 2 * scalar_t( half_t::max() );
+            if (lag2half( m, n, &A[0], lda, &H[0], ldh ) != 1)
+                mismatch += 1;
+            A[ 0 ] = save;
+        }
+
+        params.error() = error;
+        params.error2() = mismatch;
+        params.okay() = (error <= unit && mismatch == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename half_t >
+void test_lag2h_dispatch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_lag2h_work< half_t, float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lag2h_work< half_t, double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lag2h( Params& params, bool run )
+{
+    test_lag2h_dispatch< lapack::float16 >( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_lag2b( Params& params, bool run )
+{
+    test_lag2h_dispatch< lapack::bfloat16 >( params, run );
+}
@@ -13,6 +13,8 @@
 #include <vector>
 
 // -----------------------------------------------------------------------------
+// Norms read each entry of the uplo triangle once, so bandwidth counts
+// n (n + 1) / 2 entries.
 template< typename scalar_t >
 void test_lansy_work( Params& params, bool run )
 {
@@ -22,18 +24,31 @@ void test_lansy_work( Params& params, bool run )
     lapack::Norm norm = params.norm();
     lapack::Uplo uplo = params.uplo();
     int64_t n = params.dim.n();
+    lapack::Method method = params.method();
+    int64_t threads = params.threads();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    lapack::Simd simd = params.simd();  // for native method
     params.matrix.mark();
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.gbytes();
+    params.ref_gbytes();
 
     if (! run)
         return;
 
+    if (! lapack::simd_supported( simd )) {
+        params.msg() = std::string( "skipping: " ) + lapack::simd2str( simd )
+                     + " not supported";
+        return;
+    }
+    SimdScope simd_scope( simd );
+
+    // With threads > 0, run on that many threads, e.g., for scaling.
+    lapack::ThreadScope thread_scope( threads );
+
     // ---------- setup
     int64_t lda = roundup( blas::max( n, 1 ), align );
     size_t size_A = (size_t) lda * n;
@@ -54,12 +69,12 @@ void test_lansy_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    real_t norm_tst = lapack::lansy( norm, uplo, n, &A[0], lda );
+    real_t norm_tst = lapack::lansy( norm, uplo, n, &A[0], lda, method );
     time = testsweeper::get_wtime() - time;
 
+    double gbyte = 0.5 * n * (n + 1) * sizeof( scalar_t ) * 1e-9;
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::lansy( norm, n );
-    //params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 1) {
         printf( "norm_tst = %.8e\n", norm_tst );
@@ -73,7 +88,7 @@ void test_lansy_work( Params& params, bool run )
         time = testsweeper::get_wtime() - time;
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
 
         if (verbose >= 1) {
             printf( "norm_ref = %.8e\n", norm_ref );
@@ -13,6 +13,8 @@
 #include <vector>
 
 // -----------------------------------------------------------------------------
+// Norms read each entry of the upper or lower trapezoid once,
+// so bandwidth counts those entries.
 template< typename scalar_t >
 void test_lantr_work( Params& params, bool run )
 {
@@ -24,19 +26,32 @@ void test_lantr_work( Params& params, bool run )
     lapack::Diag diag = params.diag();
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
+    lapack::Method method = params.method();
+    int64_t threads = params.threads();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
+    lapack::Simd simd = params.simd();  // for native method
     params.matrix.mark();
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.gbytes();
+    params.ref_gbytes();
     params.msg();
 
     if (! run)
         return;
 
+    if (! lapack::simd_supported( simd )) {
+        params.msg() = std::string( "skipping: " ) + lapack::simd2str( simd )
+                     + " not supported";
+        return;
+    }
+    SimdScope simd_scope( simd );
+
+    // With threads > 0, run on that many threads, e.g., for scaling.
+    lapack::ThreadScope thread_scope( threads );
+
     // Any m, n actually works, despite the LAPACK documentation.
 
     // ---------- setup
@@ -59,12 +74,20 @@ void test_lantr_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    real_t norm_tst = lapack::lantr( norm, uplo, diag, m, n, &A[0], lda );
+    real_t norm_tst = lapack::lantr( norm, uplo, diag, m, n, &A[0], lda,
+                                     method );
     time = testsweeper::get_wtime() - time;
 
+    double entries = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        if (uplo == lapack::Uplo::Upper)
+            entries += blas::min( j + 1, m );
+        else
+            entries += blas::max( 0, m - j );
+    }
+    double gbyte = entries * sizeof( scalar_t ) * 1e-9;
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::lantr( norm, diag, m, n );
-    //params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
 
     if (verbose >= 1) {
         printf( "norm_tst = %.8e\n", norm_tst );
@@ -78,7 +101,7 @@ void test_lantr_work( Params& params, bool run )
         time = testsweeper::get_wtime() - time;
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
 
         if (verbose >= 1) {
             printf( "norm_ref = %.8e\n", norm_ref );
@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// @return true if x and y are the same result: equal, or both NaN.
+// For real, the sign of zero must also match, since native lascl applies the
+// same multipliers as LAPACK. For complex, LAPACK may do a complex multiply
+// by (mul, 0), so zeros can differ in sign, and where an intermediate result
+// overflows, LAPACK can give NaN from inf * 0 where native gives inf.
+template< typename real_t >
+bool same_result( real_t x, real_t y )
+{
+    if (std::isnan( x ) || std::isnan( y ))
+        return std::isnan( x ) && std::isnan( y );
+    return x == y && std::signbit( x ) == std::signbit( y );
+}
+
+template< typename real_t >
+bool same_result( std::complex< real_t > x, std::complex< real_t > y )
+{
+    bool nan_x = std::isnan( real( x ) ) || std::isnan( imag( x ) );
+    bool nan_y = std::isnan( real( y ) ) || std::isnan( imag( y ) );
+    bool inf_x = std::isinf( real( x ) ) || std::isinf( imag( x ) );
+    bool inf_y = std::isinf( real( y ) ) || std::isinf( imag( y ) );
+    if (nan_x || nan_y)
+        return (nan_x || inf_x) && (nan_y || inf_y);
+    return x == y;
+}
+
+// -----------------------------------------------------------------------------
+// Compares Method::Lapack with the given method, usually Method::Native.
+// Besides cfrom = alpha, cto = beta, which is timed, checks cfrom, cto pairs
+// where lascl applies several multipliers (smlnum or bignum, then cto/cfrom)
+// to avoid over- or underflow, and the cases where cfrom is inf or
+// cto is 0 or inf, which apply only one multiplier.
+// Scaling reads and writes each scaled entry once,
+// so bandwidth counts 2 entries per scaled entry.
+template< typename scalar_t >
+void test_lascl_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::MatrixType matrixtype = params.matrixtype();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    real_t cfrom = params.alpha();
+    real_t cto = params.beta();
+    lapack::Method method = params.method();
+    int64_t threads = params.threads();
+    int64_t align = params.align();
+    lapack::Simd simd = params.simd();  // for native method
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gbytes();
+    params.ref_gbytes();
+
+    if (! run)
+        return;
+
+    // Band types use a different storage; native lascl calls LAPACK for them.
+    if (matrixtype != lapack::MatrixType::General
+        && matrixtype != lapack::MatrixType::Lower
+        && matrixtype != lapack::MatrixType::Upper
+        && matrixtype != lapack::MatrixType::Hessenberg) {
+        params.msg() = "skipping: only matrixtype g, l, u, h supported";
+        return;
+    }
+
+    if (! lapack::simd_supported( simd )) {
+        params.msg() = std::string( "skipping: " ) + lapack::simd2str( simd )
+                     + " not supported";
+        return;
+    }
+    SimdScope simd_scope( simd );
+
+    // With threads > 0, run on that many threads, e.g., for scaling.
+    lapack::ThreadScope thread_scope( threads );
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    A_tst = A;
+    A_ref = A;
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::lascl( matrixtype, 0, 0, cfrom, cto, m, n,
+                                      &A_tst[0], lda, method );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::lascl returned error %lld\n", llong( info_tst ) );
+    }
+
+    // entries in the upper or lower trapezoid, Hessenberg, or all entries
+    double entries = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        if (matrixtype == lapack::MatrixType::Upper)
+            entries += blas::min( j + 1, m );
+        else if (matrixtype == lapack::MatrixType::Hessenberg)
+            entries += blas::min( j + 2, m );
+        else if (matrixtype == lapack::MatrixType::Lower)
+            entries += blas::max( 0, m - j );
+        else
+            entries += m;
+    }
+    double gbyte = 2. * entries * sizeof( scalar_t ) * 1e-9;
+    params.time() = time;
+    params.gbytes() = gbyte / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::lascl( matrixtype, 0, 0, cfrom, cto, m, n,
+                                          &A_ref[0], lda, lapack::Method::Lapack );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::lascl returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gbytes() = gbyte / time;
+
+        // ---------- check over/underflow cases
+        const real_t smlnum = std::numeric_limits< real_t >::min();
+        const real_t bignum = 1 / smlnum;
+        const real_t inf = std::numeric_limits< real_t >::infinity();
+        const real_t eps = std::numeric_limits< real_t >::epsilon();
+        struct { real_t cfrom, cto; } cases[] = {
+            { cfrom,          cto            },
+            { 0.5,            bignum         },  // bignum, then ratio
+            { -0.5,           bignum         },
+            { bignum,         0.5            },  // smlnum, then ratio
+            { bignum,         -0.5           },
+            { smlnum * eps,   bignum         },  // several bignum multipliers
+            { bignum,         smlnum * eps   },  // several smlnum multipliers
+            { -bignum,        smlnum         },  // negative cfrom
+            { smlnum,         -bignum        },  // negative cto
+            { 3,              0              },  // cto = 0
+            { -3,             -0.            },  // cto = -0
+            { inf,            2              },  // cfrom = inf
+            { -inf,           2              },
+            { 2,              inf            },  // cto = inf
+            { inf,            inf            },  // NaN
+        };
+
+        // ---------- check error compared to reference
+        // Count entries that differ, including the timed case above.
+        int64_t errors = 0;
+        bool first = true;
+        for (auto const& c : cases) {
+            if (! first) {
+                A_tst = A;
+                A_ref = A;
+                lapack::lascl( matrixtype, 0, 0, c.cfrom, c.cto, m, n,
+                               &A_tst[0], lda, method );
+                lapack::lascl( matrixtype, 0, 0, c.cfrom, c.cto, m, n,
+                               &A_ref[0], lda, lapack::Method::Lapack );
+            }
+            first = false;
+
+            int64_t errors_c = 0;
+            for (size_t i = 0; i < size_A; ++i) {
+                if (! same_result( A_tst[ i ], A_ref[ i ] ))
+                    errors_c += 1;
+            }
+            if (errors_c > 0 && params.verbose() >= 1) {
+                printf( "cfrom %.4e, cto %.4e: %lld entries differ\n",
+                        double( c.cfrom ), double( c.cto ), llong( errors_c ) );
+            }
+            errors += errors_c;
+        }
+        params.error() = errors;
+        params.okay() = (errors == 0);  // expect lapackpp == lapack
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_lascl( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_lascl_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_lascl_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_lascl_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_lascl_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
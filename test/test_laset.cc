@@ -13,6 +13,8 @@
 #include <vector>
 
 // -----------------------------------------------------------------------------
+// laset writes each set entry once,
+// so bandwidth counts 1 entry per set entry.
 template< typename scalar_t >
 void test_laset_work( Params& params, bool run )
 {
@@ -24,17 +26,30 @@ void test_laset_work( Params& params, bool run )
     int64_t n = params.dim.n();
     scalar_t alpha = params.alpha();
     scalar_t beta = params.beta();
+    lapack::Method method = params.method();
+    int64_t threads = params.threads();
     int64_t align = params.align();
+    lapack::Simd simd = params.simd();  // for native method
     params.matrix.mark();
 
     // mark non-standard output values
     params.ref_time();
-    //params.ref_gflops();
-    //params.gflops();
+    params.gbytes();
+    params.ref_gbytes();
 
     if (! run)
         return;
 
+    if (! lapack::simd_supported( simd )) {
+        params.msg() = std::string( "skipping: " ) + lapack::simd2str( simd )
+                     + " not supported";
+        return;
+    }
+    SimdScope simd_scope( simd );
+
+    // With threads > 0, run on that many threads, e.g., for scaling.
+    lapack::ThreadScope thread_scope( threads );
+
     // ---------- setup
     int64_t lda = roundup( blas::max( 1, m ), align );
     size_t size_A = (size_t) lda * n;
@@ -48,12 +63,22 @@ void test_laset_work( Params& params, bool run )
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    lapack::laset( matrixtype, m, n, alpha, beta, &A_tst[0], lda );
+    lapack::laset( matrixtype, m, n, alpha, beta, &A_tst[0], lda, method );
     time = testsweeper::get_wtime() - time;
 
+    // entries in the upper or lower trapezoid, or all entries
+    double entries = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        if (matrixtype == lapack::MatrixType::Upper)
+            entries += blas::min( j + 1, m );
+        else if (matrixtype == lapack::MatrixType::Lower)
+            entries += blas::max( 0, m - j );
+        else
+            entries += m;
+    }
+    double gbyte = 1. * entries * sizeof( scalar_t ) * 1e-9;
     params.time() = time;
-    //double gflop = lapack::Gflop< scalar_t >::laset( m, n, alpha, beta );
-    //params.gflops() = gflop / time;
+    params.gbytes() = gbyte / time;
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
@@ -66,7 +91,7 @@ void test_laset_work( Params& params, bool run )
         }
 
         params.ref_time() = time;
-        //params.ref_gflops() = gflop / time;
+        params.ref_gbytes() = gbyte / time;
 
         // ---------- check error compared to reference
         real_t error = 0;
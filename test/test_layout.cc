@@ -0,0 +1,917 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// Tests layout-aware overloads. The reference is what a row-major caller
+// would otherwise do: transpose into a column-major copy, call the
+// column-major routine, and transpose back; ref time includes the copies.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+
+#include <vector>
+
+using blas::Layout;
+using blas::Op;
+
+// -----------------------------------------------------------------------------
+// @return index of element (i, j) in the given layout.
+inline int64_t idx( Layout layout, int64_t i, int64_t j, int64_t ld )
+{
+    return layout == Layout::ColMajor ? i + j*ld : i*ld + j;
+}
+
+// @return leading dimension of an m-by-n matrix in the given layout.
+inline int64_t ld_layout( Layout layout, int64_t m, int64_t n, int64_t align )
+{
+    return roundup( blas::max( 1, layout == Layout::ColMajor ? m : n ), align );
+}
+
+// Copies m-by-n column-major A to B in the given layout.
+template <typename scalar_t>
+void copy_to_layout(
+    Layout layout, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda, scalar_t* B, int64_t ldb )
+{
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            B[ idx( layout, i, j, ldb ) ] = A[ i + j*lda ];
+}
+
+// Copies m-by-n B in the given layout to column-major A.
+template <typename scalar_t>
+void copy_from_layout(
+    Layout layout, int64_t m, int64_t n,
+    scalar_t const* B, int64_t ldb, scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            A[ i + j*lda ] = B[ idx( layout, i, j, ldb ) ];
+}
+
+// @return Frobenius norm of m-by-n A in the given layout.
+template <typename scalar_t>
+blas::real_type< scalar_t > norm_fro(
+    Layout layout, int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+{
+    if (layout == Layout::RowMajor)
+        std::swap( m, n );
+    return lapack::lange( lapack::Norm::Fro, m, n, A, lda );
+}
+
+// @return || I - Q^H Q ||_F / n for m-by-n Q in the given layout,
+// or || I - Q Q^H ||_F / m if rows is true.
+template <typename scalar_t>
+blas::real_type< scalar_t > ortho_error(
+    Layout layout, int64_t m, int64_t n, scalar_t const* Q, int64_t ldq,
+    bool rows )
+{
+    int64_t k = rows ? m : n;
+    std::vector< scalar_t > I( blas::max( 1, k*k ) );
+    lapack::laset( lapack::MatrixType::General, k, k, 0.0, 1.0, &I[0], k );
+    if (rows) {
+        blas::gemm( layout, Op::NoTrans, Op::ConjTrans, k, k, n,
+                    -1.0, Q, ldq, Q, ldq, 1.0, &I[0], k );
+    }
+    else {
+        blas::gemm( layout, Op::ConjTrans, Op::NoTrans, k, k, m,
+                    -1.0, Q, ldq, Q, ldq, 1.0, &I[0], k );
+    }
+    return norm_fro( layout, k, k, &I[0], k ) / blas::max( 1, k );
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesv_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = ld_layout( layout, n, n, align );
+    int64_t ldb = ld_layout( layout, n, nrhs, align );
+    int64_t ldc = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * (layout == Layout::ColMajor ? nrhs : n);
+    size_t size_C = (size_t) ldc * blas::max( n, nrhs );
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > C( size_C );
+    std::vector< int64_t > ipiv_tst( blas::max( 1, n ) );
+    std::vector< int64_t > ipiv_ref( blas::max( 1, n ) );
+
+    lapack::generate_matrix( params.matrix, n, n, &C[0], ldc );
+    copy_to_layout( layout, n, n, &C[0], ldc, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C.size(), &C[0] );
+    copy_to_layout( layout, n, nrhs, &C[0], ldc, &B_tst[0], ldb );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        int64_t ldb_bad = (layout == Layout::ColMajor ? n : nrhs) - 1;
+        assert_throw( lapack::gesv( Layout(0), n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,   -1, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,    n,   -1, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,    n, nrhs, &A_tst[0], n-1, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout,    n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb_bad ), lapack::Error );
+    }
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // ---------- run test
+    // NoTrans uses gesv; others use getrf and getrs.
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst;
+    if (trans == Op::NoTrans) {
+        info_tst = lapack::gesv( layout, n, nrhs, &A_tst[0], lda,
+                                 &ipiv_tst[0], &B_tst[0], ldb );
+    }
+    else {
+        info_tst = lapack::getrf( layout, n, n, &A_tst[0], lda, &ipiv_tst[0] );
+        lapack::getrs( layout, trans, n, nrhs, &A_tst[0], lda, &ipiv_tst[0],
+                       &B_tst[0], ldb );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesv returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - op(A) x|| / (n * ||A|| * ||x||).
+        real_t Anorm = norm_fro( layout, n, n, &A_ref[0], lda );
+        real_t Xnorm = norm_fro( layout, n, nrhs, &B_tst[0], ldb );
+        std::vector< scalar_t > R = B_ref;
+        blas::gemm( layout, trans, Op::NoTrans, n, nrhs, n,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &R[0], ldb );
+        real_t error = norm_fro( layout, n, nrhs, &R[0], ldb );
+        if (n > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: transpose, column-major solve, transpose
+        std::vector< scalar_t > Ac( (size_t) ldc * n );
+        std::vector< scalar_t > Bc( (size_t) ldc * nrhs );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        copy_from_layout( layout, n, n, &A_ref[0], lda, &Ac[0], ldc );
+        copy_from_layout( layout, n, nrhs, &B_ref[0], ldb, &Bc[0], ldc );
+        int64_t info_ref = lapack::getrf( n, n, &Ac[0], ldc, &ipiv_ref[0] );
+        lapack::getrs( trans, n, nrhs, &Ac[0], ldc, &ipiv_ref[0], &Bc[0], ldc );
+        copy_to_layout( layout, n, n, &Ac[0], ldc, &A_ref[0], lda );
+        copy_to_layout( layout, n, nrhs, &Bc[0], ldc, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_posv_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = ld_layout( layout, n, n, align );
+    int64_t ldb = ld_layout( layout, n, nrhs, align );
+    int64_t ldc = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * (layout == Layout::ColMajor ? nrhs : n);
+    size_t size_C = (size_t) ldc * blas::max( n, nrhs );
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > C( size_C );
+
+    lapack::generate_matrix( params.matrix, n, n, &C[0], ldc );
+    copy_to_layout( layout, n, n, &C[0], ldc, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C.size(), &C[0] );
+    copy_to_layout( layout, n, nrhs, &C[0], ldc, &B_tst[0], ldb );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        int64_t ldb_bad = (layout == Layout::ColMajor ? n : nrhs) - 1;
+        assert_throw( lapack::posv( Layout(0), uplo,    n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    Uplo(0), n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,   -1, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,    n,   -1, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,    n, nrhs, &A_tst[0], n-1, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout,    uplo,    n, nrhs, &A_tst[0], lda, &B_tst[0], ldb_bad ), lapack::Error );
+    }
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::posv( layout, uplo, n, nrhs, &A_tst[0], lda,
+                                     &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        real_t Xnorm = norm_fro( layout, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lanhe( lapack::Norm::Fro, uplo, n, &A_ref[0], lda );
+        std::vector< scalar_t > R = B_ref;
+        blas::hemm( layout, blas::Side::Left, uplo, n, nrhs,
+                    -1.0, &A_ref[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &R[0], ldb );
+        real_t error = norm_fro( layout, n, nrhs, &R[0], ldb );
+        if (n > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: transpose, column-major solve, transpose
+        std::vector< scalar_t > Ac( (size_t) ldc * n );
+        std::vector< scalar_t > Bc( (size_t) ldc * nrhs );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        copy_from_layout( layout, n, n, &A_ref[0], lda, &Ac[0], ldc );
+        copy_from_layout( layout, n, nrhs, &B_ref[0], ldb, &Bc[0], ldc );
+        int64_t info_ref = lapack::posv( uplo, n, nrhs, &Ac[0], ldc, &Bc[0], ldc );
+        copy_to_layout( layout, n, n, &Ac[0], ldc, &A_ref[0], lda );
+        copy_to_layout( layout, n, nrhs, &Bc[0], ldc, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tests geqrf and ungqr, or if lq is true, gelqf and unglq.
+template< typename scalar_t >
+void test_geqrf_layout_work( Params& params, bool run, bool lq )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.ortho();
+    params.ref_time();
+    params.ref_gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // QR: A (m-by-n) = Q (m-by-k) R (k-by-n);
+    // LQ: A (m-by-n) = L (m-by-k) Q (k-by-n).
+    int64_t k = blas::min( m, n );
+    int64_t lda = ld_layout( layout, m, n, align );
+    int64_t ldc = roundup( blas::max( 1, m ), align );
+    int64_t mq = lq ? k : m;
+    int64_t nq = lq ? n : k;
+    int64_t mr = lq ? m : k;
+    int64_t nr = lq ? k : n;
+    int64_t ldq = ld_layout( layout, mq, nq, align );
+    int64_t ldr = ld_layout( layout, mr, nr, align );
+    size_t size_A = (size_t) lda * (layout == Layout::ColMajor ? n : m);
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > tau_tst( k );
+    std::vector< scalar_t > tau_ref( k );
+    std::vector< scalar_t > C( (size_t) ldc * n );
+
+    lapack::generate_matrix( params.matrix, m, n, &C[0], ldc );
+    copy_to_layout( layout, m, n, &C[0], ldc, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqrf( Layout(0), m, n, &A_tst[0], lda, &tau_tst[0] ), lapack::Error );
+        assert_throw( lapack::gelqf( Layout(0), m, n, &A_tst[0], lda, &tau_tst[0] ), lapack::Error );
+    }
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lq
+        ? lapack::gelqf( layout, m, n, &A_tst[0], lda, &tau_tst[0] )
+        : lapack::geqrf( layout, m, n, &A_tst[0], lda, &tau_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lq ? lapack::Gflop< scalar_t >::gelqf( m, n )
+                      : lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Split A_tst into the triangle (R or L) and reflectors,
+        // generate Q, and check || A - QR || / (max(m, n) ||A||)
+        // or || A - LQ || / (max(m, n) ||A||), and orthogonality of Q.
+        std::vector< scalar_t > Q( (size_t) ldq * (layout == Layout::ColMajor ? nq : mq) );
+        std::vector< scalar_t > R( (size_t) ldr * (layout == Layout::ColMajor ? nr : mr) );
+        for (int64_t j = 0; j < nq; ++j)
+            for (int64_t i = 0; i < mq; ++i)
+                Q[ idx( layout, i, j, ldq ) ] = A_tst[ idx( layout, i, j, lda ) ];
+        for (int64_t j = 0; j < nr; ++j) {
+            for (int64_t i = 0; i < mr; ++i) {
+                bool in_tri = lq ? (i >= j) : (i <= j);
+                R[ idx( layout, i, j, ldr ) ]
+                    = in_tri ? A_tst[ idx( layout, i, j, lda ) ] : scalar_t( 0 );
+            }
+        }
+        if (lq)
+            lapack::unglq( layout, mq, nq, k, &Q[0], ldq, &tau_tst[0] );
+        else
+            lapack::ungqr( layout, mq, nq, k, &Q[0], ldq, &tau_tst[0] );
+
+        real_t Anorm = norm_fro( layout, m, n, &A_ref[0], lda );
+        std::vector< scalar_t > E = A_ref;
+        if (lq) {
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans, m, n, k,
+                        -1.0, &R[0], ldr, &Q[0], ldq, 1.0, &E[0], lda );
+        }
+        else {
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans, m, n, k,
+                        -1.0, &Q[0], ldq, &R[0], ldr, 1.0, &E[0], lda );
+        }
+        real_t error = norm_fro( layout, m, n, &E[0], lda );
+        if (Anorm != 0)
+            error /= (blas::max( m, n ) * Anorm);
+        params.error() = error;
+        params.ortho() = ortho_error( layout, mq, nq, &Q[0], ldq, lq );
+        params.okay() = (error < tol && params.ortho() < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: transpose, column-major QR, transpose
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        copy_from_layout( layout, m, n, &A_ref[0], lda, &C[0], ldc );
+        int64_t info_ref = lq
+            ? lapack::gelqf( m, n, &C[0], ldc, &tau_ref[0] )
+            : lapack::geqrf( m, n, &C[0], ldc, &tau_ref[0] );
+        copy_to_layout( layout, m, n, &C[0], ldc, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_heev_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ortho();
+    params.error2();
+    params.error2.name( "W error" );
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = ld_layout( layout, n, n, align );
+    int64_t ldc = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > W_tst( n );
+    std::vector< real_t > W_ref( n );
+    std::vector< scalar_t > C( (size_t) ldc * n );
+
+    // Make C Hermitian, so the full A is available for checking.
+    using blas::conj;
+    lapack::generate_matrix( params.matrix, n, n, &C[0], ldc );
+    for (int64_t j = 0; j < n; ++j) {
+        C[ j + j*ldc ] = blas::real( C[ j + j*ldc ] );
+        for (int64_t i = j + 1; i < n; ++i)
+            C[ j + i*ldc ] = conj( C[ i + j*ldc ] );
+    }
+    copy_to_layout( layout, n, n, &C[0], ldc, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::heev( Layout(0), jobz, uplo, n, &A_tst[0], lda, &W_tst[0] ), lapack::Error );
+    }
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::heev( layout, jobz, uplo, n, &A_tst[0], lda,
+                                     &W_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::heev returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "Z = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "W = " ); print_vector( n, &W_tst[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Compare eigenvalues to column-major heev;
+        // with vectors, check || A Z - Z W || / (n ||A||) and || I - Z^H Z ||.
+        lapack::heev( lapack::Job::NoVec, lapack::Uplo::Lower, n, &C[0], ldc,
+                      &W_ref[0] );
+        real_t Wmax = 0, Werror = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            Wmax = blas::max( Wmax, std::abs( W_ref[ i ] ) );
+            Werror = blas::max( Werror, std::abs( W_tst[ i ] - W_ref[ i ] ) );
+        }
+        if (Wmax != 0)
+            Werror /= (n * Wmax);
+        params.error2() = Werror;
+
+        real_t error = 0;
+        params.ortho() = 0;
+        if (jobz == lapack::Job::Vec) {
+            real_t Anorm = norm_fro( layout, n, n, &A_ref[0], lda );
+            std::vector< scalar_t > E( size_A );
+            std::vector< scalar_t > ZW = A_tst;
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < n; ++i)
+                    ZW[ idx( layout, i, j, lda ) ] *= W_tst[ j ];
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans, n, n, n,
+                        1.0, &A_ref[0], lda, &A_tst[0], lda,
+                        0.0, &E[0], lda );
+            for (size_t i = 0; i < E.size(); ++i)
+                E[ i ] -= ZW[ i ];
+            error = norm_fro( layout, n, n, &E[0], lda );
+            if (Anorm != 0)
+                error /= (n * Anorm);
+            params.ortho() = ortho_error( layout, n, n, &A_tst[0], lda, false );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && params.ortho() < tol && Werror < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: transpose, column-major heev, transpose
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        copy_from_layout( layout, n, n, &A_ref[0], lda, &C[0], ldc );
+        int64_t info_ref = lapack::heev( jobz, uplo, n, &C[0], ldc, &W_ref[0] );
+        copy_to_layout( layout, n, n, &C[0], ldc, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::heev returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesvd_layout_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    Layout layout = params.layout();
+    Job jobu = params.jobu();
+    Job jobvt = params.jobvt();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "S error" );
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    if (jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec) {
+        params.msg() = "skipping: jobu and jobvt can't both be o";
+        return;
+    }
+
+    // ---------- setup
+    int64_t k = blas::min( m, n );
+    int64_t ucol = (jobu == Job::AllVec ? m : k);
+    int64_t vrow = (jobvt == Job::AllVec ? n : k);
+    int64_t lda = ld_layout( layout, m, n, align );
+    int64_t ldu = ld_layout( layout, m, ucol, align );
+    int64_t ldvt = ld_layout( layout, vrow, n, align );
+    int64_t ldc = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * (layout == Layout::ColMajor ? n : m);
+    size_t size_U = (size_t) ldu * (layout == Layout::ColMajor ? ucol : m);
+    size_t size_VT = (size_t) ldvt * (layout == Layout::ColMajor ? n : vrow);
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > U( std::max< size_t >( 1, size_U ) );
+    std::vector< scalar_t > VT( std::max< size_t >( 1, size_VT ) );
+    std::vector< real_t > S_tst( k );
+    std::vector< real_t > S_ref( k );
+    std::vector< scalar_t > C( (size_t) ldc * n );
+
+    lapack::generate_matrix( params.matrix, m, n, &C[0], ldc );
+    copy_to_layout( layout, m, n, &C[0], ldc, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesvd( Layout(0), jobu, jobvt, m, n, &A_tst[0], lda, &S_tst[0], &U[0], ldu, &VT[0], ldvt ), lapack::Error );
+    }
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gesvd( layout, jobu, jobvt, m, n,
+                                      &A_tst[0], lda, &S_tst[0],
+                                      &U[0], ldu, &VT[0], ldvt );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Compare singular values to column-major gesvd;
+        // with both U and VT, check || A - U S V^H || / (max(m, n) ||A||)
+        // and orthogonality of U and VT.
+        lapack::gesvd( Job::NoVec, Job::NoVec, m, n, &C[0], ldc, &S_ref[0],
+                       &U[0], 1, &VT[0], 1 );
+        real_t Serror = 0;
+        for (int64_t i = 0; i < k; ++i)
+            Serror = blas::max( Serror, std::abs( S_tst[ i ] - S_ref[ i ] ) );
+        if (k > 0 && S_ref[ 0 ] != 0)
+            Serror /= S_ref[ 0 ];
+        params.error2() = Serror;
+
+        // U and VT are in A with OverwriteVec.
+        scalar_t* Up = &U[0];
+        scalar_t* VTp = &VT[0];
+        int64_t ldu_ = ldu, ldvt_ = ldvt;
+        if (jobu == Job::OverwriteVec) {
+            Up = &A_tst[0];
+            ldu_ = lda;
+        }
+        if (jobvt == Job::OverwriteVec) {
+            VTp = &A_tst[0];
+            ldvt_ = lda;
+        }
+
+        real_t error = 0;
+        params.ortho_U() = 0;
+        params.ortho_V() = 0;
+        if (jobu != Job::NoVec) {
+            params.ortho_U() = ortho_error( layout, m, k, Up, ldu_, false );
+        }
+        if (jobvt != Job::NoVec) {
+            params.ortho_V() = ortho_error( layout, k, n, VTp, ldvt_, true );
+        }
+        if (jobu != Job::NoVec && jobvt != Job::NoVec) {
+            real_t Anorm = norm_fro( layout, m, n, &A_ref[0], lda );
+            int64_t ldus = ld_layout( layout, m, k, align );
+            std::vector< scalar_t > US( (size_t) ldus * (layout == Layout::ColMajor ? k : m) );
+            for (int64_t j = 0; j < k; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    US[ idx( layout, i, j, ldus ) ]
+                        = Up[ idx( layout, i, j, ldu_ ) ] * S_tst[ j ];
+            blas::gemm( layout, Op::NoTrans, Op::NoTrans, m, n, k,
+                        -1.0, &US[0], ldus, VTp, ldvt_, 1.0, &A_ref[0], lda );
+            error = norm_fro( layout, m, n, &A_ref[0], lda );
+            if (Anorm != 0)
+                error /= (blas::max( m, n ) * Anorm);
+        }
+        params.error() = error;
+        params.okay() = (error < tol && Serror < tol
+                         && params.ortho_U() < tol && params.ortho_V() < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: transpose, column-major gesvd, transpose
+        int64_t ldu_c = roundup( blas::max( 1, m ), align );
+        int64_t ldvt_c = roundup( blas::max( 1, vrow ), align );
+        std::vector< scalar_t > Uc( (size_t) ldu_c * ucol );
+        std::vector< scalar_t > VTc( (size_t) ldvt_c * n );
+        lapack::generate_matrix( params.matrix, m, n, &C[0], ldc );
+        copy_to_layout( layout, m, n, &C[0], ldc, &A_ref[0], lda );
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        copy_from_layout( layout, m, n, &A_ref[0], lda, &C[0], ldc );
+        int64_t info_ref = lapack::gesvd( jobu, jobvt, m, n, &C[0], ldc,
+                                          &S_ref[0], &Uc[0], ldu_c,
+                                          &VTc[0], ldvt_c );
+        copy_to_layout( layout, m, n, &C[0], ldc, &A_ref[0], lda );
+        if (jobu == Job::SomeVec || jobu == Job::AllVec)
+            copy_to_layout( layout, m, ucol, &Uc[0], ldu_c, &U[0], ldu );
+        if (jobvt == Job::SomeVec || jobvt == Job::AllVec)
+            copy_to_layout( layout, vrow, n, &VTc[0], ldvt_c, &VT[0], ldvt );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesv_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesv_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesv_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesv_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_layout_dispatch( Params& params, bool run, bool lq )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_layout_work< float >( params, run, lq );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_layout_work< double >( params, run, lq );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_layout_work< std::complex<float> >( params, run, lq );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_layout_work< std::complex<double> >( params, run, lq );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_layout( Params& params, bool run )
+{
+    test_geqrf_layout_dispatch( params, run, false );
+}
+
+// -----------------------------------------------------------------------------
+void test_gelqf_layout( Params& params, bool run )
+{
+    test_geqrf_layout_dispatch( params, run, true );
+}
+
+// -----------------------------------------------------------------------------
+void test_heev_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_heev_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heev_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heev_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heev_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesvd_layout( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesvd_layout_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesvd_layout_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesvd_layout_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesvd_layout_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
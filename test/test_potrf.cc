@@ -20,6 +20,7 @@ void test_potrf_work( Params& params, bool run )
 
     // get & mark input values
     lapack::Uplo uplo = params.uplo();
+    lapack::Method method = params.method();
     int64_t n = params.dim.n();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
@@ -63,12 +64,13 @@ void test_potrf_work( Params& params, bool run )
         assert_throw( lapack::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf( uplo,     n, &A_tst[0], lda, lapack::Method(0) ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda );
+    int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda, method );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
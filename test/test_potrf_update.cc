@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests potrf_update (downdate = false) and potrf_downdate (downdate = true).
+// Factors A0, then updates by X to get the factor of A0 + X X^H; or
+// factors A0 + X X^H, then downdates by X to get the factor of A0.
+// Checks the backward error || F^H F - A || / (n ||A||) of the result F,
+// and compares it to refactoring A with potrf, which is the reference.
+template< typename scalar_t >
+void test_potrf_update_work( Params& params, bool run, bool downdate )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Uplo;
+    using blas::Op;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.error2.name( "F-Fref" );
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_X = (size_t) ldx * k;
+
+    std::vector< scalar_t > A0( size_A );
+    std::vector< scalar_t > A1( size_A );
+    std::vector< scalar_t > X( size_X );
+
+    lapack::generate_matrix( params.matrix, n, n, &A0[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, X.size(), &X[0] );
+
+    // A1 = A0 + X X^H
+    A1 = A0;
+    blas::herk( blas::Layout::ColMajor, uplo, Op::NoTrans, n, k,
+                1.0, &X[0], ldx, 1.0, &A1[0], lda );
+
+    // Update from A0 to A1, or downdate from A1 to A0.
+    std::vector< scalar_t >& A_in  = downdate ? A1 : A0;
+    std::vector< scalar_t >& A_out = downdate ? A0 : A1;
+
+    std::vector< scalar_t > F_tst = A_in;
+    int64_t info = lapack::potrf( uplo, n, &F_tst[0], lda );
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info ) );
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, k=%5lld, lda=%5lld, ldx=%5lld\n",
+                llong( n ), llong( k ), llong( lda ), llong( ldx ) );
+    }
+    if (verbose >= 2) {
+        printf( "F = " ); print_matrix( n, n, &F_tst[0], lda );
+        printf( "X = " ); print_matrix( n, k, &X[0], ldx );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        auto func = [downdate]( Uplo uplo_, int64_t n_, int64_t k_,
+                                scalar_t* A_, int64_t lda_,
+                                scalar_t const* X_, int64_t ldx_ ) {
+            return downdate
+                ? lapack::potrf_downdate( uplo_, n_, k_, A_, lda_, X_, ldx_ )
+                : lapack::potrf_update(   uplo_, n_, k_, A_, lda_, X_, ldx_ );
+        };
+        assert_throw( func( Uplo(0), n,  k, &F_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( func( uplo,   -1,  k, &F_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( func( uplo,    n, -1, &F_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( func( uplo,    n,  k, &F_tst[0], n-1, &X[0], ldx ), lapack::Error );
+        assert_throw( func( uplo,    n,  k, &F_tst[0], lda, &X[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    if (downdate)
+        info = lapack::potrf_downdate( uplo, n, k, &F_tst[0], lda, &X[0], ldx );
+    else
+        info = lapack::potrf_update( uplo, n, k, &F_tst[0], lda, &X[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf_%s returned error %lld\n",
+                 downdate ? "downdate" : "update", llong( info ) );
+    }
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "F_out = " ); print_matrix( n, n, &F_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Zero the other triangle, then R = F^H F - A_out for Upper,
+        // or F F^H - A_out for Lower, in the uplo triangle.
+        if (n > 0) {
+            if (uplo == Uplo::Upper)
+                lapack::laset( lapack::MatrixType::Lower, n-1, n-1,
+                               0.0, 0.0, &F_tst[1], lda );
+            else
+                lapack::laset( lapack::MatrixType::Upper, n-1, n-1,
+                               0.0, 0.0, &F_tst[lda], lda );
+        }
+
+        std::vector< scalar_t > R = A_out;
+        blas::herk( blas::Layout::ColMajor, uplo,
+                    (uplo == Uplo::Upper ? Op::ConjTrans : Op::NoTrans),
+                    n, n, 1.0, &F_tst[0], lda, -1.0, &R[0], lda );
+
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_out[0], lda );
+        real_t error = lapack::lanhe( lapack::Norm::One, uplo, n, &R[0], lda );
+        error /= (n * Anorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > F_ref = A_out;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_potrf( uplo2char(uplo), n, &F_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_potrf returned error %lld\n", llong( info_ref ) );
+        }
+        params.ref_time() = time;
+
+        if (verbose >= 2) {
+            printf( "F_ref = " ); print_matrix( n, n, &F_ref[0], lda );
+        }
+
+        // ---------- check difference from refactoring
+        if (params.check() == 'y') {
+            real_t Fnorm = lapack::lantr( lapack::Norm::One, uplo,
+                                          lapack::Diag::NonUnit, n, n,
+                                          &F_ref[0], lda );
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < n; ++i)
+                    F_ref[ i + j*lda ] -= F_tst[ i + j*lda ];
+            real_t error2 = lapack::lantr( lapack::Norm::One, uplo,
+                                           lapack::Diag::NonUnit, n, n,
+                                           &F_ref[0], lda );
+            error2 /= Fnorm;
+            params.error2() = error2;
+            // Forward error depends on conditioning; this loose bound holds
+            // for the default diagonally dominant matrices.
+            params.okay() = params.okay() && (error2 < n * tol);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run, false );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run, false );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run, false );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run, false );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_downdate( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run, true );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run, true );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run, true );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run, true );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrs_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A( size_A * batch );
+    std::vector< scalar_t > LL( size_A * batch );
+    std::vector< scalar_t > B_tst( size_B * batch );
+    std::vector< scalar_t > B_ref( size_B * batch );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_ref( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A[ i*size_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n"
+                "batch=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ),
+                llong( batch ) );
+    }
+
+    // factor A into LL^H or U^H U
+    LL = A;
+    lapack::potrf_batch_strided( uplo, n, &LL[0], lda, size_A,
+                                 batch, &info_tst[0] );
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::potrf_batch_strided returned error %lld for problem %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+            break;
+        }
+    }
+
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< scalar_t* > Barray( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = &LL[ i*size_A ];
+        Barray[ i ] = &B_tst[ i*size_B ];
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrs_batch( { Uplo(0) }, {  n }, { nrhs }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrs_batch( { uplo },    { -1 }, { nrhs }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrs_batch( { uplo },    {  n }, {   -1 }, Aarray, { lda }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrs_batch( { uplo },    {  n }, { nrhs }, Aarray, { n-1 }, Barray, { ldb }, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrs_batch( { uplo },    {  n }, { nrhs }, Aarray, { lda }, Barray, { n-1 }, batch, info_tst ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::potrs_batch( { uplo }, { n }, { nrhs }, Aarray, { lda },
+                         Barray, { ldb }, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrs( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over batch of relative backwards error
+        // = ||b - Ax|| / (n * ||A|| * ||x||).
+        std::vector< scalar_t > R( B_ref );
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* A_i = &A[ i*size_A ];
+            scalar_t* X_i = &B_tst[ i*size_B ];
+            scalar_t* R_i = &R[ i*size_B ];
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -one, A_i, lda,
+                              X_i, ldb,
+                        one,  R_i, ldb );
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, R_i, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X_i, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, A_i, lda );
+            error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+
+        // strided version should match pointer-array version
+        std::vector< scalar_t > B_str( B_ref );
+        std::vector< int64_t > info_str( batch );
+        lapack::potrs_batch_strided( uplo, n, nrhs, &LL[0], lda, size_A,
+                                     &B_str[0], ldb, size_B,
+                                     batch, &info_str[0] );
+        error += rel_error( B_str, B_tst );
+
+        // interleaved version should match up to rounding
+        std::vector< scalar_t > LL_int( size_A * batch );
+        std::vector< scalar_t > B_int( size_B * batch );
+        to_interleaved( lda, n, batch, &LL[0], &LL_int[0] );
+        to_interleaved( ldb, nrhs, batch, &B_ref[0], &B_int[0] );
+        lapack::potrs_batch_interleaved( uplo, n, nrhs, &LL_int[0], lda,
+                                         &B_int[0], ldb,
+                                         batch, &info_str[0] );
+        from_interleaved( ldb, nrhs, batch, &B_int[0], &B_str[0] );
+        error += rel_error( B_str, B_tst );
+
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: potrs on one problem at a time
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::potrs( uplo, n, nrhs, &LL[ i*size_A ], lda,
+                                           &B_ref[ i*size_B ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrs_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrs_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrs_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrs_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrs_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,309 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+namespace {
+
+enum class Update { Rank1, InsertRow, DeleteRow, InsertCol, DeleteCol };
+
+const char* update_name( Update update )
+{
+    switch (update) {
+        case Update::Rank1:     return "qr_update";
+        case Update::InsertRow: return "qr_insert_row";
+        case Update::DeleteRow: return "qr_delete_row";
+        case Update::InsertCol: return "qr_insert_col";
+        case Update::DeleteCol: return "qr_delete_col";
+    }
+    return "";
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Tests QR updating. Computes A = QR with geqrf and ungqr, leaving the
+// Householder vectors below R (which the routines do not reference),
+// updates Q and R, and checks || A_new - Q R || / (max( m, n ) ||A_new||)
+// and || I - Q^H Q || / m. The position j of inserted or deleted rows
+// or columns is dim.k(), modulo the valid range. For qr_insert_row and
+// qr_delete_col, also checks that updating R alone gives the same R.
+// The reference is refactoring A_new with geqrf.
+template< typename scalar_t >
+void test_qr_update_work( Params& params, bool run, Update update )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using lapack::MatrixType;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+
+    if (! run)
+        return;
+
+    if ((update == Update::DeleteRow && m == 0) ||
+        (update == Update::DeleteCol && n == 0)) {
+        params.msg() = "skipping: nothing to delete";
+        return;
+    }
+
+    // ---------- setup
+    int64_t j = 0;
+    int64_t m_new = m, n_new = n;
+    switch (update) {
+        case Update::Rank1:     break;
+        case Update::InsertRow: j = k % (m + 1); m_new = m + 1; break;
+        case Update::DeleteRow: j = k % m;       m_new = m - 1; break;
+        case Update::InsertCol: j = k % (n + 1); n_new = n + 1; break;
+        case Update::DeleteCol: j = k % n;       n_new = n - 1; break;
+    }
+
+    // Arrays have room for one more row and column.
+    int64_t lda = roundup( m + 1, align );
+    int64_t ldq = roundup( m + 1, align );
+    int64_t ldr = roundup( m + 1, align );
+    size_t size_A = (size_t) lda * (n + 1);
+    size_t size_Q = (size_t) ldq * (m + 1);
+    size_t size_R = (size_t) ldr * (n + 1);
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_new( size_A );
+    std::vector< scalar_t > Q( size_Q );
+    std::vector< scalar_t > R( size_R );
+    std::vector< scalar_t > tau( blas::max( 1, blas::min( m, n ) ) );
+    std::vector< scalar_t > x( m + n + 1 );
+    std::vector< scalar_t > u( blas::max( 1, m ) );
+    std::vector< scalar_t > v( blas::max( 1, n ) );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, x.size(), &x[0] );
+    lapack::larnv( idist, iseed, u.size(), &u[0] );
+    lapack::larnv( idist, iseed, v.size(), &v[0] );
+
+    // A = QR
+    lapack::lacpy( MatrixType::General, m, n, &A[0], lda, &R[0], ldr );
+    lapack::geqrf( m, n, &R[0], ldr, &tau[0] );
+    lapack::lacpy( MatrixType::Lower, m, blas::min( m, n ), &R[0], ldr, &Q[0], ldq );
+    lapack::ungqr( m, m, blas::min( m, n ), &Q[0], ldq, &tau[0] );
+
+    // A_new
+    for (int64_t jj = 0; jj < n_new; ++jj) {
+        for (int64_t ii = 0; ii < m_new; ++ii) {
+            int64_t i_ = ii, j_ = jj;
+            if (update == Update::InsertRow && ii >= j) i_ = ii - 1;
+            if (update == Update::DeleteRow && ii >= j) i_ = ii + 1;
+            if (update == Update::InsertCol && jj >= j) j_ = jj - 1;
+            if (update == Update::DeleteCol && jj >= j) j_ = jj + 1;
+            scalar_t aij;
+            if (update == Update::InsertRow && ii == j)
+                aij = x[ jj ];
+            else if (update == Update::InsertCol && jj == j)
+                aij = x[ ii ];
+            else
+                aij = A[ i_ + j_*lda ];
+            if (update == Update::Rank1)
+                aij += u[ ii ] * conj( v[ jj ] );
+            A_new[ ii + jj*lda ] = aij;
+        }
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "%s m=%5lld, n=%5lld, j=%5lld, lda=%5lld\n",
+                update_name( update ),
+                llong( m ), llong( n ), llong( j ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+        printf( "A_new = " ); print_matrix( m_new, n_new, &A_new[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::qr_update( -1, n, &Q[0], ldq, &R[0], ldr, &u[0], &v[0] ), lapack::Error );
+        assert_throw( lapack::qr_update( m, n, (scalar_t*) nullptr, ldq, &R[0], ldr, &u[0], &v[0] ), lapack::Error );
+        assert_throw( lapack::qr_insert_row( m, n, &Q[0], ldq, &R[0], ldr, m+1, &x[0] ), lapack::Error );
+        assert_throw( lapack::qr_insert_row( m, n, &Q[0], m, &R[0], ldr, 0, &x[0] ), lapack::Error );
+        assert_throw( lapack::qr_delete_row( 0, n, &Q[0], ldq, &R[0], ldr, 0 ), lapack::Error );
+        assert_throw( lapack::qr_insert_col( m, n, &Q[0], ldq, &R[0], ldr, n+1, &x[0] ), lapack::Error );
+        assert_throw( lapack::qr_delete_col( m, n, &Q[0], ldq, &R[0], ldr, n ), lapack::Error );
+    }
+
+    // R alone, for updates that don't need Q.
+    std::vector< scalar_t > R_only = R;
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    switch (update) {
+        case Update::Rank1:
+            lapack::qr_update( m, n, &Q[0], ldq, &R[0], ldr, &u[0], &v[0] );
+            break;
+        case Update::InsertRow:
+            lapack::qr_insert_row( m, n, &Q[0], ldq, &R[0], ldr, j, &x[0] );
+            break;
+        case Update::DeleteRow:
+            lapack::qr_delete_row( m, n, &Q[0], ldq, &R[0], ldr, j );
+            break;
+        case Update::InsertCol:
+            lapack::qr_insert_col( m, n, &Q[0], ldq, &R[0], ldr, j, &x[0] );
+            break;
+        case Update::DeleteCol:
+            lapack::qr_delete_col( m, n, &Q[0], ldq, &R[0], ldr, j );
+            break;
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (update == Update::InsertRow) {
+        lapack::qr_insert_row( m, n, (scalar_t*) nullptr, ldq,
+                               &R_only[0], ldr, j, &x[0] );
+    }
+    else if (update == Update::DeleteCol) {
+        lapack::qr_delete_col( m, n, (scalar_t*) nullptr, ldq,
+                               &R_only[0], ldr, j );
+    }
+
+    // Zero the unreferenced lower trapezoid of R.
+    if (m_new > 1) {
+        lapack::laset( MatrixType::Lower, m_new - 1, n_new, 0.0, 0.0,
+                       &R[1], ldr );
+    }
+
+    if (verbose >= 2) {
+        printf( "Q_new = " ); print_matrix( m_new, m_new, &Q[0], ldq );
+        printf( "R_new = " ); print_matrix( m_new, n_new, &R[0], ldr );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // || A_new - Q R || / (max( m, n ) ||A_new||)
+        real_t Anorm = lapack::lange( lapack::Norm::One, m_new, n_new,
+                                      &A_new[0], lda );
+        std::vector< scalar_t > E = A_new;
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m_new, n_new, m_new,
+                    -1.0, &Q[0], ldq, &R[0], ldr,
+                     1.0, &E[0], lda );
+        real_t error = lapack::lange( lapack::Norm::One, m_new, n_new,
+                                      &E[0], lda );
+        if (Anorm != 0)
+            error /= Anorm;
+        error /= blas::max( 1, blas::max( m_new, n_new ) );
+
+        // || I - Q^H Q || / m
+        std::vector< scalar_t > I( size_Q );
+        lapack::laset( MatrixType::General, m_new, m_new, 0.0, 1.0,
+                       &I[0], ldq );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper,
+                    blas::Op::ConjTrans, m_new, m_new,
+                    -1.0, &Q[0], ldq, 1.0, &I[0], ldq );
+        real_t ortho = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                      m_new, &I[0], ldq );
+        ortho /= blas::max( 1, m_new );
+
+        // R alone must match exactly.
+        bool same = true;
+        if (update == Update::InsertRow || update == Update::DeleteCol) {
+            for (int64_t jj = 0; jj < n_new; ++jj)
+                for (int64_t ii = 0; ii <= blas::min( jj, m_new - 1 ); ++ii)
+                    same = same && (R_only[ ii + jj*ldr ] == R[ ii + jj*ldr ]);
+            if (! same)
+                params.msg() = "R alone differs";
+        }
+
+        params.error() = error;
+        params.ortho() = ortho;
+        params.okay() = (error < tol) && (ortho < tol) && same;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > tau_ref( blas::max( 1, blas::min( m_new, n_new ) ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_geqrf( m_new, n_new, &A_new[0], lda,
+                                          &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_geqrf returned error %lld\n", llong( info_ref ) );
+        }
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qr_update_dispatch( Params& params, bool run, Update update )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_qr_update_work< float >( params, run, update );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_qr_update_work< double >( params, run, update );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_qr_update_work< std::complex<float> >( params, run, update );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_qr_update_work< std::complex<double> >( params, run, update );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qr_update( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, Update::Rank1 );
+}
+
+void test_qr_insert_row( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, Update::InsertRow );
+}
+
+void test_qr_delete_row( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, Update::DeleteRow );
+}
+
+void test_qr_insert_col( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, Update::InsertCol );
+}
+
+void test_qr_delete_col( Params& params, bool run )
+{
+    test_qr_update_dispatch( params, run, Update::DeleteCol );
+}
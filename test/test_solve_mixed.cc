@@ -0,0 +1,418 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests mixed-precision iterative refinement solvers.
+// If driver is true, tests the LAPACK gesv and posv overloads (dsgesv, dsposv),
+// otherwise lapack::solve_mixed.
+// Reference is the working precision gesv, posv, or hesv.
+template< typename scalar_t >
+void test_solve_mixed_work(
+    Params& params, bool run,
+    lapack::Factorization factorization, bool driver )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Factorization;
+
+    // get & mark input values
+    lapack::Uplo uplo = factorization == Factorization::LU
+                      ? lapack::Uplo::General
+                      : params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.iters();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldx = ldb;
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_ipiv = (size_t) (n);
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > X_tst( size_B );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< lapack_int > ipiv_ref( size_ipiv );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y' && ! driver) {
+        using lapack::Uplo;
+        int64_t iter;
+        assert_throw( lapack::solve_mixed( Factorization(0), uplo, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo, -1, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo,  n,   -1, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo,  n, nrhs, &A_tst[0], n-1, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo,  n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], n-1, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo,  n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], n-1, &iter ), lapack::Error );
+        assert_throw( lapack::solve_mixed( factorization, uplo,  n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter, -1 ), lapack::Error );
+        if (factorization != Factorization::LU) {
+            assert_throw( lapack::solve_mixed( factorization, Uplo(0), n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        }
+    }
+
+    // ---------- run test
+    int64_t iter = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst;
+    if (driver && factorization == Factorization::LU) {
+        info_tst = lapack::gesv(
+            n, nrhs, &A_tst[0], lda, &ipiv_tst[0],
+            &B_tst[0], ldb, &X_tst[0], ldx, &iter );
+    }
+    else if (driver) {
+        info_tst = lapack::posv(
+            uplo, n, nrhs, &A_tst[0], lda,
+            &B_tst[0], ldb, &X_tst[0], ldx, &iter );
+    }
+    else {
+        info_tst = lapack::solve_mixed(
+            factorization, uplo, n, nrhs, &A_tst[0], lda, &ipiv_tst[0],
+            &B_tst[0], ldb, &X_tst[0], ldx, &iter );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::solve_mixed returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    params.iters() = iter;
+    double gflop;
+    if (factorization == Factorization::LU)
+        gflop = lapack::Gflop< scalar_t >::gesv( n, nrhs );
+    else if (factorization == Factorization::Cholesky)
+        gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    else
+        gflop = lapack::Gflop< scalar_t >::hesv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "iter = %lld\n", llong( iter ) );
+        printf( "X = " ); print_matrix( n, nrhs, &X_tst[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        // Refinement should reach working precision, as gesv does.
+        std::vector< scalar_t > R( B_ref );
+        real_t Anorm;
+        if (factorization == Factorization::LU) {
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, &A_ref[0], lda,
+                              &X_tst[0], ldx,
+                         1.0, &R[0], ldb );
+            Anorm = lapack::lange( lapack::Norm::One, n, n, &A_ref[0], lda );
+        }
+        else {
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -1.0, &A_ref[0], lda,
+                              &X_tst[0], ldx,
+                         1.0, &R[0], ldb );
+            Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        }
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, nrhs, &R[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X_tst[0], ldx );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref;
+        if (factorization == Factorization::LU) {
+            info_ref = LAPACKE_gesv(
+                n, nrhs, &A_ref[0], lda, &ipiv_ref[0], &B_ref[0], ldb );
+        }
+        else if (factorization == Factorization::Cholesky) {
+            info_ref = LAPACKE_posv(
+                uplo2char(uplo), n, nrhs, &A_ref[0], lda, &B_ref[0], ldb );
+        }
+        else {
+            info_ref = LAPACKE_hesv(
+                uplo2char(uplo), n, nrhs, &A_ref[0], lda, &ipiv_ref[0],
+                &B_ref[0], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        if (verbose >= 2) {
+            printf( "Xref = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Mixed precision is only for double and complex<double>.
+void test_solve_mixed_dispatch(
+    Params& params, bool run,
+    lapack::Factorization factorization, bool driver )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Double:
+            test_solve_mixed_work< double >(
+                params, run, factorization, driver );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_solve_mixed_work< std::complex<double> >(
+                params, run, factorization, driver );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gesv_mixed( Params& params, bool run )
+{
+    test_solve_mixed_dispatch( params, run, lapack::Factorization::LU, true );
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_mixed( Params& params, bool run )
+{
+    test_solve_mixed_dispatch( params, run, lapack::Factorization::Cholesky, true );
+}
+
+// -----------------------------------------------------------------------------
+void test_solve_mixed_lu( Params& params, bool run )
+{
+    test_solve_mixed_dispatch( params, run, lapack::Factorization::LU, false );
+}
+
+// -----------------------------------------------------------------------------
+void test_solve_mixed_chol( Params& params, bool run )
+{
+    test_solve_mixed_dispatch( params, run, lapack::Factorization::Cholesky, false );
+}
+
+// -----------------------------------------------------------------------------
+void test_solve_mixed_ldlt( Params& params, bool run )
+{
+    test_solve_mixed_dispatch( params, run, lapack::Factorization::LDLT, false );
+}
+
+// -----------------------------------------------------------------------------
+// Overloads to call lag2h or lag2b by type.
+int64_t lag2half( int64_t m, int64_t n, double const* A, int64_t lda,
+                  lapack::float16* H, int64_t ldh )
+{
+    return lapack::lag2h( m, n, A, lda, H, ldh );
+}
+
+int64_t lag2half( int64_t m, int64_t n, double const* A, int64_t lda,
+                  lapack::bfloat16* H, int64_t ldh )
+{
+    return lapack::lag2b( m, n, A, lda, H, ldh );
+}
+
+// -----------------------------------------------------------------------------
+// Tests lapack::solve_mixed with A stored in half_t (float16 or bfloat16),
+// factored by Cholesky, as for a Gram matrix.
+// time2 is solve_mixed with A stored in double;
+// reference is the double precision posv.
+template< typename half_t >
+void test_solve_mixed_half_work( Params& params, bool run )
+{
+    using lapack::Factorization;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    double eps = std::numeric_limits< double >::epsilon();
+    double tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.iters();
+    params.time2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (params.datatype() != testsweeper::DataType::Double) {
+        throw std::runtime_error( "unknown datatype" );
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldx = ldb;
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< double > A_ref( size_A );
+    std::vector< double > A_tst2( size_A );
+    std::vector< half_t > H( size_A );
+    std::vector< double > B( size_B );
+    std::vector< double > B_ref( size_B );
+    std::vector< double > X_tst( size_B );
+    std::vector< double > X_tst2( size_B );
+
+    // The matrix solved is A as stored in half_t, widened exactly to double.
+    lapack::generate_matrix( params.matrix, n, n, &A_ref[0], lda );
+    if (n > 0) {
+        lag2half( n, n, &A_ref[0], lda, &H[0], lda );
+        lapack::lag2d( n, n, &H[0], lda, &A_ref[0], lda );
+    }
+    A_tst2 = A_ref;
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    B_ref = B;
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_ref[0], lda );
+        printf( "B = " ); print_matrix( n, nrhs, &B[0], ldb );
+    }
+
+    // ---------- run test
+    int64_t iter = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::solve_mixed(
+        Factorization::Cholesky, uplo, n, nrhs, &H[0], lda, nullptr,
+        &B[0], ldb, &X_tst[0], ldx, &iter );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::solve_mixed returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    params.iters() = iter;
+    double gflop = lapack::Gflop< double >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    // ---------- run with A stored in double, for comparison
+    int64_t iter2 = 0;
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::solve_mixed(
+        Factorization::Cholesky, uplo, n, nrhs, &A_tst2[0], lda, nullptr,
+        &B[0], ldb, &X_tst2[0], ldx, &iter2 );
+    time = testsweeper::get_wtime() - time;
+    params.time2() = time;
+
+    if (verbose >= 2) {
+        printf( "iter = %lld\n", llong( iter ) );
+        printf( "X = " ); print_matrix( n, nrhs, &X_tst[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        std::vector< double > R( B );
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs,
+                    -1.0, &A_ref[0], lda,
+                          &X_tst[0], ldx,
+                     1.0, &R[0], ldb );
+        double error = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+        double Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X_tst[0], ldx );
+        double Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_posv(
+            uplo2char(uplo), n, nrhs, &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_posv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_solve_mixed_fp16( Params& params, bool run )
+{
+    test_solve_mixed_half_work< lapack::float16 >( params, run );
+}
+
+// -----------------------------------------------------------------------------
+void test_solve_mixed_bf16( Params& params, bool run )
+{
+    test_solve_mixed_half_work< lapack::bfloat16 >( params, run );
+}
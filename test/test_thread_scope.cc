@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/thread_scope.hh"
+
+#include <stdexcept>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Checks that ThreadScope sets the OpenMP thread count while in scope,
+// and restores it on exit, on exception, and after nested scopes;
+// and that threads <= 0 leaves it unchanged.
+// Uses --threads, or 2 if it is the default 0.
+void test_thread_scope( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t threads = params.threads();
+    params.msg();
+
+    if (! run)
+        return;
+
+#ifdef _OPENMP
+    int nt = threads > 0 ? int( threads ) : 2;
+    int saved = omp_get_max_threads();
+    int errors = 0;
+
+    // Counts an error, with message, if omp_get_max_threads() != expect.
+    auto check = [&]( int expect, char const* where ) {
+        int actual = omp_get_max_threads();
+        if (actual != expect) {
+            errors += 1;
+            params.msg() += std::string( where ) + ": "
+                          + std::to_string( actual ) + " threads, expected "
+                          + std::to_string( expect ) + "; ";
+        }
+    };
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    {
+        lapack::ThreadScope scope( nt );
+        check( nt, "in scope" );
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+    check( saved, "after scope" );
+
+    // restored on exception
+    try {
+        lapack::ThreadScope scope( nt );
+        check( nt, "in scope with exception" );
+        throw std::runtime_error( "thread_scope test" );
+    }
+    catch (std::runtime_error const&) {
+        check( saved, "after exception" );
+    }
+
+    // nested scopes
+    {
+        lapack::ThreadScope outer( nt );
+        {
+            lapack::ThreadScope inner( nt + 1 );
+            check( nt + 1, "in inner scope" );
+        }
+        check( nt, "after inner scope" );
+    }
+    check( saved, "after outer scope" );
+
+    // threads <= 0 leaves settings unchanged, also with another setting
+    {
+        lapack::ThreadScope scope( 0 );
+        check( saved, "in scope( 0 )" );
+    }
+    check( saved, "after scope( 0 )" );
+    {
+        lapack::ThreadScope outer( nt );
+        lapack::ThreadScope scope( -1 );
+        check( nt, "in scope( -1 )" );
+    }
+    check( saved, "after scope( -1 )" );
+
+    params.okay() = (errors == 0);
+#else
+    params.msg() = "skipping: requires OpenMP";
+#endif
+}
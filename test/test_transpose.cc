@@ -0,0 +1,160 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests the out-of-place transpose (time, gbytes) and the in-place
+// transpose (time2, gbytes2): square with leading dimension lda if m == n,
+// else rectangular on contiguous storage, both with the kernels for --simd.
+// The reference is a simple loop.
+// Both read and write each entry once, so bandwidth counts 2 m n entries.
+template< typename scalar_t >
+void test_transpose_work( Params& params, bool run )
+{
+    using blas::conj;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    lapack::Simd simd = params.simd();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.gbytes();
+    params.time2();
+    params.gbytes2();
+    params.ref_time();
+    params.ref_gbytes();
+
+    if (! run)
+        return;
+
+    if (trans == lapack::Op::NoTrans) {
+        params.msg() = "skipping: trans must be t or c";
+        return;
+    }
+    bool conj_ = (trans == lapack::Op::ConjTrans);
+
+    if (! lapack::simd_supported( simd )) {
+        params.msg() = std::string( "skipping: " ) + lapack::simd2str( simd )
+                     + " not supported";
+        return;
+    }
+    SimdScope simd_scope( simd );
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    // in-place: lda if square, else contiguous
+    int64_t ldc = (m == n ? lda : blas::max( 1, m ));
+    int64_t ldc_out = (m == n ? lda : blas::max( 1, n ));
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * m;
+    size_t size_C = (size_t) ldc * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > C( size_C );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    lapack::lacpy( lapack::MatrixType::General, m, n, &A[0], lda, &C[0], ldc );
+
+    double gbyte = 2. * m * n * sizeof( scalar_t ) * 1e-9;
+
+    // ---------- run test, out-of-place
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    if (conj_)
+        lapack::conj_transpose( m, n, &A[0], lda, &B_tst[0], ldb );
+    else
+        lapack::transpose( m, n, &A[0], lda, &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    params.gbytes() = gbyte / time;
+
+    // ---------- run test, in-place
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    if (m == n) {
+        if (conj_)
+            lapack::conj_transpose( n, &C[0], ldc );
+        else
+            lapack::transpose( n, &C[0], ldc );
+    }
+    else {
+        if (conj_)
+            lapack::conj_transpose( m, n, &C[0] );
+        else
+            lapack::transpose( m, n, &C[0] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gbytes2() = gbyte / time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < m; ++i) {
+                B_ref[ j + i*ldb ] = conj_ ? conj( A[ i + j*lda ] )
+                                           : A[ i + j*lda ];
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gbytes() = gbyte / time;
+
+        // ---------- check error compared to reference
+        // Data movement is exact, so count entries that differ.
+        int64_t error = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            for (int64_t j = 0; j < n; ++j) {
+                error += (B_tst[ j + i*ldb ] != B_ref[ j + i*ldb ]);
+                error += (C[ j + i*ldc_out ] != B_ref[ j + i*ldb ]);
+            }
+        }
+        params.error() = error;
+        params.okay() = (error == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_transpose( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_transpose_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_transpose_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_transpose_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_transpose_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}